@@ -0,0 +1,4753 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: LogMetrics.proto
+
+#include "LogMetrics.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_InMemoryMetrics::LogMetrics_CleanerMetrics_InMemoryMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.total_entries_scanned_)*/{}
+  , /*decltype(_impl_.total_live_entries_scanned_)*/{}
+  , /*decltype(_impl_.total_scanned_entry_lengths_)*/{}
+  , /*decltype(_impl_.total_live_scanned_entry_lengths_)*/{}
+  , /*decltype(_impl_.total_relocation_callbacks_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_relocation_appends_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_bytes_freed_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_bytes_in_compacted_segments_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_bytes_appended_to_survivors_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_segments_compacted_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.get_segment_to_compact_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.wait_for_free_survivor_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.relocation_callback_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.relocation_append_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.compaction_complete_ticks_)*/uint64_t{0u}} {}
+struct LogMetrics_CleanerMetrics_InMemoryMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_InMemoryMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMetrics_CleanerMetrics_InMemoryMetricsDefaultTypeInternal() {}
+  union {
+    LogMetrics_CleanerMetrics_InMemoryMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMetrics_CleanerMetrics_InMemoryMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_InMemoryMetrics_default_instance_;
+PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_OnDiskMetrics::LogMetrics_CleanerMetrics_OnDiskMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.total_entries_scanned_)*/{}
+  , /*decltype(_impl_.total_live_entries_scanned_)*/{}
+  , /*decltype(_impl_.total_scanned_entry_lengths_)*/{}
+  , /*decltype(_impl_.total_live_scanned_entry_lengths_)*/{}
+  , /*decltype(_impl_.cleaned_segment_memory_histogram_)*/nullptr
+  , /*decltype(_impl_.cleaned_segment_disk_histogram_)*/nullptr
+  , /*decltype(_impl_.all_segments_disk_histogram_)*/nullptr
+  , /*decltype(_impl_.total_bytes_appended_to_survivors_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_memory_bytes_freed_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_disk_bytes_freed_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_memory_bytes_in_cleaned_segments_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_disk_bytes_in_cleaned_segments_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_relocation_callbacks_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_relocation_appends_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_segments_cleaned_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_empty_segments_cleaned_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_survivors_created_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_runs_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_low_disk_space_runs_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.get_segments_to_clean_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.cost_benefit_sort_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.get_sorted_entries_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.timestamp_sort_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.relocate_live_entries_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.wait_for_free_survivors_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.cleaning_complete_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.relocation_callback_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.relocation_append_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.close_survivor_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.survivor_sync_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_work_units_)*/uint64_t{0u}} {}
+struct LogMetrics_CleanerMetrics_OnDiskMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_OnDiskMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMetrics_CleanerMetrics_OnDiskMetricsDefaultTypeInternal() {}
+  union {
+    LogMetrics_CleanerMetrics_OnDiskMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMetrics_CleanerMetrics_OnDiskMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_OnDiskMetrics_default_instance_;
+PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_ThreadMetrics::LogMetrics_CleanerMetrics_ThreadMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.active_ticks_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogMetrics_CleanerMetrics_ThreadMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_ThreadMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMetrics_CleanerMetrics_ThreadMetricsDefaultTypeInternal() {}
+  union {
+    LogMetrics_CleanerMetrics_ThreadMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMetrics_CleanerMetrics_ThreadMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_ThreadMetrics_default_instance_;
+PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics::LogMetrics_CleanerMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.in_memory_metrics_)*/nullptr
+  , /*decltype(_impl_.on_disk_metrics_)*/nullptr
+  , /*decltype(_impl_.thread_metrics_)*/nullptr
+  , /*decltype(_impl_.poll_usec_)*/0u
+  , /*decltype(_impl_.max_cleanable_memory_utilization_)*/0u
+  , /*decltype(_impl_.live_segments_per_disk_pass_)*/0u
+  , /*decltype(_impl_.survivor_segments_to_reserve_)*/0u
+  , /*decltype(_impl_.min_memory_utilization_)*/0u
+  , /*decltype(_impl_.min_disk_utilization_)*/0u
+  , /*decltype(_impl_.do_work_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.do_work_sleep_ticks_)*/uint64_t{0u}} {}
+struct LogMetrics_CleanerMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMetrics_CleanerMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMetrics_CleanerMetricsDefaultTypeInternal() {}
+  union {
+    LogMetrics_CleanerMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMetrics_CleanerMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_default_instance_;
+PROTOBUF_CONSTEXPR LogMetrics_SegletMetrics::LogMetrics_SegletMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.total_seglets_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_usable_seglets_)*/uint64_t{0u}
+  , /*decltype(_impl_.emergency_head_pool_reserve_)*/uint64_t{0u}
+  , /*decltype(_impl_.emergency_head_pool_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.cleaner_pool_reserve_)*/uint64_t{0u}
+  , /*decltype(_impl_.cleaner_pool_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.default_pool_count_)*/uint64_t{0u}} {}
+struct LogMetrics_SegletMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMetrics_SegletMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMetrics_SegletMetricsDefaultTypeInternal() {}
+  union {
+    LogMetrics_SegletMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMetrics_SegletMetricsDefaultTypeInternal _LogMetrics_SegletMetrics_default_instance_;
+PROTOBUF_CONSTEXPR LogMetrics_SegmentMetrics::LogMetrics_SegmentMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.total_entry_counts_)*/{}
+  , /*decltype(_impl_.total_entry_lengths_)*/{}
+  , /*decltype(_impl_.segments_on_disk_histogram_)*/nullptr
+  , /*decltype(_impl_.current_segments_on_disk_)*/uint64_t{0u}} {}
+struct LogMetrics_SegmentMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMetrics_SegmentMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMetrics_SegmentMetricsDefaultTypeInternal() {}
+  union {
+    LogMetrics_SegmentMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMetrics_SegmentMetricsDefaultTypeInternal _LogMetrics_SegmentMetrics_default_instance_;
+PROTOBUF_CONSTEXPR LogMetrics::LogMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.cleaner_metrics_)*/nullptr
+  , /*decltype(_impl_.seglet_metrics_)*/nullptr
+  , /*decltype(_impl_.segment_metrics_)*/nullptr
+  , /*decltype(_impl_.ticks_per_second_)*/0
+  , /*decltype(_impl_.total_sync_calls_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_sync_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_append_calls_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_append_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_no_space_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_bytes_appended_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_metadata_bytes_appended_)*/uint64_t{0u}} {}
+struct LogMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMetricsDefaultTypeInternal() {}
+  union {
+    LogMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMetricsDefaultTypeInternal _LogMetrics_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_LogMetrics_2eproto[7];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_LogMetrics_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_LogMetrics_2eproto = nullptr;
+
+const uint32_t TableStruct_LogMetrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_relocation_callbacks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_relocation_appends_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_bytes_freed_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_bytes_in_compacted_segments_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_bytes_appended_to_survivors_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_segments_compacted_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_entries_scanned_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_live_entries_scanned_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_scanned_entry_lengths_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_live_scanned_entry_lengths_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.get_segment_to_compact_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.wait_for_free_survivor_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.relocation_callback_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.relocation_append_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.compaction_complete_ticks_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_bytes_appended_to_survivors_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_memory_bytes_freed_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_disk_bytes_freed_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_memory_bytes_in_cleaned_segments_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_disk_bytes_in_cleaned_segments_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_relocation_callbacks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_relocation_appends_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_segments_cleaned_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_empty_segments_cleaned_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_survivors_created_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_runs_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_low_disk_space_runs_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_entries_scanned_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_live_entries_scanned_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_scanned_entry_lengths_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_live_scanned_entry_lengths_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.get_segments_to_clean_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.cost_benefit_sort_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.get_sorted_entries_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.timestamp_sort_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.relocate_live_entries_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.wait_for_free_survivors_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.cleaning_complete_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.relocation_callback_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.relocation_append_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.close_survivor_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.survivor_sync_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.cleaned_segment_memory_histogram_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.cleaned_segment_disk_histogram_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.all_segments_disk_histogram_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_work_units_),
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  15,
+  16,
+  17,
+  18,
+  19,
+  20,
+  21,
+  22,
+  23,
+  24,
+  25,
+  26,
+  0,
+  1,
+  2,
+  27,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics, _impl_.active_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.poll_usec_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.max_cleanable_memory_utilization_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.live_segments_per_disk_pass_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.survivor_segments_to_reserve_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.min_memory_utilization_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.min_disk_utilization_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.do_work_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.do_work_sleep_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.in_memory_metrics_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.on_disk_metrics_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics, _impl_.thread_metrics_),
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_.total_seglets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_.total_usable_seglets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_.emergency_head_pool_reserve_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_.emergency_head_pool_count_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_.cleaner_pool_reserve_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_.cleaner_pool_count_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics, _impl_.default_pool_count_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics, _impl_.segments_on_disk_histogram_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics, _impl_.current_segments_on_disk_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics, _impl_.total_entry_counts_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics, _impl_.total_entry_lengths_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.ticks_per_second_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.total_sync_calls_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.total_sync_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.total_append_calls_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.total_append_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.total_no_space_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.total_bytes_appended_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.total_metadata_bytes_appended_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.cleaner_metrics_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.seglet_metrics_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::LogMetrics, _impl_.segment_metrics_),
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 22, -1, sizeof(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics)},
+  { 38, 76, -1, sizeof(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics)},
+  { 108, -1, -1, sizeof(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics)},
+  { 115, 132, -1, sizeof(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics)},
+  { 143, 156, -1, sizeof(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics)},
+  { 163, 173, -1, sizeof(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics)},
+  { 177, 194, -1, sizeof(::RAMCloud::ProtoBuf::LogMetrics)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_InMemoryMetrics_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_OnDiskMetrics_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_ThreadMetrics_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_LogMetrics_SegletMetrics_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_LogMetrics_SegmentMetrics_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_LogMetrics_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_LogMetrics_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020LogMetrics.proto\022\021RAMCloud.ProtoBuf\032\017H"
+  "istogram.proto\"\237\031\n\nLogMetrics\022\030\n\020ticks_p"
+  "er_second\030\001 \002(\001\022\030\n\020total_sync_calls\030\002 \002("
+  "\006\022\030\n\020total_sync_ticks\030\003 \002(\006\022\032\n\022total_app"
+  "end_calls\030\004 \002(\006\022\032\n\022total_append_ticks\030\005 "
+  "\002(\006\022\034\n\024total_no_space_ticks\030\006 \002(\006\022\034\n\024tot"
+  "al_bytes_appended\030\007 \002(\006\022%\n\035total_metadat"
+  "a_bytes_appended\030\010 \002(\006\022E\n\017cleaner_metric"
+  "s\030\t \002(\0132,.RAMCloud.ProtoBuf.LogMetrics.C"
+  "leanerMetrics\022C\n\016seglet_metrics\030\n \002(\0132+."
+  "RAMCloud.ProtoBuf.LogMetrics.SegletMetri"
+  "cs\022E\n\017segment_metrics\030\013 \002(\0132,.RAMCloud.P"
+  "rotoBuf.LogMetrics.SegmentMetrics\032\277\022\n\016Cl"
+  "eanerMetrics\022\021\n\tpoll_usec\030\001 \002(\007\022(\n max_c"
+  "leanable_memory_utilization\030\002 \002(\007\022#\n\033liv"
+  "e_segments_per_disk_pass\030\003 \002(\007\022$\n\034surviv"
+  "or_segments_to_reserve\030\004 \002(\007\022\036\n\026min_memo"
+  "ry_utilization\030\005 \002(\007\022\034\n\024min_disk_utiliza"
+  "tion\030\006 \002(\007\022\025\n\rdo_work_ticks\030\007 \002(\006\022\033\n\023do_"
+  "work_sleep_ticks\030\010 \002(\006\022W\n\021in_memory_metr"
+  "ics\030\t \002(\0132<.RAMCloud.ProtoBuf.LogMetrics"
+  ".CleanerMetrics.InMemoryMetrics\022S\n\017on_di"
+  "sk_metrics\030\n \002(\0132:.RAMCloud.ProtoBuf.Log"
+  "Metrics.CleanerMetrics.OnDiskMetrics\022R\n\016"
+  "thread_metrics\030\013 \002(\0132:.RAMCloud.ProtoBuf"
+  ".LogMetrics.CleanerMetrics.ThreadMetrics"
+  "\032\304\004\n\017InMemoryMetrics\022\"\n\032total_relocation"
+  "_callbacks\030\001 \002(\006\022 \n\030total_relocation_app"
+  "ends\030\002 \002(\006\022\031\n\021total_bytes_freed\030\003 \002(\006\022)\n"
+  "!total_bytes_in_compacted_segments\030\004 \002(\006"
+  "\022)\n!total_bytes_appended_to_survivors\030\005 "
+  "\002(\006\022 \n\030total_segments_compacted\030\006 \002(\006\022\035\n"
+  "\025total_entries_scanned\030\007 \003(\006\022\"\n\032total_li"
+  "ve_entries_scanned\030\010 \003(\006\022#\n\033total_scanne"
+  "d_entry_lengths\030\t \003(\006\022(\n total_live_scan"
+  "ned_entry_lengths\030\n \003(\006\022\023\n\013total_ticks\030\013"
+  " \002(\006\022$\n\034get_segment_to_compact_ticks\030\014 \002"
+  "(\006\022$\n\034wait_for_free_survivor_ticks\030\r \002(\006"
+  "\022!\n\031relocation_callback_ticks\030\016 \002(\006\022\037\n\027r"
+  "elocation_append_ticks\030\017 \002(\006\022!\n\031compacti"
+  "on_complete_ticks\030\020 \002(\006\032\302\t\n\rOnDiskMetric"
+  "s\022)\n!total_bytes_appended_to_survivors\030\001"
+  " \002(\006\022 \n\030total_memory_bytes_freed\030\002 \002(\006\022\036"
+  "\n\026total_disk_bytes_freed\030\003 \002(\006\022.\n&total_"
+  "memory_bytes_in_cleaned_segments\030\004 \002(\006\022,"
+  "\n$total_disk_bytes_in_cleaned_segments\030\005"
+  " \002(\006\022\"\n\032total_relocation_callbacks\030\006 \002(\006"
+  "\022 \n\030total_relocation_appends\030\007 \002(\006\022\036\n\026to"
+  "tal_segments_cleaned\030\010 \002(\006\022$\n\034total_empt"
+  "y_segments_cleaned\030\t \002(\006\022\037\n\027total_surviv"
+  "ors_created\030\n \002(\006\022\022\n\ntotal_runs\030\013 \002(\006\022!\n"
+  "\031total_low_disk_space_runs\030\014 \002(\006\022\035\n\025tota"
+  "l_entries_scanned\030\r \003(\006\022\"\n\032total_live_en"
+  "tries_scanned\030\016 \003(\006\022#\n\033total_scanned_ent"
+  "ry_lengths\030\017 \003(\006\022(\n total_live_scanned_e"
+  "ntry_lengths\030\020 \003(\006\022\023\n\013total_ticks\030\021 \002(\006\022"
+  "#\n\033get_segments_to_clean_ticks\030\022 \002(\006\022\037\n\027"
+  "cost_benefit_sort_ticks\030\023 \002(\006\022 \n\030get_sor"
+  "ted_entries_ticks\030\024 \002(\006\022\034\n\024timestamp_sor"
+  "t_ticks\030\025 \002(\006\022#\n\033relocate_live_entries_t"
+  "icks\030\026 \002(\006\022%\n\035wait_for_free_survivors_ti"
+  "cks\030\027 \002(\006\022\037\n\027cleaning_complete_ticks\030\030 \002"
+  "(\006\022!\n\031relocation_callback_ticks\030\031 \002(\006\022\037\n"
+  "\027relocation_append_ticks\030\032 \002(\006\022\034\n\024close_"
+  "survivor_ticks\030\033 \002(\006\022\033\n\023survivor_sync_ti"
+  "cks\030\034 \002(\006\022F\n cleaned_segment_memory_hist"
+  "ogram\030\035 \002(\0132\034.RAMCloud.ProtoBuf.Histogra"
+  "m\022D\n\036cleaned_segment_disk_histogram\030\036 \002("
+  "\0132\034.RAMCloud.ProtoBuf.Histogram\022A\n\033all_s"
+  "egments_disk_histogram\030\037 \002(\0132\034.RAMCloud."
+  "ProtoBuf.Histogram\022\030\n\020total_work_units\030 "
+  " \002(\006\032%\n\rThreadMetrics\022\024\n\014active_ticks\030\001 "
+  "\003(\006\032\342\001\n\rSegletMetrics\022\025\n\rtotal_seglets\030\001"
+  " \002(\006\022\034\n\024total_usable_seglets\030\002 \002(\006\022#\n\033em"
+  "ergency_head_pool_reserve\030\003 \002(\006\022!\n\031emerg"
+  "ency_head_pool_count\030\004 \002(\006\022\034\n\024cleaner_po"
+  "ol_reserve\030\005 \002(\006\022\032\n\022cleaner_pool_count\030\006"
+  " \002(\006\022\032\n\022default_pool_count\030\007 \002(\006\032\255\001\n\016Seg"
+  "mentMetrics\022@\n\032segments_on_disk_histogra"
+  "m\030\001 \002(\0132\034.RAMCloud.ProtoBuf.Histogram\022 \n"
+  "\030current_segments_on_disk\030\002 \002(\006\022\032\n\022total"
+  "_entry_counts\030\003 \003(\006\022\033\n\023total_entry_lengt"
+  "hs\030\004 \003(\006"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_LogMetrics_2eproto_deps[1] = {
+  &::descriptor_table_Histogram_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_LogMetrics_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_LogMetrics_2eproto = {
+    false, false, 3288, descriptor_table_protodef_LogMetrics_2eproto,
+    "LogMetrics.proto",
+    &descriptor_table_LogMetrics_2eproto_once, descriptor_table_LogMetrics_2eproto_deps, 1, 7,
+    schemas, file_default_instances, TableStruct_LogMetrics_2eproto::offsets,
+    file_level_metadata_LogMetrics_2eproto, file_level_enum_descriptors_LogMetrics_2eproto,
+    file_level_service_descriptors_LogMetrics_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_LogMetrics_2eproto_getter() {
+  return &descriptor_table_LogMetrics_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_LogMetrics_2eproto(&descriptor_table_LogMetrics_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class LogMetrics_CleanerMetrics_InMemoryMetrics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogMetrics_CleanerMetrics_InMemoryMetrics>()._impl_._has_bits_);
+  static void set_has_total_relocation_callbacks(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_total_relocation_appends(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_total_bytes_freed(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_total_bytes_in_compacted_segments(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_total_bytes_appended_to_survivors(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_total_segments_compacted(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_total_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_get_segment_to_compact_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_wait_for_free_survivor_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_relocation_callback_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_relocation_append_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_compaction_complete_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000fff) ^ 0x00000fff) != 0;
+  }
+};
+
+LogMetrics_CleanerMetrics_InMemoryMetrics::LogMetrics_CleanerMetrics_InMemoryMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+}
+LogMetrics_CleanerMetrics_InMemoryMetrics::LogMetrics_CleanerMetrics_InMemoryMetrics(const LogMetrics_CleanerMetrics_InMemoryMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMetrics_CleanerMetrics_InMemoryMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_entries_scanned_){from._impl_.total_entries_scanned_}
+    , decltype(_impl_.total_live_entries_scanned_){from._impl_.total_live_entries_scanned_}
+    , decltype(_impl_.total_scanned_entry_lengths_){from._impl_.total_scanned_entry_lengths_}
+    , decltype(_impl_.total_live_scanned_entry_lengths_){from._impl_.total_live_scanned_entry_lengths_}
+    , decltype(_impl_.total_relocation_callbacks_){}
+    , decltype(_impl_.total_relocation_appends_){}
+    , decltype(_impl_.total_bytes_freed_){}
+    , decltype(_impl_.total_bytes_in_compacted_segments_){}
+    , decltype(_impl_.total_bytes_appended_to_survivors_){}
+    , decltype(_impl_.total_segments_compacted_){}
+    , decltype(_impl_.total_ticks_){}
+    , decltype(_impl_.get_segment_to_compact_ticks_){}
+    , decltype(_impl_.wait_for_free_survivor_ticks_){}
+    , decltype(_impl_.relocation_callback_ticks_){}
+    , decltype(_impl_.relocation_append_ticks_){}
+    , decltype(_impl_.compaction_complete_ticks_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.total_relocation_callbacks_, &from._impl_.total_relocation_callbacks_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compaction_complete_ticks_) -
+    reinterpret_cast<char*>(&_impl_.total_relocation_callbacks_)) + sizeof(_impl_.compaction_complete_ticks_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+}
+
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_entries_scanned_){arena}
+    , decltype(_impl_.total_live_entries_scanned_){arena}
+    , decltype(_impl_.total_scanned_entry_lengths_){arena}
+    , decltype(_impl_.total_live_scanned_entry_lengths_){arena}
+    , decltype(_impl_.total_relocation_callbacks_){uint64_t{0u}}
+    , decltype(_impl_.total_relocation_appends_){uint64_t{0u}}
+    , decltype(_impl_.total_bytes_freed_){uint64_t{0u}}
+    , decltype(_impl_.total_bytes_in_compacted_segments_){uint64_t{0u}}
+    , decltype(_impl_.total_bytes_appended_to_survivors_){uint64_t{0u}}
+    , decltype(_impl_.total_segments_compacted_){uint64_t{0u}}
+    , decltype(_impl_.total_ticks_){uint64_t{0u}}
+    , decltype(_impl_.get_segment_to_compact_ticks_){uint64_t{0u}}
+    , decltype(_impl_.wait_for_free_survivor_ticks_){uint64_t{0u}}
+    , decltype(_impl_.relocation_callback_ticks_){uint64_t{0u}}
+    , decltype(_impl_.relocation_append_ticks_){uint64_t{0u}}
+    , decltype(_impl_.compaction_complete_ticks_){uint64_t{0u}}
+  };
+}
+
+LogMetrics_CleanerMetrics_InMemoryMetrics::~LogMetrics_CleanerMetrics_InMemoryMetrics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.total_entries_scanned_.~RepeatedField();
+  _impl_.total_live_entries_scanned_.~RepeatedField();
+  _impl_.total_scanned_entry_lengths_.~RepeatedField();
+  _impl_.total_live_scanned_entry_lengths_.~RepeatedField();
+}
+
+void LogMetrics_CleanerMetrics_InMemoryMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMetrics_CleanerMetrics_InMemoryMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.total_entries_scanned_.Clear();
+  _impl_.total_live_entries_scanned_.Clear();
+  _impl_.total_scanned_entry_lengths_.Clear();
+  _impl_.total_live_scanned_entry_lengths_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.total_relocation_callbacks_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.get_segment_to_compact_ticks_) -
+        reinterpret_cast<char*>(&_impl_.total_relocation_callbacks_)) + sizeof(_impl_.get_segment_to_compact_ticks_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.wait_for_free_survivor_ticks_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.compaction_complete_ticks_) -
+        reinterpret_cast<char*>(&_impl_.wait_for_free_survivor_ticks_)) + sizeof(_impl_.compaction_complete_ticks_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMetrics_CleanerMetrics_InMemoryMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 total_relocation_callbacks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_total_relocation_callbacks(&has_bits);
+          _impl_.total_relocation_callbacks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_relocation_appends = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_total_relocation_appends(&has_bits);
+          _impl_.total_relocation_appends_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_bytes_freed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_total_bytes_freed(&has_bits);
+          _impl_.total_bytes_freed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_bytes_in_compacted_segments = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_total_bytes_in_compacted_segments(&has_bits);
+          _impl_.total_bytes_in_compacted_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_bytes_appended_to_survivors = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_total_bytes_appended_to_survivors(&has_bits);
+          _impl_.total_bytes_appended_to_survivors_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_segments_compacted = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_total_segments_compacted(&has_bits);
+          _impl_.total_segments_compacted_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_entries_scanned = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_entries_scanned(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<57>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 58) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_entries_scanned(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_live_entries_scanned = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_live_entries_scanned(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<65>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 66) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_live_entries_scanned(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_scanned_entry_lengths = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_scanned_entry_lengths(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<73>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 74) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_scanned_entry_lengths(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_live_scanned_entry_lengths = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_live_scanned_entry_lengths(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<81>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 82) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_live_scanned_entry_lengths(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_ticks = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_total_ticks(&has_bits);
+          _impl_.total_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 get_segment_to_compact_ticks = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_get_segment_to_compact_ticks(&has_bits);
+          _impl_.get_segment_to_compact_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 wait_for_free_survivor_ticks = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_wait_for_free_survivor_ticks(&has_bits);
+          _impl_.wait_for_free_survivor_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 relocation_callback_ticks = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_relocation_callback_ticks(&has_bits);
+          _impl_.relocation_callback_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 relocation_append_ticks = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _Internal::set_has_relocation_append_ticks(&has_bits);
+          _impl_.relocation_append_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 compaction_complete_ticks = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _Internal::set_has_compaction_complete_ticks(&has_bits);
+          _impl_.compaction_complete_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMetrics_CleanerMetrics_InMemoryMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 total_relocation_callbacks = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_total_relocation_callbacks(), target);
+  }
+
+  // required fixed64 total_relocation_appends = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_total_relocation_appends(), target);
+  }
+
+  // required fixed64 total_bytes_freed = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_total_bytes_freed(), target);
+  }
+
+  // required fixed64 total_bytes_in_compacted_segments = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_total_bytes_in_compacted_segments(), target);
+  }
+
+  // required fixed64 total_bytes_appended_to_survivors = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_total_bytes_appended_to_survivors(), target);
+  }
+
+  // required fixed64 total_segments_compacted = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_total_segments_compacted(), target);
+  }
+
+  // repeated fixed64 total_entries_scanned = 7;
+  for (int i = 0, n = this->_internal_total_entries_scanned_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_total_entries_scanned(i), target);
+  }
+
+  // repeated fixed64 total_live_entries_scanned = 8;
+  for (int i = 0, n = this->_internal_total_live_entries_scanned_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(8, this->_internal_total_live_entries_scanned(i), target);
+  }
+
+  // repeated fixed64 total_scanned_entry_lengths = 9;
+  for (int i = 0, n = this->_internal_total_scanned_entry_lengths_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(9, this->_internal_total_scanned_entry_lengths(i), target);
+  }
+
+  // repeated fixed64 total_live_scanned_entry_lengths = 10;
+  for (int i = 0, n = this->_internal_total_live_scanned_entry_lengths_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(10, this->_internal_total_live_scanned_entry_lengths(i), target);
+  }
+
+  // required fixed64 total_ticks = 11;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(11, this->_internal_total_ticks(), target);
+  }
+
+  // required fixed64 get_segment_to_compact_ticks = 12;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(12, this->_internal_get_segment_to_compact_ticks(), target);
+  }
+
+  // required fixed64 wait_for_free_survivor_ticks = 13;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(13, this->_internal_wait_for_free_survivor_ticks(), target);
+  }
+
+  // required fixed64 relocation_callback_ticks = 14;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(14, this->_internal_relocation_callback_ticks(), target);
+  }
+
+  // required fixed64 relocation_append_ticks = 15;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(15, this->_internal_relocation_append_ticks(), target);
+  }
+
+  // required fixed64 compaction_complete_ticks = 16;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(16, this->_internal_compaction_complete_ticks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  return target;
+}
+
+size_t LogMetrics_CleanerMetrics_InMemoryMetrics::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  size_t total_size = 0;
+
+  if (_internal_has_total_relocation_callbacks()) {
+    // required fixed64 total_relocation_callbacks = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_relocation_appends()) {
+    // required fixed64 total_relocation_appends = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_bytes_freed()) {
+    // required fixed64 total_bytes_freed = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_bytes_in_compacted_segments()) {
+    // required fixed64 total_bytes_in_compacted_segments = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_bytes_appended_to_survivors()) {
+    // required fixed64 total_bytes_appended_to_survivors = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_segments_compacted()) {
+    // required fixed64 total_segments_compacted = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_ticks()) {
+    // required fixed64 total_ticks = 11;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_get_segment_to_compact_ticks()) {
+    // required fixed64 get_segment_to_compact_ticks = 12;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_wait_for_free_survivor_ticks()) {
+    // required fixed64 wait_for_free_survivor_ticks = 13;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_relocation_callback_ticks()) {
+    // required fixed64 relocation_callback_ticks = 14;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_relocation_append_ticks()) {
+    // required fixed64 relocation_append_ticks = 15;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_compaction_complete_ticks()) {
+    // required fixed64 compaction_complete_ticks = 16;
+    total_size += 2 + 8;
+  }
+
+  return total_size;
+}
+size_t LogMetrics_CleanerMetrics_InMemoryMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000fff) ^ 0x00000fff) == 0) {  // All required fields are present.
+    // required fixed64 total_relocation_callbacks = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 total_relocation_appends = 2;
+    total_size += 1 + 8;
+
+    // required fixed64 total_bytes_freed = 3;
+    total_size += 1 + 8;
+
+    // required fixed64 total_bytes_in_compacted_segments = 4;
+    total_size += 1 + 8;
+
+    // required fixed64 total_bytes_appended_to_survivors = 5;
+    total_size += 1 + 8;
+
+    // required fixed64 total_segments_compacted = 6;
+    total_size += 1 + 8;
+
+    // required fixed64 total_ticks = 11;
+    total_size += 1 + 8;
+
+    // required fixed64 get_segment_to_compact_ticks = 12;
+    total_size += 1 + 8;
+
+    // required fixed64 wait_for_free_survivor_ticks = 13;
+    total_size += 1 + 8;
+
+    // required fixed64 relocation_callback_ticks = 14;
+    total_size += 1 + 8;
+
+    // required fixed64 relocation_append_ticks = 15;
+    total_size += 1 + 8;
+
+    // required fixed64 compaction_complete_ticks = 16;
+    total_size += 2 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 total_entries_scanned = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_entries_scanned_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_entries_scanned_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 total_live_entries_scanned = 8;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_live_entries_scanned_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_live_entries_scanned_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 total_scanned_entry_lengths = 9;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_scanned_entry_lengths_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_scanned_entry_lengths_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 total_live_scanned_entry_lengths = 10;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_live_scanned_entry_lengths_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_live_scanned_entry_lengths_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMetrics_CleanerMetrics_InMemoryMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMetrics_CleanerMetrics_InMemoryMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMetrics_CleanerMetrics_InMemoryMetrics::GetClassData() const { return &_class_data_; }
+
+
+void LogMetrics_CleanerMetrics_InMemoryMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMetrics_CleanerMetrics_InMemoryMetrics*>(&to_msg);
+  auto& from = static_cast<const LogMetrics_CleanerMetrics_InMemoryMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.total_entries_scanned_.MergeFrom(from._impl_.total_entries_scanned_);
+  _this->_impl_.total_live_entries_scanned_.MergeFrom(from._impl_.total_live_entries_scanned_);
+  _this->_impl_.total_scanned_entry_lengths_.MergeFrom(from._impl_.total_scanned_entry_lengths_);
+  _this->_impl_.total_live_scanned_entry_lengths_.MergeFrom(from._impl_.total_live_scanned_entry_lengths_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.total_relocation_callbacks_ = from._impl_.total_relocation_callbacks_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.total_relocation_appends_ = from._impl_.total_relocation_appends_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.total_bytes_freed_ = from._impl_.total_bytes_freed_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.total_bytes_in_compacted_segments_ = from._impl_.total_bytes_in_compacted_segments_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.total_bytes_appended_to_survivors_ = from._impl_.total_bytes_appended_to_survivors_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.total_segments_compacted_ = from._impl_.total_segments_compacted_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.total_ticks_ = from._impl_.total_ticks_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.get_segment_to_compact_ticks_ = from._impl_.get_segment_to_compact_ticks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.wait_for_free_survivor_ticks_ = from._impl_.wait_for_free_survivor_ticks_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.relocation_callback_ticks_ = from._impl_.relocation_callback_ticks_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.relocation_append_ticks_ = from._impl_.relocation_append_ticks_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.compaction_complete_ticks_ = from._impl_.compaction_complete_ticks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMetrics_CleanerMetrics_InMemoryMetrics::CopyFrom(const LogMetrics_CleanerMetrics_InMemoryMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMetrics_CleanerMetrics_InMemoryMetrics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void LogMetrics_CleanerMetrics_InMemoryMetrics::InternalSwap(LogMetrics_CleanerMetrics_InMemoryMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.total_entries_scanned_.InternalSwap(&other->_impl_.total_entries_scanned_);
+  _impl_.total_live_entries_scanned_.InternalSwap(&other->_impl_.total_live_entries_scanned_);
+  _impl_.total_scanned_entry_lengths_.InternalSwap(&other->_impl_.total_scanned_entry_lengths_);
+  _impl_.total_live_scanned_entry_lengths_.InternalSwap(&other->_impl_.total_live_scanned_entry_lengths_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.compaction_complete_ticks_)
+      + sizeof(LogMetrics_CleanerMetrics_InMemoryMetrics::_impl_.compaction_complete_ticks_)
+      - PROTOBUF_FIELD_OFFSET(LogMetrics_CleanerMetrics_InMemoryMetrics, _impl_.total_relocation_callbacks_)>(
+          reinterpret_cast<char*>(&_impl_.total_relocation_callbacks_),
+          reinterpret_cast<char*>(&other->_impl_.total_relocation_callbacks_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMetrics_CleanerMetrics_InMemoryMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMetrics_2eproto_getter, &descriptor_table_LogMetrics_2eproto_once,
+      file_level_metadata_LogMetrics_2eproto[0]);
+}
+
+// ===================================================================
+
+class LogMetrics_CleanerMetrics_OnDiskMetrics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogMetrics_CleanerMetrics_OnDiskMetrics>()._impl_._has_bits_);
+  static void set_has_total_bytes_appended_to_survivors(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_total_memory_bytes_freed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_total_disk_bytes_freed(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_total_memory_bytes_in_cleaned_segments(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_total_disk_bytes_in_cleaned_segments(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_total_relocation_callbacks(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_total_relocation_appends(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_total_segments_cleaned(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_total_empty_segments_cleaned(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_total_survivors_created(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_total_runs(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_total_low_disk_space_runs(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_total_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_get_segments_to_clean_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_cost_benefit_sort_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_get_sorted_entries_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_timestamp_sort_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_relocate_live_entries_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_wait_for_free_survivors_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_cleaning_complete_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static void set_has_relocation_callback_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static void set_has_relocation_append_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 16777216u;
+  }
+  static void set_has_close_survivor_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 33554432u;
+  }
+  static void set_has_survivor_sync_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 67108864u;
+  }
+  static const ::RAMCloud::ProtoBuf::Histogram& cleaned_segment_memory_histogram(const LogMetrics_CleanerMetrics_OnDiskMetrics* msg);
+  static void set_has_cleaned_segment_memory_histogram(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::RAMCloud::ProtoBuf::Histogram& cleaned_segment_disk_histogram(const LogMetrics_CleanerMetrics_OnDiskMetrics* msg);
+  static void set_has_cleaned_segment_disk_histogram(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::RAMCloud::ProtoBuf::Histogram& all_segments_disk_histogram(const LogMetrics_CleanerMetrics_OnDiskMetrics* msg);
+  static void set_has_all_segments_disk_histogram(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_total_work_units(HasBits* has_bits) {
+    (*has_bits)[0] |= 134217728u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0fffffff) ^ 0x0fffffff) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::Histogram&
+LogMetrics_CleanerMetrics_OnDiskMetrics::_Internal::cleaned_segment_memory_histogram(const LogMetrics_CleanerMetrics_OnDiskMetrics* msg) {
+  return *msg->_impl_.cleaned_segment_memory_histogram_;
+}
+const ::RAMCloud::ProtoBuf::Histogram&
+LogMetrics_CleanerMetrics_OnDiskMetrics::_Internal::cleaned_segment_disk_histogram(const LogMetrics_CleanerMetrics_OnDiskMetrics* msg) {
+  return *msg->_impl_.cleaned_segment_disk_histogram_;
+}
+const ::RAMCloud::ProtoBuf::Histogram&
+LogMetrics_CleanerMetrics_OnDiskMetrics::_Internal::all_segments_disk_histogram(const LogMetrics_CleanerMetrics_OnDiskMetrics* msg) {
+  return *msg->_impl_.all_segments_disk_histogram_;
+}
+void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_cleaned_segment_memory_histogram() {
+  if (_impl_.cleaned_segment_memory_histogram_ != nullptr) _impl_.cleaned_segment_memory_histogram_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_cleaned_segment_disk_histogram() {
+  if (_impl_.cleaned_segment_disk_histogram_ != nullptr) _impl_.cleaned_segment_disk_histogram_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_all_segments_disk_histogram() {
+  if (_impl_.all_segments_disk_histogram_ != nullptr) _impl_.all_segments_disk_histogram_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+LogMetrics_CleanerMetrics_OnDiskMetrics::LogMetrics_CleanerMetrics_OnDiskMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+}
+LogMetrics_CleanerMetrics_OnDiskMetrics::LogMetrics_CleanerMetrics_OnDiskMetrics(const LogMetrics_CleanerMetrics_OnDiskMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMetrics_CleanerMetrics_OnDiskMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_entries_scanned_){from._impl_.total_entries_scanned_}
+    , decltype(_impl_.total_live_entries_scanned_){from._impl_.total_live_entries_scanned_}
+    , decltype(_impl_.total_scanned_entry_lengths_){from._impl_.total_scanned_entry_lengths_}
+    , decltype(_impl_.total_live_scanned_entry_lengths_){from._impl_.total_live_scanned_entry_lengths_}
+    , decltype(_impl_.cleaned_segment_memory_histogram_){nullptr}
+    , decltype(_impl_.cleaned_segment_disk_histogram_){nullptr}
+    , decltype(_impl_.all_segments_disk_histogram_){nullptr}
+    , decltype(_impl_.total_bytes_appended_to_survivors_){}
+    , decltype(_impl_.total_memory_bytes_freed_){}
+    , decltype(_impl_.total_disk_bytes_freed_){}
+    , decltype(_impl_.total_memory_bytes_in_cleaned_segments_){}
+    , decltype(_impl_.total_disk_bytes_in_cleaned_segments_){}
+    , decltype(_impl_.total_relocation_callbacks_){}
+    , decltype(_impl_.total_relocation_appends_){}
+    , decltype(_impl_.total_segments_cleaned_){}
+    , decltype(_impl_.total_empty_segments_cleaned_){}
+    , decltype(_impl_.total_survivors_created_){}
+    , decltype(_impl_.total_runs_){}
+    , decltype(_impl_.total_low_disk_space_runs_){}
+    , decltype(_impl_.total_ticks_){}
+    , decltype(_impl_.get_segments_to_clean_ticks_){}
+    , decltype(_impl_.cost_benefit_sort_ticks_){}
+    , decltype(_impl_.get_sorted_entries_ticks_){}
+    , decltype(_impl_.timestamp_sort_ticks_){}
+    , decltype(_impl_.relocate_live_entries_ticks_){}
+    , decltype(_impl_.wait_for_free_survivors_ticks_){}
+    , decltype(_impl_.cleaning_complete_ticks_){}
+    , decltype(_impl_.relocation_callback_ticks_){}
+    , decltype(_impl_.relocation_append_ticks_){}
+    , decltype(_impl_.close_survivor_ticks_){}
+    , decltype(_impl_.survivor_sync_ticks_){}
+    , decltype(_impl_.total_work_units_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_cleaned_segment_memory_histogram()) {
+    _this->_impl_.cleaned_segment_memory_histogram_ = new ::RAMCloud::ProtoBuf::Histogram(*from._impl_.cleaned_segment_memory_histogram_);
+  }
+  if (from._internal_has_cleaned_segment_disk_histogram()) {
+    _this->_impl_.cleaned_segment_disk_histogram_ = new ::RAMCloud::ProtoBuf::Histogram(*from._impl_.cleaned_segment_disk_histogram_);
+  }
+  if (from._internal_has_all_segments_disk_histogram()) {
+    _this->_impl_.all_segments_disk_histogram_ = new ::RAMCloud::ProtoBuf::Histogram(*from._impl_.all_segments_disk_histogram_);
+  }
+  ::memcpy(&_impl_.total_bytes_appended_to_survivors_, &from._impl_.total_bytes_appended_to_survivors_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_work_units_) -
+    reinterpret_cast<char*>(&_impl_.total_bytes_appended_to_survivors_)) + sizeof(_impl_.total_work_units_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+}
+
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_entries_scanned_){arena}
+    , decltype(_impl_.total_live_entries_scanned_){arena}
+    , decltype(_impl_.total_scanned_entry_lengths_){arena}
+    , decltype(_impl_.total_live_scanned_entry_lengths_){arena}
+    , decltype(_impl_.cleaned_segment_memory_histogram_){nullptr}
+    , decltype(_impl_.cleaned_segment_disk_histogram_){nullptr}
+    , decltype(_impl_.all_segments_disk_histogram_){nullptr}
+    , decltype(_impl_.total_bytes_appended_to_survivors_){uint64_t{0u}}
+    , decltype(_impl_.total_memory_bytes_freed_){uint64_t{0u}}
+    , decltype(_impl_.total_disk_bytes_freed_){uint64_t{0u}}
+    , decltype(_impl_.total_memory_bytes_in_cleaned_segments_){uint64_t{0u}}
+    , decltype(_impl_.total_disk_bytes_in_cleaned_segments_){uint64_t{0u}}
+    , decltype(_impl_.total_relocation_callbacks_){uint64_t{0u}}
+    , decltype(_impl_.total_relocation_appends_){uint64_t{0u}}
+    , decltype(_impl_.total_segments_cleaned_){uint64_t{0u}}
+    , decltype(_impl_.total_empty_segments_cleaned_){uint64_t{0u}}
+    , decltype(_impl_.total_survivors_created_){uint64_t{0u}}
+    , decltype(_impl_.total_runs_){uint64_t{0u}}
+    , decltype(_impl_.total_low_disk_space_runs_){uint64_t{0u}}
+    , decltype(_impl_.total_ticks_){uint64_t{0u}}
+    , decltype(_impl_.get_segments_to_clean_ticks_){uint64_t{0u}}
+    , decltype(_impl_.cost_benefit_sort_ticks_){uint64_t{0u}}
+    , decltype(_impl_.get_sorted_entries_ticks_){uint64_t{0u}}
+    , decltype(_impl_.timestamp_sort_ticks_){uint64_t{0u}}
+    , decltype(_impl_.relocate_live_entries_ticks_){uint64_t{0u}}
+    , decltype(_impl_.wait_for_free_survivors_ticks_){uint64_t{0u}}
+    , decltype(_impl_.cleaning_complete_ticks_){uint64_t{0u}}
+    , decltype(_impl_.relocation_callback_ticks_){uint64_t{0u}}
+    , decltype(_impl_.relocation_append_ticks_){uint64_t{0u}}
+    , decltype(_impl_.close_survivor_ticks_){uint64_t{0u}}
+    , decltype(_impl_.survivor_sync_ticks_){uint64_t{0u}}
+    , decltype(_impl_.total_work_units_){uint64_t{0u}}
+  };
+}
+
+LogMetrics_CleanerMetrics_OnDiskMetrics::~LogMetrics_CleanerMetrics_OnDiskMetrics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.total_entries_scanned_.~RepeatedField();
+  _impl_.total_live_entries_scanned_.~RepeatedField();
+  _impl_.total_scanned_entry_lengths_.~RepeatedField();
+  _impl_.total_live_scanned_entry_lengths_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.cleaned_segment_memory_histogram_;
+  if (this != internal_default_instance()) delete _impl_.cleaned_segment_disk_histogram_;
+  if (this != internal_default_instance()) delete _impl_.all_segments_disk_histogram_;
+}
+
+void LogMetrics_CleanerMetrics_OnDiskMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMetrics_CleanerMetrics_OnDiskMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.total_entries_scanned_.Clear();
+  _impl_.total_live_entries_scanned_.Clear();
+  _impl_.total_scanned_entry_lengths_.Clear();
+  _impl_.total_live_scanned_entry_lengths_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.cleaned_segment_memory_histogram_ != nullptr);
+      _impl_.cleaned_segment_memory_histogram_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.cleaned_segment_disk_histogram_ != nullptr);
+      _impl_.cleaned_segment_disk_histogram_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.all_segments_disk_histogram_ != nullptr);
+      _impl_.all_segments_disk_histogram_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.total_bytes_appended_to_survivors_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.total_disk_bytes_in_cleaned_segments_) -
+        reinterpret_cast<char*>(&_impl_.total_bytes_appended_to_survivors_)) + sizeof(_impl_.total_disk_bytes_in_cleaned_segments_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.total_relocation_callbacks_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.total_ticks_) -
+        reinterpret_cast<char*>(&_impl_.total_relocation_callbacks_)) + sizeof(_impl_.total_ticks_));
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    ::memset(&_impl_.get_segments_to_clean_ticks_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.relocation_callback_ticks_) -
+        reinterpret_cast<char*>(&_impl_.get_segments_to_clean_ticks_)) + sizeof(_impl_.relocation_callback_ticks_));
+  }
+  if (cached_has_bits & 0x0f000000u) {
+    ::memset(&_impl_.relocation_append_ticks_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.total_work_units_) -
+        reinterpret_cast<char*>(&_impl_.relocation_append_ticks_)) + sizeof(_impl_.total_work_units_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMetrics_CleanerMetrics_OnDiskMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 total_bytes_appended_to_survivors = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_total_bytes_appended_to_survivors(&has_bits);
+          _impl_.total_bytes_appended_to_survivors_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_memory_bytes_freed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_total_memory_bytes_freed(&has_bits);
+          _impl_.total_memory_bytes_freed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_disk_bytes_freed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_total_disk_bytes_freed(&has_bits);
+          _impl_.total_disk_bytes_freed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_memory_bytes_in_cleaned_segments = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_total_memory_bytes_in_cleaned_segments(&has_bits);
+          _impl_.total_memory_bytes_in_cleaned_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_disk_bytes_in_cleaned_segments = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_total_disk_bytes_in_cleaned_segments(&has_bits);
+          _impl_.total_disk_bytes_in_cleaned_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_relocation_callbacks = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_total_relocation_callbacks(&has_bits);
+          _impl_.total_relocation_callbacks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_relocation_appends = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_total_relocation_appends(&has_bits);
+          _impl_.total_relocation_appends_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_segments_cleaned = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_total_segments_cleaned(&has_bits);
+          _impl_.total_segments_cleaned_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_empty_segments_cleaned = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_total_empty_segments_cleaned(&has_bits);
+          _impl_.total_empty_segments_cleaned_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_survivors_created = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_total_survivors_created(&has_bits);
+          _impl_.total_survivors_created_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_runs = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_total_runs(&has_bits);
+          _impl_.total_runs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_low_disk_space_runs = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_total_low_disk_space_runs(&has_bits);
+          _impl_.total_low_disk_space_runs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_entries_scanned = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_entries_scanned(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<105>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 106) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_entries_scanned(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_live_entries_scanned = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_live_entries_scanned(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<113>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 114) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_live_entries_scanned(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_scanned_entry_lengths = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_scanned_entry_lengths(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<121>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 122) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_scanned_entry_lengths(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_live_scanned_entry_lengths = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_total_live_scanned_entry_lengths(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<129>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 130) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_live_scanned_entry_lengths(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_ticks = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 137)) {
+          _Internal::set_has_total_ticks(&has_bits);
+          _impl_.total_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 get_segments_to_clean_ticks = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 145)) {
+          _Internal::set_has_get_segments_to_clean_ticks(&has_bits);
+          _impl_.get_segments_to_clean_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 cost_benefit_sort_ticks = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 153)) {
+          _Internal::set_has_cost_benefit_sort_ticks(&has_bits);
+          _impl_.cost_benefit_sort_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 get_sorted_entries_ticks = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 161)) {
+          _Internal::set_has_get_sorted_entries_ticks(&has_bits);
+          _impl_.get_sorted_entries_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 timestamp_sort_ticks = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 169)) {
+          _Internal::set_has_timestamp_sort_ticks(&has_bits);
+          _impl_.timestamp_sort_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 relocate_live_entries_ticks = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 177)) {
+          _Internal::set_has_relocate_live_entries_ticks(&has_bits);
+          _impl_.relocate_live_entries_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 wait_for_free_survivors_ticks = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 185)) {
+          _Internal::set_has_wait_for_free_survivors_ticks(&has_bits);
+          _impl_.wait_for_free_survivors_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 cleaning_complete_ticks = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 193)) {
+          _Internal::set_has_cleaning_complete_ticks(&has_bits);
+          _impl_.cleaning_complete_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 relocation_callback_ticks = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 201)) {
+          _Internal::set_has_relocation_callback_ticks(&has_bits);
+          _impl_.relocation_callback_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 relocation_append_ticks = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 209)) {
+          _Internal::set_has_relocation_append_ticks(&has_bits);
+          _impl_.relocation_append_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 close_survivor_ticks = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 217)) {
+          _Internal::set_has_close_survivor_ticks(&has_bits);
+          _impl_.close_survivor_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 survivor_sync_ticks = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 225)) {
+          _Internal::set_has_survivor_sync_ticks(&has_bits);
+          _impl_.survivor_sync_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_memory_histogram = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 234)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cleaned_segment_memory_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_disk_histogram = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cleaned_segment_disk_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.Histogram all_segments_disk_histogram = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 250)) {
+          ptr = ctx->ParseMessage(_internal_mutable_all_segments_disk_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_work_units = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 1)) {
+          _Internal::set_has_total_work_units(&has_bits);
+          _impl_.total_work_units_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMetrics_CleanerMetrics_OnDiskMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 total_bytes_appended_to_survivors = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_total_bytes_appended_to_survivors(), target);
+  }
+
+  // required fixed64 total_memory_bytes_freed = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_total_memory_bytes_freed(), target);
+  }
+
+  // required fixed64 total_disk_bytes_freed = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_total_disk_bytes_freed(), target);
+  }
+
+  // required fixed64 total_memory_bytes_in_cleaned_segments = 4;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_total_memory_bytes_in_cleaned_segments(), target);
+  }
+
+  // required fixed64 total_disk_bytes_in_cleaned_segments = 5;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_total_disk_bytes_in_cleaned_segments(), target);
+  }
+
+  // required fixed64 total_relocation_callbacks = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_total_relocation_callbacks(), target);
+  }
+
+  // required fixed64 total_relocation_appends = 7;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_total_relocation_appends(), target);
+  }
+
+  // required fixed64 total_segments_cleaned = 8;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(8, this->_internal_total_segments_cleaned(), target);
+  }
+
+  // required fixed64 total_empty_segments_cleaned = 9;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(9, this->_internal_total_empty_segments_cleaned(), target);
+  }
+
+  // required fixed64 total_survivors_created = 10;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(10, this->_internal_total_survivors_created(), target);
+  }
+
+  // required fixed64 total_runs = 11;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(11, this->_internal_total_runs(), target);
+  }
+
+  // required fixed64 total_low_disk_space_runs = 12;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(12, this->_internal_total_low_disk_space_runs(), target);
+  }
+
+  // repeated fixed64 total_entries_scanned = 13;
+  for (int i = 0, n = this->_internal_total_entries_scanned_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(13, this->_internal_total_entries_scanned(i), target);
+  }
+
+  // repeated fixed64 total_live_entries_scanned = 14;
+  for (int i = 0, n = this->_internal_total_live_entries_scanned_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(14, this->_internal_total_live_entries_scanned(i), target);
+  }
+
+  // repeated fixed64 total_scanned_entry_lengths = 15;
+  for (int i = 0, n = this->_internal_total_scanned_entry_lengths_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(15, this->_internal_total_scanned_entry_lengths(i), target);
+  }
+
+  // repeated fixed64 total_live_scanned_entry_lengths = 16;
+  for (int i = 0, n = this->_internal_total_live_scanned_entry_lengths_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(16, this->_internal_total_live_scanned_entry_lengths(i), target);
+  }
+
+  // required fixed64 total_ticks = 17;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(17, this->_internal_total_ticks(), target);
+  }
+
+  // required fixed64 get_segments_to_clean_ticks = 18;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(18, this->_internal_get_segments_to_clean_ticks(), target);
+  }
+
+  // required fixed64 cost_benefit_sort_ticks = 19;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(19, this->_internal_cost_benefit_sort_ticks(), target);
+  }
+
+  // required fixed64 get_sorted_entries_ticks = 20;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(20, this->_internal_get_sorted_entries_ticks(), target);
+  }
+
+  // required fixed64 timestamp_sort_ticks = 21;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(21, this->_internal_timestamp_sort_ticks(), target);
+  }
+
+  // required fixed64 relocate_live_entries_ticks = 22;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(22, this->_internal_relocate_live_entries_ticks(), target);
+  }
+
+  // required fixed64 wait_for_free_survivors_ticks = 23;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(23, this->_internal_wait_for_free_survivors_ticks(), target);
+  }
+
+  // required fixed64 cleaning_complete_ticks = 24;
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(24, this->_internal_cleaning_complete_ticks(), target);
+  }
+
+  // required fixed64 relocation_callback_ticks = 25;
+  if (cached_has_bits & 0x00800000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(25, this->_internal_relocation_callback_ticks(), target);
+  }
+
+  // required fixed64 relocation_append_ticks = 26;
+  if (cached_has_bits & 0x01000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(26, this->_internal_relocation_append_ticks(), target);
+  }
+
+  // required fixed64 close_survivor_ticks = 27;
+  if (cached_has_bits & 0x02000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(27, this->_internal_close_survivor_ticks(), target);
+  }
+
+  // required fixed64 survivor_sync_ticks = 28;
+  if (cached_has_bits & 0x04000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(28, this->_internal_survivor_sync_ticks(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_memory_histogram = 29;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(29, _Internal::cleaned_segment_memory_histogram(this),
+        _Internal::cleaned_segment_memory_histogram(this).GetCachedSize(), target, stream);
+  }
+
+  // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_disk_histogram = 30;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(30, _Internal::cleaned_segment_disk_histogram(this),
+        _Internal::cleaned_segment_disk_histogram(this).GetCachedSize(), target, stream);
+  }
+
+  // required .RAMCloud.ProtoBuf.Histogram all_segments_disk_histogram = 31;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(31, _Internal::all_segments_disk_histogram(this),
+        _Internal::all_segments_disk_histogram(this).GetCachedSize(), target, stream);
+  }
+
+  // required fixed64 total_work_units = 32;
+  if (cached_has_bits & 0x08000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(32, this->_internal_total_work_units(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  return target;
+}
+
+size_t LogMetrics_CleanerMetrics_OnDiskMetrics::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  size_t total_size = 0;
+
+  if (_internal_has_cleaned_segment_memory_histogram()) {
+    // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_memory_histogram = 29;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cleaned_segment_memory_histogram_);
+  }
+
+  if (_internal_has_cleaned_segment_disk_histogram()) {
+    // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_disk_histogram = 30;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cleaned_segment_disk_histogram_);
+  }
+
+  if (_internal_has_all_segments_disk_histogram()) {
+    // required .RAMCloud.ProtoBuf.Histogram all_segments_disk_histogram = 31;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.all_segments_disk_histogram_);
+  }
+
+  if (_internal_has_total_bytes_appended_to_survivors()) {
+    // required fixed64 total_bytes_appended_to_survivors = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_memory_bytes_freed()) {
+    // required fixed64 total_memory_bytes_freed = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_disk_bytes_freed()) {
+    // required fixed64 total_disk_bytes_freed = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_memory_bytes_in_cleaned_segments()) {
+    // required fixed64 total_memory_bytes_in_cleaned_segments = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_disk_bytes_in_cleaned_segments()) {
+    // required fixed64 total_disk_bytes_in_cleaned_segments = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_relocation_callbacks()) {
+    // required fixed64 total_relocation_callbacks = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_relocation_appends()) {
+    // required fixed64 total_relocation_appends = 7;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_segments_cleaned()) {
+    // required fixed64 total_segments_cleaned = 8;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_empty_segments_cleaned()) {
+    // required fixed64 total_empty_segments_cleaned = 9;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_survivors_created()) {
+    // required fixed64 total_survivors_created = 10;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_runs()) {
+    // required fixed64 total_runs = 11;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_low_disk_space_runs()) {
+    // required fixed64 total_low_disk_space_runs = 12;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_ticks()) {
+    // required fixed64 total_ticks = 17;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_get_segments_to_clean_ticks()) {
+    // required fixed64 get_segments_to_clean_ticks = 18;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_cost_benefit_sort_ticks()) {
+    // required fixed64 cost_benefit_sort_ticks = 19;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_get_sorted_entries_ticks()) {
+    // required fixed64 get_sorted_entries_ticks = 20;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_timestamp_sort_ticks()) {
+    // required fixed64 timestamp_sort_ticks = 21;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_relocate_live_entries_ticks()) {
+    // required fixed64 relocate_live_entries_ticks = 22;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_wait_for_free_survivors_ticks()) {
+    // required fixed64 wait_for_free_survivors_ticks = 23;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_cleaning_complete_ticks()) {
+    // required fixed64 cleaning_complete_ticks = 24;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_relocation_callback_ticks()) {
+    // required fixed64 relocation_callback_ticks = 25;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_relocation_append_ticks()) {
+    // required fixed64 relocation_append_ticks = 26;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_close_survivor_ticks()) {
+    // required fixed64 close_survivor_ticks = 27;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_survivor_sync_ticks()) {
+    // required fixed64 survivor_sync_ticks = 28;
+    total_size += 2 + 8;
+  }
+
+  if (_internal_has_total_work_units()) {
+    // required fixed64 total_work_units = 32;
+    total_size += 2 + 8;
+  }
+
+  return total_size;
+}
+size_t LogMetrics_CleanerMetrics_OnDiskMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0fffffff) ^ 0x0fffffff) == 0) {  // All required fields are present.
+    // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_memory_histogram = 29;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cleaned_segment_memory_histogram_);
+
+    // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_disk_histogram = 30;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cleaned_segment_disk_histogram_);
+
+    // required .RAMCloud.ProtoBuf.Histogram all_segments_disk_histogram = 31;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.all_segments_disk_histogram_);
+
+    // required fixed64 total_bytes_appended_to_survivors = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 total_memory_bytes_freed = 2;
+    total_size += 1 + 8;
+
+    // required fixed64 total_disk_bytes_freed = 3;
+    total_size += 1 + 8;
+
+    // required fixed64 total_memory_bytes_in_cleaned_segments = 4;
+    total_size += 1 + 8;
+
+    // required fixed64 total_disk_bytes_in_cleaned_segments = 5;
+    total_size += 1 + 8;
+
+    // required fixed64 total_relocation_callbacks = 6;
+    total_size += 1 + 8;
+
+    // required fixed64 total_relocation_appends = 7;
+    total_size += 1 + 8;
+
+    // required fixed64 total_segments_cleaned = 8;
+    total_size += 1 + 8;
+
+    // required fixed64 total_empty_segments_cleaned = 9;
+    total_size += 1 + 8;
+
+    // required fixed64 total_survivors_created = 10;
+    total_size += 1 + 8;
+
+    // required fixed64 total_runs = 11;
+    total_size += 1 + 8;
+
+    // required fixed64 total_low_disk_space_runs = 12;
+    total_size += 1 + 8;
+
+    // required fixed64 total_ticks = 17;
+    total_size += 2 + 8;
+
+    // required fixed64 get_segments_to_clean_ticks = 18;
+    total_size += 2 + 8;
+
+    // required fixed64 cost_benefit_sort_ticks = 19;
+    total_size += 2 + 8;
+
+    // required fixed64 get_sorted_entries_ticks = 20;
+    total_size += 2 + 8;
+
+    // required fixed64 timestamp_sort_ticks = 21;
+    total_size += 2 + 8;
+
+    // required fixed64 relocate_live_entries_ticks = 22;
+    total_size += 2 + 8;
+
+    // required fixed64 wait_for_free_survivors_ticks = 23;
+    total_size += 2 + 8;
+
+    // required fixed64 cleaning_complete_ticks = 24;
+    total_size += 2 + 8;
+
+    // required fixed64 relocation_callback_ticks = 25;
+    total_size += 2 + 8;
+
+    // required fixed64 relocation_append_ticks = 26;
+    total_size += 2 + 8;
+
+    // required fixed64 close_survivor_ticks = 27;
+    total_size += 2 + 8;
+
+    // required fixed64 survivor_sync_ticks = 28;
+    total_size += 2 + 8;
+
+    // required fixed64 total_work_units = 32;
+    total_size += 2 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 total_entries_scanned = 13;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_entries_scanned_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_entries_scanned_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 total_live_entries_scanned = 14;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_live_entries_scanned_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_live_entries_scanned_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 total_scanned_entry_lengths = 15;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_scanned_entry_lengths_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_scanned_entry_lengths_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 total_live_scanned_entry_lengths = 16;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_live_scanned_entry_lengths_size());
+    size_t data_size = 8UL * count;
+    total_size += 2 *
+                  ::_pbi::FromIntSize(this->_internal_total_live_scanned_entry_lengths_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMetrics_CleanerMetrics_OnDiskMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMetrics_CleanerMetrics_OnDiskMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMetrics_CleanerMetrics_OnDiskMetrics::GetClassData() const { return &_class_data_; }
+
+
+void LogMetrics_CleanerMetrics_OnDiskMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMetrics_CleanerMetrics_OnDiskMetrics*>(&to_msg);
+  auto& from = static_cast<const LogMetrics_CleanerMetrics_OnDiskMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.total_entries_scanned_.MergeFrom(from._impl_.total_entries_scanned_);
+  _this->_impl_.total_live_entries_scanned_.MergeFrom(from._impl_.total_live_entries_scanned_);
+  _this->_impl_.total_scanned_entry_lengths_.MergeFrom(from._impl_.total_scanned_entry_lengths_);
+  _this->_impl_.total_live_scanned_entry_lengths_.MergeFrom(from._impl_.total_live_scanned_entry_lengths_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_cleaned_segment_memory_histogram()->::RAMCloud::ProtoBuf::Histogram::MergeFrom(
+          from._internal_cleaned_segment_memory_histogram());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_cleaned_segment_disk_histogram()->::RAMCloud::ProtoBuf::Histogram::MergeFrom(
+          from._internal_cleaned_segment_disk_histogram());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_all_segments_disk_histogram()->::RAMCloud::ProtoBuf::Histogram::MergeFrom(
+          from._internal_all_segments_disk_histogram());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.total_bytes_appended_to_survivors_ = from._impl_.total_bytes_appended_to_survivors_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.total_memory_bytes_freed_ = from._impl_.total_memory_bytes_freed_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.total_disk_bytes_freed_ = from._impl_.total_disk_bytes_freed_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.total_memory_bytes_in_cleaned_segments_ = from._impl_.total_memory_bytes_in_cleaned_segments_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.total_disk_bytes_in_cleaned_segments_ = from._impl_.total_disk_bytes_in_cleaned_segments_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.total_relocation_callbacks_ = from._impl_.total_relocation_callbacks_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.total_relocation_appends_ = from._impl_.total_relocation_appends_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.total_segments_cleaned_ = from._impl_.total_segments_cleaned_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.total_empty_segments_cleaned_ = from._impl_.total_empty_segments_cleaned_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.total_survivors_created_ = from._impl_.total_survivors_created_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.total_runs_ = from._impl_.total_runs_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.total_low_disk_space_runs_ = from._impl_.total_low_disk_space_runs_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.total_ticks_ = from._impl_.total_ticks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.get_segments_to_clean_ticks_ = from._impl_.get_segments_to_clean_ticks_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.cost_benefit_sort_ticks_ = from._impl_.cost_benefit_sort_ticks_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.get_sorted_entries_ticks_ = from._impl_.get_sorted_entries_ticks_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.timestamp_sort_ticks_ = from._impl_.timestamp_sort_ticks_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.relocate_live_entries_ticks_ = from._impl_.relocate_live_entries_ticks_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.wait_for_free_survivors_ticks_ = from._impl_.wait_for_free_survivors_ticks_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.cleaning_complete_ticks_ = from._impl_.cleaning_complete_ticks_;
+    }
+    if (cached_has_bits & 0x00800000u) {
+      _this->_impl_.relocation_callback_ticks_ = from._impl_.relocation_callback_ticks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0f000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      _this->_impl_.relocation_append_ticks_ = from._impl_.relocation_append_ticks_;
+    }
+    if (cached_has_bits & 0x02000000u) {
+      _this->_impl_.close_survivor_ticks_ = from._impl_.close_survivor_ticks_;
+    }
+    if (cached_has_bits & 0x04000000u) {
+      _this->_impl_.survivor_sync_ticks_ = from._impl_.survivor_sync_ticks_;
+    }
+    if (cached_has_bits & 0x08000000u) {
+      _this->_impl_.total_work_units_ = from._impl_.total_work_units_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMetrics_CleanerMetrics_OnDiskMetrics::CopyFrom(const LogMetrics_CleanerMetrics_OnDiskMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMetrics_CleanerMetrics_OnDiskMetrics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_cleaned_segment_memory_histogram()) {
+    if (!_impl_.cleaned_segment_memory_histogram_->IsInitialized()) return false;
+  }
+  if (_internal_has_cleaned_segment_disk_histogram()) {
+    if (!_impl_.cleaned_segment_disk_histogram_->IsInitialized()) return false;
+  }
+  if (_internal_has_all_segments_disk_histogram()) {
+    if (!_impl_.all_segments_disk_histogram_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void LogMetrics_CleanerMetrics_OnDiskMetrics::InternalSwap(LogMetrics_CleanerMetrics_OnDiskMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.total_entries_scanned_.InternalSwap(&other->_impl_.total_entries_scanned_);
+  _impl_.total_live_entries_scanned_.InternalSwap(&other->_impl_.total_live_entries_scanned_);
+  _impl_.total_scanned_entry_lengths_.InternalSwap(&other->_impl_.total_scanned_entry_lengths_);
+  _impl_.total_live_scanned_entry_lengths_.InternalSwap(&other->_impl_.total_live_scanned_entry_lengths_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.total_work_units_)
+      + sizeof(LogMetrics_CleanerMetrics_OnDiskMetrics::_impl_.total_work_units_)
+      - PROTOBUF_FIELD_OFFSET(LogMetrics_CleanerMetrics_OnDiskMetrics, _impl_.cleaned_segment_memory_histogram_)>(
+          reinterpret_cast<char*>(&_impl_.cleaned_segment_memory_histogram_),
+          reinterpret_cast<char*>(&other->_impl_.cleaned_segment_memory_histogram_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMetrics_CleanerMetrics_OnDiskMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMetrics_2eproto_getter, &descriptor_table_LogMetrics_2eproto_once,
+      file_level_metadata_LogMetrics_2eproto[1]);
+}
+
+// ===================================================================
+
+class LogMetrics_CleanerMetrics_ThreadMetrics::_Internal {
+ public:
+};
+
+LogMetrics_CleanerMetrics_ThreadMetrics::LogMetrics_CleanerMetrics_ThreadMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+}
+LogMetrics_CleanerMetrics_ThreadMetrics::LogMetrics_CleanerMetrics_ThreadMetrics(const LogMetrics_CleanerMetrics_ThreadMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMetrics_CleanerMetrics_ThreadMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.active_ticks_){from._impl_.active_ticks_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+}
+
+inline void LogMetrics_CleanerMetrics_ThreadMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.active_ticks_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LogMetrics_CleanerMetrics_ThreadMetrics::~LogMetrics_CleanerMetrics_ThreadMetrics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMetrics_CleanerMetrics_ThreadMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.active_ticks_.~RepeatedField();
+}
+
+void LogMetrics_CleanerMetrics_ThreadMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMetrics_CleanerMetrics_ThreadMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.active_ticks_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMetrics_CleanerMetrics_ThreadMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated fixed64 active_ticks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_active_ticks(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<9>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_active_ticks(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMetrics_CleanerMetrics_ThreadMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated fixed64 active_ticks = 1;
+  for (int i = 0, n = this->_internal_active_ticks_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_active_ticks(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+  return target;
+}
+
+size_t LogMetrics_CleanerMetrics_ThreadMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 active_ticks = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_active_ticks_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_active_ticks_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMetrics_CleanerMetrics_ThreadMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMetrics_CleanerMetrics_ThreadMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMetrics_CleanerMetrics_ThreadMetrics::GetClassData() const { return &_class_data_; }
+
+
+void LogMetrics_CleanerMetrics_ThreadMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMetrics_CleanerMetrics_ThreadMetrics*>(&to_msg);
+  auto& from = static_cast<const LogMetrics_CleanerMetrics_ThreadMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.active_ticks_.MergeFrom(from._impl_.active_ticks_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMetrics_CleanerMetrics_ThreadMetrics::CopyFrom(const LogMetrics_CleanerMetrics_ThreadMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMetrics_CleanerMetrics_ThreadMetrics::IsInitialized() const {
+  return true;
+}
+
+void LogMetrics_CleanerMetrics_ThreadMetrics::InternalSwap(LogMetrics_CleanerMetrics_ThreadMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.active_ticks_.InternalSwap(&other->_impl_.active_ticks_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMetrics_CleanerMetrics_ThreadMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMetrics_2eproto_getter, &descriptor_table_LogMetrics_2eproto_once,
+      file_level_metadata_LogMetrics_2eproto[2]);
+}
+
+// ===================================================================
+
+class LogMetrics_CleanerMetrics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogMetrics_CleanerMetrics>()._impl_._has_bits_);
+  static void set_has_poll_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_max_cleanable_memory_utilization(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_live_segments_per_disk_pass(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_survivor_segments_to_reserve(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_min_memory_utilization(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_min_disk_utilization(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_do_work_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_do_work_sleep_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics& in_memory_metrics(const LogMetrics_CleanerMetrics* msg);
+  static void set_has_in_memory_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics& on_disk_metrics(const LogMetrics_CleanerMetrics* msg);
+  static void set_has_on_disk_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics& thread_metrics(const LogMetrics_CleanerMetrics* msg);
+  static void set_has_thread_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000007ff) ^ 0x000007ff) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics&
+LogMetrics_CleanerMetrics::_Internal::in_memory_metrics(const LogMetrics_CleanerMetrics* msg) {
+  return *msg->_impl_.in_memory_metrics_;
+}
+const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics&
+LogMetrics_CleanerMetrics::_Internal::on_disk_metrics(const LogMetrics_CleanerMetrics* msg) {
+  return *msg->_impl_.on_disk_metrics_;
+}
+const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics&
+LogMetrics_CleanerMetrics::_Internal::thread_metrics(const LogMetrics_CleanerMetrics* msg) {
+  return *msg->_impl_.thread_metrics_;
+}
+LogMetrics_CleanerMetrics::LogMetrics_CleanerMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+}
+LogMetrics_CleanerMetrics::LogMetrics_CleanerMetrics(const LogMetrics_CleanerMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMetrics_CleanerMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.in_memory_metrics_){nullptr}
+    , decltype(_impl_.on_disk_metrics_){nullptr}
+    , decltype(_impl_.thread_metrics_){nullptr}
+    , decltype(_impl_.poll_usec_){}
+    , decltype(_impl_.max_cleanable_memory_utilization_){}
+    , decltype(_impl_.live_segments_per_disk_pass_){}
+    , decltype(_impl_.survivor_segments_to_reserve_){}
+    , decltype(_impl_.min_memory_utilization_){}
+    , decltype(_impl_.min_disk_utilization_){}
+    , decltype(_impl_.do_work_ticks_){}
+    , decltype(_impl_.do_work_sleep_ticks_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_in_memory_metrics()) {
+    _this->_impl_.in_memory_metrics_ = new ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics(*from._impl_.in_memory_metrics_);
+  }
+  if (from._internal_has_on_disk_metrics()) {
+    _this->_impl_.on_disk_metrics_ = new ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics(*from._impl_.on_disk_metrics_);
+  }
+  if (from._internal_has_thread_metrics()) {
+    _this->_impl_.thread_metrics_ = new ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics(*from._impl_.thread_metrics_);
+  }
+  ::memcpy(&_impl_.poll_usec_, &from._impl_.poll_usec_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.do_work_sleep_ticks_) -
+    reinterpret_cast<char*>(&_impl_.poll_usec_)) + sizeof(_impl_.do_work_sleep_ticks_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+}
+
+inline void LogMetrics_CleanerMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.in_memory_metrics_){nullptr}
+    , decltype(_impl_.on_disk_metrics_){nullptr}
+    , decltype(_impl_.thread_metrics_){nullptr}
+    , decltype(_impl_.poll_usec_){0u}
+    , decltype(_impl_.max_cleanable_memory_utilization_){0u}
+    , decltype(_impl_.live_segments_per_disk_pass_){0u}
+    , decltype(_impl_.survivor_segments_to_reserve_){0u}
+    , decltype(_impl_.min_memory_utilization_){0u}
+    , decltype(_impl_.min_disk_utilization_){0u}
+    , decltype(_impl_.do_work_ticks_){uint64_t{0u}}
+    , decltype(_impl_.do_work_sleep_ticks_){uint64_t{0u}}
+  };
+}
+
+LogMetrics_CleanerMetrics::~LogMetrics_CleanerMetrics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMetrics_CleanerMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.in_memory_metrics_;
+  if (this != internal_default_instance()) delete _impl_.on_disk_metrics_;
+  if (this != internal_default_instance()) delete _impl_.thread_metrics_;
+}
+
+void LogMetrics_CleanerMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMetrics_CleanerMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.in_memory_metrics_ != nullptr);
+      _impl_.in_memory_metrics_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.on_disk_metrics_ != nullptr);
+      _impl_.on_disk_metrics_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.thread_metrics_ != nullptr);
+      _impl_.thread_metrics_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.poll_usec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.min_memory_utilization_) -
+        reinterpret_cast<char*>(&_impl_.poll_usec_)) + sizeof(_impl_.min_memory_utilization_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.min_disk_utilization_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.do_work_sleep_ticks_) -
+        reinterpret_cast<char*>(&_impl_.min_disk_utilization_)) + sizeof(_impl_.do_work_sleep_ticks_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMetrics_CleanerMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed32 poll_usec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_poll_usec(&has_bits);
+          _impl_.poll_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 max_cleanable_memory_utilization = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_max_cleanable_memory_utilization(&has_bits);
+          _impl_.max_cleanable_memory_utilization_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 live_segments_per_disk_pass = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_live_segments_per_disk_pass(&has_bits);
+          _impl_.live_segments_per_disk_pass_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 survivor_segments_to_reserve = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_survivor_segments_to_reserve(&has_bits);
+          _impl_.survivor_segments_to_reserve_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 min_memory_utilization = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_min_memory_utilization(&has_bits);
+          _impl_.min_memory_utilization_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 min_disk_utilization = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_min_disk_utilization(&has_bits);
+          _impl_.min_disk_utilization_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 do_work_ticks = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_do_work_ticks(&has_bits);
+          _impl_.do_work_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 do_work_sleep_ticks = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_do_work_sleep_ticks(&has_bits);
+          _impl_.do_work_sleep_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics in_memory_metrics = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_in_memory_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics on_disk_metrics = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_on_disk_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics thread_metrics = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_thread_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMetrics_CleanerMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed32 poll_usec = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_poll_usec(), target);
+  }
+
+  // required fixed32 max_cleanable_memory_utilization = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(2, this->_internal_max_cleanable_memory_utilization(), target);
+  }
+
+  // required fixed32 live_segments_per_disk_pass = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(3, this->_internal_live_segments_per_disk_pass(), target);
+  }
+
+  // required fixed32 survivor_segments_to_reserve = 4;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(4, this->_internal_survivor_segments_to_reserve(), target);
+  }
+
+  // required fixed32 min_memory_utilization = 5;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(5, this->_internal_min_memory_utilization(), target);
+  }
+
+  // required fixed32 min_disk_utilization = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(6, this->_internal_min_disk_utilization(), target);
+  }
+
+  // required fixed64 do_work_ticks = 7;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_do_work_ticks(), target);
+  }
+
+  // required fixed64 do_work_sleep_ticks = 8;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(8, this->_internal_do_work_sleep_ticks(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics in_memory_metrics = 9;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::in_memory_metrics(this),
+        _Internal::in_memory_metrics(this).GetCachedSize(), target, stream);
+  }
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics on_disk_metrics = 10;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::on_disk_metrics(this),
+        _Internal::on_disk_metrics(this).GetCachedSize(), target, stream);
+  }
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics thread_metrics = 11;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::thread_metrics(this),
+        _Internal::thread_metrics(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  return target;
+}
+
+size_t LogMetrics_CleanerMetrics::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  size_t total_size = 0;
+
+  if (_internal_has_in_memory_metrics()) {
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics in_memory_metrics = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.in_memory_metrics_);
+  }
+
+  if (_internal_has_on_disk_metrics()) {
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics on_disk_metrics = 10;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.on_disk_metrics_);
+  }
+
+  if (_internal_has_thread_metrics()) {
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics thread_metrics = 11;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.thread_metrics_);
+  }
+
+  if (_internal_has_poll_usec()) {
+    // required fixed32 poll_usec = 1;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_max_cleanable_memory_utilization()) {
+    // required fixed32 max_cleanable_memory_utilization = 2;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_live_segments_per_disk_pass()) {
+    // required fixed32 live_segments_per_disk_pass = 3;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_survivor_segments_to_reserve()) {
+    // required fixed32 survivor_segments_to_reserve = 4;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_min_memory_utilization()) {
+    // required fixed32 min_memory_utilization = 5;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_min_disk_utilization()) {
+    // required fixed32 min_disk_utilization = 6;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_do_work_ticks()) {
+    // required fixed64 do_work_ticks = 7;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_do_work_sleep_ticks()) {
+    // required fixed64 do_work_sleep_ticks = 8;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t LogMetrics_CleanerMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x000007ff) ^ 0x000007ff) == 0) {  // All required fields are present.
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics in_memory_metrics = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.in_memory_metrics_);
+
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics on_disk_metrics = 10;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.on_disk_metrics_);
+
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics thread_metrics = 11;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.thread_metrics_);
+
+    // required fixed32 poll_usec = 1;
+    total_size += 1 + 4;
+
+    // required fixed32 max_cleanable_memory_utilization = 2;
+    total_size += 1 + 4;
+
+    // required fixed32 live_segments_per_disk_pass = 3;
+    total_size += 1 + 4;
+
+    // required fixed32 survivor_segments_to_reserve = 4;
+    total_size += 1 + 4;
+
+    // required fixed32 min_memory_utilization = 5;
+    total_size += 1 + 4;
+
+    // required fixed32 min_disk_utilization = 6;
+    total_size += 1 + 4;
+
+    // required fixed64 do_work_ticks = 7;
+    total_size += 1 + 8;
+
+    // required fixed64 do_work_sleep_ticks = 8;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMetrics_CleanerMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMetrics_CleanerMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMetrics_CleanerMetrics::GetClassData() const { return &_class_data_; }
+
+
+void LogMetrics_CleanerMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMetrics_CleanerMetrics*>(&to_msg);
+  auto& from = static_cast<const LogMetrics_CleanerMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_in_memory_metrics()->::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics::MergeFrom(
+          from._internal_in_memory_metrics());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_on_disk_metrics()->::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics::MergeFrom(
+          from._internal_on_disk_metrics());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_thread_metrics()->::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics::MergeFrom(
+          from._internal_thread_metrics());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.poll_usec_ = from._impl_.poll_usec_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.max_cleanable_memory_utilization_ = from._impl_.max_cleanable_memory_utilization_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.live_segments_per_disk_pass_ = from._impl_.live_segments_per_disk_pass_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.survivor_segments_to_reserve_ = from._impl_.survivor_segments_to_reserve_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.min_memory_utilization_ = from._impl_.min_memory_utilization_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.min_disk_utilization_ = from._impl_.min_disk_utilization_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.do_work_ticks_ = from._impl_.do_work_ticks_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.do_work_sleep_ticks_ = from._impl_.do_work_sleep_ticks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMetrics_CleanerMetrics::CopyFrom(const LogMetrics_CleanerMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMetrics_CleanerMetrics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_in_memory_metrics()) {
+    if (!_impl_.in_memory_metrics_->IsInitialized()) return false;
+  }
+  if (_internal_has_on_disk_metrics()) {
+    if (!_impl_.on_disk_metrics_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void LogMetrics_CleanerMetrics::InternalSwap(LogMetrics_CleanerMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogMetrics_CleanerMetrics, _impl_.do_work_sleep_ticks_)
+      + sizeof(LogMetrics_CleanerMetrics::_impl_.do_work_sleep_ticks_)
+      - PROTOBUF_FIELD_OFFSET(LogMetrics_CleanerMetrics, _impl_.in_memory_metrics_)>(
+          reinterpret_cast<char*>(&_impl_.in_memory_metrics_),
+          reinterpret_cast<char*>(&other->_impl_.in_memory_metrics_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMetrics_CleanerMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMetrics_2eproto_getter, &descriptor_table_LogMetrics_2eproto_once,
+      file_level_metadata_LogMetrics_2eproto[3]);
+}
+
+// ===================================================================
+
+class LogMetrics_SegletMetrics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogMetrics_SegletMetrics>()._impl_._has_bits_);
+  static void set_has_total_seglets(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_total_usable_seglets(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_emergency_head_pool_reserve(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_emergency_head_pool_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_cleaner_pool_reserve(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cleaner_pool_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_default_pool_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007f) ^ 0x0000007f) != 0;
+  }
+};
+
+LogMetrics_SegletMetrics::LogMetrics_SegletMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+}
+LogMetrics_SegletMetrics::LogMetrics_SegletMetrics(const LogMetrics_SegletMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMetrics_SegletMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_seglets_){}
+    , decltype(_impl_.total_usable_seglets_){}
+    , decltype(_impl_.emergency_head_pool_reserve_){}
+    , decltype(_impl_.emergency_head_pool_count_){}
+    , decltype(_impl_.cleaner_pool_reserve_){}
+    , decltype(_impl_.cleaner_pool_count_){}
+    , decltype(_impl_.default_pool_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.total_seglets_, &from._impl_.total_seglets_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.default_pool_count_) -
+    reinterpret_cast<char*>(&_impl_.total_seglets_)) + sizeof(_impl_.default_pool_count_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+}
+
+inline void LogMetrics_SegletMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_seglets_){uint64_t{0u}}
+    , decltype(_impl_.total_usable_seglets_){uint64_t{0u}}
+    , decltype(_impl_.emergency_head_pool_reserve_){uint64_t{0u}}
+    , decltype(_impl_.emergency_head_pool_count_){uint64_t{0u}}
+    , decltype(_impl_.cleaner_pool_reserve_){uint64_t{0u}}
+    , decltype(_impl_.cleaner_pool_count_){uint64_t{0u}}
+    , decltype(_impl_.default_pool_count_){uint64_t{0u}}
+  };
+}
+
+LogMetrics_SegletMetrics::~LogMetrics_SegletMetrics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMetrics_SegletMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LogMetrics_SegletMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMetrics_SegletMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.total_seglets_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.default_pool_count_) -
+        reinterpret_cast<char*>(&_impl_.total_seglets_)) + sizeof(_impl_.default_pool_count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMetrics_SegletMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 total_seglets = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_total_seglets(&has_bits);
+          _impl_.total_seglets_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_usable_seglets = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_total_usable_seglets(&has_bits);
+          _impl_.total_usable_seglets_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 emergency_head_pool_reserve = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_emergency_head_pool_reserve(&has_bits);
+          _impl_.emergency_head_pool_reserve_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 emergency_head_pool_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_emergency_head_pool_count(&has_bits);
+          _impl_.emergency_head_pool_count_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 cleaner_pool_reserve = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_cleaner_pool_reserve(&has_bits);
+          _impl_.cleaner_pool_reserve_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 cleaner_pool_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_cleaner_pool_count(&has_bits);
+          _impl_.cleaner_pool_count_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 default_pool_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_default_pool_count(&has_bits);
+          _impl_.default_pool_count_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMetrics_SegletMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 total_seglets = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_total_seglets(), target);
+  }
+
+  // required fixed64 total_usable_seglets = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_total_usable_seglets(), target);
+  }
+
+  // required fixed64 emergency_head_pool_reserve = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_emergency_head_pool_reserve(), target);
+  }
+
+  // required fixed64 emergency_head_pool_count = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_emergency_head_pool_count(), target);
+  }
+
+  // required fixed64 cleaner_pool_reserve = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_cleaner_pool_reserve(), target);
+  }
+
+  // required fixed64 cleaner_pool_count = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_cleaner_pool_count(), target);
+  }
+
+  // required fixed64 default_pool_count = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_default_pool_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  return target;
+}
+
+size_t LogMetrics_SegletMetrics::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  size_t total_size = 0;
+
+  if (_internal_has_total_seglets()) {
+    // required fixed64 total_seglets = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_usable_seglets()) {
+    // required fixed64 total_usable_seglets = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_emergency_head_pool_reserve()) {
+    // required fixed64 emergency_head_pool_reserve = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_emergency_head_pool_count()) {
+    // required fixed64 emergency_head_pool_count = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_cleaner_pool_reserve()) {
+    // required fixed64 cleaner_pool_reserve = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_cleaner_pool_count()) {
+    // required fixed64 cleaner_pool_count = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_default_pool_count()) {
+    // required fixed64 default_pool_count = 7;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t LogMetrics_SegletMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007f) ^ 0x0000007f) == 0) {  // All required fields are present.
+    // required fixed64 total_seglets = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 total_usable_seglets = 2;
+    total_size += 1 + 8;
+
+    // required fixed64 emergency_head_pool_reserve = 3;
+    total_size += 1 + 8;
+
+    // required fixed64 emergency_head_pool_count = 4;
+    total_size += 1 + 8;
+
+    // required fixed64 cleaner_pool_reserve = 5;
+    total_size += 1 + 8;
+
+    // required fixed64 cleaner_pool_count = 6;
+    total_size += 1 + 8;
+
+    // required fixed64 default_pool_count = 7;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMetrics_SegletMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMetrics_SegletMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMetrics_SegletMetrics::GetClassData() const { return &_class_data_; }
+
+
+void LogMetrics_SegletMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMetrics_SegletMetrics*>(&to_msg);
+  auto& from = static_cast<const LogMetrics_SegletMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.total_seglets_ = from._impl_.total_seglets_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.total_usable_seglets_ = from._impl_.total_usable_seglets_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.emergency_head_pool_reserve_ = from._impl_.emergency_head_pool_reserve_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.emergency_head_pool_count_ = from._impl_.emergency_head_pool_count_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.cleaner_pool_reserve_ = from._impl_.cleaner_pool_reserve_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cleaner_pool_count_ = from._impl_.cleaner_pool_count_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.default_pool_count_ = from._impl_.default_pool_count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMetrics_SegletMetrics::CopyFrom(const LogMetrics_SegletMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMetrics_SegletMetrics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void LogMetrics_SegletMetrics::InternalSwap(LogMetrics_SegletMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogMetrics_SegletMetrics, _impl_.default_pool_count_)
+      + sizeof(LogMetrics_SegletMetrics::_impl_.default_pool_count_)
+      - PROTOBUF_FIELD_OFFSET(LogMetrics_SegletMetrics, _impl_.total_seglets_)>(
+          reinterpret_cast<char*>(&_impl_.total_seglets_),
+          reinterpret_cast<char*>(&other->_impl_.total_seglets_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMetrics_SegletMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMetrics_2eproto_getter, &descriptor_table_LogMetrics_2eproto_once,
+      file_level_metadata_LogMetrics_2eproto[4]);
+}
+
+// ===================================================================
+
+class LogMetrics_SegmentMetrics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogMetrics_SegmentMetrics>()._impl_._has_bits_);
+  static const ::RAMCloud::ProtoBuf::Histogram& segments_on_disk_histogram(const LogMetrics_SegmentMetrics* msg);
+  static void set_has_segments_on_disk_histogram(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_current_segments_on_disk(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::Histogram&
+LogMetrics_SegmentMetrics::_Internal::segments_on_disk_histogram(const LogMetrics_SegmentMetrics* msg) {
+  return *msg->_impl_.segments_on_disk_histogram_;
+}
+void LogMetrics_SegmentMetrics::clear_segments_on_disk_histogram() {
+  if (_impl_.segments_on_disk_histogram_ != nullptr) _impl_.segments_on_disk_histogram_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+LogMetrics_SegmentMetrics::LogMetrics_SegmentMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+}
+LogMetrics_SegmentMetrics::LogMetrics_SegmentMetrics(const LogMetrics_SegmentMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMetrics_SegmentMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_entry_counts_){from._impl_.total_entry_counts_}
+    , decltype(_impl_.total_entry_lengths_){from._impl_.total_entry_lengths_}
+    , decltype(_impl_.segments_on_disk_histogram_){nullptr}
+    , decltype(_impl_.current_segments_on_disk_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_segments_on_disk_histogram()) {
+    _this->_impl_.segments_on_disk_histogram_ = new ::RAMCloud::ProtoBuf::Histogram(*from._impl_.segments_on_disk_histogram_);
+  }
+  _this->_impl_.current_segments_on_disk_ = from._impl_.current_segments_on_disk_;
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+}
+
+inline void LogMetrics_SegmentMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.total_entry_counts_){arena}
+    , decltype(_impl_.total_entry_lengths_){arena}
+    , decltype(_impl_.segments_on_disk_histogram_){nullptr}
+    , decltype(_impl_.current_segments_on_disk_){uint64_t{0u}}
+  };
+}
+
+LogMetrics_SegmentMetrics::~LogMetrics_SegmentMetrics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMetrics_SegmentMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.total_entry_counts_.~RepeatedField();
+  _impl_.total_entry_lengths_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.segments_on_disk_histogram_;
+}
+
+void LogMetrics_SegmentMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMetrics_SegmentMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.total_entry_counts_.Clear();
+  _impl_.total_entry_lengths_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.segments_on_disk_histogram_ != nullptr);
+    _impl_.segments_on_disk_histogram_->Clear();
+  }
+  _impl_.current_segments_on_disk_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMetrics_SegmentMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .RAMCloud.ProtoBuf.Histogram segments_on_disk_histogram = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_segments_on_disk_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 current_segments_on_disk = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_current_segments_on_disk(&has_bits);
+          _impl_.current_segments_on_disk_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_entry_counts = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_entry_counts(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<25>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_entry_counts(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 total_entry_lengths = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_total_entry_lengths(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<33>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_total_entry_lengths(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMetrics_SegmentMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .RAMCloud.ProtoBuf.Histogram segments_on_disk_histogram = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::segments_on_disk_histogram(this),
+        _Internal::segments_on_disk_histogram(this).GetCachedSize(), target, stream);
+  }
+
+  // required fixed64 current_segments_on_disk = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_current_segments_on_disk(), target);
+  }
+
+  // repeated fixed64 total_entry_counts = 3;
+  for (int i = 0, n = this->_internal_total_entry_counts_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_total_entry_counts(i), target);
+  }
+
+  // repeated fixed64 total_entry_lengths = 4;
+  for (int i = 0, n = this->_internal_total_entry_lengths_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_total_entry_lengths(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  return target;
+}
+
+size_t LogMetrics_SegmentMetrics::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  size_t total_size = 0;
+
+  if (_internal_has_segments_on_disk_histogram()) {
+    // required .RAMCloud.ProtoBuf.Histogram segments_on_disk_histogram = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.segments_on_disk_histogram_);
+  }
+
+  if (_internal_has_current_segments_on_disk()) {
+    // required fixed64 current_segments_on_disk = 2;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t LogMetrics_SegmentMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .RAMCloud.ProtoBuf.Histogram segments_on_disk_histogram = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.segments_on_disk_histogram_);
+
+    // required fixed64 current_segments_on_disk = 2;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 total_entry_counts = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_entry_counts_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_entry_counts_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 total_entry_lengths = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_total_entry_lengths_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_total_entry_lengths_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMetrics_SegmentMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMetrics_SegmentMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMetrics_SegmentMetrics::GetClassData() const { return &_class_data_; }
+
+
+void LogMetrics_SegmentMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMetrics_SegmentMetrics*>(&to_msg);
+  auto& from = static_cast<const LogMetrics_SegmentMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.total_entry_counts_.MergeFrom(from._impl_.total_entry_counts_);
+  _this->_impl_.total_entry_lengths_.MergeFrom(from._impl_.total_entry_lengths_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_segments_on_disk_histogram()->::RAMCloud::ProtoBuf::Histogram::MergeFrom(
+          from._internal_segments_on_disk_histogram());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.current_segments_on_disk_ = from._impl_.current_segments_on_disk_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMetrics_SegmentMetrics::CopyFrom(const LogMetrics_SegmentMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMetrics_SegmentMetrics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_segments_on_disk_histogram()) {
+    if (!_impl_.segments_on_disk_histogram_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void LogMetrics_SegmentMetrics::InternalSwap(LogMetrics_SegmentMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.total_entry_counts_.InternalSwap(&other->_impl_.total_entry_counts_);
+  _impl_.total_entry_lengths_.InternalSwap(&other->_impl_.total_entry_lengths_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogMetrics_SegmentMetrics, _impl_.current_segments_on_disk_)
+      + sizeof(LogMetrics_SegmentMetrics::_impl_.current_segments_on_disk_)
+      - PROTOBUF_FIELD_OFFSET(LogMetrics_SegmentMetrics, _impl_.segments_on_disk_histogram_)>(
+          reinterpret_cast<char*>(&_impl_.segments_on_disk_histogram_),
+          reinterpret_cast<char*>(&other->_impl_.segments_on_disk_histogram_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMetrics_SegmentMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMetrics_2eproto_getter, &descriptor_table_LogMetrics_2eproto_once,
+      file_level_metadata_LogMetrics_2eproto[5]);
+}
+
+// ===================================================================
+
+class LogMetrics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogMetrics>()._impl_._has_bits_);
+  static void set_has_ticks_per_second(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_total_sync_calls(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_total_sync_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_total_append_calls(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_total_append_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_total_no_space_ticks(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_total_bytes_appended(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_total_metadata_bytes_appended(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics& cleaner_metrics(const LogMetrics* msg);
+  static void set_has_cleaner_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics& seglet_metrics(const LogMetrics* msg);
+  static void set_has_seglet_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics& segment_metrics(const LogMetrics* msg);
+  static void set_has_segment_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000007ff) ^ 0x000007ff) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics&
+LogMetrics::_Internal::cleaner_metrics(const LogMetrics* msg) {
+  return *msg->_impl_.cleaner_metrics_;
+}
+const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics&
+LogMetrics::_Internal::seglet_metrics(const LogMetrics* msg) {
+  return *msg->_impl_.seglet_metrics_;
+}
+const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics&
+LogMetrics::_Internal::segment_metrics(const LogMetrics* msg) {
+  return *msg->_impl_.segment_metrics_;
+}
+LogMetrics::LogMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.LogMetrics)
+}
+LogMetrics::LogMetrics(const LogMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cleaner_metrics_){nullptr}
+    , decltype(_impl_.seglet_metrics_){nullptr}
+    , decltype(_impl_.segment_metrics_){nullptr}
+    , decltype(_impl_.ticks_per_second_){}
+    , decltype(_impl_.total_sync_calls_){}
+    , decltype(_impl_.total_sync_ticks_){}
+    , decltype(_impl_.total_append_calls_){}
+    , decltype(_impl_.total_append_ticks_){}
+    , decltype(_impl_.total_no_space_ticks_){}
+    , decltype(_impl_.total_bytes_appended_){}
+    , decltype(_impl_.total_metadata_bytes_appended_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_cleaner_metrics()) {
+    _this->_impl_.cleaner_metrics_ = new ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics(*from._impl_.cleaner_metrics_);
+  }
+  if (from._internal_has_seglet_metrics()) {
+    _this->_impl_.seglet_metrics_ = new ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics(*from._impl_.seglet_metrics_);
+  }
+  if (from._internal_has_segment_metrics()) {
+    _this->_impl_.segment_metrics_ = new ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics(*from._impl_.segment_metrics_);
+  }
+  ::memcpy(&_impl_.ticks_per_second_, &from._impl_.ticks_per_second_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_metadata_bytes_appended_) -
+    reinterpret_cast<char*>(&_impl_.ticks_per_second_)) + sizeof(_impl_.total_metadata_bytes_appended_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.LogMetrics)
+}
+
+inline void LogMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cleaner_metrics_){nullptr}
+    , decltype(_impl_.seglet_metrics_){nullptr}
+    , decltype(_impl_.segment_metrics_){nullptr}
+    , decltype(_impl_.ticks_per_second_){0}
+    , decltype(_impl_.total_sync_calls_){uint64_t{0u}}
+    , decltype(_impl_.total_sync_ticks_){uint64_t{0u}}
+    , decltype(_impl_.total_append_calls_){uint64_t{0u}}
+    , decltype(_impl_.total_append_ticks_){uint64_t{0u}}
+    , decltype(_impl_.total_no_space_ticks_){uint64_t{0u}}
+    , decltype(_impl_.total_bytes_appended_){uint64_t{0u}}
+    , decltype(_impl_.total_metadata_bytes_appended_){uint64_t{0u}}
+  };
+}
+
+LogMetrics::~LogMetrics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.LogMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.cleaner_metrics_;
+  if (this != internal_default_instance()) delete _impl_.seglet_metrics_;
+  if (this != internal_default_instance()) delete _impl_.segment_metrics_;
+}
+
+void LogMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.LogMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.cleaner_metrics_ != nullptr);
+      _impl_.cleaner_metrics_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.seglet_metrics_ != nullptr);
+      _impl_.seglet_metrics_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.segment_metrics_ != nullptr);
+      _impl_.segment_metrics_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.ticks_per_second_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.total_append_ticks_) -
+        reinterpret_cast<char*>(&_impl_.ticks_per_second_)) + sizeof(_impl_.total_append_ticks_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.total_no_space_ticks_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.total_metadata_bytes_appended_) -
+        reinterpret_cast<char*>(&_impl_.total_no_space_ticks_)) + sizeof(_impl_.total_metadata_bytes_appended_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required double ticks_per_second = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_ticks_per_second(&has_bits);
+          _impl_.ticks_per_second_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_sync_calls = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_total_sync_calls(&has_bits);
+          _impl_.total_sync_calls_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_sync_ticks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_total_sync_ticks(&has_bits);
+          _impl_.total_sync_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_append_calls = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_total_append_calls(&has_bits);
+          _impl_.total_append_calls_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_append_ticks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_total_append_ticks(&has_bits);
+          _impl_.total_append_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_no_space_ticks = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_total_no_space_ticks(&has_bits);
+          _impl_.total_no_space_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_bytes_appended = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_total_bytes_appended(&has_bits);
+          _impl_.total_bytes_appended_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 total_metadata_bytes_appended = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_total_metadata_bytes_appended(&has_bits);
+          _impl_.total_metadata_bytes_appended_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics cleaner_metrics = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cleaner_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.LogMetrics.SegletMetrics seglet_metrics = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_seglet_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics segment_metrics = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_segment_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.LogMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required double ticks_per_second = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_ticks_per_second(), target);
+  }
+
+  // required fixed64 total_sync_calls = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_total_sync_calls(), target);
+  }
+
+  // required fixed64 total_sync_ticks = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_total_sync_ticks(), target);
+  }
+
+  // required fixed64 total_append_calls = 4;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_total_append_calls(), target);
+  }
+
+  // required fixed64 total_append_ticks = 5;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_total_append_ticks(), target);
+  }
+
+  // required fixed64 total_no_space_ticks = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_total_no_space_ticks(), target);
+  }
+
+  // required fixed64 total_bytes_appended = 7;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_total_bytes_appended(), target);
+  }
+
+  // required fixed64 total_metadata_bytes_appended = 8;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(8, this->_internal_total_metadata_bytes_appended(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics cleaner_metrics = 9;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::cleaner_metrics(this),
+        _Internal::cleaner_metrics(this).GetCachedSize(), target, stream);
+  }
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.SegletMetrics seglet_metrics = 10;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::seglet_metrics(this),
+        _Internal::seglet_metrics(this).GetCachedSize(), target, stream);
+  }
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics segment_metrics = 11;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::segment_metrics(this),
+        _Internal::segment_metrics(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.LogMetrics)
+  return target;
+}
+
+size_t LogMetrics::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.LogMetrics)
+  size_t total_size = 0;
+
+  if (_internal_has_cleaner_metrics()) {
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics cleaner_metrics = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cleaner_metrics_);
+  }
+
+  if (_internal_has_seglet_metrics()) {
+    // required .RAMCloud.ProtoBuf.LogMetrics.SegletMetrics seglet_metrics = 10;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.seglet_metrics_);
+  }
+
+  if (_internal_has_segment_metrics()) {
+    // required .RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics segment_metrics = 11;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.segment_metrics_);
+  }
+
+  if (_internal_has_ticks_per_second()) {
+    // required double ticks_per_second = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_sync_calls()) {
+    // required fixed64 total_sync_calls = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_sync_ticks()) {
+    // required fixed64 total_sync_ticks = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_append_calls()) {
+    // required fixed64 total_append_calls = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_append_ticks()) {
+    // required fixed64 total_append_ticks = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_no_space_ticks()) {
+    // required fixed64 total_no_space_ticks = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_bytes_appended()) {
+    // required fixed64 total_bytes_appended = 7;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_total_metadata_bytes_appended()) {
+    // required fixed64 total_metadata_bytes_appended = 8;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t LogMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.LogMetrics)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x000007ff) ^ 0x000007ff) == 0) {  // All required fields are present.
+    // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics cleaner_metrics = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cleaner_metrics_);
+
+    // required .RAMCloud.ProtoBuf.LogMetrics.SegletMetrics seglet_metrics = 10;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.seglet_metrics_);
+
+    // required .RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics segment_metrics = 11;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.segment_metrics_);
+
+    // required double ticks_per_second = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 total_sync_calls = 2;
+    total_size += 1 + 8;
+
+    // required fixed64 total_sync_ticks = 3;
+    total_size += 1 + 8;
+
+    // required fixed64 total_append_calls = 4;
+    total_size += 1 + 8;
+
+    // required fixed64 total_append_ticks = 5;
+    total_size += 1 + 8;
+
+    // required fixed64 total_no_space_ticks = 6;
+    total_size += 1 + 8;
+
+    // required fixed64 total_bytes_appended = 7;
+    total_size += 1 + 8;
+
+    // required fixed64 total_metadata_bytes_appended = 8;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMetrics::GetClassData() const { return &_class_data_; }
+
+
+void LogMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMetrics*>(&to_msg);
+  auto& from = static_cast<const LogMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.LogMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_cleaner_metrics()->::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics::MergeFrom(
+          from._internal_cleaner_metrics());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_seglet_metrics()->::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics::MergeFrom(
+          from._internal_seglet_metrics());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_segment_metrics()->::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics::MergeFrom(
+          from._internal_segment_metrics());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ticks_per_second_ = from._impl_.ticks_per_second_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.total_sync_calls_ = from._impl_.total_sync_calls_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.total_sync_ticks_ = from._impl_.total_sync_ticks_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.total_append_calls_ = from._impl_.total_append_calls_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.total_append_ticks_ = from._impl_.total_append_ticks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.total_no_space_ticks_ = from._impl_.total_no_space_ticks_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.total_bytes_appended_ = from._impl_.total_bytes_appended_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.total_metadata_bytes_appended_ = from._impl_.total_metadata_bytes_appended_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMetrics::CopyFrom(const LogMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.LogMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMetrics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_cleaner_metrics()) {
+    if (!_impl_.cleaner_metrics_->IsInitialized()) return false;
+  }
+  if (_internal_has_seglet_metrics()) {
+    if (!_impl_.seglet_metrics_->IsInitialized()) return false;
+  }
+  if (_internal_has_segment_metrics()) {
+    if (!_impl_.segment_metrics_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void LogMetrics::InternalSwap(LogMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogMetrics, _impl_.total_metadata_bytes_appended_)
+      + sizeof(LogMetrics::_impl_.total_metadata_bytes_appended_)
+      - PROTOBUF_FIELD_OFFSET(LogMetrics, _impl_.cleaner_metrics_)>(
+          reinterpret_cast<char*>(&_impl_.cleaner_metrics_),
+          reinterpret_cast<char*>(&other->_impl_.cleaner_metrics_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMetrics_2eproto_getter, &descriptor_table_LogMetrics_2eproto_once,
+      file_level_metadata_LogMetrics_2eproto[6]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::LogMetrics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::LogMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::LogMetrics >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,787 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MasterRecoveryInfo.proto
+
+#include "MasterRecoveryInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR MasterRecoveryInfo_TabletStats::MasterRecoveryInfo_TabletStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.byte_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.object_count_)*/uint64_t{0u}} {}
+struct MasterRecoveryInfo_TabletStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MasterRecoveryInfo_TabletStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MasterRecoveryInfo_TabletStatsDefaultTypeInternal() {}
+  union {
+    MasterRecoveryInfo_TabletStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MasterRecoveryInfo_TabletStatsDefaultTypeInternal _MasterRecoveryInfo_TabletStats_default_instance_;
+PROTOBUF_CONSTEXPR MasterRecoveryInfo::MasterRecoveryInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tablet_stats_)*/{}
+  , /*decltype(_impl_.min_open_segment_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.min_open_segment_epoch_)*/uint64_t{0u}} {}
+struct MasterRecoveryInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MasterRecoveryInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MasterRecoveryInfoDefaultTypeInternal() {}
+  union {
+    MasterRecoveryInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MasterRecoveryInfoDefaultTypeInternal _MasterRecoveryInfo_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_MasterRecoveryInfo_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_MasterRecoveryInfo_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_MasterRecoveryInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_MasterRecoveryInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats, _impl_.table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats, _impl_.start_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats, _impl_.end_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats, _impl_.byte_count_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats, _impl_.object_count_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _impl_.min_open_segment_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _impl_.min_open_segment_epoch_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _impl_.tablet_stats_),
+  0,
+  1,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 11, -1, sizeof(::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats)},
+  { 16, 25, -1, sizeof(::RAMCloud::ProtoBuf::MasterRecoveryInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_MasterRecoveryInfo_TabletStats_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_MasterRecoveryInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_MasterRecoveryInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030MasterRecoveryInfo.proto\022\021RAMCloud.Pro"
+  "toBuf\"\223\002\n\022MasterRecoveryInfo\022\033\n\023min_open"
+  "_segment_id\030\001 \002(\004\022\036\n\026min_open_segment_ep"
+  "och\030\002 \002(\004\022G\n\014tablet_stats\030\003 \003(\01321.RAMClo"
+  "ud.ProtoBuf.MasterRecoveryInfo.TabletSta"
+  "ts\032w\n\013TabletStats\022\020\n\010table_id\030\001 \002(\004\022\026\n\016s"
+  "tart_key_hash\030\002 \002(\004\022\024\n\014end_key_hash\030\003 \002("
+  "\004\022\022\n\nbyte_count\030\004 \002(\004\022\024\n\014object_count\030\005 "
+  "\002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_MasterRecoveryInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_MasterRecoveryInfo_2eproto = {
+    false, false, 323, descriptor_table_protodef_MasterRecoveryInfo_2eproto,
+    "MasterRecoveryInfo.proto",
+    &descriptor_table_MasterRecoveryInfo_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_MasterRecoveryInfo_2eproto::offsets,
+    file_level_metadata_MasterRecoveryInfo_2eproto, file_level_enum_descriptors_MasterRecoveryInfo_2eproto,
+    file_level_service_descriptors_MasterRecoveryInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_MasterRecoveryInfo_2eproto_getter() {
+  return &descriptor_table_MasterRecoveryInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_MasterRecoveryInfo_2eproto(&descriptor_table_MasterRecoveryInfo_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class MasterRecoveryInfo_TabletStats::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MasterRecoveryInfo_TabletStats>()._impl_._has_bits_);
+  static void set_has_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_start_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_end_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_byte_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_object_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+MasterRecoveryInfo_TabletStats::MasterRecoveryInfo_TabletStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+}
+MasterRecoveryInfo_TabletStats::MasterRecoveryInfo_TabletStats(const MasterRecoveryInfo_TabletStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MasterRecoveryInfo_TabletStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_id_){}
+    , decltype(_impl_.start_key_hash_){}
+    , decltype(_impl_.end_key_hash_){}
+    , decltype(_impl_.byte_count_){}
+    , decltype(_impl_.object_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.table_id_, &from._impl_.table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.object_count_) -
+    reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.object_count_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+}
+
+inline void MasterRecoveryInfo_TabletStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_id_){uint64_t{0u}}
+    , decltype(_impl_.start_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.end_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.byte_count_){uint64_t{0u}}
+    , decltype(_impl_.object_count_){uint64_t{0u}}
+  };
+}
+
+MasterRecoveryInfo_TabletStats::~MasterRecoveryInfo_TabletStats() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MasterRecoveryInfo_TabletStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MasterRecoveryInfo_TabletStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MasterRecoveryInfo_TabletStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.object_count_) -
+        reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.object_count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MasterRecoveryInfo_TabletStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 table_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_table_id(&has_bits);
+          _impl_.table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 start_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_start_key_hash(&has_bits);
+          _impl_.start_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end_key_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end_key_hash(&has_bits);
+          _impl_.end_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 byte_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_byte_count(&has_bits);
+          _impl_.byte_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 object_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_object_count(&has_bits);
+          _impl_.object_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MasterRecoveryInfo_TabletStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 table_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_table_id(), target);
+  }
+
+  // required uint64 start_key_hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_start_key_hash(), target);
+  }
+
+  // required uint64 end_key_hash = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end_key_hash(), target);
+  }
+
+  // required uint64 byte_count = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_byte_count(), target);
+  }
+
+  // required uint64 object_count = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_object_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  return target;
+}
+
+size_t MasterRecoveryInfo_TabletStats::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  size_t total_size = 0;
+
+  if (_internal_has_table_id()) {
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+  }
+
+  if (_internal_has_start_key_hash()) {
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+  }
+
+  if (_internal_has_end_key_hash()) {
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+  }
+
+  if (_internal_has_byte_count()) {
+    // required uint64 byte_count = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_byte_count());
+  }
+
+  if (_internal_has_object_count()) {
+    // required uint64 object_count = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_object_count());
+  }
+
+  return total_size;
+}
+size_t MasterRecoveryInfo_TabletStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+
+    // required uint64 byte_count = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_byte_count());
+
+    // required uint64 object_count = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_object_count());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MasterRecoveryInfo_TabletStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MasterRecoveryInfo_TabletStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MasterRecoveryInfo_TabletStats::GetClassData() const { return &_class_data_; }
+
+
+void MasterRecoveryInfo_TabletStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MasterRecoveryInfo_TabletStats*>(&to_msg);
+  auto& from = static_cast<const MasterRecoveryInfo_TabletStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.table_id_ = from._impl_.table_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.start_key_hash_ = from._impl_.start_key_hash_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.end_key_hash_ = from._impl_.end_key_hash_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.byte_count_ = from._impl_.byte_count_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.object_count_ = from._impl_.object_count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MasterRecoveryInfo_TabletStats::CopyFrom(const MasterRecoveryInfo_TabletStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MasterRecoveryInfo_TabletStats::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MasterRecoveryInfo_TabletStats::InternalSwap(MasterRecoveryInfo_TabletStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MasterRecoveryInfo_TabletStats, _impl_.object_count_)
+      + sizeof(MasterRecoveryInfo_TabletStats::_impl_.object_count_)
+      - PROTOBUF_FIELD_OFFSET(MasterRecoveryInfo_TabletStats, _impl_.table_id_)>(
+          reinterpret_cast<char*>(&_impl_.table_id_),
+          reinterpret_cast<char*>(&other->_impl_.table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MasterRecoveryInfo_TabletStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MasterRecoveryInfo_2eproto_getter, &descriptor_table_MasterRecoveryInfo_2eproto_once,
+      file_level_metadata_MasterRecoveryInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class MasterRecoveryInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MasterRecoveryInfo>()._impl_._has_bits_);
+  static void set_has_min_open_segment_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_min_open_segment_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+MasterRecoveryInfo::MasterRecoveryInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+}
+MasterRecoveryInfo::MasterRecoveryInfo(const MasterRecoveryInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MasterRecoveryInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tablet_stats_){from._impl_.tablet_stats_}
+    , decltype(_impl_.min_open_segment_id_){}
+    , decltype(_impl_.min_open_segment_epoch_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_open_segment_id_, &from._impl_.min_open_segment_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.min_open_segment_epoch_) -
+    reinterpret_cast<char*>(&_impl_.min_open_segment_id_)) + sizeof(_impl_.min_open_segment_epoch_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+}
+
+inline void MasterRecoveryInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tablet_stats_){arena}
+    , decltype(_impl_.min_open_segment_id_){uint64_t{0u}}
+    , decltype(_impl_.min_open_segment_epoch_){uint64_t{0u}}
+  };
+}
+
+MasterRecoveryInfo::~MasterRecoveryInfo() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MasterRecoveryInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tablet_stats_.~RepeatedPtrField();
+}
+
+void MasterRecoveryInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MasterRecoveryInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tablet_stats_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.min_open_segment_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.min_open_segment_epoch_) -
+        reinterpret_cast<char*>(&_impl_.min_open_segment_id_)) + sizeof(_impl_.min_open_segment_epoch_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MasterRecoveryInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 min_open_segment_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_min_open_segment_id(&has_bits);
+          _impl_.min_open_segment_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 min_open_segment_epoch = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_min_open_segment_epoch(&has_bits);
+          _impl_.min_open_segment_epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats tablet_stats = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tablet_stats(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MasterRecoveryInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 min_open_segment_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_min_open_segment_id(), target);
+  }
+
+  // required uint64 min_open_segment_epoch = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_min_open_segment_epoch(), target);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats tablet_stats = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tablet_stats_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tablet_stats(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  return target;
+}
+
+size_t MasterRecoveryInfo::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  size_t total_size = 0;
+
+  if (_internal_has_min_open_segment_id()) {
+    // required uint64 min_open_segment_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_open_segment_id());
+  }
+
+  if (_internal_has_min_open_segment_epoch()) {
+    // required uint64 min_open_segment_epoch = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_open_segment_epoch());
+  }
+
+  return total_size;
+}
+size_t MasterRecoveryInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 min_open_segment_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_open_segment_id());
+
+    // required uint64 min_open_segment_epoch = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_open_segment_epoch());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats tablet_stats = 3;
+  total_size += 1UL * this->_internal_tablet_stats_size();
+  for (const auto& msg : this->_impl_.tablet_stats_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MasterRecoveryInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MasterRecoveryInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MasterRecoveryInfo::GetClassData() const { return &_class_data_; }
+
+
+void MasterRecoveryInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MasterRecoveryInfo*>(&to_msg);
+  auto& from = static_cast<const MasterRecoveryInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tablet_stats_.MergeFrom(from._impl_.tablet_stats_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.min_open_segment_id_ = from._impl_.min_open_segment_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.min_open_segment_epoch_ = from._impl_.min_open_segment_epoch_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MasterRecoveryInfo::CopyFrom(const MasterRecoveryInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MasterRecoveryInfo::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tablet_stats_))
+    return false;
+  return true;
+}
+
+void MasterRecoveryInfo::InternalSwap(MasterRecoveryInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.tablet_stats_.InternalSwap(&other->_impl_.tablet_stats_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MasterRecoveryInfo, _impl_.min_open_segment_epoch_)
+      + sizeof(MasterRecoveryInfo::_impl_.min_open_segment_epoch_)
+      - PROTOBUF_FIELD_OFFSET(MasterRecoveryInfo, _impl_.min_open_segment_id_)>(
+          reinterpret_cast<char*>(&_impl_.min_open_segment_id_),
+          reinterpret_cast<char*>(&other->_impl_.min_open_segment_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MasterRecoveryInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MasterRecoveryInfo_2eproto_getter, &descriptor_table_MasterRecoveryInfo_2eproto_once,
+      file_level_metadata_MasterRecoveryInfo_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::MasterRecoveryInfo*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::MasterRecoveryInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::MasterRecoveryInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,753 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MasterRecoveryInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_MasterRecoveryInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_MasterRecoveryInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_MasterRecoveryInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_MasterRecoveryInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_MasterRecoveryInfo_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class MasterRecoveryInfo;
+struct MasterRecoveryInfoDefaultTypeInternal;
+extern MasterRecoveryInfoDefaultTypeInternal _MasterRecoveryInfo_default_instance_;
+class MasterRecoveryInfo_TabletStats;
+struct MasterRecoveryInfo_TabletStatsDefaultTypeInternal;
+extern MasterRecoveryInfo_TabletStatsDefaultTypeInternal _MasterRecoveryInfo_TabletStats_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::MasterRecoveryInfo* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::MasterRecoveryInfo>(Arena*);
+template<> ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class MasterRecoveryInfo_TabletStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats) */ {
+ public:
+  inline MasterRecoveryInfo_TabletStats() : MasterRecoveryInfo_TabletStats(nullptr) {}
+  ~MasterRecoveryInfo_TabletStats() override;
+  explicit PROTOBUF_CONSTEXPR MasterRecoveryInfo_TabletStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MasterRecoveryInfo_TabletStats(const MasterRecoveryInfo_TabletStats& from);
+  MasterRecoveryInfo_TabletStats(MasterRecoveryInfo_TabletStats&& from) noexcept
+    : MasterRecoveryInfo_TabletStats() {
+    *this = ::std::move(from);
+  }
+
+  inline MasterRecoveryInfo_TabletStats& operator=(const MasterRecoveryInfo_TabletStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MasterRecoveryInfo_TabletStats& operator=(MasterRecoveryInfo_TabletStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MasterRecoveryInfo_TabletStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MasterRecoveryInfo_TabletStats* internal_default_instance() {
+    return reinterpret_cast<const MasterRecoveryInfo_TabletStats*>(
+               &_MasterRecoveryInfo_TabletStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MasterRecoveryInfo_TabletStats& a, MasterRecoveryInfo_TabletStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MasterRecoveryInfo_TabletStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MasterRecoveryInfo_TabletStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MasterRecoveryInfo_TabletStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MasterRecoveryInfo_TabletStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MasterRecoveryInfo_TabletStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MasterRecoveryInfo_TabletStats& from) {
+    MasterRecoveryInfo_TabletStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MasterRecoveryInfo_TabletStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats";
+  }
+  protected:
+  explicit MasterRecoveryInfo_TabletStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableIdFieldNumber = 1,
+    kStartKeyHashFieldNumber = 2,
+    kEndKeyHashFieldNumber = 3,
+    kByteCountFieldNumber = 4,
+    kObjectCountFieldNumber = 5,
+  };
+  // required uint64 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 2;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 3;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // required uint64 byte_count = 4;
+  bool has_byte_count() const;
+  private:
+  bool _internal_has_byte_count() const;
+  public:
+  void clear_byte_count();
+  uint64_t byte_count() const;
+  void set_byte_count(uint64_t value);
+  private:
+  uint64_t _internal_byte_count() const;
+  void _internal_set_byte_count(uint64_t value);
+  public:
+
+  // required uint64 object_count = 5;
+  bool has_object_count() const;
+  private:
+  bool _internal_has_object_count() const;
+  public:
+  void clear_object_count();
+  uint64_t object_count() const;
+  void set_object_count(uint64_t value);
+  private:
+  uint64_t _internal_object_count() const;
+  void _internal_set_object_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t table_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t byte_count_;
+    uint64_t object_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MasterRecoveryInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MasterRecoveryInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.MasterRecoveryInfo) */ {
+ public:
+  inline MasterRecoveryInfo() : MasterRecoveryInfo(nullptr) {}
+  ~MasterRecoveryInfo() override;
+  explicit PROTOBUF_CONSTEXPR MasterRecoveryInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MasterRecoveryInfo(const MasterRecoveryInfo& from);
+  MasterRecoveryInfo(MasterRecoveryInfo&& from) noexcept
+    : MasterRecoveryInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline MasterRecoveryInfo& operator=(const MasterRecoveryInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MasterRecoveryInfo& operator=(MasterRecoveryInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MasterRecoveryInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MasterRecoveryInfo* internal_default_instance() {
+    return reinterpret_cast<const MasterRecoveryInfo*>(
+               &_MasterRecoveryInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MasterRecoveryInfo& a, MasterRecoveryInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MasterRecoveryInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MasterRecoveryInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MasterRecoveryInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MasterRecoveryInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MasterRecoveryInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MasterRecoveryInfo& from) {
+    MasterRecoveryInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MasterRecoveryInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.MasterRecoveryInfo";
+  }
+  protected:
+  explicit MasterRecoveryInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MasterRecoveryInfo_TabletStats TabletStats;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletStatsFieldNumber = 3,
+    kMinOpenSegmentIdFieldNumber = 1,
+    kMinOpenSegmentEpochFieldNumber = 2,
+  };
+  // repeated .RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats tablet_stats = 3;
+  int tablet_stats_size() const;
+  private:
+  int _internal_tablet_stats_size() const;
+  public:
+  void clear_tablet_stats();
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* mutable_tablet_stats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats >*
+      mutable_tablet_stats();
+  private:
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats& _internal_tablet_stats(int index) const;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* _internal_add_tablet_stats();
+  public:
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats& tablet_stats(int index) const;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* add_tablet_stats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats >&
+      tablet_stats() const;
+
+  // required uint64 min_open_segment_id = 1;
+  bool has_min_open_segment_id() const;
+  private:
+  bool _internal_has_min_open_segment_id() const;
+  public:
+  void clear_min_open_segment_id();
+  uint64_t min_open_segment_id() const;
+  void set_min_open_segment_id(uint64_t value);
+  private:
+  uint64_t _internal_min_open_segment_id() const;
+  void _internal_set_min_open_segment_id(uint64_t value);
+  public:
+
+  // required uint64 min_open_segment_epoch = 2;
+  bool has_min_open_segment_epoch() const;
+  private:
+  bool _internal_has_min_open_segment_epoch() const;
+  public:
+  void clear_min_open_segment_epoch();
+  uint64_t min_open_segment_epoch() const;
+  void set_min_open_segment_epoch(uint64_t value);
+  private:
+  uint64_t _internal_min_open_segment_epoch() const;
+  void _internal_set_min_open_segment_epoch(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats > tablet_stats_;
+    uint64_t min_open_segment_id_;
+    uint64_t min_open_segment_epoch_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MasterRecoveryInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MasterRecoveryInfo_TabletStats
+
+// required uint64 table_id = 1;
+inline bool MasterRecoveryInfo_TabletStats::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MasterRecoveryInfo_TabletStats::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void MasterRecoveryInfo_TabletStats::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.table_id)
+  return _internal_table_id();
+}
+inline void MasterRecoveryInfo_TabletStats::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_id_ = value;
+}
+inline void MasterRecoveryInfo_TabletStats::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.table_id)
+}
+
+// required uint64 start_key_hash = 2;
+inline bool MasterRecoveryInfo_TabletStats::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MasterRecoveryInfo_TabletStats::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void MasterRecoveryInfo_TabletStats::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void MasterRecoveryInfo_TabletStats::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.start_key_hash_ = value;
+}
+inline void MasterRecoveryInfo_TabletStats::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.start_key_hash)
+}
+
+// required uint64 end_key_hash = 3;
+inline bool MasterRecoveryInfo_TabletStats::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MasterRecoveryInfo_TabletStats::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void MasterRecoveryInfo_TabletStats::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void MasterRecoveryInfo_TabletStats::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.end_key_hash_ = value;
+}
+inline void MasterRecoveryInfo_TabletStats::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.end_key_hash)
+}
+
+// required uint64 byte_count = 4;
+inline bool MasterRecoveryInfo_TabletStats::_internal_has_byte_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool MasterRecoveryInfo_TabletStats::has_byte_count() const {
+  return _internal_has_byte_count();
+}
+inline void MasterRecoveryInfo_TabletStats::clear_byte_count() {
+  _impl_.byte_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::_internal_byte_count() const {
+  return _impl_.byte_count_;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::byte_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.byte_count)
+  return _internal_byte_count();
+}
+inline void MasterRecoveryInfo_TabletStats::_internal_set_byte_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.byte_count_ = value;
+}
+inline void MasterRecoveryInfo_TabletStats::set_byte_count(uint64_t value) {
+  _internal_set_byte_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.byte_count)
+}
+
+// required uint64 object_count = 5;
+inline bool MasterRecoveryInfo_TabletStats::_internal_has_object_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool MasterRecoveryInfo_TabletStats::has_object_count() const {
+  return _internal_has_object_count();
+}
+inline void MasterRecoveryInfo_TabletStats::clear_object_count() {
+  _impl_.object_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::_internal_object_count() const {
+  return _impl_.object_count_;
+}
+inline uint64_t MasterRecoveryInfo_TabletStats::object_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.object_count)
+  return _internal_object_count();
+}
+inline void MasterRecoveryInfo_TabletStats::_internal_set_object_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.object_count_ = value;
+}
+inline void MasterRecoveryInfo_TabletStats::set_object_count(uint64_t value) {
+  _internal_set_object_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats.object_count)
+}
+
+// -------------------------------------------------------------------
+
+// MasterRecoveryInfo
+
+// required uint64 min_open_segment_id = 1;
+inline bool MasterRecoveryInfo::_internal_has_min_open_segment_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MasterRecoveryInfo::has_min_open_segment_id() const {
+  return _internal_has_min_open_segment_id();
+}
+inline void MasterRecoveryInfo::clear_min_open_segment_id() {
+  _impl_.min_open_segment_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t MasterRecoveryInfo::_internal_min_open_segment_id() const {
+  return _impl_.min_open_segment_id_;
+}
+inline uint64_t MasterRecoveryInfo::min_open_segment_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.min_open_segment_id)
+  return _internal_min_open_segment_id();
+}
+inline void MasterRecoveryInfo::_internal_set_min_open_segment_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_open_segment_id_ = value;
+}
+inline void MasterRecoveryInfo::set_min_open_segment_id(uint64_t value) {
+  _internal_set_min_open_segment_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.MasterRecoveryInfo.min_open_segment_id)
+}
+
+// required uint64 min_open_segment_epoch = 2;
+inline bool MasterRecoveryInfo::_internal_has_min_open_segment_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MasterRecoveryInfo::has_min_open_segment_epoch() const {
+  return _internal_has_min_open_segment_epoch();
+}
+inline void MasterRecoveryInfo::clear_min_open_segment_epoch() {
+  _impl_.min_open_segment_epoch_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t MasterRecoveryInfo::_internal_min_open_segment_epoch() const {
+  return _impl_.min_open_segment_epoch_;
+}
+inline uint64_t MasterRecoveryInfo::min_open_segment_epoch() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.min_open_segment_epoch)
+  return _internal_min_open_segment_epoch();
+}
+inline void MasterRecoveryInfo::_internal_set_min_open_segment_epoch(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.min_open_segment_epoch_ = value;
+}
+inline void MasterRecoveryInfo::set_min_open_segment_epoch(uint64_t value) {
+  _internal_set_min_open_segment_epoch(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.MasterRecoveryInfo.min_open_segment_epoch)
+}
+
+// repeated .RAMCloud.ProtoBuf.MasterRecoveryInfo.TabletStats tablet_stats = 3;
+inline int MasterRecoveryInfo::_internal_tablet_stats_size() const {
+  return _impl_.tablet_stats_.size();
+}
+inline int MasterRecoveryInfo::tablet_stats_size() const {
+  return _internal_tablet_stats_size();
+}
+inline void MasterRecoveryInfo::clear_tablet_stats() {
+  _impl_.tablet_stats_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* MasterRecoveryInfo::mutable_tablet_stats(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.MasterRecoveryInfo.tablet_stats)
+  return _impl_.tablet_stats_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats >*
+MasterRecoveryInfo::mutable_tablet_stats() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.MasterRecoveryInfo.tablet_stats)
+  return &_impl_.tablet_stats_;
+}
+inline const ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats& MasterRecoveryInfo::_internal_tablet_stats(int index) const {
+  return _impl_.tablet_stats_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats& MasterRecoveryInfo::tablet_stats(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.MasterRecoveryInfo.tablet_stats)
+  return _internal_tablet_stats(index);
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* MasterRecoveryInfo::_internal_add_tablet_stats() {
+  return _impl_.tablet_stats_.Add();
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* MasterRecoveryInfo::add_tablet_stats() {
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats* _add = _internal_add_tablet_stats();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.MasterRecoveryInfo.tablet_stats)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::MasterRecoveryInfo_TabletStats >&
+MasterRecoveryInfo::tablet_stats() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.MasterRecoveryInfo.tablet_stats)
+  return _impl_.tablet_stats_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_MasterRecoveryInfo_2eproto
+// RAMCloud pragma [GCCWARN=0]
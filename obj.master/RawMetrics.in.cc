@@ -0,0 +1,1178 @@
+// This file was automatically generated by scripts/rawmetrics.py.
+// Do not edit it.
+namespace RAMCloud {
+RawMetrics::MetricInfo RawMetrics::metricInfo(int i)
+{
+    switch (i) {
+        case 0:
+            return {"coordinator.recoveryCount",
+                    &coordinator.recoveryCount,
+                    false};
+        case 1:
+            return {"coordinator.recoveryTicks",
+                    &coordinator.recoveryTicks,
+                    false};
+        case 2:
+            return {"coordinator.recoveryBuildReplicaMapTicks",
+                    &coordinator.recoveryBuildReplicaMapTicks,
+                    false};
+        case 3:
+            return {"coordinator.recoveryStartTicks",
+                    &coordinator.recoveryStartTicks,
+                    false};
+        case 4:
+            return {"coordinator.recoveryCompleteTicks",
+                    &coordinator.recoveryCompleteTicks,
+                    false};
+        case 5:
+            return {"master.recoveryCount",
+                    &master.recoveryCount,
+                    false};
+        case 6:
+            return {"master.recoveryTicks",
+                    &master.recoveryTicks,
+                    false};
+        case 7:
+            return {"master.replicaManagerTicks",
+                    &master.replicaManagerTicks,
+                    false};
+        case 8:
+            return {"master.segmentAppendTicks",
+                    &master.segmentAppendTicks,
+                    false};
+        case 9:
+            return {"master.segmentAppendCopyTicks",
+                    &master.segmentAppendCopyTicks,
+                    false};
+        case 10:
+            return {"master.segmentReadCount",
+                    &master.segmentReadCount,
+                    false};
+        case 11:
+            return {"master.segmentReadTicks",
+                    &master.segmentReadTicks,
+                    false};
+        case 12:
+            return {"master.segmentReadStallTicks",
+                    &master.segmentReadStallTicks,
+                    false};
+        case 13:
+            return {"master.segmentReadByteCount",
+                    &master.segmentReadByteCount,
+                    false};
+        case 14:
+            return {"master.verifyChecksumTicks",
+                    &master.verifyChecksumTicks,
+                    false};
+        case 15:
+            return {"master.recoverSegmentTicks",
+                    &master.recoverSegmentTicks,
+                    false};
+        case 16:
+            return {"master.backupInRecoverTicks",
+                    &master.backupInRecoverTicks,
+                    false};
+        case 17:
+            return {"master.segmentCloseCount",
+                    &master.segmentCloseCount,
+                    false};
+        case 18:
+            return {"master.recoverySegmentEntryCount",
+                    &master.recoverySegmentEntryCount,
+                    false};
+        case 19:
+            return {"master.recoverySegmentEntryBytes",
+                    &master.recoverySegmentEntryBytes,
+                    false};
+        case 20:
+            return {"master.liveObjectCount",
+                    &master.liveObjectCount,
+                    false};
+        case 21:
+            return {"master.liveObjectBytes",
+                    &master.liveObjectBytes,
+                    false};
+        case 22:
+            return {"master.objectAppendCount",
+                    &master.objectAppendCount,
+                    false};
+        case 23:
+            return {"master.objectDiscardCount",
+                    &master.objectDiscardCount,
+                    false};
+        case 24:
+            return {"master.safeVersionRecoveryCount",
+                    &master.safeVersionRecoveryCount,
+                    false};
+        case 25:
+            return {"master.safeVersionNonRecoveryCount",
+                    &master.safeVersionNonRecoveryCount,
+                    false};
+        case 26:
+            return {"master.tombstoneAppendCount",
+                    &master.tombstoneAppendCount,
+                    false};
+        case 27:
+            return {"master.tombstoneDiscardCount",
+                    &master.tombstoneDiscardCount,
+                    false};
+        case 28:
+            return {"master.logSyncTicks",
+                    &master.logSyncTicks,
+                    false};
+        case 29:
+            return {"master.logSyncBytes",
+                    &master.logSyncBytes,
+                    false};
+        case 30:
+            return {"master.recoveryWillTicks",
+                    &master.recoveryWillTicks,
+                    false};
+        case 31:
+            return {"master.removeTombstoneTicks",
+                    &master.removeTombstoneTicks,
+                    false};
+        case 32:
+            return {"master.replicationTicks",
+                    &master.replicationTicks,
+                    false};
+        case 33:
+            return {"master.replicationBytes",
+                    &master.replicationBytes,
+                    false};
+        case 34:
+            return {"master.replicas",
+                    &master.replicas,
+                    true};
+        case 35:
+            return {"master.backupCloseTicks",
+                    &master.backupCloseTicks,
+                    false};
+        case 36:
+            return {"master.backupCloseCount",
+                    &master.backupCloseCount,
+                    false};
+        case 37:
+            return {"master.logSyncCloseTicks",
+                    &master.logSyncCloseTicks,
+                    false};
+        case 38:
+            return {"master.logSyncCloseCount",
+                    &master.logSyncCloseCount,
+                    false};
+        case 39:
+            return {"master.replicaRecoveries",
+                    &master.replicaRecoveries,
+                    false};
+        case 40:
+            return {"master.openReplicaRecoveries",
+                    &master.openReplicaRecoveries,
+                    false};
+        case 41:
+            return {"master.replicationTasks",
+                    &master.replicationTasks,
+                    true};
+        case 42:
+            return {"master.replicationTransmitCopyTicks",
+                    &master.replicationTransmitCopyTicks,
+                    false};
+        case 43:
+            return {"master.logSyncTransmitCopyTicks",
+                    &master.logSyncTransmitCopyTicks,
+                    false};
+        case 44:
+            return {"master.replayMemoryReadBytes",
+                    &master.replayMemoryReadBytes,
+                    false};
+        case 45:
+            return {"master.replayMemoryWrittenBytes",
+                    &master.replayMemoryWrittenBytes,
+                    false};
+        case 46:
+            return {"master.replicationTransmitActiveTicks",
+                    &master.replicationTransmitActiveTicks,
+                    false};
+        case 47:
+            return {"master.logSyncTransmitActiveTicks",
+                    &master.logSyncTransmitActiveTicks,
+                    false};
+        case 48:
+            return {"master.replicationPostingWriteRpcTicks",
+                    &master.replicationPostingWriteRpcTicks,
+                    false};
+        case 49:
+            return {"master.recoverSegmentPostingWriteRpcTicks",
+                    &master.recoverSegmentPostingWriteRpcTicks,
+                    false};
+        case 50:
+            return {"master.logSyncPostingWriteRpcTicks",
+                    &master.logSyncPostingWriteRpcTicks,
+                    false};
+        case 51:
+            return {"master.replicationWindowStalls",
+                    &master.replicationWindowStalls,
+                    false};
+        case 52:
+            return {"master.replicationWindowDecreases",
+                    &master.replicationWindowDecreases,
+                    false};
+        case 53:
+            return {"master.replicationMaxBackupQueueDepth",
+                    &master.replicationMaxBackupQueueDepth,
+                    true};
+        case 54:
+            return {"master.logSyncBatchCount",
+                    &master.logSyncBatchCount,
+                    false};
+        case 55:
+            return {"master.logSyncBatchRpcs",
+                    &master.logSyncBatchRpcs,
+                    false};
+        case 56:
+            return {"backup.recoveryCount",
+                    &backup.recoveryCount,
+                    false};
+        case 57:
+            return {"backup.recoveryTicks",
+                    &backup.recoveryTicks,
+                    false};
+        case 58:
+            return {"backup.serviceTicks",
+                    &backup.serviceTicks,
+                    false};
+        case 59:
+            return {"backup.readCompletionCount",
+                    &backup.readCompletionCount,
+                    false};
+        case 60:
+            return {"backup.readingDataTicks",
+                    &backup.readingDataTicks,
+                    false};
+        case 61:
+            return {"backup.storageReadCount",
+                    &backup.storageReadCount,
+                    false};
+        case 62:
+            return {"backup.storageReadBytes",
+                    &backup.storageReadBytes,
+                    false};
+        case 63:
+            return {"backup.storageReadTicks",
+                    &backup.storageReadTicks,
+                    false};
+        case 64:
+            return {"backup.writeClearTicks",
+                    &backup.writeClearTicks,
+                    false};
+        case 65:
+            return {"backup.writeCopyBytes",
+                    &backup.writeCopyBytes,
+                    false};
+        case 66:
+            return {"backup.writeCopyTicks",
+                    &backup.writeCopyTicks,
+                    false};
+        case 67:
+            return {"backup.storageWriteCount",
+                    &backup.storageWriteCount,
+                    false};
+        case 68:
+            return {"backup.storageWriteBytes",
+                    &backup.storageWriteBytes,
+                    false};
+        case 69:
+            return {"backup.storageWriteTicks",
+                    &backup.storageWriteTicks,
+                    false};
+        case 70:
+            return {"backup.filterTicks",
+                    &backup.filterTicks,
+                    false};
+        case 71:
+            return {"backup.primaryLoadCount",
+                    &backup.primaryLoadCount,
+                    false};
+        case 72:
+            return {"backup.secondaryLoadCount",
+                    &backup.secondaryLoadCount,
+                    false};
+        case 73:
+            return {"backup.storageType",
+                    &backup.storageType,
+                    false};
+        case 74:
+            return {"backup.uncommittedFramesFreed",
+                    &backup.uncommittedFramesFreed,
+                    false};
+        case 75:
+            return {"rpc.rpc0Count",
+                    &rpc.rpc0Count,
+                    false};
+        case 76:
+            return {"rpc.rpc1Count",
+                    &rpc.rpc1Count,
+                    false};
+        case 77:
+            return {"rpc.rpc2Count",
+                    &rpc.rpc2Count,
+                    false};
+        case 78:
+            return {"rpc.rpc3Count",
+                    &rpc.rpc3Count,
+                    false};
+        case 79:
+            return {"rpc.rpc4Count",
+                    &rpc.rpc4Count,
+                    false};
+        case 80:
+            return {"rpc.rpc5Count",
+                    &rpc.rpc5Count,
+                    false};
+        case 81:
+            return {"rpc.rpc6Count",
+                    &rpc.rpc6Count,
+                    false};
+        case 82:
+            return {"rpc.pingCount",
+                    &rpc.pingCount,
+                    false};
+        case 83:
+            return {"rpc.proxyPingCount",
+                    &rpc.proxyPingCount,
+                    false};
+        case 84:
+            return {"rpc.killCount",
+                    &rpc.killCount,
+                    false};
+        case 85:
+            return {"rpc.createTableCount",
+                    &rpc.createTableCount,
+                    false};
+        case 86:
+            return {"rpc.getTableIdCount",
+                    &rpc.getTableIdCount,
+                    false};
+        case 87:
+            return {"rpc.dropTableCount",
+                    &rpc.dropTableCount,
+                    false};
+        case 88:
+            return {"rpc.readCount",
+                    &rpc.readCount,
+                    false};
+        case 89:
+            return {"rpc.writeCount",
+                    &rpc.writeCount,
+                    false};
+        case 90:
+            return {"rpc.removeCount",
+                    &rpc.removeCount,
+                    false};
+        case 91:
+            return {"rpc.enlistServerCount",
+                    &rpc.enlistServerCount,
+                    false};
+        case 92:
+            return {"rpc.getServerListCount",
+                    &rpc.getServerListCount,
+                    false};
+        case 93:
+            return {"rpc.getTabletMapCount",
+                    &rpc.getTabletMapCount,
+                    false};
+        case 94:
+            return {"rpc.recoverCount",
+                    &rpc.recoverCount,
+                    false};
+        case 95:
+            return {"rpc.hintServerDownCount",
+                    &rpc.hintServerDownCount,
+                    false};
+        case 96:
+            return {"rpc.recoveryMasterFinishedCount",
+                    &rpc.recoveryMasterFinishedCount,
+                    false};
+        case 97:
+            return {"rpc.enumerateCount",
+                    &rpc.enumerateCount,
+                    false};
+        case 98:
+            return {"rpc.setMasterRecoveryInfoCount",
+                    &rpc.setMasterRecoveryInfoCount,
+                    false};
+        case 99:
+            return {"rpc.fillWithTestDataCount",
+                    &rpc.fillWithTestDataCount,
+                    false};
+        case 100:
+            return {"rpc.multiReadCount",
+                    &rpc.multiReadCount,
+                    false};
+        case 101:
+            return {"rpc.getMetricsCount",
+                    &rpc.getMetricsCount,
+                    false};
+        case 102:
+            return {"rpc.rpc27Count",
+                    &rpc.rpc27Count,
+                    false};
+        case 103:
+            return {"rpc.backupFreeCount",
+                    &rpc.backupFreeCount,
+                    false};
+        case 104:
+            return {"rpc.backupGetRecoveryDataCount",
+                    &rpc.backupGetRecoveryDataCount,
+                    false};
+        case 105:
+            return {"rpc.rpc30Count",
+                    &rpc.rpc30Count,
+                    false};
+        case 106:
+            return {"rpc.backupStartReadingDataCount",
+                    &rpc.backupStartReadingDataCount,
+                    false};
+        case 107:
+            return {"rpc.backupWriteCount",
+                    &rpc.backupWriteCount,
+                    false};
+        case 108:
+            return {"rpc.backupRecoveryCompleteCount",
+                    &rpc.backupRecoveryCompleteCount,
+                    false};
+        case 109:
+            return {"rpc.backupQuiesceCount",
+                    &rpc.backupQuiesceCount,
+                    false};
+        case 110:
+            return {"rpc.updateServerListCount",
+                    &rpc.updateServerListCount,
+                    false};
+        case 111:
+            return {"rpc.backupStartPartitionCount",
+                    &rpc.backupStartPartitionCount,
+                    false};
+        case 112:
+            return {"rpc.rpc37Count",
+                    &rpc.rpc37Count,
+                    false};
+        case 113:
+            return {"rpc.rpc38Count",
+                    &rpc.rpc38Count,
+                    false};
+        case 114:
+            return {"rpc.dropTabletOwnershipCount",
+                    &rpc.dropTabletOwnershipCount,
+                    false};
+        case 115:
+            return {"rpc.takeTabletOwnershipCount",
+                    &rpc.takeTabletOwnershipCount,
+                    false};
+        case 116:
+            return {"rpc.backupAssignGroupCount",
+                    &rpc.backupAssignGroupCount,
+                    false};
+        case 117:
+            return {"rpc.getHeadOfLogCount",
+                    &rpc.getHeadOfLogCount,
+                    false};
+        case 118:
+            return {"rpc.incrementRpcCount",
+                    &rpc.incrementRpcCount,
+                    false};
+        case 119:
+            return {"rpc.prepForMigrationCount",
+                    &rpc.prepForMigrationCount,
+                    false};
+        case 120:
+            return {"rpc.receiveMigrationDataCount",
+                    &rpc.receiveMigrationDataCount,
+                    false};
+        case 121:
+            return {"rpc.reassignTabletOwnershipCount",
+                    &rpc.reassignTabletOwnershipCount,
+                    false};
+        case 122:
+            return {"rpc.migrateTabletCount",
+                    &rpc.migrateTabletCount,
+                    false};
+        case 123:
+            return {"rpc.isReplicaNeededCount",
+                    &rpc.isReplicaNeededCount,
+                    false};
+        case 124:
+            return {"rpc.splitTabletCount",
+                    &rpc.splitTabletCount,
+                    false};
+        case 125:
+            return {"rpc.getServerStatisticsCount",
+                    &rpc.getServerStatisticsCount,
+                    false};
+        case 126:
+            return {"rpc.setRuntimeOptionCount",
+                    &rpc.setRuntimeOptionCount,
+                    false};
+        case 127:
+            return {"rpc.getServerConfigCount",
+                    &rpc.getServerConfigCount,
+                    false};
+        case 128:
+            return {"rpc.getLogMetricsCount",
+                    &rpc.getLogMetricsCount,
+                    false};
+        case 129:
+            return {"rpc.multiWriteCount",
+                    &rpc.multiWriteCount,
+                    false};
+        case 130:
+            return {"rpc.verifyMembershipCount",
+                    &rpc.verifyMembershipCount,
+                    false};
+        case 131:
+            return {"rpc.scanCount",
+                    &rpc.scanCount,
+                    false};
+        case 132:
+            return {"rpc.illegalRpcCount",
+                    &rpc.illegalRpcCount,
+                    false};
+        case 133:
+            return {"rpc.rpc0Ticks",
+                    &rpc.rpc0Ticks,
+                    false};
+        case 134:
+            return {"rpc.rpc1Ticks",
+                    &rpc.rpc1Ticks,
+                    false};
+        case 135:
+            return {"rpc.rpc2Ticks",
+                    &rpc.rpc2Ticks,
+                    false};
+        case 136:
+            return {"rpc.rpc3Ticks",
+                    &rpc.rpc3Ticks,
+                    false};
+        case 137:
+            return {"rpc.rpc4Ticks",
+                    &rpc.rpc4Ticks,
+                    false};
+        case 138:
+            return {"rpc.rpc5Ticks",
+                    &rpc.rpc5Ticks,
+                    false};
+        case 139:
+            return {"rpc.rpc6Ticks",
+                    &rpc.rpc6Ticks,
+                    false};
+        case 140:
+            return {"rpc.pingTicks",
+                    &rpc.pingTicks,
+                    false};
+        case 141:
+            return {"rpc.proxyPingTicks",
+                    &rpc.proxyPingTicks,
+                    false};
+        case 142:
+            return {"rpc.killTicks",
+                    &rpc.killTicks,
+                    false};
+        case 143:
+            return {"rpc.createTableTicks",
+                    &rpc.createTableTicks,
+                    false};
+        case 144:
+            return {"rpc.getTableIdTicks",
+                    &rpc.getTableIdTicks,
+                    false};
+        case 145:
+            return {"rpc.dropTableTicks",
+                    &rpc.dropTableTicks,
+                    false};
+        case 146:
+            return {"rpc.readTicks",
+                    &rpc.readTicks,
+                    false};
+        case 147:
+            return {"rpc.writeTicks",
+                    &rpc.writeTicks,
+                    false};
+        case 148:
+            return {"rpc.removeTicks",
+                    &rpc.removeTicks,
+                    false};
+        case 149:
+            return {"rpc.enlistServerTicks",
+                    &rpc.enlistServerTicks,
+                    false};
+        case 150:
+            return {"rpc.getServerListTicks",
+                    &rpc.getServerListTicks,
+                    false};
+        case 151:
+            return {"rpc.getTabletMapTicks",
+                    &rpc.getTabletMapTicks,
+                    false};
+        case 152:
+            return {"rpc.recoverTicks",
+                    &rpc.recoverTicks,
+                    false};
+        case 153:
+            return {"rpc.hintServerDownTicks",
+                    &rpc.hintServerDownTicks,
+                    false};
+        case 154:
+            return {"rpc.recoveryMasterFinishedTicks",
+                    &rpc.recoveryMasterFinishedTicks,
+                    false};
+        case 155:
+            return {"rpc.enumerateTicks",
+                    &rpc.enumerateTicks,
+                    false};
+        case 156:
+            return {"rpc.setMasterRecoveryInfoTicks",
+                    &rpc.setMasterRecoveryInfoTicks,
+                    false};
+        case 157:
+            return {"rpc.fillWithTestDataTicks",
+                    &rpc.fillWithTestDataTicks,
+                    false};
+        case 158:
+            return {"rpc.multiReadTicks",
+                    &rpc.multiReadTicks,
+                    false};
+        case 159:
+            return {"rpc.getMetricsTicks",
+                    &rpc.getMetricsTicks,
+                    false};
+        case 160:
+            return {"rpc.rpc27Ticks",
+                    &rpc.rpc27Ticks,
+                    false};
+        case 161:
+            return {"rpc.backupFreeTicks",
+                    &rpc.backupFreeTicks,
+                    false};
+        case 162:
+            return {"rpc.backupGetRecoveryDataTicks",
+                    &rpc.backupGetRecoveryDataTicks,
+                    false};
+        case 163:
+            return {"rpc.rpc30Ticks",
+                    &rpc.rpc30Ticks,
+                    false};
+        case 164:
+            return {"rpc.backupStartReadingDataTicks",
+                    &rpc.backupStartReadingDataTicks,
+                    false};
+        case 165:
+            return {"rpc.backupWriteTicks",
+                    &rpc.backupWriteTicks,
+                    false};
+        case 166:
+            return {"rpc.backupRecoveryCompleteTicks",
+                    &rpc.backupRecoveryCompleteTicks,
+                    false};
+        case 167:
+            return {"rpc.backupQuiesceTicks",
+                    &rpc.backupQuiesceTicks,
+                    false};
+        case 168:
+            return {"rpc.setServerListTicks",
+                    &rpc.setServerListTicks,
+                    false};
+        case 169:
+            return {"rpc.updateServerListTicks",
+                    &rpc.updateServerListTicks,
+                    false};
+        case 170:
+            return {"rpc.backupStartPartition",
+                    &rpc.backupStartPartition,
+                    false};
+        case 171:
+            return {"rpc.rpc37Ticks",
+                    &rpc.rpc37Ticks,
+                    false};
+        case 172:
+            return {"rpc.rpc38Ticks",
+                    &rpc.rpc38Ticks,
+                    false};
+        case 173:
+            return {"rpc.dropTabletOwnershipTicks",
+                    &rpc.dropTabletOwnershipTicks,
+                    false};
+        case 174:
+            return {"rpc.takeTabletOwnershipTicks",
+                    &rpc.takeTabletOwnershipTicks,
+                    false};
+        case 175:
+            return {"rpc.backupAssignGroupTicks",
+                    &rpc.backupAssignGroupTicks,
+                    false};
+        case 176:
+            return {"rpc.getHeadOfLogTicks",
+                    &rpc.getHeadOfLogTicks,
+                    false};
+        case 177:
+            return {"rpc.incrementTicks",
+                    &rpc.incrementTicks,
+                    false};
+        case 178:
+            return {"rpc.prepForMigrationTicks",
+                    &rpc.prepForMigrationTicks,
+                    false};
+        case 179:
+            return {"rpc.receiveMigrationDataTicks",
+                    &rpc.receiveMigrationDataTicks,
+                    false};
+        case 180:
+            return {"rpc.reassignTabletOwnershipTicks",
+                    &rpc.reassignTabletOwnershipTicks,
+                    false};
+        case 181:
+            return {"rpc.migrateTabletTicks",
+                    &rpc.migrateTabletTicks,
+                    false};
+        case 182:
+            return {"rpc.isReplicaNeededTicks",
+                    &rpc.isReplicaNeededTicks,
+                    false};
+        case 183:
+            return {"rpc.splitTabletTicks",
+                    &rpc.splitTabletTicks,
+                    false};
+        case 184:
+            return {"rpc.getServerStatisticsTicks",
+                    &rpc.getServerStatisticsTicks,
+                    false};
+        case 185:
+            return {"rpc.setRuntimeOptionTicks",
+                    &rpc.setRuntimeOptionTicks,
+                    false};
+        case 186:
+            return {"rpc.getServerConfigTicks",
+                    &rpc.getServerConfigTicks,
+                    false};
+        case 187:
+            return {"rpc.getLogMetricsTicks",
+                    &rpc.getLogMetricsTicks,
+                    false};
+        case 188:
+            return {"rpc.multiWriteTicks",
+                    &rpc.multiWriteTicks,
+                    false};
+        case 189:
+            return {"rpc.verifyMembershipTicks",
+                    &rpc.verifyMembershipTicks,
+                    false};
+        case 190:
+            return {"rpc.scanTicks",
+                    &rpc.scanTicks,
+                    false};
+        case 191:
+            return {"rpc.illegalRpcTicks",
+                    &rpc.illegalRpcTicks,
+                    false};
+        case 192:
+            return {"rpc.rpc0WaitTicks",
+                    &rpc.rpc0WaitTicks,
+                    false};
+        case 193:
+            return {"rpc.rpc1WaitTicks",
+                    &rpc.rpc1WaitTicks,
+                    false};
+        case 194:
+            return {"rpc.rpc2WaitTicks",
+                    &rpc.rpc2WaitTicks,
+                    false};
+        case 195:
+            return {"rpc.rpc3WaitTicks",
+                    &rpc.rpc3WaitTicks,
+                    false};
+        case 196:
+            return {"rpc.rpc4WaitTicks",
+                    &rpc.rpc4WaitTicks,
+                    false};
+        case 197:
+            return {"rpc.rpc5WaitTicks",
+                    &rpc.rpc5WaitTicks,
+                    false};
+        case 198:
+            return {"rpc.rpc6WaitTicks",
+                    &rpc.rpc6WaitTicks,
+                    false};
+        case 199:
+            return {"rpc.pingWaitTicks",
+                    &rpc.pingWaitTicks,
+                    false};
+        case 200:
+            return {"rpc.proxyPingWaitTicks",
+                    &rpc.proxyPingWaitTicks,
+                    false};
+        case 201:
+            return {"rpc.killWaitTicks",
+                    &rpc.killWaitTicks,
+                    false};
+        case 202:
+            return {"rpc.createTableWaitTicks",
+                    &rpc.createTableWaitTicks,
+                    false};
+        case 203:
+            return {"rpc.getTableIdWaitTicks",
+                    &rpc.getTableIdWaitTicks,
+                    false};
+        case 204:
+            return {"rpc.dropTableWaitTicks",
+                    &rpc.dropTableWaitTicks,
+                    false};
+        case 205:
+            return {"rpc.readWaitTicks",
+                    &rpc.readWaitTicks,
+                    false};
+        case 206:
+            return {"rpc.writeWaitTicks",
+                    &rpc.writeWaitTicks,
+                    false};
+        case 207:
+            return {"rpc.removeWaitTicks",
+                    &rpc.removeWaitTicks,
+                    false};
+        case 208:
+            return {"rpc.enlistServerWaitTicks",
+                    &rpc.enlistServerWaitTicks,
+                    false};
+        case 209:
+            return {"rpc.getServerListWaitTicks",
+                    &rpc.getServerListWaitTicks,
+                    false};
+        case 210:
+            return {"rpc.getTabletMapWaitTicks",
+                    &rpc.getTabletMapWaitTicks,
+                    false};
+        case 211:
+            return {"rpc.recoverWaitTicks",
+                    &rpc.recoverWaitTicks,
+                    false};
+        case 212:
+            return {"rpc.hintServerDownWaitTicks",
+                    &rpc.hintServerDownWaitTicks,
+                    false};
+        case 213:
+            return {"rpc.recoveryMasterFinishedWaitTicks",
+                    &rpc.recoveryMasterFinishedWaitTicks,
+                    false};
+        case 214:
+            return {"rpc.enumerateWaitTicks",
+                    &rpc.enumerateWaitTicks,
+                    false};
+        case 215:
+            return {"rpc.setMasterRecoveryInfoWaitTicks",
+                    &rpc.setMasterRecoveryInfoWaitTicks,
+                    false};
+        case 216:
+            return {"rpc.fillWithTestDataWaitTicks",
+                    &rpc.fillWithTestDataWaitTicks,
+                    false};
+        case 217:
+            return {"rpc.multiReadWaitTicks",
+                    &rpc.multiReadWaitTicks,
+                    false};
+        case 218:
+            return {"rpc.getMetricsWaitTicks",
+                    &rpc.getMetricsWaitTicks,
+                    false};
+        case 219:
+            return {"rpc.rpc27WaitTicks",
+                    &rpc.rpc27WaitTicks,
+                    false};
+        case 220:
+            return {"rpc.backupFreeWaitTicks",
+                    &rpc.backupFreeWaitTicks,
+                    false};
+        case 221:
+            return {"rpc.backupGetRecoveryDataWaitTicks",
+                    &rpc.backupGetRecoveryDataWaitTicks,
+                    false};
+        case 222:
+            return {"rpc.rpc30WaitTicks",
+                    &rpc.rpc30WaitTicks,
+                    false};
+        case 223:
+            return {"rpc.backupStartReadingDataWaitTicks",
+                    &rpc.backupStartReadingDataWaitTicks,
+                    false};
+        case 224:
+            return {"rpc.backupWriteWaitTicks",
+                    &rpc.backupWriteWaitTicks,
+                    false};
+        case 225:
+            return {"rpc.backupRecoveryCompleteWaitTicks",
+                    &rpc.backupRecoveryCompleteWaitTicks,
+                    false};
+        case 226:
+            return {"rpc.backupQuiesceWaitTicks",
+                    &rpc.backupQuiesceWaitTicks,
+                    false};
+        case 227:
+            return {"rpc.setServerListWaitTicks",
+                    &rpc.setServerListWaitTicks,
+                    false};
+        case 228:
+            return {"rpc.updateServerListWaitTicks",
+                    &rpc.updateServerListWaitTicks,
+                    false};
+        case 229:
+            return {"rpc.rpc37WaitTicks",
+                    &rpc.rpc37WaitTicks,
+                    false};
+        case 230:
+            return {"rpc.rpc38WaitTicks",
+                    &rpc.rpc38WaitTicks,
+                    false};
+        case 231:
+            return {"rpc.dropTabletOwnershipWaitTicks",
+                    &rpc.dropTabletOwnershipWaitTicks,
+                    false};
+        case 232:
+            return {"rpc.takeTabletOwnershipWaitTicks",
+                    &rpc.takeTabletOwnershipWaitTicks,
+                    false};
+        case 233:
+            return {"rpc.backupAssignGroupWaitTicks",
+                    &rpc.backupAssignGroupWaitTicks,
+                    false};
+        case 234:
+            return {"rpc.getHeadOfLogWaitTicks",
+                    &rpc.getHeadOfLogWaitTicks,
+                    false};
+        case 235:
+            return {"rpc.incrementWaitTicks",
+                    &rpc.incrementWaitTicks,
+                    false};
+        case 236:
+            return {"rpc.prepForMigrationWaitTicks",
+                    &rpc.prepForMigrationWaitTicks,
+                    false};
+        case 237:
+            return {"rpc.receiveMigrationDataWaitTicks",
+                    &rpc.receiveMigrationDataWaitTicks,
+                    false};
+        case 238:
+            return {"rpc.reassignTabletOwnershipWaitTicks",
+                    &rpc.reassignTabletOwnershipWaitTicks,
+                    false};
+        case 239:
+            return {"rpc.migrateTabletWaitTicks",
+                    &rpc.migrateTabletWaitTicks,
+                    false};
+        case 240:
+            return {"rpc.isReplicaNeededWaitTicks",
+                    &rpc.isReplicaNeededWaitTicks,
+                    false};
+        case 241:
+            return {"rpc.splitTabletWaitTicks",
+                    &rpc.splitTabletWaitTicks,
+                    false};
+        case 242:
+            return {"rpc.getServerStatisticsWaitTicks",
+                    &rpc.getServerStatisticsWaitTicks,
+                    false};
+        case 243:
+            return {"rpc.setRuntimeOptionWaitTicks",
+                    &rpc.setRuntimeOptionWaitTicks,
+                    false};
+        case 244:
+            return {"rpc.getServerConfigWaitTicks",
+                    &rpc.getServerConfigWaitTicks,
+                    false};
+        case 245:
+            return {"rpc.getLogMetricsWaitTicks",
+                    &rpc.getLogMetricsWaitTicks,
+                    false};
+        case 246:
+            return {"rpc.multiWriteWaitTicks",
+                    &rpc.multiWriteWaitTicks,
+                    false};
+        case 247:
+            return {"rpc.verifyMembershipWaitTicks",
+                    &rpc.verifyMembershipWaitTicks,
+                    false};
+        case 248:
+            return {"rpc.scanWaitTicks",
+                    &rpc.scanWaitTicks,
+                    false};
+        case 249:
+            return {"rpc.illegalRpcWaitTicks",
+                    &rpc.illegalRpcWaitTicks,
+                    false};
+        case 250:
+            return {"transport.transmit.ticks",
+                    &transport.transmit.ticks,
+                    false};
+        case 251:
+            return {"transport.transmit.messageCount",
+                    &transport.transmit.messageCount,
+                    false};
+        case 252:
+            return {"transport.transmit.packetCount",
+                    &transport.transmit.packetCount,
+                    false};
+        case 253:
+            return {"transport.transmit.iovecCount",
+                    &transport.transmit.iovecCount,
+                    false};
+        case 254:
+            return {"transport.transmit.byteCount",
+                    &transport.transmit.byteCount,
+                    false};
+        case 255:
+            return {"transport.transmit.copyTicks",
+                    &transport.transmit.copyTicks,
+                    false};
+        case 256:
+            return {"transport.transmit.dmaTicks",
+                    &transport.transmit.dmaTicks,
+                    false};
+        case 257:
+            return {"transport.receive.ticks",
+                    &transport.receive.ticks,
+                    false};
+        case 258:
+            return {"transport.receive.messageCount",
+                    &transport.receive.messageCount,
+                    false};
+        case 259:
+            return {"transport.receive.packetCount",
+                    &transport.receive.packetCount,
+                    false};
+        case 260:
+            return {"transport.receive.iovecCount",
+                    &transport.receive.iovecCount,
+                    false};
+        case 261:
+            return {"transport.receive.byteCount",
+                    &transport.receive.byteCount,
+                    false};
+        case 262:
+            return {"transport.infiniband.transmitActiveTicks",
+                    &transport.infiniband.transmitActiveTicks,
+                    false};
+        case 263:
+            return {"transport.sessionOpenTicks",
+                    &transport.sessionOpenTicks,
+                    false};
+        case 264:
+            return {"transport.sessionOpenCount",
+                    &transport.sessionOpenCount,
+                    false};
+        case 265:
+            return {"transport.sessionOpenSquaredTicks",
+                    &transport.sessionOpenSquaredTicks,
+                    false};
+        case 266:
+            return {"transport.retrySessionOpenCount",
+                    &transport.retrySessionOpenCount,
+                    false};
+        case 267:
+            return {"transport.clientRpcsActiveTicks",
+                    &transport.clientRpcsActiveTicks,
+                    false};
+        case 268:
+            return {"temp.ticks0",
+                    &temp.ticks0,
+                    false};
+        case 269:
+            return {"temp.count0",
+                    &temp.count0,
+                    false};
+        case 270:
+            return {"temp.ticks1",
+                    &temp.ticks1,
+                    false};
+        case 271:
+            return {"temp.count1",
+                    &temp.count1,
+                    false};
+        case 272:
+            return {"temp.ticks2",
+                    &temp.ticks2,
+                    false};
+        case 273:
+            return {"temp.count2",
+                    &temp.count2,
+                    false};
+        case 274:
+            return {"temp.ticks3",
+                    &temp.ticks3,
+                    false};
+        case 275:
+            return {"temp.count3",
+                    &temp.count3,
+                    false};
+        case 276:
+            return {"temp.ticks4",
+                    &temp.ticks4,
+                    false};
+        case 277:
+            return {"temp.count4",
+                    &temp.count4,
+                    false};
+        case 278:
+            return {"temp.ticks5",
+                    &temp.ticks5,
+                    false};
+        case 279:
+            return {"temp.count5",
+                    &temp.count5,
+                    false};
+        case 280:
+            return {"temp.ticks6",
+                    &temp.ticks6,
+                    false};
+        case 281:
+            return {"temp.count6",
+                    &temp.count6,
+                    false};
+        case 282:
+            return {"temp.ticks7",
+                    &temp.ticks7,
+                    false};
+        case 283:
+            return {"temp.count7",
+                    &temp.count7,
+                    false};
+        case 284:
+            return {"temp.ticks8",
+                    &temp.ticks8,
+                    false};
+        case 285:
+            return {"temp.count8",
+                    &temp.count8,
+                    false};
+        case 286:
+            return {"temp.ticks9",
+                    &temp.ticks9,
+                    false};
+        case 287:
+            return {"temp.count9",
+                    &temp.count9,
+                    false};
+        case 288:
+            return {"serverId",
+                    &serverId,
+                    true};
+        case 289:
+            return {"pid",
+                    &pid,
+                    true};
+        case 290:
+            return {"clockFrequency",
+                    &clockFrequency,
+                    true};
+        case 291:
+            return {"segmentSize",
+                    &segmentSize,
+                    true};
+    }
+    return {NULL, NULL, false};
+}
+} // namespace RAMCloud
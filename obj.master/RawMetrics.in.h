@@ -0,0 +1,926 @@
+// This file was automatically generated by scripts/rawmetrics.py.
+// Do not edit it.
+/// server metrics
+    RawMetrics()
+        : coordinator()
+        , master()
+        , backup()
+        , rpc()
+        , transport()
+        , temp()
+        , serverId(0)
+        , pid(0)
+        , clockFrequency(0)
+        , segmentSize(0) {}
+    /// metrics for coordinator
+    struct Coordinator {
+        Coordinator()
+            : recoveryCount(0)
+            , recoveryTicks(0)
+            , recoveryBuildReplicaMapTicks(0)
+            , recoveryStartTicks(0)
+            , recoveryCompleteTicks(0) {}
+        /// number of recoveries in which this coordinator participated
+        RawMetric recoveryCount;
+        /// elapsed time during recoveries
+        RawMetric recoveryTicks;
+        /// time contacting backups and finding replicas for crashed master
+        RawMetric recoveryBuildReplicaMapTicks;
+        /// time in Recovery::start
+        RawMetric recoveryStartTicks;
+        /// time sending recovery complete RPCs to backups
+        RawMetric recoveryCompleteTicks;
+    } coordinator;
+    /// metrics for masters
+    struct Master {
+        Master()
+            : recoveryCount(0)
+            , recoveryTicks(0)
+            , replicaManagerTicks(0)
+            , segmentAppendTicks(0)
+            , segmentAppendCopyTicks(0)
+            , segmentReadCount(0)
+            , segmentReadTicks(0)
+            , segmentReadStallTicks(0)
+            , segmentReadByteCount(0)
+            , verifyChecksumTicks(0)
+            , recoverSegmentTicks(0)
+            , backupInRecoverTicks(0)
+            , segmentCloseCount(0)
+            , recoverySegmentEntryCount(0)
+            , recoverySegmentEntryBytes(0)
+            , liveObjectCount(0)
+            , liveObjectBytes(0)
+            , objectAppendCount(0)
+            , objectDiscardCount(0)
+            , safeVersionRecoveryCount(0)
+            , safeVersionNonRecoveryCount(0)
+            , tombstoneAppendCount(0)
+            , tombstoneDiscardCount(0)
+            , logSyncTicks(0)
+            , logSyncBytes(0)
+            , recoveryWillTicks(0)
+            , removeTombstoneTicks(0)
+            , replicationTicks(0)
+            , replicationBytes(0)
+            , replicas(0)
+            , backupCloseTicks(0)
+            , backupCloseCount(0)
+            , logSyncCloseTicks(0)
+            , logSyncCloseCount(0)
+            , replicaRecoveries(0)
+            , openReplicaRecoveries(0)
+            , replicationTasks(0)
+            , replicationTransmitCopyTicks(0)
+            , logSyncTransmitCopyTicks(0)
+            , replayMemoryReadBytes(0)
+            , replayMemoryWrittenBytes(0)
+            , replicationTransmitActiveTicks(0)
+            , logSyncTransmitActiveTicks(0)
+            , replicationPostingWriteRpcTicks(0)
+            , recoverSegmentPostingWriteRpcTicks(0)
+            , logSyncPostingWriteRpcTicks(0)
+            , replicationWindowStalls(0)
+            , replicationWindowDecreases(0)
+            , replicationMaxBackupQueueDepth(0)
+            , logSyncBatchCount(0)
+            , logSyncBatchRpcs(0) {}
+        /// number of recoveries in which this master participated
+        RawMetric recoveryCount;
+        /// the elapsed time during recoveries
+        RawMetric recoveryTicks;
+        /// time spent in ReplicaManager
+        RawMetric replicaManagerTicks;
+        /// time spent in Segment::append
+        RawMetric segmentAppendTicks;
+        /// time spent copying in Segment::append
+        RawMetric segmentAppendCopyTicks;
+        /// number of BackupClient::getRecoveryData calls issued
+        RawMetric segmentReadCount;
+        /// elapsed time for getRecoveryData calls to backups
+        RawMetric segmentReadTicks;
+        /// time stalled waiting for segments from backups
+        RawMetric segmentReadStallTicks;
+        /// bytes of recovery segments received from backups
+        RawMetric segmentReadByteCount;
+        /// time verifying checksums on objects from backups
+        RawMetric verifyChecksumTicks;
+        /// spent in MasterService::recoverSegment
+        RawMetric recoverSegmentTicks;
+        /// time spent in ReplicaManager::proceed called from MasterService::recoverSegment
+        RawMetric backupInRecoverTicks;
+        /// number of complete segments written to backups
+        RawMetric segmentCloseCount;
+        /// number of recovery segment entries (e.g. objects, tombstones)
+        RawMetric recoverySegmentEntryCount;
+        /// number of bytes in recovery segment entries (without overhead)
+        RawMetric recoverySegmentEntryBytes;
+        /// number of live objects written during recovery
+        RawMetric liveObjectCount;
+        /// number of bytes of live object data written during recovery
+        RawMetric liveObjectBytes;
+        /// number of objects appended to the log during recovery
+        RawMetric objectAppendCount;
+        /// number of objects not appended to the log during recovery
+        RawMetric objectDiscardCount;
+        /// number of safeVersion updates during recovery
+        RawMetric safeVersionRecoveryCount;
+        /// number of safeVersion discarded during recovery
+        RawMetric safeVersionNonRecoveryCount;
+        /// number of tombstones kept during recovery
+        RawMetric tombstoneAppendCount;
+        /// number of tombstones discarded during recovery
+        RawMetric tombstoneDiscardCount;
+        /// time syncing the log at the end of recovery
+        RawMetric logSyncTicks;
+        /// bytes sent during log sync
+        RawMetric logSyncBytes;
+        /// time rebuilding will at the end of recovery
+        RawMetric recoveryWillTicks;
+        /// time deleting tombstones at the end of recovery
+        RawMetric removeTombstoneTicks;
+        /// time with outstanding RPCs to backups
+        RawMetric replicationTicks;
+        /// bytes sent during recovery from first gRD response through log sync
+        RawMetric replicationBytes;
+        /// number of backups on which to replicate each segment
+        RawMetric replicas;
+        /// time closing segments in ReplicaManager
+        RawMetric backupCloseTicks;
+        /// number of segments closed in ReplicaManager
+        RawMetric backupCloseCount;
+        /// time close segments during log sync
+        RawMetric logSyncCloseTicks;
+        /// number of segments closed during log sync
+        RawMetric logSyncCloseCount;
+        /// number of replicas which have started replica recreation
+        RawMetric replicaRecoveries;
+        /// of replicaRecoveries how many were for replicas which were open
+        RawMetric openReplicaRecoveries;
+        /// max number of outstanding tasks in ReplicaManager
+        RawMetric replicationTasks;
+        /// time spent copying outgoing rpcs in transport
+        RawMetric replicationTransmitCopyTicks;
+        /// time spent copying outgoing rpcs in transport just during log sync
+        RawMetric logSyncTransmitCopyTicks;
+        /// rough estimate of memory read during log replay
+        RawMetric replayMemoryReadBytes;
+        /// rough estimate of memory written during log replay
+        RawMetric replayMemoryWrittenBytes;
+        /// time transport tx was active during replication
+        RawMetric replicationTransmitActiveTicks;
+        /// time transport tx was active during log sync
+        RawMetric logSyncTransmitActiveTicks;
+        /// time spent during recovery starting write rpcs in transport
+        RawMetric replicationPostingWriteRpcTicks;
+        /// time spent during recoverSegment starting write rpcs in transport
+        RawMetric recoverSegmentPostingWriteRpcTicks;
+        /// time spent during recovery final log sync starting write rpcs in transport
+        RawMetric logSyncPostingWriteRpcTicks;
+        /// replication writes deferred because the target backup's write window was full
+        RawMetric replicationWindowStalls;
+        /// times a backup's replication write window was cut due to congestion
+        RawMetric replicationWindowDecreases;
+        /// max number of replication write rpcs outstanding to a single backup
+        RawMetric replicationMaxBackupQueueDepth;
+        /// log syncs performed on behalf of deferred write replies
+        RawMetric logSyncBatchCount;
+        /// write replies released by those syncs (divide by logSyncBatchCount for the average batch size)
+        RawMetric logSyncBatchRpcs;
+    } master;
+    /// metrics for backups
+    struct Backup {
+        Backup()
+            : recoveryCount(0)
+            , recoveryTicks(0)
+            , serviceTicks(0)
+            , readCompletionCount(0)
+            , readingDataTicks(0)
+            , storageReadCount(0)
+            , storageReadBytes(0)
+            , storageReadTicks(0)
+            , writeClearTicks(0)
+            , writeCopyBytes(0)
+            , writeCopyTicks(0)
+            , storageWriteCount(0)
+            , storageWriteBytes(0)
+            , storageWriteTicks(0)
+            , filterTicks(0)
+            , primaryLoadCount(0)
+            , secondaryLoadCount(0)
+            , storageType(0)
+            , uncommittedFramesFreed(0) {}
+        /// number of recoveries in which this backup participated
+        RawMetric recoveryCount;
+        /// elapsed time during recovery
+        RawMetric recoveryTicks;
+        /// time spent servicing RPC requests
+        RawMetric serviceTicks;
+        /// number of getRecoveryData requests successfully completed
+        RawMetric readCompletionCount;
+        /// time from startReadingData to done reading
+        RawMetric readingDataTicks;
+        /// number of segment reads from disk
+        RawMetric storageReadCount;
+        /// amount of bytes read from disk
+        RawMetric storageReadBytes;
+        /// time reading from disk
+        RawMetric storageReadTicks;
+        /// time clearing segment memory during segment open
+        RawMetric writeClearTicks;
+        /// bytes written to backup segments
+        RawMetric writeCopyBytes;
+        /// time copying data to backup segments
+        RawMetric writeCopyTicks;
+        /// number of segment writes to disk
+        RawMetric storageWriteCount;
+        /// bytes written to disk
+        RawMetric storageWriteBytes;
+        /// time writing to disk
+        RawMetric storageWriteTicks;
+        /// time filtering segments
+        RawMetric filterTicks;
+        /// number of primary segments requested
+        RawMetric primaryLoadCount;
+        /// number of secondary segments requested
+        RawMetric secondaryLoadCount;
+        /// 1 = in-memory, 2 = on-disk
+        RawMetric storageType;
+        /// number of segment frames freed before being fully flushed to disk
+        RawMetric uncommittedFramesFreed;
+    } backup;
+    /// metrics for remote procedure calls
+    struct Rpc {
+        Rpc()
+            : rpc0Count(0)
+            , rpc1Count(0)
+            , rpc2Count(0)
+            , rpc3Count(0)
+            , rpc4Count(0)
+            , rpc5Count(0)
+            , rpc6Count(0)
+            , pingCount(0)
+            , proxyPingCount(0)
+            , killCount(0)
+            , createTableCount(0)
+            , getTableIdCount(0)
+            , dropTableCount(0)
+            , readCount(0)
+            , writeCount(0)
+            , removeCount(0)
+            , enlistServerCount(0)
+            , getServerListCount(0)
+            , getTabletMapCount(0)
+            , recoverCount(0)
+            , hintServerDownCount(0)
+            , recoveryMasterFinishedCount(0)
+            , enumerateCount(0)
+            , setMasterRecoveryInfoCount(0)
+            , fillWithTestDataCount(0)
+            , multiReadCount(0)
+            , getMetricsCount(0)
+            , rpc27Count(0)
+            , backupFreeCount(0)
+            , backupGetRecoveryDataCount(0)
+            , rpc30Count(0)
+            , backupStartReadingDataCount(0)
+            , backupWriteCount(0)
+            , backupRecoveryCompleteCount(0)
+            , backupQuiesceCount(0)
+            , updateServerListCount(0)
+            , backupStartPartitionCount(0)
+            , rpc37Count(0)
+            , rpc38Count(0)
+            , dropTabletOwnershipCount(0)
+            , takeTabletOwnershipCount(0)
+            , backupAssignGroupCount(0)
+            , getHeadOfLogCount(0)
+            , incrementRpcCount(0)
+            , prepForMigrationCount(0)
+            , receiveMigrationDataCount(0)
+            , reassignTabletOwnershipCount(0)
+            , migrateTabletCount(0)
+            , isReplicaNeededCount(0)
+            , splitTabletCount(0)
+            , getServerStatisticsCount(0)
+            , setRuntimeOptionCount(0)
+            , getServerConfigCount(0)
+            , getLogMetricsCount(0)
+            , multiWriteCount(0)
+            , verifyMembershipCount(0)
+            , scanCount(0)
+            , illegalRpcCount(0)
+            , rpc0Ticks(0)
+            , rpc1Ticks(0)
+            , rpc2Ticks(0)
+            , rpc3Ticks(0)
+            , rpc4Ticks(0)
+            , rpc5Ticks(0)
+            , rpc6Ticks(0)
+            , pingTicks(0)
+            , proxyPingTicks(0)
+            , killTicks(0)
+            , createTableTicks(0)
+            , getTableIdTicks(0)
+            , dropTableTicks(0)
+            , readTicks(0)
+            , writeTicks(0)
+            , removeTicks(0)
+            , enlistServerTicks(0)
+            , getServerListTicks(0)
+            , getTabletMapTicks(0)
+            , recoverTicks(0)
+            , hintServerDownTicks(0)
+            , recoveryMasterFinishedTicks(0)
+            , enumerateTicks(0)
+            , setMasterRecoveryInfoTicks(0)
+            , fillWithTestDataTicks(0)
+            , multiReadTicks(0)
+            , getMetricsTicks(0)
+            , rpc27Ticks(0)
+            , backupFreeTicks(0)
+            , backupGetRecoveryDataTicks(0)
+            , rpc30Ticks(0)
+            , backupStartReadingDataTicks(0)
+            , backupWriteTicks(0)
+            , backupRecoveryCompleteTicks(0)
+            , backupQuiesceTicks(0)
+            , setServerListTicks(0)
+            , updateServerListTicks(0)
+            , backupStartPartition(0)
+            , rpc37Ticks(0)
+            , rpc38Ticks(0)
+            , dropTabletOwnershipTicks(0)
+            , takeTabletOwnershipTicks(0)
+            , backupAssignGroupTicks(0)
+            , getHeadOfLogTicks(0)
+            , incrementTicks(0)
+            , prepForMigrationTicks(0)
+            , receiveMigrationDataTicks(0)
+            , reassignTabletOwnershipTicks(0)
+            , migrateTabletTicks(0)
+            , isReplicaNeededTicks(0)
+            , splitTabletTicks(0)
+            , getServerStatisticsTicks(0)
+            , setRuntimeOptionTicks(0)
+            , getServerConfigTicks(0)
+            , getLogMetricsTicks(0)
+            , multiWriteTicks(0)
+            , verifyMembershipTicks(0)
+            , scanTicks(0)
+            , illegalRpcTicks(0)
+            , rpc0WaitTicks(0)
+            , rpc1WaitTicks(0)
+            , rpc2WaitTicks(0)
+            , rpc3WaitTicks(0)
+            , rpc4WaitTicks(0)
+            , rpc5WaitTicks(0)
+            , rpc6WaitTicks(0)
+            , pingWaitTicks(0)
+            , proxyPingWaitTicks(0)
+            , killWaitTicks(0)
+            , createTableWaitTicks(0)
+            , getTableIdWaitTicks(0)
+            , dropTableWaitTicks(0)
+            , readWaitTicks(0)
+            , writeWaitTicks(0)
+            , removeWaitTicks(0)
+            , enlistServerWaitTicks(0)
+            , getServerListWaitTicks(0)
+            , getTabletMapWaitTicks(0)
+            , recoverWaitTicks(0)
+            , hintServerDownWaitTicks(0)
+            , recoveryMasterFinishedWaitTicks(0)
+            , enumerateWaitTicks(0)
+            , setMasterRecoveryInfoWaitTicks(0)
+            , fillWithTestDataWaitTicks(0)
+            , multiReadWaitTicks(0)
+            , getMetricsWaitTicks(0)
+            , rpc27WaitTicks(0)
+            , backupFreeWaitTicks(0)
+            , backupGetRecoveryDataWaitTicks(0)
+            , rpc30WaitTicks(0)
+            , backupStartReadingDataWaitTicks(0)
+            , backupWriteWaitTicks(0)
+            , backupRecoveryCompleteWaitTicks(0)
+            , backupQuiesceWaitTicks(0)
+            , setServerListWaitTicks(0)
+            , updateServerListWaitTicks(0)
+            , rpc37WaitTicks(0)
+            , rpc38WaitTicks(0)
+            , dropTabletOwnershipWaitTicks(0)
+            , takeTabletOwnershipWaitTicks(0)
+            , backupAssignGroupWaitTicks(0)
+            , getHeadOfLogWaitTicks(0)
+            , incrementWaitTicks(0)
+            , prepForMigrationWaitTicks(0)
+            , receiveMigrationDataWaitTicks(0)
+            , reassignTabletOwnershipWaitTicks(0)
+            , migrateTabletWaitTicks(0)
+            , isReplicaNeededWaitTicks(0)
+            , splitTabletWaitTicks(0)
+            , getServerStatisticsWaitTicks(0)
+            , setRuntimeOptionWaitTicks(0)
+            , getServerConfigWaitTicks(0)
+            , getLogMetricsWaitTicks(0)
+            , multiWriteWaitTicks(0)
+            , verifyMembershipWaitTicks(0)
+            , scanWaitTicks(0)
+            , illegalRpcWaitTicks(0) {}
+        /// number of invocations of RPC 0 (undefined)
+        RawMetric rpc0Count;
+        /// number of invocations of RPC 1 (undefined)
+        RawMetric rpc1Count;
+        /// number of invocations of RPC 2 (undefined)
+        RawMetric rpc2Count;
+        /// number of invocations of RPC 3 (undefined)
+        RawMetric rpc3Count;
+        /// number of invocations of RPC 4 (undefined)
+        RawMetric rpc4Count;
+        /// number of invocations of RPC 5 (undefined)
+        RawMetric rpc5Count;
+        /// number of invocations of RPC 6 (undefined)
+        RawMetric rpc6Count;
+        /// number of invocations of PING RPC
+        RawMetric pingCount;
+        /// number of invocations of PROXY_PING RPC
+        RawMetric proxyPingCount;
+        /// number of invocations of KILL RPC
+        RawMetric killCount;
+        /// number of invocations of CREATE_TABLE RPC
+        RawMetric createTableCount;
+        /// number of invocations of GET_TABLE_ID RPC
+        RawMetric getTableIdCount;
+        /// number of invocations of DROP_TABLE RPC
+        RawMetric dropTableCount;
+        /// number of invocations of READ RPC
+        RawMetric readCount;
+        /// number of invocations of WRITE RPC
+        RawMetric writeCount;
+        /// number of invocations of REMOVE RPC
+        RawMetric removeCount;
+        /// number of invocations of ENLIST_SERVER RPC
+        RawMetric enlistServerCount;
+        /// number of invocations of GET_SERVER_LIST RPC
+        RawMetric getServerListCount;
+        /// number of invocations of GET_TABLET_MAP RPC
+        RawMetric getTabletMapCount;
+        /// number of invocations of RECOVER RPC
+        RawMetric recoverCount;
+        /// number of invocations of HINT_SERVER_DOWN RPC
+        RawMetric hintServerDownCount;
+        /// number of invocations of RECOVERY_MASTER_FINISHED RPC
+        RawMetric recoveryMasterFinishedCount;
+        /// number of invocations of ENUMERATE RPC
+        RawMetric enumerateCount;
+        /// number of invocations of SET_MASTER_RECOVERY_INFO RPC
+        RawMetric setMasterRecoveryInfoCount;
+        /// number of invocations of FILL_WITH_TEST_DATA RPC
+        RawMetric fillWithTestDataCount;
+        /// number of invocations of MULTI_READ RPC
+        RawMetric multiReadCount;
+        /// number of invocations of GET_METRICS RPC
+        RawMetric getMetricsCount;
+        /// number of invocations of RPC 27 (undefined)
+        RawMetric rpc27Count;
+        /// number of invocations of BACKUP_FREE RPC
+        RawMetric backupFreeCount;
+        /// number of invocations of BACKUP_GETRECOVERYDATA RPC
+        RawMetric backupGetRecoveryDataCount;
+        /// number of invocations of RPC 30 (undefined)
+        RawMetric rpc30Count;
+        /// number of invocations of BACKUP_STARTREADINGDATA RPC
+        RawMetric backupStartReadingDataCount;
+        /// number of invocations of BACKUP_WRITE RPC
+        RawMetric backupWriteCount;
+        /// number of invocations of BACKUP_RECOVERYCOMPLETE RPC
+        RawMetric backupRecoveryCompleteCount;
+        /// number of invocations of BACKUP_QUIESCE RPC
+        RawMetric backupQuiesceCount;
+        /// number of invocations of UPDATE_SERVER_LIST RPC
+        RawMetric updateServerListCount;
+        /// time spent executing BACKUP_STARTPARTITION RPC
+        RawMetric backupStartPartitionCount;
+        /// number of invocations of RPC 37 (undefined)
+        RawMetric rpc37Count;
+        /// number of invocations of RPC 38 (undefined)
+        RawMetric rpc38Count;
+        /// number of invocations of DROP_TABLET_OWNERSHIP RPC
+        RawMetric dropTabletOwnershipCount;
+        /// number of invocations of TAKE_TABLET_OWNERSHIP RPC
+        RawMetric takeTabletOwnershipCount;
+        /// number of invocations of BACKUP_ASSIGN_GROUP RPC
+        RawMetric backupAssignGroupCount;
+        /// number of invocations of GET_HEAD_OF_LOG RPC
+        RawMetric getHeadOfLogCount;
+        /// number of invocations of INCREMENT RPC
+        RawMetric incrementRpcCount;
+        /// number of invocations of PREP_FOR_MIGRATION RPC
+        RawMetric prepForMigrationCount;
+        /// number of invocations of RECEIVE_MIGRATION_DATA RPC
+        RawMetric receiveMigrationDataCount;
+        /// number of invocations of REASSIGN_TABLET_OWNERSHIP RPC
+        RawMetric reassignTabletOwnershipCount;
+        /// number of invocations of MIGRATE_TABLET RPC
+        RawMetric migrateTabletCount;
+        /// number of invocations of IS_REPLICA_NEEDED RPC
+        RawMetric isReplicaNeededCount;
+        /// number of invocations of SPLIT_TABLET
+        RawMetric splitTabletCount;
+        /// number of invocations of GET_SERVER_STATISTICS RPC
+        RawMetric getServerStatisticsCount;
+        /// number of invocations of SET_RUNTIME_OPTION RPC
+        RawMetric setRuntimeOptionCount;
+        /// number of invocations of GET_SERVER_CONFIG RPC
+        RawMetric getServerConfigCount;
+        /// number of invocations of GET_LOG_METRICS RPC
+        RawMetric getLogMetricsCount;
+        /// number of invocations of MULTI_WRITE RPC
+        RawMetric multiWriteCount;
+        /// number of invocations of VERIFY_MEMBERSHIP RPC
+        RawMetric verifyMembershipCount;
+        /// number of invocations of SCAN RPC
+        RawMetric scanCount;
+        /// number of invocations of RPCs with illegal opcodes
+        RawMetric illegalRpcCount;
+        /// time spent executing RPC 0 (undefined)
+        RawMetric rpc0Ticks;
+        /// time spent executing RPC 1 (undefined)
+        RawMetric rpc1Ticks;
+        /// time spent executing RPC 2 (undefined)
+        RawMetric rpc2Ticks;
+        /// time spent executing RPC 3 (undefined)
+        RawMetric rpc3Ticks;
+        /// time spent executing RPC 4 (undefined)
+        RawMetric rpc4Ticks;
+        /// time spent executing RPC 5 (undefined)
+        RawMetric rpc5Ticks;
+        /// time spent executing RPC 6 (undefined)
+        RawMetric rpc6Ticks;
+        /// time spent executing PING RPC
+        RawMetric pingTicks;
+        /// time spent executing PROXY_PING RPC
+        RawMetric proxyPingTicks;
+        /// time spent executing KILL RPC
+        RawMetric killTicks;
+        /// time spent executing CREATE_TABLE RPC
+        RawMetric createTableTicks;
+        /// time spent executing GET_TABLE_ID RPC
+        RawMetric getTableIdTicks;
+        /// time spent executing DROP_TABLE RPC
+        RawMetric dropTableTicks;
+        /// time spent executing READ RPC
+        RawMetric readTicks;
+        /// time spent executing WRITE RPC
+        RawMetric writeTicks;
+        /// time spent executing REMOVE RPC
+        RawMetric removeTicks;
+        /// time spent executing ENLIST_SERVER RPC
+        RawMetric enlistServerTicks;
+        /// time spent executing GET_SERVER_LIST RPC
+        RawMetric getServerListTicks;
+        /// time spent executing GET_TABLET_MAP RPC
+        RawMetric getTabletMapTicks;
+        /// time spent executing RECOVER RPC
+        RawMetric recoverTicks;
+        /// time spent executing HINT_SERVER_DOWN RPC
+        RawMetric hintServerDownTicks;
+        /// time spent executing RECOVERY_MASTER_FINISHED RPC
+        RawMetric recoveryMasterFinishedTicks;
+        /// time spent executing ENUMERATE RPC
+        RawMetric enumerateTicks;
+        /// time spent executing SET_MASTER_RECOVERY_INFO RPC
+        RawMetric setMasterRecoveryInfoTicks;
+        /// time spent executing FILL_WITH_TEST_DATA RPC
+        RawMetric fillWithTestDataTicks;
+        /// time spent executing MULTI_READ RPC
+        RawMetric multiReadTicks;
+        /// time spent executing GET_METRICS RPC
+        RawMetric getMetricsTicks;
+        /// time spent executing RPC 27 (undefined)
+        RawMetric rpc27Ticks;
+        /// time spent executing BACKUP_FREE RPC
+        RawMetric backupFreeTicks;
+        /// time spent executing BACKUP_GETRECOVERYDATA RPC
+        RawMetric backupGetRecoveryDataTicks;
+        /// time spent executing RPC 30 (undefined)
+        RawMetric rpc30Ticks;
+        /// time spent executing BACKUP_STARTREADINGDATA RPC
+        RawMetric backupStartReadingDataTicks;
+        /// time spent executing BACKUP_WRITE RPC
+        RawMetric backupWriteTicks;
+        /// time spent executing BACKUP_RECOVERYCOMPLETE RPC
+        RawMetric backupRecoveryCompleteTicks;
+        /// time spent executing BACKUP_QUIESCE RPC
+        RawMetric backupQuiesceTicks;
+        /// time spent executing SET_SERVER_LIST RPC
+        RawMetric setServerListTicks;
+        /// time spent executing BACKUP_STARTPARTITION RPC
+        RawMetric updateServerListTicks;
+        /// time spent executing RPC 4 (undefined)
+        RawMetric backupStartPartition;
+        /// time spent executing RPC 37 (undefined)
+        RawMetric rpc37Ticks;
+        /// time spent executing RPC 38 (undefined)
+        RawMetric rpc38Ticks;
+        /// number of invocations of DROP_TABLET_OWNERSHIP RPC
+        RawMetric dropTabletOwnershipTicks;
+        /// number of invocations of TAKE_TABLET_OWNERSHIP RPC
+        RawMetric takeTabletOwnershipTicks;
+        /// time spent executing BACKUP_ASSIGN_GROUP RPC
+        RawMetric backupAssignGroupTicks;
+        /// time spent executing GET_HEAD_OF_LOG RPC
+        RawMetric getHeadOfLogTicks;
+        /// time spent executing INCREMENT RPC
+        RawMetric incrementTicks;
+        /// time spent executing PREP_FOR_MIGRATION RPC
+        RawMetric prepForMigrationTicks;
+        /// time spent executing RECEIVE_MIGRATION_DATA RPC
+        RawMetric receiveMigrationDataTicks;
+        /// time spent executing REASSIGN_TABLET_OWNERSHIP RPC
+        RawMetric reassignTabletOwnershipTicks;
+        /// time spent executing MIGRATE_TABLET RPC
+        RawMetric migrateTabletTicks;
+        /// time spent executing IS_REPLICA_NEEDED_RPC
+        RawMetric isReplicaNeededTicks;
+        /// time spent executing SPLIT_TABLET RPC
+        RawMetric splitTabletTicks;
+        /// time spent executing GET_SERVER_STATISTICS RPC
+        RawMetric getServerStatisticsTicks;
+        /// time spent executing SET_RUNTIME_OPTION RPC
+        RawMetric setRuntimeOptionTicks;
+        /// time spent executing GET_SERVER_CONFIG RPC
+        RawMetric getServerConfigTicks;
+        /// time spent executing GET_LOG_METRICS RPC
+        RawMetric getLogMetricsTicks;
+        /// time spent executing MULTI_WRITE RPC
+        RawMetric multiWriteTicks;
+        /// number of invocations of VERIFY_MEMBERSHIP
+        RawMetric verifyMembershipTicks;
+        /// time spent executing SCAN RPC
+        RawMetric scanTicks;
+        /// time spent executing RPCs with illegal opcodes
+        RawMetric illegalRpcTicks;
+        /// time RPC 0 (undefined) waited for a worker thread
+        RawMetric rpc0WaitTicks;
+        /// time RPC 1 (undefined) waited for a worker thread
+        RawMetric rpc1WaitTicks;
+        /// time RPC 2 (undefined) waited for a worker thread
+        RawMetric rpc2WaitTicks;
+        /// time RPC 3 (undefined) waited for a worker thread
+        RawMetric rpc3WaitTicks;
+        /// time RPC 4 (undefined) waited for a worker thread
+        RawMetric rpc4WaitTicks;
+        /// time RPC 5 (undefined) waited for a worker thread
+        RawMetric rpc5WaitTicks;
+        /// time RPC 6 (undefined) waited for a worker thread
+        RawMetric rpc6WaitTicks;
+        /// time PING RPC waited for a worker thread
+        RawMetric pingWaitTicks;
+        /// time PROXY_PING RPC waited for a worker thread
+        RawMetric proxyPingWaitTicks;
+        /// time KILL RPC waited for a worker thread
+        RawMetric killWaitTicks;
+        /// time CREATE_TABLE RPC waited for a worker thread
+        RawMetric createTableWaitTicks;
+        /// time GET_TABLE_ID RPC waited for a worker thread
+        RawMetric getTableIdWaitTicks;
+        /// time DROP_TABLE RPC waited for a worker thread
+        RawMetric dropTableWaitTicks;
+        /// time READ RPC waited for a worker thread
+        RawMetric readWaitTicks;
+        /// time WRITE RPC waited for a worker thread
+        RawMetric writeWaitTicks;
+        /// time REMOVE RPC waited for a worker thread
+        RawMetric removeWaitTicks;
+        /// time ENLIST_SERVER RPC waited for a worker thread
+        RawMetric enlistServerWaitTicks;
+        /// time GET_SERVER_LIST RPC waited for a worker thread
+        RawMetric getServerListWaitTicks;
+        /// time GET_TABLET_MAP RPC waited for a worker thread
+        RawMetric getTabletMapWaitTicks;
+        /// time RECOVER RPC waited for a worker thread
+        RawMetric recoverWaitTicks;
+        /// time HINT_SERVER_DOWN RPC waited for a worker thread
+        RawMetric hintServerDownWaitTicks;
+        /// time RECOVERY_MASTER_FINISHED RPC waited for a worker thread
+        RawMetric recoveryMasterFinishedWaitTicks;
+        /// time ENUMERATE RPC waited for a worker thread
+        RawMetric enumerateWaitTicks;
+        /// time SET_MASTER_RECOVERY_INFO RPC waited for a worker thread
+        RawMetric setMasterRecoveryInfoWaitTicks;
+        /// time FILL_WITH_TEST_DATA RPC waited for a worker thread
+        RawMetric fillWithTestDataWaitTicks;
+        /// time MULTI_READ RPC waited for a worker thread
+        RawMetric multiReadWaitTicks;
+        /// time GET_METRICS RPC waited for a worker thread
+        RawMetric getMetricsWaitTicks;
+        /// time RPC 27 (undefined) waited for a worker thread
+        RawMetric rpc27WaitTicks;
+        /// time BACKUP_FREE RPC waited for a worker thread
+        RawMetric backupFreeWaitTicks;
+        /// time BACKUP_GETRECOVERYDATA RPC waited for a worker thread
+        RawMetric backupGetRecoveryDataWaitTicks;
+        /// time RPC 30 (undefined) waited for a worker thread
+        RawMetric rpc30WaitTicks;
+        /// time BACKUP_STARTREADINGDATA RPC waited for a worker thread
+        RawMetric backupStartReadingDataWaitTicks;
+        /// time BACKUP_WRITE RPC waited for a worker thread
+        RawMetric backupWriteWaitTicks;
+        /// time BACKUP_RECOVERYCOMPLETE RPC waited for a worker thread
+        RawMetric backupRecoveryCompleteWaitTicks;
+        /// time BACKUP_QUIESCE RPC waited for a worker thread
+        RawMetric backupQuiesceWaitTicks;
+        /// time SET_SERVER_LIST RPC waited for a worker thread
+        RawMetric setServerListWaitTicks;
+        /// time BACKUP_STARTPARTITION RPC waited for a worker thread
+        RawMetric updateServerListWaitTicks;
+        /// time RPC 37 (undefined) waited for a worker thread
+        RawMetric rpc37WaitTicks;
+        /// time RPC 38 (undefined) waited for a worker thread
+        RawMetric rpc38WaitTicks;
+        /// time DROP_TABLET_OWNERSHIP RPC waited for a worker thread
+        RawMetric dropTabletOwnershipWaitTicks;
+        /// time TAKE_TABLET_OWNERSHIP RPC waited for a worker thread
+        RawMetric takeTabletOwnershipWaitTicks;
+        /// time BACKUP_ASSIGN_GROUP RPC waited for a worker thread
+        RawMetric backupAssignGroupWaitTicks;
+        /// time GET_HEAD_OF_LOG RPC waited for a worker thread
+        RawMetric getHeadOfLogWaitTicks;
+        /// time INCREMENT RPC waited for a worker thread
+        RawMetric incrementWaitTicks;
+        /// time PREP_FOR_MIGRATION RPC waited for a worker thread
+        RawMetric prepForMigrationWaitTicks;
+        /// time RECEIVE_MIGRATION_DATA RPC waited for a worker thread
+        RawMetric receiveMigrationDataWaitTicks;
+        /// time REASSIGN_TABLET_OWNERSHIP RPC waited for a worker thread
+        RawMetric reassignTabletOwnershipWaitTicks;
+        /// time MIGRATE_TABLET RPC waited for a worker thread
+        RawMetric migrateTabletWaitTicks;
+        /// time IS_REPLICA_NEEDED RPC waited for a worker thread
+        RawMetric isReplicaNeededWaitTicks;
+        /// time SPLIT_TABLET RPC waited for a worker thread
+        RawMetric splitTabletWaitTicks;
+        /// time GET_SERVER_STATISTICS RPC waited for a worker thread
+        RawMetric getServerStatisticsWaitTicks;
+        /// time SET_RUNTIME_OPTION RPC waited for a worker thread
+        RawMetric setRuntimeOptionWaitTicks;
+        /// time GET_SERVER_CONFIG RPC waited for a worker thread
+        RawMetric getServerConfigWaitTicks;
+        /// time GET_LOG_METRICS RPC waited for a worker thread
+        RawMetric getLogMetricsWaitTicks;
+        /// time MULTI_WRITE RPC waited for a worker thread
+        RawMetric multiWriteWaitTicks;
+        /// time VERIFY_MEMBERSHIP RPC waited for a worker thread
+        RawMetric verifyMembershipWaitTicks;
+        /// time SCAN RPC waited for a worker thread
+        RawMetric scanWaitTicks;
+        /// time RPCs with illegal opcodes waited for a worker thread
+        RawMetric illegalRpcWaitTicks;
+    } rpc;
+    /// transport metrics
+    struct Transport {
+        Transport()
+            : transmit()
+            , receive()
+            , infiniband()
+            , sessionOpenTicks(0)
+            , sessionOpenCount(0)
+            , sessionOpenSquaredTicks(0)
+            , retrySessionOpenCount(0)
+            , clientRpcsActiveTicks(0) {}
+        /// metrics related to transmitting messages
+        struct Transmit {
+            Transmit()
+                : ticks(0)
+                , messageCount(0)
+                , packetCount(0)
+                , iovecCount(0)
+                , byteCount(0)
+                , copyTicks(0)
+                , dmaTicks(0) {}
+            /// elapsed time transmitting messages
+            RawMetric ticks;
+            /// number of messages transmitted
+            RawMetric messageCount;
+            /// number of packets transmitted
+            RawMetric packetCount;
+            /// number of Buffer chunks transmitted
+            RawMetric iovecCount;
+            /// number of bytes transmitted
+            RawMetric byteCount;
+            /// elapsed time copying messages
+            RawMetric copyTicks;
+            /// elapsed time waiting for DMA to HCA
+            RawMetric dmaTicks;
+        } transmit;
+        /// metrics related to receiving messages
+        struct Receive {
+            Receive()
+                : ticks(0)
+                , messageCount(0)
+                , packetCount(0)
+                , iovecCount(0)
+                , byteCount(0) {}
+            /// elapsed time receiving messages
+            RawMetric ticks;
+            /// number of messages received
+            RawMetric messageCount;
+            /// number of packets received
+            RawMetric packetCount;
+            /// number of Buffer chunks received
+            RawMetric iovecCount;
+            /// number of bytes received
+            RawMetric byteCount;
+        } receive;
+        /// metrics for Infiniband networking
+        struct Infiniband {
+            Infiniband()
+                : transmitActiveTicks(0) {}
+            /// time with packets on the transmit queue
+            RawMetric transmitActiveTicks;
+        } infiniband;
+        /// time opening sessions for RPCs
+        RawMetric sessionOpenTicks;
+        /// number of sessions opened for RPCs
+        RawMetric sessionOpenCount;
+        /// used for calculating the standard deviation of sessionOpenTicks
+        RawMetric sessionOpenSquaredTicks;
+        /// member of timeouts during session open
+        RawMetric retrySessionOpenCount;
+        /// time with a client RPC active on the network
+        RawMetric clientRpcsActiveTicks;
+    } transport;
+    /// metrics for temporary use
+    struct Temp {
+        Temp()
+            : ticks0(0)
+            , count0(0)
+            , ticks1(0)
+            , count1(0)
+            , ticks2(0)
+            , count2(0)
+            , ticks3(0)
+            , count3(0)
+            , ticks4(0)
+            , count4(0)
+            , ticks5(0)
+            , count5(0)
+            , ticks6(0)
+            , count6(0)
+            , ticks7(0)
+            , count7(0)
+            , ticks8(0)
+            , count8(0)
+            , ticks9(0)
+            , count9(0) {}
+        /// amount of time for some undefined activity
+        RawMetric ticks0;
+        /// number of occurrences of some undefined event
+        RawMetric count0;
+        /// amount of time for some undefined activity
+        RawMetric ticks1;
+        /// number of occurrences of some undefined event
+        RawMetric count1;
+        /// amount of time for some undefined activity
+        RawMetric ticks2;
+        /// number of occurrences of some undefined event
+        RawMetric count2;
+        /// amount of time for some undefined activity
+        RawMetric ticks3;
+        /// number of occurrences of some undefined event
+        RawMetric count3;
+        /// amount of time for some undefined activity
+        RawMetric ticks4;
+        /// number of occurrences of some undefined event
+        RawMetric count4;
+        /// amount of time for some undefined activity
+        RawMetric ticks5;
+        /// number of occurrences of some undefined event
+        RawMetric count5;
+        /// amount of time for some undefined activity
+        RawMetric ticks6;
+        /// number of occurrences of some undefined event
+        RawMetric count6;
+        /// amount of time for some undefined activity
+        RawMetric ticks7;
+        /// number of occurrences of some undefined event
+        RawMetric count7;
+        /// amount of time for some undefined activity
+        RawMetric ticks8;
+        /// number of occurrences of some undefined event
+        RawMetric count8;
+        /// amount of time for some undefined activity
+        RawMetric ticks9;
+        /// number of occurrences of some undefined event
+        RawMetric count9;
+    } temp;
+    /// server id assigned by coordinator
+    RawMetric serverId;
+    /// process ID on machine
+    RawMetric pid;
+    /// cycles per second for the cpu
+    RawMetric clockFrequency;
+    /// size in bytes of segments
+    RawMetric segmentSize;
+    static const int numMetrics = 292;
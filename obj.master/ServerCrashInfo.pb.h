@@ -0,0 +1,406 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerCrashInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerCrashInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerCrashInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerCrashInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerCrashInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerCrashInfo_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerCrashInfo;
+struct ServerCrashInfoDefaultTypeInternal;
+extern ServerCrashInfoDefaultTypeInternal _ServerCrashInfo_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerCrashInfo* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerCrashInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerCrashInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerCrashInfo) */ {
+ public:
+  inline ServerCrashInfo() : ServerCrashInfo(nullptr) {}
+  ~ServerCrashInfo() override;
+  explicit PROTOBUF_CONSTEXPR ServerCrashInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerCrashInfo(const ServerCrashInfo& from);
+  ServerCrashInfo(ServerCrashInfo&& from) noexcept
+    : ServerCrashInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerCrashInfo& operator=(const ServerCrashInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerCrashInfo& operator=(ServerCrashInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerCrashInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerCrashInfo* internal_default_instance() {
+    return reinterpret_cast<const ServerCrashInfo*>(
+               &_ServerCrashInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerCrashInfo& a, ServerCrashInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerCrashInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerCrashInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerCrashInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerCrashInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerCrashInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerCrashInfo& from) {
+    ServerCrashInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerCrashInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerCrashInfo";
+  }
+  protected:
+  explicit ServerCrashInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntryTypeFieldNumber = 1,
+    kServerIdFieldNumber = 2,
+    kUpdateVersionFieldNumber = 3,
+  };
+  // required string entry_type = 1;
+  bool has_entry_type() const;
+  private:
+  bool _internal_has_entry_type() const;
+  public:
+  void clear_entry_type();
+  const std::string& entry_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entry_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entry_type();
+  PROTOBUF_NODISCARD std::string* release_entry_type();
+  void set_allocated_entry_type(std::string* entry_type);
+  private:
+  const std::string& _internal_entry_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entry_type(const std::string& value);
+  std::string* _internal_mutable_entry_type();
+  public:
+
+  // required uint64 server_id = 2;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // optional uint64 update_version = 3;
+  bool has_update_version() const;
+  private:
+  bool _internal_has_update_version() const;
+  public:
+  void clear_update_version();
+  uint64_t update_version() const;
+  void set_update_version(uint64_t value);
+  private:
+  uint64_t _internal_update_version() const;
+  void _internal_set_update_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerCrashInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entry_type_;
+    uint64_t server_id_;
+    uint64_t update_version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerCrashInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerCrashInfo
+
+// required string entry_type = 1;
+inline bool ServerCrashInfo::_internal_has_entry_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerCrashInfo::has_entry_type() const {
+  return _internal_has_entry_type();
+}
+inline void ServerCrashInfo::clear_entry_type() {
+  _impl_.entry_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerCrashInfo::entry_type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerCrashInfo.entry_type)
+  return _internal_entry_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerCrashInfo::set_entry_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entry_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerCrashInfo.entry_type)
+}
+inline std::string* ServerCrashInfo::mutable_entry_type() {
+  std::string* _s = _internal_mutable_entry_type();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerCrashInfo.entry_type)
+  return _s;
+}
+inline const std::string& ServerCrashInfo::_internal_entry_type() const {
+  return _impl_.entry_type_.Get();
+}
+inline void ServerCrashInfo::_internal_set_entry_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entry_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerCrashInfo::_internal_mutable_entry_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entry_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerCrashInfo::release_entry_type() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerCrashInfo.entry_type)
+  if (!_internal_has_entry_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entry_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerCrashInfo::set_allocated_entry_type(std::string* entry_type) {
+  if (entry_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entry_type_.SetAllocated(entry_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerCrashInfo.entry_type)
+}
+
+// required uint64 server_id = 2;
+inline bool ServerCrashInfo::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerCrashInfo::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void ServerCrashInfo::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerCrashInfo::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t ServerCrashInfo::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerCrashInfo.server_id)
+  return _internal_server_id();
+}
+inline void ServerCrashInfo::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.server_id_ = value;
+}
+inline void ServerCrashInfo::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerCrashInfo.server_id)
+}
+
+// optional uint64 update_version = 3;
+inline bool ServerCrashInfo::_internal_has_update_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerCrashInfo::has_update_version() const {
+  return _internal_has_update_version();
+}
+inline void ServerCrashInfo::clear_update_version() {
+  _impl_.update_version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerCrashInfo::_internal_update_version() const {
+  return _impl_.update_version_;
+}
+inline uint64_t ServerCrashInfo::update_version() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerCrashInfo.update_version)
+  return _internal_update_version();
+}
+inline void ServerCrashInfo::_internal_set_update_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.update_version_ = value;
+}
+inline void ServerCrashInfo::set_update_version(uint64_t value) {
+  _internal_set_update_version(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerCrashInfo.update_version)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerCrashInfo_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,557 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerInformation.proto
+
+#include "ServerInformation.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR ServerInformation::ServerInformation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entry_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.service_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.service_mask_)*/0u
+  , /*decltype(_impl_.read_speed_)*/0u
+  , /*decltype(_impl_.update_version_)*/uint64_t{0u}} {}
+struct ServerInformationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerInformationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerInformationDefaultTypeInternal() {}
+  union {
+    ServerInformation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerInformationDefaultTypeInternal _ServerInformation_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ServerInformation_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ServerInformation_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ServerInformation_2eproto = nullptr;
+
+const uint32_t TableStruct_ServerInformation_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _impl_.entry_type_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _impl_.service_mask_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _impl_.read_speed_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _impl_.service_locator_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerInformation, _impl_.update_version_),
+  0,
+  2,
+  3,
+  4,
+  1,
+  5,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::RAMCloud::ProtoBuf::ServerInformation)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_ServerInformation_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ServerInformation_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027ServerInformation.proto\022\021RAMCloud.Prot"
+  "oBuf\"\225\001\n\021ServerInformation\022\022\n\nentry_type"
+  "\030\001 \002(\t\022\021\n\tserver_id\030\002 \002(\006\022\024\n\014service_mas"
+  "k\030\003 \002(\r\022\022\n\nread_speed\030\004 \002(\r\022\027\n\017service_l"
+  "ocator\030\006 \002(\t\022\026\n\016update_version\030\007 \001(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_ServerInformation_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ServerInformation_2eproto = {
+    false, false, 196, descriptor_table_protodef_ServerInformation_2eproto,
+    "ServerInformation.proto",
+    &descriptor_table_ServerInformation_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_ServerInformation_2eproto::offsets,
+    file_level_metadata_ServerInformation_2eproto, file_level_enum_descriptors_ServerInformation_2eproto,
+    file_level_service_descriptors_ServerInformation_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ServerInformation_2eproto_getter() {
+  return &descriptor_table_ServerInformation_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ServerInformation_2eproto(&descriptor_table_ServerInformation_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerInformation::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerInformation>()._impl_._has_bits_);
+  static void set_has_entry_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_service_mask(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_read_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_service_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_update_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+ServerInformation::ServerInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerInformation)
+}
+ServerInformation::ServerInformation(const ServerInformation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerInformation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entry_type_){}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.service_mask_){}
+    , decltype(_impl_.read_speed_){}
+    , decltype(_impl_.update_version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.entry_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_entry_type()) {
+    _this->_impl_.entry_type_.Set(from._internal_entry_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_locator()) {
+    _this->_impl_.service_locator_.Set(from._internal_service_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.server_id_, &from._impl_.server_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.update_version_) -
+    reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.update_version_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerInformation)
+}
+
+inline void ServerInformation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entry_type_){}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.service_mask_){0u}
+    , decltype(_impl_.read_speed_){0u}
+    , decltype(_impl_.update_version_){uint64_t{0u}}
+  };
+  _impl_.entry_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerInformation::~ServerInformation() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerInformation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerInformation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entry_type_.Destroy();
+  _impl_.service_locator_.Destroy();
+}
+
+void ServerInformation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerInformation::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerInformation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.entry_type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.service_locator_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.server_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.update_version_) -
+        reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.update_version_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerInformation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string entry_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_entry_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerInformation.entry_type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 server_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 service_mask = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_service_mask(&has_bits);
+          _impl_.service_mask_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 read_speed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_read_speed(&has_bits);
+          _impl_.read_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string service_locator = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_service_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerInformation.service_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 update_version = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_update_version(&has_bits);
+          _impl_.update_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerInformation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerInformation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string entry_type = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_entry_type().data(), static_cast<int>(this->_internal_entry_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerInformation.entry_type");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_entry_type(), target);
+  }
+
+  // required fixed64 server_id = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_server_id(), target);
+  }
+
+  // required uint32 service_mask = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_service_mask(), target);
+  }
+
+  // required uint32 read_speed = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_read_speed(), target);
+  }
+
+  // required string service_locator = 6;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_locator().data(), static_cast<int>(this->_internal_service_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerInformation.service_locator");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_service_locator(), target);
+  }
+
+  // optional uint64 update_version = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_update_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerInformation)
+  return target;
+}
+
+size_t ServerInformation::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerInformation)
+  size_t total_size = 0;
+
+  if (_internal_has_entry_type()) {
+    // required string entry_type = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_entry_type());
+  }
+
+  if (_internal_has_service_locator()) {
+    // required string service_locator = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_service_mask()) {
+    // required uint32 service_mask = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_mask());
+  }
+
+  if (_internal_has_read_speed()) {
+    // required uint32 read_speed = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_read_speed());
+  }
+
+  return total_size;
+}
+size_t ServerInformation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerInformation)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required string entry_type = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_entry_type());
+
+    // required string service_locator = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+
+    // required uint32 service_mask = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_mask());
+
+    // required uint32 read_speed = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_read_speed());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint64 update_version = 7;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000020u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_update_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerInformation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerInformation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerInformation::GetClassData() const { return &_class_data_; }
+
+
+void ServerInformation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerInformation*>(&to_msg);
+  auto& from = static_cast<const ServerInformation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerInformation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_entry_type(from._internal_entry_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_service_locator(from._internal_service_locator());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.service_mask_ = from._impl_.service_mask_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.read_speed_ = from._impl_.read_speed_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.update_version_ = from._impl_.update_version_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerInformation::CopyFrom(const ServerInformation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerInformation)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerInformation::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerInformation::InternalSwap(ServerInformation* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.entry_type_, lhs_arena,
+      &other->_impl_.entry_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_locator_, lhs_arena,
+      &other->_impl_.service_locator_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerInformation, _impl_.update_version_)
+      + sizeof(ServerInformation::_impl_.update_version_)
+      - PROTOBUF_FIELD_OFFSET(ServerInformation, _impl_.server_id_)>(
+          reinterpret_cast<char*>(&_impl_.server_id_),
+          reinterpret_cast<char*>(&other->_impl_.server_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerInformation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerInformation_2eproto_getter, &descriptor_table_ServerInformation_2eproto_once,
+      file_level_metadata_ServerInformation_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerInformation*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerInformation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerInformation >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,580 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerInformation.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerInformation_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerInformation_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerInformation_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerInformation_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerInformation_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerInformation;
+struct ServerInformationDefaultTypeInternal;
+extern ServerInformationDefaultTypeInternal _ServerInformation_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerInformation* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerInformation>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerInformation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerInformation) */ {
+ public:
+  inline ServerInformation() : ServerInformation(nullptr) {}
+  ~ServerInformation() override;
+  explicit PROTOBUF_CONSTEXPR ServerInformation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerInformation(const ServerInformation& from);
+  ServerInformation(ServerInformation&& from) noexcept
+    : ServerInformation() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerInformation& operator=(const ServerInformation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerInformation& operator=(ServerInformation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerInformation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerInformation* internal_default_instance() {
+    return reinterpret_cast<const ServerInformation*>(
+               &_ServerInformation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerInformation& a, ServerInformation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerInformation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerInformation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerInformation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerInformation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerInformation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerInformation& from) {
+    ServerInformation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerInformation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerInformation";
+  }
+  protected:
+  explicit ServerInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntryTypeFieldNumber = 1,
+    kServiceLocatorFieldNumber = 6,
+    kServerIdFieldNumber = 2,
+    kServiceMaskFieldNumber = 3,
+    kReadSpeedFieldNumber = 4,
+    kUpdateVersionFieldNumber = 7,
+  };
+  // required string entry_type = 1;
+  bool has_entry_type() const;
+  private:
+  bool _internal_has_entry_type() const;
+  public:
+  void clear_entry_type();
+  const std::string& entry_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entry_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entry_type();
+  PROTOBUF_NODISCARD std::string* release_entry_type();
+  void set_allocated_entry_type(std::string* entry_type);
+  private:
+  const std::string& _internal_entry_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entry_type(const std::string& value);
+  std::string* _internal_mutable_entry_type();
+  public:
+
+  // required string service_locator = 6;
+  bool has_service_locator() const;
+  private:
+  bool _internal_has_service_locator() const;
+  public:
+  void clear_service_locator();
+  const std::string& service_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_locator();
+  PROTOBUF_NODISCARD std::string* release_service_locator();
+  void set_allocated_service_locator(std::string* service_locator);
+  private:
+  const std::string& _internal_service_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_locator(const std::string& value);
+  std::string* _internal_mutable_service_locator();
+  public:
+
+  // required fixed64 server_id = 2;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required uint32 service_mask = 3;
+  bool has_service_mask() const;
+  private:
+  bool _internal_has_service_mask() const;
+  public:
+  void clear_service_mask();
+  uint32_t service_mask() const;
+  void set_service_mask(uint32_t value);
+  private:
+  uint32_t _internal_service_mask() const;
+  void _internal_set_service_mask(uint32_t value);
+  public:
+
+  // required uint32 read_speed = 4;
+  bool has_read_speed() const;
+  private:
+  bool _internal_has_read_speed() const;
+  public:
+  void clear_read_speed();
+  uint32_t read_speed() const;
+  void set_read_speed(uint32_t value);
+  private:
+  uint32_t _internal_read_speed() const;
+  void _internal_set_read_speed(uint32_t value);
+  public:
+
+  // optional uint64 update_version = 7;
+  bool has_update_version() const;
+  private:
+  bool _internal_has_update_version() const;
+  public:
+  void clear_update_version();
+  uint64_t update_version() const;
+  void set_update_version(uint64_t value);
+  private:
+  uint64_t _internal_update_version() const;
+  void _internal_set_update_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerInformation)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entry_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_locator_;
+    uint64_t server_id_;
+    uint32_t service_mask_;
+    uint32_t read_speed_;
+    uint64_t update_version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerInformation_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerInformation
+
+// required string entry_type = 1;
+inline bool ServerInformation::_internal_has_entry_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerInformation::has_entry_type() const {
+  return _internal_has_entry_type();
+}
+inline void ServerInformation::clear_entry_type() {
+  _impl_.entry_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerInformation::entry_type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerInformation.entry_type)
+  return _internal_entry_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerInformation::set_entry_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entry_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerInformation.entry_type)
+}
+inline std::string* ServerInformation::mutable_entry_type() {
+  std::string* _s = _internal_mutable_entry_type();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerInformation.entry_type)
+  return _s;
+}
+inline const std::string& ServerInformation::_internal_entry_type() const {
+  return _impl_.entry_type_.Get();
+}
+inline void ServerInformation::_internal_set_entry_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entry_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerInformation::_internal_mutable_entry_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entry_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerInformation::release_entry_type() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerInformation.entry_type)
+  if (!_internal_has_entry_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entry_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerInformation::set_allocated_entry_type(std::string* entry_type) {
+  if (entry_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entry_type_.SetAllocated(entry_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerInformation.entry_type)
+}
+
+// required fixed64 server_id = 2;
+inline bool ServerInformation::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerInformation::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void ServerInformation::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerInformation::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t ServerInformation::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerInformation.server_id)
+  return _internal_server_id();
+}
+inline void ServerInformation::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.server_id_ = value;
+}
+inline void ServerInformation::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerInformation.server_id)
+}
+
+// required uint32 service_mask = 3;
+inline bool ServerInformation::_internal_has_service_mask() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerInformation::has_service_mask() const {
+  return _internal_has_service_mask();
+}
+inline void ServerInformation::clear_service_mask() {
+  _impl_.service_mask_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ServerInformation::_internal_service_mask() const {
+  return _impl_.service_mask_;
+}
+inline uint32_t ServerInformation::service_mask() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerInformation.service_mask)
+  return _internal_service_mask();
+}
+inline void ServerInformation::_internal_set_service_mask(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.service_mask_ = value;
+}
+inline void ServerInformation::set_service_mask(uint32_t value) {
+  _internal_set_service_mask(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerInformation.service_mask)
+}
+
+// required uint32 read_speed = 4;
+inline bool ServerInformation::_internal_has_read_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerInformation::has_read_speed() const {
+  return _internal_has_read_speed();
+}
+inline void ServerInformation::clear_read_speed() {
+  _impl_.read_speed_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t ServerInformation::_internal_read_speed() const {
+  return _impl_.read_speed_;
+}
+inline uint32_t ServerInformation::read_speed() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerInformation.read_speed)
+  return _internal_read_speed();
+}
+inline void ServerInformation::_internal_set_read_speed(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.read_speed_ = value;
+}
+inline void ServerInformation::set_read_speed(uint32_t value) {
+  _internal_set_read_speed(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerInformation.read_speed)
+}
+
+// required string service_locator = 6;
+inline bool ServerInformation::_internal_has_service_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerInformation::has_service_locator() const {
+  return _internal_has_service_locator();
+}
+inline void ServerInformation::clear_service_locator() {
+  _impl_.service_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ServerInformation::service_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerInformation.service_locator)
+  return _internal_service_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerInformation::set_service_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.service_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerInformation.service_locator)
+}
+inline std::string* ServerInformation::mutable_service_locator() {
+  std::string* _s = _internal_mutable_service_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerInformation.service_locator)
+  return _s;
+}
+inline const std::string& ServerInformation::_internal_service_locator() const {
+  return _impl_.service_locator_.Get();
+}
+inline void ServerInformation::_internal_set_service_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.service_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerInformation::_internal_mutable_service_locator() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.service_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerInformation::release_service_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerInformation.service_locator)
+  if (!_internal_has_service_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.service_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerInformation::set_allocated_service_locator(std::string* service_locator) {
+  if (service_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.service_locator_.SetAllocated(service_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerInformation.service_locator)
+}
+
+// optional uint64 update_version = 7;
+inline bool ServerInformation::_internal_has_update_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerInformation::has_update_version() const {
+  return _internal_has_update_version();
+}
+inline void ServerInformation::clear_update_version() {
+  _impl_.update_version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t ServerInformation::_internal_update_version() const {
+  return _impl_.update_version_;
+}
+inline uint64_t ServerInformation::update_version() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerInformation.update_version)
+  return _internal_update_version();
+}
+inline void ServerInformation::_internal_set_update_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.update_version_ = value;
+}
+inline void ServerInformation::set_update_version(uint64_t value) {
+  _internal_set_update_version(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerInformation.update_version)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerInformation_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,883 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerList.proto
+
+#include "ServerList.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR ServerList_Entry::ServerList_Entry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.service_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.services_)*/0u
+  , /*decltype(_impl_.expected_read_mbytes_per_sec_)*/0u
+  , /*decltype(_impl_.replication_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0u} {}
+struct ServerList_EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerList_EntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerList_EntryDefaultTypeInternal() {}
+  union {
+    ServerList_Entry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerList_EntryDefaultTypeInternal _ServerList_Entry_default_instance_;
+PROTOBUF_CONSTEXPR ServerList::ServerList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.server_)*/{}
+  , /*decltype(_impl_.version_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0} {}
+struct ServerListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerListDefaultTypeInternal() {}
+  union {
+    ServerList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerListDefaultTypeInternal _ServerList_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ServerList_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ServerList_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ServerList_2eproto = nullptr;
+
+const uint32_t TableStruct_ServerList_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _impl_.services_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _impl_.service_locator_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _impl_.expected_read_mbytes_per_sec_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList_Entry, _impl_.replication_id_),
+  2,
+  1,
+  0,
+  3,
+  5,
+  4,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList, _impl_.server_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList, _impl_.version_number_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerList, _impl_.type_),
+  ~0u,
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::RAMCloud::ProtoBuf::ServerList_Entry)},
+  { 18, 27, -1, sizeof(::RAMCloud::ProtoBuf::ServerList)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_ServerList_Entry_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerList_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ServerList_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020ServerList.proto\022\021RAMCloud.ProtoBuf\"\304\002"
+  "\n\nServerList\0223\n\006server\030\001 \003(\0132#.RAMCloud."
+  "ProtoBuf.ServerList.Entry\022\026\n\016version_num"
+  "ber\030\002 \002(\006\0220\n\004type\030\003 \002(\0162\".RAMCloud.Proto"
+  "Buf.ServerList.Type\032\223\001\n\005Entry\022\020\n\010service"
+  "s\030\001 \002(\007\022\021\n\tserver_id\030\002 \002(\006\022\027\n\017service_lo"
+  "cator\030\003 \002(\t\022$\n\034expected_read_mbytes_per_"
+  "sec\030\005 \002(\007\022\016\n\006status\030\006 \002(\007\022\026\n\016replication"
+  "_id\030\007 \002(\006\"!\n\004Type\022\r\n\tFULL_LIST\020\000\022\n\n\006UPDA"
+  "TE\020\001"
+  ;
+static ::_pbi::once_flag descriptor_table_ServerList_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ServerList_2eproto = {
+    false, false, 364, descriptor_table_protodef_ServerList_2eproto,
+    "ServerList.proto",
+    &descriptor_table_ServerList_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_ServerList_2eproto::offsets,
+    file_level_metadata_ServerList_2eproto, file_level_enum_descriptors_ServerList_2eproto,
+    file_level_service_descriptors_ServerList_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ServerList_2eproto_getter() {
+  return &descriptor_table_ServerList_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ServerList_2eproto(&descriptor_table_ServerList_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ServerList_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ServerList_2eproto);
+  return file_level_enum_descriptors_ServerList_2eproto[0];
+}
+bool ServerList_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ServerList_Type ServerList::FULL_LIST;
+constexpr ServerList_Type ServerList::UPDATE;
+constexpr ServerList_Type ServerList::Type_MIN;
+constexpr ServerList_Type ServerList::Type_MAX;
+constexpr int ServerList::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class ServerList_Entry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerList_Entry>()._impl_._has_bits_);
+  static void set_has_services(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_service_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_expected_read_mbytes_per_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_replication_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003f) ^ 0x0000003f) != 0;
+  }
+};
+
+ServerList_Entry::ServerList_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerList.Entry)
+}
+ServerList_Entry::ServerList_Entry(const ServerList_Entry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerList_Entry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.services_){}
+    , decltype(_impl_.expected_read_mbytes_per_sec_){}
+    , decltype(_impl_.replication_id_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_locator()) {
+    _this->_impl_.service_locator_.Set(from._internal_service_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.server_id_, &from._impl_.server_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerList.Entry)
+}
+
+inline void ServerList_Entry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.services_){0u}
+    , decltype(_impl_.expected_read_mbytes_per_sec_){0u}
+    , decltype(_impl_.replication_id_){uint64_t{0u}}
+    , decltype(_impl_.status_){0u}
+  };
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerList_Entry::~ServerList_Entry() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerList.Entry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerList_Entry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_locator_.Destroy();
+}
+
+void ServerList_Entry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerList_Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerList.Entry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.service_locator_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.server_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_) -
+        reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.status_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerList_Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed32 services = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_services(&has_bits);
+          _impl_.services_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 server_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string service_locator = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_service_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerList.Entry.service_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 expected_read_mbytes_per_sec = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_expected_read_mbytes_per_sec(&has_bits);
+          _impl_.expected_read_mbytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 status = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_status(&has_bits);
+          _impl_.status_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 replication_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_replication_id(&has_bits);
+          _impl_.replication_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerList_Entry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerList.Entry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed32 services = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_services(), target);
+  }
+
+  // required fixed64 server_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_server_id(), target);
+  }
+
+  // required string service_locator = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_locator().data(), static_cast<int>(this->_internal_service_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerList.Entry.service_locator");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_service_locator(), target);
+  }
+
+  // required fixed32 expected_read_mbytes_per_sec = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(5, this->_internal_expected_read_mbytes_per_sec(), target);
+  }
+
+  // required fixed32 status = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(6, this->_internal_status(), target);
+  }
+
+  // required fixed64 replication_id = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_replication_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerList.Entry)
+  return target;
+}
+
+size_t ServerList_Entry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerList.Entry)
+  size_t total_size = 0;
+
+  if (_internal_has_service_locator()) {
+    // required string service_locator = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_services()) {
+    // required fixed32 services = 1;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_expected_read_mbytes_per_sec()) {
+    // required fixed32 expected_read_mbytes_per_sec = 5;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_replication_id()) {
+    // required fixed64 replication_id = 7;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_status()) {
+    // required fixed32 status = 6;
+    total_size += 1 + 4;
+  }
+
+  return total_size;
+}
+size_t ServerList_Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerList.Entry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003f) ^ 0x0000003f) == 0) {  // All required fields are present.
+    // required string service_locator = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+
+    // required fixed32 services = 1;
+    total_size += 1 + 4;
+
+    // required fixed32 expected_read_mbytes_per_sec = 5;
+    total_size += 1 + 4;
+
+    // required fixed64 replication_id = 7;
+    total_size += 1 + 8;
+
+    // required fixed32 status = 6;
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerList_Entry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerList_Entry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerList_Entry::GetClassData() const { return &_class_data_; }
+
+
+void ServerList_Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerList_Entry*>(&to_msg);
+  auto& from = static_cast<const ServerList_Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerList.Entry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_service_locator(from._internal_service_locator());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.services_ = from._impl_.services_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.expected_read_mbytes_per_sec_ = from._impl_.expected_read_mbytes_per_sec_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.replication_id_ = from._impl_.replication_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerList_Entry::CopyFrom(const ServerList_Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerList.Entry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerList_Entry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerList_Entry::InternalSwap(ServerList_Entry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_locator_, lhs_arena,
+      &other->_impl_.service_locator_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerList_Entry, _impl_.status_)
+      + sizeof(ServerList_Entry::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(ServerList_Entry, _impl_.server_id_)>(
+          reinterpret_cast<char*>(&_impl_.server_id_),
+          reinterpret_cast<char*>(&other->_impl_.server_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerList_Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerList_2eproto_getter, &descriptor_table_ServerList_2eproto_once,
+      file_level_metadata_ServerList_2eproto[0]);
+}
+
+// ===================================================================
+
+class ServerList::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerList>()._impl_._has_bits_);
+  static void set_has_version_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ServerList::ServerList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerList)
+}
+ServerList::ServerList(const ServerList& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.server_){from._impl_.server_}
+    , decltype(_impl_.version_number_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_number_, &from._impl_.version_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.version_number_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerList)
+}
+
+inline void ServerList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.server_){arena}
+    , decltype(_impl_.version_number_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+  };
+}
+
+ServerList::~ServerList() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.server_.~RepeatedPtrField();
+}
+
+void ServerList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerList::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.version_number_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.version_number_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .RAMCloud.ProtoBuf.ServerList.Entry server = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_server(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 version_number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_version_number(&has_bits);
+          _impl_.version_number_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.ServerList.Type type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::RAMCloud::ProtoBuf::ServerList_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::RAMCloud::ProtoBuf::ServerList_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.ServerList.Entry server = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_server_size()); i < n; i++) {
+    const auto& repfield = this->_internal_server(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 version_number = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_version_number(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.ServerList.Type type = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerList)
+  return target;
+}
+
+size_t ServerList::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerList)
+  size_t total_size = 0;
+
+  if (_internal_has_version_number()) {
+    // required fixed64 version_number = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_type()) {
+    // required .RAMCloud.ProtoBuf.ServerList.Type type = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return total_size;
+}
+size_t ServerList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerList)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required fixed64 version_number = 2;
+    total_size += 1 + 8;
+
+    // required .RAMCloud.ProtoBuf.ServerList.Type type = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.ServerList.Entry server = 1;
+  total_size += 1UL * this->_internal_server_size();
+  for (const auto& msg : this->_impl_.server_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerList::GetClassData() const { return &_class_data_; }
+
+
+void ServerList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerList*>(&to_msg);
+  auto& from = static_cast<const ServerList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.server_.MergeFrom(from._impl_.server_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.version_number_ = from._impl_.version_number_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerList::CopyFrom(const ServerList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerList::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.server_))
+    return false;
+  return true;
+}
+
+void ServerList::InternalSwap(ServerList* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.server_.InternalSwap(&other->_impl_.server_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerList, _impl_.type_)
+      + sizeof(ServerList::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(ServerList, _impl_.version_number_)>(
+          reinterpret_cast<char*>(&_impl_.version_number_),
+          reinterpret_cast<char*>(&other->_impl_.version_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerList_2eproto_getter, &descriptor_table_ServerList_2eproto_once,
+      file_level_metadata_ServerList_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerList_Entry*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerList_Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerList_Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerList*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerList >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
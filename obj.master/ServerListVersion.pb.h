@@ -0,0 +1,363 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerListVersion.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerListVersion_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerListVersion_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerListVersion_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerListVersion_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerListVersion_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerListVersion;
+struct ServerListVersionDefaultTypeInternal;
+extern ServerListVersionDefaultTypeInternal _ServerListVersion_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerListVersion* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerListVersion>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerListVersion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerListVersion) */ {
+ public:
+  inline ServerListVersion() : ServerListVersion(nullptr) {}
+  ~ServerListVersion() override;
+  explicit PROTOBUF_CONSTEXPR ServerListVersion(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerListVersion(const ServerListVersion& from);
+  ServerListVersion(ServerListVersion&& from) noexcept
+    : ServerListVersion() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerListVersion& operator=(const ServerListVersion& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerListVersion& operator=(ServerListVersion&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerListVersion& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerListVersion* internal_default_instance() {
+    return reinterpret_cast<const ServerListVersion*>(
+               &_ServerListVersion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerListVersion& a, ServerListVersion& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerListVersion* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerListVersion* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerListVersion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerListVersion>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerListVersion& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerListVersion& from) {
+    ServerListVersion::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerListVersion* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerListVersion";
+  }
+  protected:
+  explicit ServerListVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntryTypeFieldNumber = 1,
+    kVersionFieldNumber = 2,
+  };
+  // required string entry_type = 1;
+  bool has_entry_type() const;
+  private:
+  bool _internal_has_entry_type() const;
+  public:
+  void clear_entry_type();
+  const std::string& entry_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entry_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entry_type();
+  PROTOBUF_NODISCARD std::string* release_entry_type();
+  void set_allocated_entry_type(std::string* entry_type);
+  private:
+  const std::string& _internal_entry_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entry_type(const std::string& value);
+  std::string* _internal_mutable_entry_type();
+  public:
+
+  // required uint64 version = 2;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerListVersion)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entry_type_;
+    uint64_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerListVersion_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerListVersion
+
+// required string entry_type = 1;
+inline bool ServerListVersion::_internal_has_entry_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerListVersion::has_entry_type() const {
+  return _internal_has_entry_type();
+}
+inline void ServerListVersion::clear_entry_type() {
+  _impl_.entry_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerListVersion::entry_type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListVersion.entry_type)
+  return _internal_entry_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerListVersion::set_entry_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entry_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListVersion.entry_type)
+}
+inline std::string* ServerListVersion::mutable_entry_type() {
+  std::string* _s = _internal_mutable_entry_type();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerListVersion.entry_type)
+  return _s;
+}
+inline const std::string& ServerListVersion::_internal_entry_type() const {
+  return _impl_.entry_type_.Get();
+}
+inline void ServerListVersion::_internal_set_entry_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entry_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerListVersion::_internal_mutable_entry_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entry_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerListVersion::release_entry_type() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerListVersion.entry_type)
+  if (!_internal_has_entry_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entry_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerListVersion::set_allocated_entry_type(std::string* entry_type) {
+  if (entry_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entry_type_.SetAllocated(entry_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerListVersion.entry_type)
+}
+
+// required uint64 version = 2;
+inline bool ServerListVersion::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerListVersion::has_version() const {
+  return _internal_has_version();
+}
+inline void ServerListVersion::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerListVersion::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t ServerListVersion::version() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListVersion.version)
+  return _internal_version();
+}
+inline void ServerListVersion::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void ServerListVersion::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListVersion.version)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerListVersion_2eproto
+// RAMCloud pragma [GCCWARN=0]
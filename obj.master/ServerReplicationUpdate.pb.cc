@@ -0,0 +1,489 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerReplicationUpdate.proto
+
+#include "ServerReplicationUpdate.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR ServerReplicationUpdate::ServerReplicationUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entry_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.master_recovery_info_)*/nullptr
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.replication_id_)*/uint64_t{0u}} {}
+struct ServerReplicationUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerReplicationUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerReplicationUpdateDefaultTypeInternal() {}
+  union {
+    ServerReplicationUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerReplicationUpdateDefaultTypeInternal _ServerReplicationUpdate_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ServerReplicationUpdate_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ServerReplicationUpdate_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ServerReplicationUpdate_2eproto = nullptr;
+
+const uint32_t TableStruct_ServerReplicationUpdate_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerReplicationUpdate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerReplicationUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerReplicationUpdate, _impl_.entry_type_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerReplicationUpdate, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerReplicationUpdate, _impl_.master_recovery_info_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerReplicationUpdate, _impl_.replication_id_),
+  0,
+  2,
+  1,
+  3,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::RAMCloud::ProtoBuf::ServerReplicationUpdate)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_ServerReplicationUpdate_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ServerReplicationUpdate_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\035ServerReplicationUpdate.proto\022\021RAMClou"
+  "d.ProtoBuf\032\030MasterRecoveryInfo.proto\"\235\001\n"
+  "\027ServerReplicationUpdate\022\022\n\nentry_type\030\001"
+  " \002(\t\022\021\n\tserver_id\030\002 \002(\006\022C\n\024master_recove"
+  "ry_info\030\003 \002(\0132%.RAMCloud.ProtoBuf.Master"
+  "RecoveryInfo\022\026\n\016replication_id\030\004 \002(\006"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ServerReplicationUpdate_2eproto_deps[1] = {
+  &::descriptor_table_MasterRecoveryInfo_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_ServerReplicationUpdate_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ServerReplicationUpdate_2eproto = {
+    false, false, 236, descriptor_table_protodef_ServerReplicationUpdate_2eproto,
+    "ServerReplicationUpdate.proto",
+    &descriptor_table_ServerReplicationUpdate_2eproto_once, descriptor_table_ServerReplicationUpdate_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_ServerReplicationUpdate_2eproto::offsets,
+    file_level_metadata_ServerReplicationUpdate_2eproto, file_level_enum_descriptors_ServerReplicationUpdate_2eproto,
+    file_level_service_descriptors_ServerReplicationUpdate_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ServerReplicationUpdate_2eproto_getter() {
+  return &descriptor_table_ServerReplicationUpdate_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ServerReplicationUpdate_2eproto(&descriptor_table_ServerReplicationUpdate_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerReplicationUpdate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerReplicationUpdate>()._impl_._has_bits_);
+  static void set_has_entry_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& master_recovery_info(const ServerReplicationUpdate* msg);
+  static void set_has_master_recovery_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replication_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::MasterRecoveryInfo&
+ServerReplicationUpdate::_Internal::master_recovery_info(const ServerReplicationUpdate* msg) {
+  return *msg->_impl_.master_recovery_info_;
+}
+void ServerReplicationUpdate::clear_master_recovery_info() {
+  if (_impl_.master_recovery_info_ != nullptr) _impl_.master_recovery_info_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+ServerReplicationUpdate::ServerReplicationUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+}
+ServerReplicationUpdate::ServerReplicationUpdate(const ServerReplicationUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerReplicationUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entry_type_){}
+    , decltype(_impl_.master_recovery_info_){nullptr}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.replication_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.entry_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_entry_type()) {
+    _this->_impl_.entry_type_.Set(from._internal_entry_type(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_master_recovery_info()) {
+    _this->_impl_.master_recovery_info_ = new ::RAMCloud::ProtoBuf::MasterRecoveryInfo(*from._impl_.master_recovery_info_);
+  }
+  ::memcpy(&_impl_.server_id_, &from._impl_.server_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replication_id_) -
+    reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.replication_id_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+}
+
+inline void ServerReplicationUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entry_type_){}
+    , decltype(_impl_.master_recovery_info_){nullptr}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.replication_id_){uint64_t{0u}}
+  };
+  _impl_.entry_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerReplicationUpdate::~ServerReplicationUpdate() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerReplicationUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entry_type_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.master_recovery_info_;
+}
+
+void ServerReplicationUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerReplicationUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.entry_type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.master_recovery_info_ != nullptr);
+      _impl_.master_recovery_info_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.server_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.replication_id_) -
+        reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.replication_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerReplicationUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string entry_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_entry_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerReplicationUpdate.entry_type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 server_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_master_recovery_info(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 replication_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_replication_id(&has_bits);
+          _impl_.replication_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerReplicationUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string entry_type = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_entry_type().data(), static_cast<int>(this->_internal_entry_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerReplicationUpdate.entry_type");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_entry_type(), target);
+  }
+
+  // required fixed64 server_id = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_server_id(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::master_recovery_info(this),
+        _Internal::master_recovery_info(this).GetCachedSize(), target, stream);
+  }
+
+  // required fixed64 replication_id = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_replication_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  return target;
+}
+
+size_t ServerReplicationUpdate::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  size_t total_size = 0;
+
+  if (_internal_has_entry_type()) {
+    // required string entry_type = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_entry_type());
+  }
+
+  if (_internal_has_master_recovery_info()) {
+    // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_recovery_info_);
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_replication_id()) {
+    // required fixed64 replication_id = 4;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t ServerReplicationUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string entry_type = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_entry_type());
+
+    // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_recovery_info_);
+
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+
+    // required fixed64 replication_id = 4;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerReplicationUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerReplicationUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerReplicationUpdate::GetClassData() const { return &_class_data_; }
+
+
+void ServerReplicationUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerReplicationUpdate*>(&to_msg);
+  auto& from = static_cast<const ServerReplicationUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_entry_type(from._internal_entry_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_master_recovery_info()->::RAMCloud::ProtoBuf::MasterRecoveryInfo::MergeFrom(
+          from._internal_master_recovery_info());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replication_id_ = from._impl_.replication_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerReplicationUpdate::CopyFrom(const ServerReplicationUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerReplicationUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerReplicationUpdate::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_master_recovery_info()) {
+    if (!_impl_.master_recovery_info_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ServerReplicationUpdate::InternalSwap(ServerReplicationUpdate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.entry_type_, lhs_arena,
+      &other->_impl_.entry_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerReplicationUpdate, _impl_.replication_id_)
+      + sizeof(ServerReplicationUpdate::_impl_.replication_id_)
+      - PROTOBUF_FIELD_OFFSET(ServerReplicationUpdate, _impl_.master_recovery_info_)>(
+          reinterpret_cast<char*>(&_impl_.master_recovery_info_),
+          reinterpret_cast<char*>(&other->_impl_.master_recovery_info_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerReplicationUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerReplicationUpdate_2eproto_getter, &descriptor_table_ServerReplicationUpdate_2eproto_once,
+      file_level_metadata_ServerReplicationUpdate_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerReplicationUpdate*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerReplicationUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerReplicationUpdate >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,2071 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerStatistics.proto
+
+#include "ServerStatistics.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR ServerStatistics_TabletEntry::ServerStatistics_TabletEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.number_read_and_writes_)*/uint64_t{0u}
+  , /*decltype(_impl_.byte_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.object_count_)*/uint64_t{0u}} {}
+struct ServerStatistics_TabletEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatistics_TabletEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatistics_TabletEntryDefaultTypeInternal() {}
+  union {
+    ServerStatistics_TabletEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatistics_TabletEntryDefaultTypeInternal _ServerStatistics_TabletEntry_default_instance_;
+PROTOBUF_CONSTEXPR ServerStatistics_HashTable::ServerStatistics_HashTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.num_buckets_)*/uint64_t{0u}
+  , /*decltype(_impl_.sampled_buckets_)*/uint64_t{0u}
+  , /*decltype(_impl_.load_factor_)*/0
+  , /*decltype(_impl_.average_chain_length_)*/0
+  , /*decltype(_impl_.overflowed_bucket_fraction_)*/0
+  , /*decltype(_impl_.resize_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.resize_target_buckets_)*/uint64_t{0u}
+  , /*decltype(_impl_.resize_progress_)*/0
+  , /*decltype(_impl_.max_chain_length_)*/0u} {}
+struct ServerStatistics_HashTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatistics_HashTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatistics_HashTableDefaultTypeInternal() {}
+  union {
+    ServerStatistics_HashTable _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatistics_HashTableDefaultTypeInternal _ServerStatistics_HashTable_default_instance_;
+PROTOBUF_CONSTEXPR ServerStatistics_Migration::ServerStatistics_Migration(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.phase_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.new_owner_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.progress_)*/0
+  , /*decltype(_impl_.objects_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.tombstones_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.segments_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.elapsed_seconds_)*/0
+  , /*decltype(_impl_.bytes_per_second_)*/0} {}
+struct ServerStatistics_MigrationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatistics_MigrationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatistics_MigrationDefaultTypeInternal() {}
+  union {
+    ServerStatistics_Migration _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatistics_MigrationDefaultTypeInternal _ServerStatistics_Migration_default_instance_;
+PROTOBUF_CONSTEXPR ServerStatistics::ServerStatistics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tabletentry_)*/{}
+  , /*decltype(_impl_.migration_)*/{}
+  , /*decltype(_impl_.spin_lock_stats_)*/nullptr
+  , /*decltype(_impl_.hash_table_)*/nullptr} {}
+struct ServerStatisticsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatisticsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatisticsDefaultTypeInternal() {}
+  union {
+    ServerStatistics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatisticsDefaultTypeInternal _ServerStatistics_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ServerStatistics_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ServerStatistics_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ServerStatistics_2eproto = nullptr;
+
+const uint32_t TableStruct_ServerStatistics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.start_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.end_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.number_read_and_writes_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.byte_count_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.object_count_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.num_buckets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.sampled_buckets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.load_factor_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.average_chain_length_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.max_chain_length_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.overflowed_bucket_fraction_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.resize_count_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.resize_target_buckets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_HashTable, _impl_.resize_progress_),
+  0,
+  1,
+  2,
+  3,
+  8,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.start_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.end_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.new_owner_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.progress_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.objects_sent_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.tombstones_sent_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.bytes_sent_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.segments_sent_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.elapsed_seconds_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_Migration, _impl_.bytes_per_second_),
+  1,
+  2,
+  3,
+  4,
+  0,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_.tabletentry_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_.spin_lock_stats_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_.hash_table_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_.migration_),
+  ~0u,
+  0,
+  1,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry)},
+  { 18, 33, -1, sizeof(::RAMCloud::ProtoBuf::ServerStatistics_HashTable)},
+  { 42, 60, -1, sizeof(::RAMCloud::ProtoBuf::ServerStatistics_Migration)},
+  { 72, 82, -1, sizeof(::RAMCloud::ProtoBuf::ServerStatistics)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_ServerStatistics_TabletEntry_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerStatistics_HashTable_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerStatistics_Migration_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerStatistics_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ServerStatistics_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026ServerStatistics.proto\022\021RAMCloud.Proto"
+  "Buf\032\030SpinLockStatistics.proto\"\315\007\n\020Server"
+  "Statistics\022D\n\013tabletentry\030\001 \003(\0132/.RAMClo"
+  "ud.ProtoBuf.ServerStatistics.TabletEntry"
+  "\022>\n\017spin_lock_stats\030\002 \002(\0132%.RAMCloud.Pro"
+  "toBuf.SpinLockStatistics\022A\n\nhash_table\030\003"
+  " \001(\0132-.RAMCloud.ProtoBuf.ServerStatistic"
+  "s.HashTable\022@\n\tmigration\030\004 \003(\0132-.RAMClou"
+  "d.ProtoBuf.ServerStatistics.Migration\032\240\001"
+  "\n\013TabletEntry\022\020\n\010table_id\030\001 \002(\004\022\026\n\016start"
+  "_key_hash\030\002 \002(\004\022\024\n\014end_key_hash\030\003 \002(\004\022!\n"
+  "\026number_read_and_writes\030\004 \001(\004:\0010\022\025\n\nbyte"
+  "_count\030\005 \001(\004:\0010\022\027\n\014object_count\030\006 \001(\004:\0010"
+  "\032\370\001\n\tHashTable\022\023\n\013num_buckets\030\001 \002(\004\022\027\n\017s"
+  "ampled_buckets\030\002 \002(\004\022\023\n\013load_factor\030\003 \001("
+  "\001\022\034\n\024average_chain_length\030\004 \001(\001\022\030\n\020max_c"
+  "hain_length\030\005 \001(\r\022\"\n\032overflowed_bucket_f"
+  "raction\030\006 \001(\001\022\024\n\014resize_count\030\007 \002(\004\022\035\n\025r"
+  "esize_target_buckets\030\010 \001(\004\022\027\n\017resize_pro"
+  "gress\030\t \001(\001\032\217\002\n\tMigration\022\020\n\010table_id\030\001 "
+  "\002(\004\022\026\n\016start_key_hash\030\002 \002(\004\022\024\n\014end_key_h"
+  "ash\030\003 \002(\004\022\024\n\014new_owner_id\030\004 \002(\004\022\r\n\005phase"
+  "\030\005 \002(\t\022\020\n\010progress\030\006 \002(\001\022\024\n\014objects_sent"
+  "\030\007 \002(\004\022\027\n\017tombstones_sent\030\010 \002(\004\022\022\n\nbytes"
+  "_sent\030\t \002(\004\022\025\n\rsegments_sent\030\n \002(\004\022\027\n\017el"
+  "apsed_seconds\030\013 \002(\001\022\030\n\020bytes_per_second\030"
+  "\014 \002(\001"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ServerStatistics_2eproto_deps[1] = {
+  &::descriptor_table_SpinLockStatistics_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_ServerStatistics_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ServerStatistics_2eproto = {
+    false, false, 1045, descriptor_table_protodef_ServerStatistics_2eproto,
+    "ServerStatistics.proto",
+    &descriptor_table_ServerStatistics_2eproto_once, descriptor_table_ServerStatistics_2eproto_deps, 1, 4,
+    schemas, file_default_instances, TableStruct_ServerStatistics_2eproto::offsets,
+    file_level_metadata_ServerStatistics_2eproto, file_level_enum_descriptors_ServerStatistics_2eproto,
+    file_level_service_descriptors_ServerStatistics_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ServerStatistics_2eproto_getter() {
+  return &descriptor_table_ServerStatistics_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ServerStatistics_2eproto(&descriptor_table_ServerStatistics_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerStatistics_TabletEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerStatistics_TabletEntry>()._impl_._has_bits_);
+  static void set_has_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_start_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_end_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_number_read_and_writes(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_byte_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_object_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+ServerStatistics_TabletEntry::ServerStatistics_TabletEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+}
+ServerStatistics_TabletEntry::ServerStatistics_TabletEntry(const ServerStatistics_TabletEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStatistics_TabletEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_id_){}
+    , decltype(_impl_.start_key_hash_){}
+    , decltype(_impl_.end_key_hash_){}
+    , decltype(_impl_.number_read_and_writes_){}
+    , decltype(_impl_.byte_count_){}
+    , decltype(_impl_.object_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.table_id_, &from._impl_.table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.object_count_) -
+    reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.object_count_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+}
+
+inline void ServerStatistics_TabletEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_id_){uint64_t{0u}}
+    , decltype(_impl_.start_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.end_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.number_read_and_writes_){uint64_t{0u}}
+    , decltype(_impl_.byte_count_){uint64_t{0u}}
+    , decltype(_impl_.object_count_){uint64_t{0u}}
+  };
+}
+
+ServerStatistics_TabletEntry::~ServerStatistics_TabletEntry() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStatistics_TabletEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ServerStatistics_TabletEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStatistics_TabletEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.object_count_) -
+        reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.object_count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStatistics_TabletEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 table_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_table_id(&has_bits);
+          _impl_.table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 start_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_start_key_hash(&has_bits);
+          _impl_.start_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end_key_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end_key_hash(&has_bits);
+          _impl_.end_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 number_read_and_writes = 4 [default = 0];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_number_read_and_writes(&has_bits);
+          _impl_.number_read_and_writes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 byte_count = 5 [default = 0];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_byte_count(&has_bits);
+          _impl_.byte_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 object_count = 6 [default = 0];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_object_count(&has_bits);
+          _impl_.object_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStatistics_TabletEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 table_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_table_id(), target);
+  }
+
+  // required uint64 start_key_hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_start_key_hash(), target);
+  }
+
+  // required uint64 end_key_hash = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end_key_hash(), target);
+  }
+
+  // optional uint64 number_read_and_writes = 4 [default = 0];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_number_read_and_writes(), target);
+  }
+
+  // optional uint64 byte_count = 5 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_byte_count(), target);
+  }
+
+  // optional uint64 object_count = 6 [default = 0];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_object_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  return target;
+}
+
+size_t ServerStatistics_TabletEntry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  size_t total_size = 0;
+
+  if (_internal_has_table_id()) {
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+  }
+
+  if (_internal_has_start_key_hash()) {
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+  }
+
+  if (_internal_has_end_key_hash()) {
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+  }
+
+  return total_size;
+}
+size_t ServerStatistics_TabletEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000038u) {
+    // optional uint64 number_read_and_writes = 4 [default = 0];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_number_read_and_writes());
+    }
+
+    // optional uint64 byte_count = 5 [default = 0];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_byte_count());
+    }
+
+    // optional uint64 object_count = 6 [default = 0];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_object_count());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatistics_TabletEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStatistics_TabletEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatistics_TabletEntry::GetClassData() const { return &_class_data_; }
+
+
+void ServerStatistics_TabletEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStatistics_TabletEntry*>(&to_msg);
+  auto& from = static_cast<const ServerStatistics_TabletEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.table_id_ = from._impl_.table_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.start_key_hash_ = from._impl_.start_key_hash_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.end_key_hash_ = from._impl_.end_key_hash_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.number_read_and_writes_ = from._impl_.number_read_and_writes_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.byte_count_ = from._impl_.byte_count_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.object_count_ = from._impl_.object_count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStatistics_TabletEntry::CopyFrom(const ServerStatistics_TabletEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerStatistics_TabletEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerStatistics_TabletEntry::InternalSwap(ServerStatistics_TabletEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStatistics_TabletEntry, _impl_.object_count_)
+      + sizeof(ServerStatistics_TabletEntry::_impl_.object_count_)
+      - PROTOBUF_FIELD_OFFSET(ServerStatistics_TabletEntry, _impl_.table_id_)>(
+          reinterpret_cast<char*>(&_impl_.table_id_),
+          reinterpret_cast<char*>(&other->_impl_.table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistics_TabletEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerStatistics_2eproto_getter, &descriptor_table_ServerStatistics_2eproto_once,
+      file_level_metadata_ServerStatistics_2eproto[0]);
+}
+
+// ===================================================================
+
+class ServerStatistics_HashTable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerStatistics_HashTable>()._impl_._has_bits_);
+  static void set_has_num_buckets(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sampled_buckets(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_load_factor(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_average_chain_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_max_chain_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_overflowed_bucket_fraction(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_resize_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_resize_target_buckets(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_resize_progress(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000023) ^ 0x00000023) != 0;
+  }
+};
+
+ServerStatistics_HashTable::ServerStatistics_HashTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+}
+ServerStatistics_HashTable::ServerStatistics_HashTable(const ServerStatistics_HashTable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStatistics_HashTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_buckets_){}
+    , decltype(_impl_.sampled_buckets_){}
+    , decltype(_impl_.load_factor_){}
+    , decltype(_impl_.average_chain_length_){}
+    , decltype(_impl_.overflowed_bucket_fraction_){}
+    , decltype(_impl_.resize_count_){}
+    , decltype(_impl_.resize_target_buckets_){}
+    , decltype(_impl_.resize_progress_){}
+    , decltype(_impl_.max_chain_length_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_buckets_, &from._impl_.num_buckets_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_chain_length_) -
+    reinterpret_cast<char*>(&_impl_.num_buckets_)) + sizeof(_impl_.max_chain_length_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+}
+
+inline void ServerStatistics_HashTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_buckets_){uint64_t{0u}}
+    , decltype(_impl_.sampled_buckets_){uint64_t{0u}}
+    , decltype(_impl_.load_factor_){0}
+    , decltype(_impl_.average_chain_length_){0}
+    , decltype(_impl_.overflowed_bucket_fraction_){0}
+    , decltype(_impl_.resize_count_){uint64_t{0u}}
+    , decltype(_impl_.resize_target_buckets_){uint64_t{0u}}
+    , decltype(_impl_.resize_progress_){0}
+    , decltype(_impl_.max_chain_length_){0u}
+  };
+}
+
+ServerStatistics_HashTable::~ServerStatistics_HashTable() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStatistics_HashTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ServerStatistics_HashTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStatistics_HashTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.num_buckets_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.resize_progress_) -
+        reinterpret_cast<char*>(&_impl_.num_buckets_)) + sizeof(_impl_.resize_progress_));
+  }
+  _impl_.max_chain_length_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStatistics_HashTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 num_buckets = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_buckets(&has_bits);
+          _impl_.num_buckets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sampled_buckets = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sampled_buckets(&has_bits);
+          _impl_.sampled_buckets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double load_factor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_load_factor(&has_bits);
+          _impl_.load_factor_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double average_chain_length = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_average_chain_length(&has_bits);
+          _impl_.average_chain_length_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 max_chain_length = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_max_chain_length(&has_bits);
+          _impl_.max_chain_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double overflowed_bucket_fraction = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_overflowed_bucket_fraction(&has_bits);
+          _impl_.overflowed_bucket_fraction_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 resize_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_resize_count(&has_bits);
+          _impl_.resize_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 resize_target_buckets = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_resize_target_buckets(&has_bits);
+          _impl_.resize_target_buckets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double resize_progress = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_resize_progress(&has_bits);
+          _impl_.resize_progress_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStatistics_HashTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 num_buckets = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_num_buckets(), target);
+  }
+
+  // required uint64 sampled_buckets = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sampled_buckets(), target);
+  }
+
+  // optional double load_factor = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_load_factor(), target);
+  }
+
+  // optional double average_chain_length = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_average_chain_length(), target);
+  }
+
+  // optional uint32 max_chain_length = 5;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_max_chain_length(), target);
+  }
+
+  // optional double overflowed_bucket_fraction = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_overflowed_bucket_fraction(), target);
+  }
+
+  // required uint64 resize_count = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_resize_count(), target);
+  }
+
+  // optional uint64 resize_target_buckets = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_resize_target_buckets(), target);
+  }
+
+  // optional double resize_progress = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_resize_progress(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  return target;
+}
+
+size_t ServerStatistics_HashTable::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  size_t total_size = 0;
+
+  if (_internal_has_num_buckets()) {
+    // required uint64 num_buckets = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_buckets());
+  }
+
+  if (_internal_has_sampled_buckets()) {
+    // required uint64 sampled_buckets = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sampled_buckets());
+  }
+
+  if (_internal_has_resize_count()) {
+    // required uint64 resize_count = 7;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_resize_count());
+  }
+
+  return total_size;
+}
+size_t ServerStatistics_HashTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000023) ^ 0x00000023) == 0) {  // All required fields are present.
+    // required uint64 num_buckets = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_buckets());
+
+    // required uint64 sampled_buckets = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sampled_buckets());
+
+    // required uint64 resize_count = 7;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_resize_count());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001cu) {
+    // optional double load_factor = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double average_chain_length = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double overflowed_bucket_fraction = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x000000c0u) {
+    // optional uint64 resize_target_buckets = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_resize_target_buckets());
+    }
+
+    // optional double resize_progress = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  // optional uint32 max_chain_length = 5;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_chain_length());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatistics_HashTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStatistics_HashTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatistics_HashTable::GetClassData() const { return &_class_data_; }
+
+
+void ServerStatistics_HashTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStatistics_HashTable*>(&to_msg);
+  auto& from = static_cast<const ServerStatistics_HashTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.num_buckets_ = from._impl_.num_buckets_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sampled_buckets_ = from._impl_.sampled_buckets_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.load_factor_ = from._impl_.load_factor_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.average_chain_length_ = from._impl_.average_chain_length_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.overflowed_bucket_fraction_ = from._impl_.overflowed_bucket_fraction_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.resize_count_ = from._impl_.resize_count_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.resize_target_buckets_ = from._impl_.resize_target_buckets_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.resize_progress_ = from._impl_.resize_progress_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_max_chain_length(from._internal_max_chain_length());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStatistics_HashTable::CopyFrom(const ServerStatistics_HashTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerStatistics_HashTable::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerStatistics_HashTable::InternalSwap(ServerStatistics_HashTable* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStatistics_HashTable, _impl_.max_chain_length_)
+      + sizeof(ServerStatistics_HashTable::_impl_.max_chain_length_)
+      - PROTOBUF_FIELD_OFFSET(ServerStatistics_HashTable, _impl_.num_buckets_)>(
+          reinterpret_cast<char*>(&_impl_.num_buckets_),
+          reinterpret_cast<char*>(&other->_impl_.num_buckets_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistics_HashTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerStatistics_2eproto_getter, &descriptor_table_ServerStatistics_2eproto_once,
+      file_level_metadata_ServerStatistics_2eproto[1]);
+}
+
+// ===================================================================
+
+class ServerStatistics_Migration::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerStatistics_Migration>()._impl_._has_bits_);
+  static void set_has_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_start_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_end_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_new_owner_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_phase(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_progress(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_objects_sent(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_tombstones_sent(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_bytes_sent(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_segments_sent(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_elapsed_seconds(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_bytes_per_second(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000fff) ^ 0x00000fff) != 0;
+  }
+};
+
+ServerStatistics_Migration::ServerStatistics_Migration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+}
+ServerStatistics_Migration::ServerStatistics_Migration(const ServerStatistics_Migration& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStatistics_Migration* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.table_id_){}
+    , decltype(_impl_.start_key_hash_){}
+    , decltype(_impl_.end_key_hash_){}
+    , decltype(_impl_.new_owner_id_){}
+    , decltype(_impl_.progress_){}
+    , decltype(_impl_.objects_sent_){}
+    , decltype(_impl_.tombstones_sent_){}
+    , decltype(_impl_.bytes_sent_){}
+    , decltype(_impl_.segments_sent_){}
+    , decltype(_impl_.elapsed_seconds_){}
+    , decltype(_impl_.bytes_per_second_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_phase()) {
+    _this->_impl_.phase_.Set(from._internal_phase(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.table_id_, &from._impl_.table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bytes_per_second_) -
+    reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.bytes_per_second_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+}
+
+inline void ServerStatistics_Migration::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.table_id_){uint64_t{0u}}
+    , decltype(_impl_.start_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.end_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.new_owner_id_){uint64_t{0u}}
+    , decltype(_impl_.progress_){0}
+    , decltype(_impl_.objects_sent_){uint64_t{0u}}
+    , decltype(_impl_.tombstones_sent_){uint64_t{0u}}
+    , decltype(_impl_.bytes_sent_){uint64_t{0u}}
+    , decltype(_impl_.segments_sent_){uint64_t{0u}}
+    , decltype(_impl_.elapsed_seconds_){0}
+    , decltype(_impl_.bytes_per_second_){0}
+  };
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerStatistics_Migration::~ServerStatistics_Migration() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStatistics_Migration::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.phase_.Destroy();
+}
+
+void ServerStatistics_Migration::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStatistics_Migration::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.phase_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tombstones_sent_) -
+        reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.tombstones_sent_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.bytes_sent_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bytes_per_second_) -
+        reinterpret_cast<char*>(&_impl_.bytes_sent_)) + sizeof(_impl_.bytes_per_second_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStatistics_Migration::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 table_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_table_id(&has_bits);
+          _impl_.table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 start_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_start_key_hash(&has_bits);
+          _impl_.start_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end_key_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end_key_hash(&has_bits);
+          _impl_.end_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 new_owner_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_new_owner_id(&has_bits);
+          _impl_.new_owner_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string phase = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_phase();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerStatistics.Migration.phase");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required double progress = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_progress(&has_bits);
+          _impl_.progress_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 objects_sent = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_objects_sent(&has_bits);
+          _impl_.objects_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 tombstones_sent = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_tombstones_sent(&has_bits);
+          _impl_.tombstones_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 bytes_sent = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_bytes_sent(&has_bits);
+          _impl_.bytes_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 segments_sent = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_segments_sent(&has_bits);
+          _impl_.segments_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double elapsed_seconds = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_elapsed_seconds(&has_bits);
+          _impl_.elapsed_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double bytes_per_second = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_bytes_per_second(&has_bits);
+          _impl_.bytes_per_second_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStatistics_Migration::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 table_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_table_id(), target);
+  }
+
+  // required uint64 start_key_hash = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_start_key_hash(), target);
+  }
+
+  // required uint64 end_key_hash = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end_key_hash(), target);
+  }
+
+  // required uint64 new_owner_id = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_new_owner_id(), target);
+  }
+
+  // required string phase = 5;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_phase().data(), static_cast<int>(this->_internal_phase().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerStatistics.Migration.phase");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_phase(), target);
+  }
+
+  // required double progress = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_progress(), target);
+  }
+
+  // required uint64 objects_sent = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_objects_sent(), target);
+  }
+
+  // required uint64 tombstones_sent = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_tombstones_sent(), target);
+  }
+
+  // required uint64 bytes_sent = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_bytes_sent(), target);
+  }
+
+  // required uint64 segments_sent = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_segments_sent(), target);
+  }
+
+  // required double elapsed_seconds = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_elapsed_seconds(), target);
+  }
+
+  // required double bytes_per_second = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_bytes_per_second(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  return target;
+}
+
+size_t ServerStatistics_Migration::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  size_t total_size = 0;
+
+  if (_internal_has_phase()) {
+    // required string phase = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phase());
+  }
+
+  if (_internal_has_table_id()) {
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+  }
+
+  if (_internal_has_start_key_hash()) {
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+  }
+
+  if (_internal_has_end_key_hash()) {
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+  }
+
+  if (_internal_has_new_owner_id()) {
+    // required uint64 new_owner_id = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_new_owner_id());
+  }
+
+  if (_internal_has_progress()) {
+    // required double progress = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_objects_sent()) {
+    // required uint64 objects_sent = 7;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_objects_sent());
+  }
+
+  if (_internal_has_tombstones_sent()) {
+    // required uint64 tombstones_sent = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tombstones_sent());
+  }
+
+  if (_internal_has_bytes_sent()) {
+    // required uint64 bytes_sent = 9;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_sent());
+  }
+
+  if (_internal_has_segments_sent()) {
+    // required uint64 segments_sent = 10;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_segments_sent());
+  }
+
+  if (_internal_has_elapsed_seconds()) {
+    // required double elapsed_seconds = 11;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_bytes_per_second()) {
+    // required double bytes_per_second = 12;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t ServerStatistics_Migration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000fff) ^ 0x00000fff) == 0) {  // All required fields are present.
+    // required string phase = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phase());
+
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+
+    // required uint64 new_owner_id = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_new_owner_id());
+
+    // required double progress = 6;
+    total_size += 1 + 8;
+
+    // required uint64 objects_sent = 7;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_objects_sent());
+
+    // required uint64 tombstones_sent = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tombstones_sent());
+
+    // required uint64 bytes_sent = 9;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_sent());
+
+    // required uint64 segments_sent = 10;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_segments_sent());
+
+    // required double elapsed_seconds = 11;
+    total_size += 1 + 8;
+
+    // required double bytes_per_second = 12;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatistics_Migration::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStatistics_Migration::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatistics_Migration::GetClassData() const { return &_class_data_; }
+
+
+void ServerStatistics_Migration::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStatistics_Migration*>(&to_msg);
+  auto& from = static_cast<const ServerStatistics_Migration&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_phase(from._internal_phase());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.table_id_ = from._impl_.table_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.start_key_hash_ = from._impl_.start_key_hash_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.end_key_hash_ = from._impl_.end_key_hash_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.new_owner_id_ = from._impl_.new_owner_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.progress_ = from._impl_.progress_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.objects_sent_ = from._impl_.objects_sent_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.tombstones_sent_ = from._impl_.tombstones_sent_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.bytes_sent_ = from._impl_.bytes_sent_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.segments_sent_ = from._impl_.segments_sent_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.elapsed_seconds_ = from._impl_.elapsed_seconds_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.bytes_per_second_ = from._impl_.bytes_per_second_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStatistics_Migration::CopyFrom(const ServerStatistics_Migration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerStatistics_Migration::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerStatistics_Migration::InternalSwap(ServerStatistics_Migration* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.phase_, lhs_arena,
+      &other->_impl_.phase_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStatistics_Migration, _impl_.bytes_per_second_)
+      + sizeof(ServerStatistics_Migration::_impl_.bytes_per_second_)
+      - PROTOBUF_FIELD_OFFSET(ServerStatistics_Migration, _impl_.table_id_)>(
+          reinterpret_cast<char*>(&_impl_.table_id_),
+          reinterpret_cast<char*>(&other->_impl_.table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistics_Migration::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerStatistics_2eproto_getter, &descriptor_table_ServerStatistics_2eproto_once,
+      file_level_metadata_ServerStatistics_2eproto[2]);
+}
+
+// ===================================================================
+
+class ServerStatistics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerStatistics>()._impl_._has_bits_);
+  static const ::RAMCloud::ProtoBuf::SpinLockStatistics& spin_lock_stats(const ServerStatistics* msg);
+  static void set_has_spin_lock_stats(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable& hash_table(const ServerStatistics* msg);
+  static void set_has_hash_table(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::SpinLockStatistics&
+ServerStatistics::_Internal::spin_lock_stats(const ServerStatistics* msg) {
+  return *msg->_impl_.spin_lock_stats_;
+}
+const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable&
+ServerStatistics::_Internal::hash_table(const ServerStatistics* msg) {
+  return *msg->_impl_.hash_table_;
+}
+void ServerStatistics::clear_spin_lock_stats() {
+  if (_impl_.spin_lock_stats_ != nullptr) _impl_.spin_lock_stats_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+ServerStatistics::ServerStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerStatistics)
+}
+ServerStatistics::ServerStatistics(const ServerStatistics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStatistics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tabletentry_){from._impl_.tabletentry_}
+    , decltype(_impl_.migration_){from._impl_.migration_}
+    , decltype(_impl_.spin_lock_stats_){nullptr}
+    , decltype(_impl_.hash_table_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_spin_lock_stats()) {
+    _this->_impl_.spin_lock_stats_ = new ::RAMCloud::ProtoBuf::SpinLockStatistics(*from._impl_.spin_lock_stats_);
+  }
+  if (from._internal_has_hash_table()) {
+    _this->_impl_.hash_table_ = new ::RAMCloud::ProtoBuf::ServerStatistics_HashTable(*from._impl_.hash_table_);
+  }
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerStatistics)
+}
+
+inline void ServerStatistics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tabletentry_){arena}
+    , decltype(_impl_.migration_){arena}
+    , decltype(_impl_.spin_lock_stats_){nullptr}
+    , decltype(_impl_.hash_table_){nullptr}
+  };
+}
+
+ServerStatistics::~ServerStatistics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerStatistics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStatistics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tabletentry_.~RepeatedPtrField();
+  _impl_.migration_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.spin_lock_stats_;
+  if (this != internal_default_instance()) delete _impl_.hash_table_;
+}
+
+void ServerStatistics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStatistics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerStatistics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tabletentry_.Clear();
+  _impl_.migration_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.spin_lock_stats_ != nullptr);
+      _impl_.spin_lock_stats_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.hash_table_ != nullptr);
+      _impl_.hash_table_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStatistics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tabletentry(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spin_lock_stats(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .RAMCloud.ProtoBuf.ServerStatistics.HashTable hash_table = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hash_table(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.ServerStatistics.Migration migration = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_migration(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStatistics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerStatistics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tabletentry_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tabletentry(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::spin_lock_stats(this),
+        _Internal::spin_lock_stats(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .RAMCloud.ProtoBuf.ServerStatistics.HashTable hash_table = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::hash_table(this),
+        _Internal::hash_table(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.Migration migration = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_migration_size()); i < n; i++) {
+    const auto& repfield = this->_internal_migration(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerStatistics)
+  return target;
+}
+
+size_t ServerStatistics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerStatistics)
+  size_t total_size = 0;
+
+  // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+  if (_internal_has_spin_lock_stats()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.spin_lock_stats_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+  total_size += 1UL * this->_internal_tabletentry_size();
+  for (const auto& msg : this->_impl_.tabletentry_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.Migration migration = 4;
+  total_size += 1UL * this->_internal_migration_size();
+  for (const auto& msg : this->_impl_.migration_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional .RAMCloud.ProtoBuf.ServerStatistics.HashTable hash_table = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.hash_table_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatistics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStatistics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatistics::GetClassData() const { return &_class_data_; }
+
+
+void ServerStatistics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStatistics*>(&to_msg);
+  auto& from = static_cast<const ServerStatistics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerStatistics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tabletentry_.MergeFrom(from._impl_.tabletentry_);
+  _this->_impl_.migration_.MergeFrom(from._impl_.migration_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_spin_lock_stats()->::RAMCloud::ProtoBuf::SpinLockStatistics::MergeFrom(
+          from._internal_spin_lock_stats());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_hash_table()->::RAMCloud::ProtoBuf::ServerStatistics_HashTable::MergeFrom(
+          from._internal_hash_table());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStatistics::CopyFrom(const ServerStatistics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerStatistics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerStatistics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tabletentry_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.migration_))
+    return false;
+  if (_internal_has_spin_lock_stats()) {
+    if (!_impl_.spin_lock_stats_->IsInitialized()) return false;
+  }
+  if (_internal_has_hash_table()) {
+    if (!_impl_.hash_table_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ServerStatistics::InternalSwap(ServerStatistics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.tabletentry_.InternalSwap(&other->_impl_.tabletentry_);
+  _impl_.migration_.InternalSwap(&other->_impl_.migration_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStatistics, _impl_.hash_table_)
+      + sizeof(ServerStatistics::_impl_.hash_table_)
+      - PROTOBUF_FIELD_OFFSET(ServerStatistics, _impl_.spin_lock_stats_)>(
+          reinterpret_cast<char*>(&_impl_.spin_lock_stats_),
+          reinterpret_cast<char*>(&other->_impl_.spin_lock_stats_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerStatistics_2eproto_getter, &descriptor_table_ServerStatistics_2eproto_once,
+      file_level_metadata_ServerStatistics_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerStatistics_HashTable*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerStatistics_HashTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerStatistics_HashTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerStatistics_Migration*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerStatistics_Migration >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerStatistics_Migration >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerStatistics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerStatistics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerStatistics >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,2251 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerStatistics.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerStatistics_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerStatistics_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "SpinLockStatistics.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerStatistics_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerStatistics_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerStatistics_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerStatistics;
+struct ServerStatisticsDefaultTypeInternal;
+extern ServerStatisticsDefaultTypeInternal _ServerStatistics_default_instance_;
+class ServerStatistics_HashTable;
+struct ServerStatistics_HashTableDefaultTypeInternal;
+extern ServerStatistics_HashTableDefaultTypeInternal _ServerStatistics_HashTable_default_instance_;
+class ServerStatistics_Migration;
+struct ServerStatistics_MigrationDefaultTypeInternal;
+extern ServerStatistics_MigrationDefaultTypeInternal _ServerStatistics_Migration_default_instance_;
+class ServerStatistics_TabletEntry;
+struct ServerStatistics_TabletEntryDefaultTypeInternal;
+extern ServerStatistics_TabletEntryDefaultTypeInternal _ServerStatistics_TabletEntry_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerStatistics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerStatistics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerStatistics_HashTable>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerStatistics_Migration* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerStatistics_Migration>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerStatistics_TabletEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry) */ {
+ public:
+  inline ServerStatistics_TabletEntry() : ServerStatistics_TabletEntry(nullptr) {}
+  ~ServerStatistics_TabletEntry() override;
+  explicit PROTOBUF_CONSTEXPR ServerStatistics_TabletEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistics_TabletEntry(const ServerStatistics_TabletEntry& from);
+  ServerStatistics_TabletEntry(ServerStatistics_TabletEntry&& from) noexcept
+    : ServerStatistics_TabletEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistics_TabletEntry& operator=(const ServerStatistics_TabletEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistics_TabletEntry& operator=(ServerStatistics_TabletEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistics_TabletEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistics_TabletEntry* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistics_TabletEntry*>(
+               &_ServerStatistics_TabletEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerStatistics_TabletEntry& a, ServerStatistics_TabletEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistics_TabletEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistics_TabletEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatistics_TabletEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatistics_TabletEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistics_TabletEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStatistics_TabletEntry& from) {
+    ServerStatistics_TabletEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistics_TabletEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerStatistics.TabletEntry";
+  }
+  protected:
+  explicit ServerStatistics_TabletEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableIdFieldNumber = 1,
+    kStartKeyHashFieldNumber = 2,
+    kEndKeyHashFieldNumber = 3,
+    kNumberReadAndWritesFieldNumber = 4,
+    kByteCountFieldNumber = 5,
+    kObjectCountFieldNumber = 6,
+  };
+  // required uint64 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 2;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 3;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // optional uint64 number_read_and_writes = 4 [default = 0];
+  bool has_number_read_and_writes() const;
+  private:
+  bool _internal_has_number_read_and_writes() const;
+  public:
+  void clear_number_read_and_writes();
+  uint64_t number_read_and_writes() const;
+  void set_number_read_and_writes(uint64_t value);
+  private:
+  uint64_t _internal_number_read_and_writes() const;
+  void _internal_set_number_read_and_writes(uint64_t value);
+  public:
+
+  // optional uint64 byte_count = 5 [default = 0];
+  bool has_byte_count() const;
+  private:
+  bool _internal_has_byte_count() const;
+  public:
+  void clear_byte_count();
+  uint64_t byte_count() const;
+  void set_byte_count(uint64_t value);
+  private:
+  uint64_t _internal_byte_count() const;
+  void _internal_set_byte_count(uint64_t value);
+  public:
+
+  // optional uint64 object_count = 6 [default = 0];
+  bool has_object_count() const;
+  private:
+  bool _internal_has_object_count() const;
+  public:
+  void clear_object_count();
+  uint64_t object_count() const;
+  void set_object_count(uint64_t value);
+  private:
+  uint64_t _internal_object_count() const;
+  void _internal_set_object_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t table_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t number_read_and_writes_;
+    uint64_t byte_count_;
+    uint64_t object_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerStatistics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatistics_HashTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerStatistics.HashTable) */ {
+ public:
+  inline ServerStatistics_HashTable() : ServerStatistics_HashTable(nullptr) {}
+  ~ServerStatistics_HashTable() override;
+  explicit PROTOBUF_CONSTEXPR ServerStatistics_HashTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistics_HashTable(const ServerStatistics_HashTable& from);
+  ServerStatistics_HashTable(ServerStatistics_HashTable&& from) noexcept
+    : ServerStatistics_HashTable() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistics_HashTable& operator=(const ServerStatistics_HashTable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistics_HashTable& operator=(ServerStatistics_HashTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistics_HashTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistics_HashTable* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistics_HashTable*>(
+               &_ServerStatistics_HashTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ServerStatistics_HashTable& a, ServerStatistics_HashTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistics_HashTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistics_HashTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatistics_HashTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatistics_HashTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistics_HashTable& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStatistics_HashTable& from) {
+    ServerStatistics_HashTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistics_HashTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerStatistics.HashTable";
+  }
+  protected:
+  explicit ServerStatistics_HashTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumBucketsFieldNumber = 1,
+    kSampledBucketsFieldNumber = 2,
+    kLoadFactorFieldNumber = 3,
+    kAverageChainLengthFieldNumber = 4,
+    kOverflowedBucketFractionFieldNumber = 6,
+    kResizeCountFieldNumber = 7,
+    kResizeTargetBucketsFieldNumber = 8,
+    kResizeProgressFieldNumber = 9,
+    kMaxChainLengthFieldNumber = 5,
+  };
+  // required uint64 num_buckets = 1;
+  bool has_num_buckets() const;
+  private:
+  bool _internal_has_num_buckets() const;
+  public:
+  void clear_num_buckets();
+  uint64_t num_buckets() const;
+  void set_num_buckets(uint64_t value);
+  private:
+  uint64_t _internal_num_buckets() const;
+  void _internal_set_num_buckets(uint64_t value);
+  public:
+
+  // required uint64 sampled_buckets = 2;
+  bool has_sampled_buckets() const;
+  private:
+  bool _internal_has_sampled_buckets() const;
+  public:
+  void clear_sampled_buckets();
+  uint64_t sampled_buckets() const;
+  void set_sampled_buckets(uint64_t value);
+  private:
+  uint64_t _internal_sampled_buckets() const;
+  void _internal_set_sampled_buckets(uint64_t value);
+  public:
+
+  // optional double load_factor = 3;
+  bool has_load_factor() const;
+  private:
+  bool _internal_has_load_factor() const;
+  public:
+  void clear_load_factor();
+  double load_factor() const;
+  void set_load_factor(double value);
+  private:
+  double _internal_load_factor() const;
+  void _internal_set_load_factor(double value);
+  public:
+
+  // optional double average_chain_length = 4;
+  bool has_average_chain_length() const;
+  private:
+  bool _internal_has_average_chain_length() const;
+  public:
+  void clear_average_chain_length();
+  double average_chain_length() const;
+  void set_average_chain_length(double value);
+  private:
+  double _internal_average_chain_length() const;
+  void _internal_set_average_chain_length(double value);
+  public:
+
+  // optional double overflowed_bucket_fraction = 6;
+  bool has_overflowed_bucket_fraction() const;
+  private:
+  bool _internal_has_overflowed_bucket_fraction() const;
+  public:
+  void clear_overflowed_bucket_fraction();
+  double overflowed_bucket_fraction() const;
+  void set_overflowed_bucket_fraction(double value);
+  private:
+  double _internal_overflowed_bucket_fraction() const;
+  void _internal_set_overflowed_bucket_fraction(double value);
+  public:
+
+  // required uint64 resize_count = 7;
+  bool has_resize_count() const;
+  private:
+  bool _internal_has_resize_count() const;
+  public:
+  void clear_resize_count();
+  uint64_t resize_count() const;
+  void set_resize_count(uint64_t value);
+  private:
+  uint64_t _internal_resize_count() const;
+  void _internal_set_resize_count(uint64_t value);
+  public:
+
+  // optional uint64 resize_target_buckets = 8;
+  bool has_resize_target_buckets() const;
+  private:
+  bool _internal_has_resize_target_buckets() const;
+  public:
+  void clear_resize_target_buckets();
+  uint64_t resize_target_buckets() const;
+  void set_resize_target_buckets(uint64_t value);
+  private:
+  uint64_t _internal_resize_target_buckets() const;
+  void _internal_set_resize_target_buckets(uint64_t value);
+  public:
+
+  // optional double resize_progress = 9;
+  bool has_resize_progress() const;
+  private:
+  bool _internal_has_resize_progress() const;
+  public:
+  void clear_resize_progress();
+  double resize_progress() const;
+  void set_resize_progress(double value);
+  private:
+  double _internal_resize_progress() const;
+  void _internal_set_resize_progress(double value);
+  public:
+
+  // optional uint32 max_chain_length = 5;
+  bool has_max_chain_length() const;
+  private:
+  bool _internal_has_max_chain_length() const;
+  public:
+  void clear_max_chain_length();
+  uint32_t max_chain_length() const;
+  void set_max_chain_length(uint32_t value);
+  private:
+  uint32_t _internal_max_chain_length() const;
+  void _internal_set_max_chain_length(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerStatistics.HashTable)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t num_buckets_;
+    uint64_t sampled_buckets_;
+    double load_factor_;
+    double average_chain_length_;
+    double overflowed_bucket_fraction_;
+    uint64_t resize_count_;
+    uint64_t resize_target_buckets_;
+    double resize_progress_;
+    uint32_t max_chain_length_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerStatistics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatistics_Migration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerStatistics.Migration) */ {
+ public:
+  inline ServerStatistics_Migration() : ServerStatistics_Migration(nullptr) {}
+  ~ServerStatistics_Migration() override;
+  explicit PROTOBUF_CONSTEXPR ServerStatistics_Migration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistics_Migration(const ServerStatistics_Migration& from);
+  ServerStatistics_Migration(ServerStatistics_Migration&& from) noexcept
+    : ServerStatistics_Migration() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistics_Migration& operator=(const ServerStatistics_Migration& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistics_Migration& operator=(ServerStatistics_Migration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistics_Migration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistics_Migration* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistics_Migration*>(
+               &_ServerStatistics_Migration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ServerStatistics_Migration& a, ServerStatistics_Migration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistics_Migration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistics_Migration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatistics_Migration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatistics_Migration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistics_Migration& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStatistics_Migration& from) {
+    ServerStatistics_Migration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistics_Migration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerStatistics.Migration";
+  }
+  protected:
+  explicit ServerStatistics_Migration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPhaseFieldNumber = 5,
+    kTableIdFieldNumber = 1,
+    kStartKeyHashFieldNumber = 2,
+    kEndKeyHashFieldNumber = 3,
+    kNewOwnerIdFieldNumber = 4,
+    kProgressFieldNumber = 6,
+    kObjectsSentFieldNumber = 7,
+    kTombstonesSentFieldNumber = 8,
+    kBytesSentFieldNumber = 9,
+    kSegmentsSentFieldNumber = 10,
+    kElapsedSecondsFieldNumber = 11,
+    kBytesPerSecondFieldNumber = 12,
+  };
+  // required string phase = 5;
+  bool has_phase() const;
+  private:
+  bool _internal_has_phase() const;
+  public:
+  void clear_phase();
+  const std::string& phase() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_phase(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_phase();
+  PROTOBUF_NODISCARD std::string* release_phase();
+  void set_allocated_phase(std::string* phase);
+  private:
+  const std::string& _internal_phase() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_phase(const std::string& value);
+  std::string* _internal_mutable_phase();
+  public:
+
+  // required uint64 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 2;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 3;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // required uint64 new_owner_id = 4;
+  bool has_new_owner_id() const;
+  private:
+  bool _internal_has_new_owner_id() const;
+  public:
+  void clear_new_owner_id();
+  uint64_t new_owner_id() const;
+  void set_new_owner_id(uint64_t value);
+  private:
+  uint64_t _internal_new_owner_id() const;
+  void _internal_set_new_owner_id(uint64_t value);
+  public:
+
+  // required double progress = 6;
+  bool has_progress() const;
+  private:
+  bool _internal_has_progress() const;
+  public:
+  void clear_progress();
+  double progress() const;
+  void set_progress(double value);
+  private:
+  double _internal_progress() const;
+  void _internal_set_progress(double value);
+  public:
+
+  // required uint64 objects_sent = 7;
+  bool has_objects_sent() const;
+  private:
+  bool _internal_has_objects_sent() const;
+  public:
+  void clear_objects_sent();
+  uint64_t objects_sent() const;
+  void set_objects_sent(uint64_t value);
+  private:
+  uint64_t _internal_objects_sent() const;
+  void _internal_set_objects_sent(uint64_t value);
+  public:
+
+  // required uint64 tombstones_sent = 8;
+  bool has_tombstones_sent() const;
+  private:
+  bool _internal_has_tombstones_sent() const;
+  public:
+  void clear_tombstones_sent();
+  uint64_t tombstones_sent() const;
+  void set_tombstones_sent(uint64_t value);
+  private:
+  uint64_t _internal_tombstones_sent() const;
+  void _internal_set_tombstones_sent(uint64_t value);
+  public:
+
+  // required uint64 bytes_sent = 9;
+  bool has_bytes_sent() const;
+  private:
+  bool _internal_has_bytes_sent() const;
+  public:
+  void clear_bytes_sent();
+  uint64_t bytes_sent() const;
+  void set_bytes_sent(uint64_t value);
+  private:
+  uint64_t _internal_bytes_sent() const;
+  void _internal_set_bytes_sent(uint64_t value);
+  public:
+
+  // required uint64 segments_sent = 10;
+  bool has_segments_sent() const;
+  private:
+  bool _internal_has_segments_sent() const;
+  public:
+  void clear_segments_sent();
+  uint64_t segments_sent() const;
+  void set_segments_sent(uint64_t value);
+  private:
+  uint64_t _internal_segments_sent() const;
+  void _internal_set_segments_sent(uint64_t value);
+  public:
+
+  // required double elapsed_seconds = 11;
+  bool has_elapsed_seconds() const;
+  private:
+  bool _internal_has_elapsed_seconds() const;
+  public:
+  void clear_elapsed_seconds();
+  double elapsed_seconds() const;
+  void set_elapsed_seconds(double value);
+  private:
+  double _internal_elapsed_seconds() const;
+  void _internal_set_elapsed_seconds(double value);
+  public:
+
+  // required double bytes_per_second = 12;
+  bool has_bytes_per_second() const;
+  private:
+  bool _internal_has_bytes_per_second() const;
+  public:
+  void clear_bytes_per_second();
+  double bytes_per_second() const;
+  void set_bytes_per_second(double value);
+  private:
+  double _internal_bytes_per_second() const;
+  void _internal_set_bytes_per_second(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerStatistics.Migration)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phase_;
+    uint64_t table_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t new_owner_id_;
+    double progress_;
+    uint64_t objects_sent_;
+    uint64_t tombstones_sent_;
+    uint64_t bytes_sent_;
+    uint64_t segments_sent_;
+    double elapsed_seconds_;
+    double bytes_per_second_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerStatistics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatistics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerStatistics) */ {
+ public:
+  inline ServerStatistics() : ServerStatistics(nullptr) {}
+  ~ServerStatistics() override;
+  explicit PROTOBUF_CONSTEXPR ServerStatistics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistics(const ServerStatistics& from);
+  ServerStatistics(ServerStatistics&& from) noexcept
+    : ServerStatistics() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistics& operator=(const ServerStatistics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistics& operator=(ServerStatistics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistics* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistics*>(
+               &_ServerStatistics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ServerStatistics& a, ServerStatistics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatistics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatistics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStatistics& from) {
+    ServerStatistics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerStatistics";
+  }
+  protected:
+  explicit ServerStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ServerStatistics_TabletEntry TabletEntry;
+  typedef ServerStatistics_HashTable HashTable;
+  typedef ServerStatistics_Migration Migration;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletentryFieldNumber = 1,
+    kMigrationFieldNumber = 4,
+    kSpinLockStatsFieldNumber = 2,
+    kHashTableFieldNumber = 3,
+  };
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+  int tabletentry_size() const;
+  private:
+  int _internal_tabletentry_size() const;
+  public:
+  void clear_tabletentry();
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* mutable_tabletentry(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >*
+      mutable_tabletentry();
+  private:
+  const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& _internal_tabletentry(int index) const;
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* _internal_add_tabletentry();
+  public:
+  const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& tabletentry(int index) const;
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* add_tabletentry();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >&
+      tabletentry() const;
+
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.Migration migration = 4;
+  int migration_size() const;
+  private:
+  int _internal_migration_size() const;
+  public:
+  void clear_migration();
+  ::RAMCloud::ProtoBuf::ServerStatistics_Migration* mutable_migration(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_Migration >*
+      mutable_migration();
+  private:
+  const ::RAMCloud::ProtoBuf::ServerStatistics_Migration& _internal_migration(int index) const;
+  ::RAMCloud::ProtoBuf::ServerStatistics_Migration* _internal_add_migration();
+  public:
+  const ::RAMCloud::ProtoBuf::ServerStatistics_Migration& migration(int index) const;
+  ::RAMCloud::ProtoBuf::ServerStatistics_Migration* add_migration();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_Migration >&
+      migration() const;
+
+  // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+  bool has_spin_lock_stats() const;
+  private:
+  bool _internal_has_spin_lock_stats() const;
+  public:
+  void clear_spin_lock_stats();
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics& spin_lock_stats() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::SpinLockStatistics* release_spin_lock_stats();
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* mutable_spin_lock_stats();
+  void set_allocated_spin_lock_stats(::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats);
+  private:
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics& _internal_spin_lock_stats() const;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* _internal_mutable_spin_lock_stats();
+  public:
+  void unsafe_arena_set_allocated_spin_lock_stats(
+      ::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats);
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* unsafe_arena_release_spin_lock_stats();
+
+  // optional .RAMCloud.ProtoBuf.ServerStatistics.HashTable hash_table = 3;
+  bool has_hash_table() const;
+  private:
+  bool _internal_has_hash_table() const;
+  public:
+  void clear_hash_table();
+  const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable& hash_table() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* release_hash_table();
+  ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* mutable_hash_table();
+  void set_allocated_hash_table(::RAMCloud::ProtoBuf::ServerStatistics_HashTable* hash_table);
+  private:
+  const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable& _internal_hash_table() const;
+  ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* _internal_mutable_hash_table();
+  public:
+  void unsafe_arena_set_allocated_hash_table(
+      ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* hash_table);
+  ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* unsafe_arena_release_hash_table();
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerStatistics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry > tabletentry_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_Migration > migration_;
+    ::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats_;
+    ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* hash_table_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerStatistics_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerStatistics_TabletEntry
+
+// required uint64 table_id = 1;
+inline bool ServerStatistics_TabletEntry::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void ServerStatistics_TabletEntry::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t ServerStatistics_TabletEntry::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.table_id)
+  return _internal_table_id();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_id_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.table_id)
+}
+
+// required uint64 start_key_hash = 2;
+inline bool ServerStatistics_TabletEntry::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void ServerStatistics_TabletEntry::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t ServerStatistics_TabletEntry::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.start_key_hash_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.start_key_hash)
+}
+
+// required uint64 end_key_hash = 3;
+inline bool ServerStatistics_TabletEntry::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void ServerStatistics_TabletEntry::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t ServerStatistics_TabletEntry::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.end_key_hash_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.end_key_hash)
+}
+
+// optional uint64 number_read_and_writes = 4 [default = 0];
+inline bool ServerStatistics_TabletEntry::_internal_has_number_read_and_writes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_number_read_and_writes() const {
+  return _internal_has_number_read_and_writes();
+}
+inline void ServerStatistics_TabletEntry::clear_number_read_and_writes() {
+  _impl_.number_read_and_writes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_number_read_and_writes() const {
+  return _impl_.number_read_and_writes_;
+}
+inline uint64_t ServerStatistics_TabletEntry::number_read_and_writes() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.number_read_and_writes)
+  return _internal_number_read_and_writes();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_number_read_and_writes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.number_read_and_writes_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_number_read_and_writes(uint64_t value) {
+  _internal_set_number_read_and_writes(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.number_read_and_writes)
+}
+
+// optional uint64 byte_count = 5 [default = 0];
+inline bool ServerStatistics_TabletEntry::_internal_has_byte_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_byte_count() const {
+  return _internal_has_byte_count();
+}
+inline void ServerStatistics_TabletEntry::clear_byte_count() {
+  _impl_.byte_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_byte_count() const {
+  return _impl_.byte_count_;
+}
+inline uint64_t ServerStatistics_TabletEntry::byte_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.byte_count)
+  return _internal_byte_count();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_byte_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.byte_count_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_byte_count(uint64_t value) {
+  _internal_set_byte_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.byte_count)
+}
+
+// optional uint64 object_count = 6 [default = 0];
+inline bool ServerStatistics_TabletEntry::_internal_has_object_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_object_count() const {
+  return _internal_has_object_count();
+}
+inline void ServerStatistics_TabletEntry::clear_object_count() {
+  _impl_.object_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_object_count() const {
+  return _impl_.object_count_;
+}
+inline uint64_t ServerStatistics_TabletEntry::object_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.object_count)
+  return _internal_object_count();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_object_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.object_count_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_object_count(uint64_t value) {
+  _internal_set_object_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.object_count)
+}
+
+// -------------------------------------------------------------------
+
+// ServerStatistics_HashTable
+
+// required uint64 num_buckets = 1;
+inline bool ServerStatistics_HashTable::_internal_has_num_buckets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_num_buckets() const {
+  return _internal_has_num_buckets();
+}
+inline void ServerStatistics_HashTable::clear_num_buckets() {
+  _impl_.num_buckets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ServerStatistics_HashTable::_internal_num_buckets() const {
+  return _impl_.num_buckets_;
+}
+inline uint64_t ServerStatistics_HashTable::num_buckets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.num_buckets)
+  return _internal_num_buckets();
+}
+inline void ServerStatistics_HashTable::_internal_set_num_buckets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_buckets_ = value;
+}
+inline void ServerStatistics_HashTable::set_num_buckets(uint64_t value) {
+  _internal_set_num_buckets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.num_buckets)
+}
+
+// required uint64 sampled_buckets = 2;
+inline bool ServerStatistics_HashTable::_internal_has_sampled_buckets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_sampled_buckets() const {
+  return _internal_has_sampled_buckets();
+}
+inline void ServerStatistics_HashTable::clear_sampled_buckets() {
+  _impl_.sampled_buckets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerStatistics_HashTable::_internal_sampled_buckets() const {
+  return _impl_.sampled_buckets_;
+}
+inline uint64_t ServerStatistics_HashTable::sampled_buckets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.sampled_buckets)
+  return _internal_sampled_buckets();
+}
+inline void ServerStatistics_HashTable::_internal_set_sampled_buckets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sampled_buckets_ = value;
+}
+inline void ServerStatistics_HashTable::set_sampled_buckets(uint64_t value) {
+  _internal_set_sampled_buckets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.sampled_buckets)
+}
+
+// optional double load_factor = 3;
+inline bool ServerStatistics_HashTable::_internal_has_load_factor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_load_factor() const {
+  return _internal_has_load_factor();
+}
+inline void ServerStatistics_HashTable::clear_load_factor() {
+  _impl_.load_factor_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double ServerStatistics_HashTable::_internal_load_factor() const {
+  return _impl_.load_factor_;
+}
+inline double ServerStatistics_HashTable::load_factor() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.load_factor)
+  return _internal_load_factor();
+}
+inline void ServerStatistics_HashTable::_internal_set_load_factor(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.load_factor_ = value;
+}
+inline void ServerStatistics_HashTable::set_load_factor(double value) {
+  _internal_set_load_factor(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.load_factor)
+}
+
+// optional double average_chain_length = 4;
+inline bool ServerStatistics_HashTable::_internal_has_average_chain_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_average_chain_length() const {
+  return _internal_has_average_chain_length();
+}
+inline void ServerStatistics_HashTable::clear_average_chain_length() {
+  _impl_.average_chain_length_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double ServerStatistics_HashTable::_internal_average_chain_length() const {
+  return _impl_.average_chain_length_;
+}
+inline double ServerStatistics_HashTable::average_chain_length() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.average_chain_length)
+  return _internal_average_chain_length();
+}
+inline void ServerStatistics_HashTable::_internal_set_average_chain_length(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.average_chain_length_ = value;
+}
+inline void ServerStatistics_HashTable::set_average_chain_length(double value) {
+  _internal_set_average_chain_length(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.average_chain_length)
+}
+
+// optional uint32 max_chain_length = 5;
+inline bool ServerStatistics_HashTable::_internal_has_max_chain_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_max_chain_length() const {
+  return _internal_has_max_chain_length();
+}
+inline void ServerStatistics_HashTable::clear_max_chain_length() {
+  _impl_.max_chain_length_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t ServerStatistics_HashTable::_internal_max_chain_length() const {
+  return _impl_.max_chain_length_;
+}
+inline uint32_t ServerStatistics_HashTable::max_chain_length() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.max_chain_length)
+  return _internal_max_chain_length();
+}
+inline void ServerStatistics_HashTable::_internal_set_max_chain_length(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.max_chain_length_ = value;
+}
+inline void ServerStatistics_HashTable::set_max_chain_length(uint32_t value) {
+  _internal_set_max_chain_length(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.max_chain_length)
+}
+
+// optional double overflowed_bucket_fraction = 6;
+inline bool ServerStatistics_HashTable::_internal_has_overflowed_bucket_fraction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_overflowed_bucket_fraction() const {
+  return _internal_has_overflowed_bucket_fraction();
+}
+inline void ServerStatistics_HashTable::clear_overflowed_bucket_fraction() {
+  _impl_.overflowed_bucket_fraction_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double ServerStatistics_HashTable::_internal_overflowed_bucket_fraction() const {
+  return _impl_.overflowed_bucket_fraction_;
+}
+inline double ServerStatistics_HashTable::overflowed_bucket_fraction() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.overflowed_bucket_fraction)
+  return _internal_overflowed_bucket_fraction();
+}
+inline void ServerStatistics_HashTable::_internal_set_overflowed_bucket_fraction(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.overflowed_bucket_fraction_ = value;
+}
+inline void ServerStatistics_HashTable::set_overflowed_bucket_fraction(double value) {
+  _internal_set_overflowed_bucket_fraction(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.overflowed_bucket_fraction)
+}
+
+// required uint64 resize_count = 7;
+inline bool ServerStatistics_HashTable::_internal_has_resize_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_resize_count() const {
+  return _internal_has_resize_count();
+}
+inline void ServerStatistics_HashTable::clear_resize_count() {
+  _impl_.resize_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t ServerStatistics_HashTable::_internal_resize_count() const {
+  return _impl_.resize_count_;
+}
+inline uint64_t ServerStatistics_HashTable::resize_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.resize_count)
+  return _internal_resize_count();
+}
+inline void ServerStatistics_HashTable::_internal_set_resize_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.resize_count_ = value;
+}
+inline void ServerStatistics_HashTable::set_resize_count(uint64_t value) {
+  _internal_set_resize_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.resize_count)
+}
+
+// optional uint64 resize_target_buckets = 8;
+inline bool ServerStatistics_HashTable::_internal_has_resize_target_buckets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_resize_target_buckets() const {
+  return _internal_has_resize_target_buckets();
+}
+inline void ServerStatistics_HashTable::clear_resize_target_buckets() {
+  _impl_.resize_target_buckets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t ServerStatistics_HashTable::_internal_resize_target_buckets() const {
+  return _impl_.resize_target_buckets_;
+}
+inline uint64_t ServerStatistics_HashTable::resize_target_buckets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.resize_target_buckets)
+  return _internal_resize_target_buckets();
+}
+inline void ServerStatistics_HashTable::_internal_set_resize_target_buckets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.resize_target_buckets_ = value;
+}
+inline void ServerStatistics_HashTable::set_resize_target_buckets(uint64_t value) {
+  _internal_set_resize_target_buckets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.resize_target_buckets)
+}
+
+// optional double resize_progress = 9;
+inline bool ServerStatistics_HashTable::_internal_has_resize_progress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ServerStatistics_HashTable::has_resize_progress() const {
+  return _internal_has_resize_progress();
+}
+inline void ServerStatistics_HashTable::clear_resize_progress() {
+  _impl_.resize_progress_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double ServerStatistics_HashTable::_internal_resize_progress() const {
+  return _impl_.resize_progress_;
+}
+inline double ServerStatistics_HashTable::resize_progress() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.HashTable.resize_progress)
+  return _internal_resize_progress();
+}
+inline void ServerStatistics_HashTable::_internal_set_resize_progress(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.resize_progress_ = value;
+}
+inline void ServerStatistics_HashTable::set_resize_progress(double value) {
+  _internal_set_resize_progress(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.HashTable.resize_progress)
+}
+
+// -------------------------------------------------------------------
+
+// ServerStatistics_Migration
+
+// required uint64 table_id = 1;
+inline bool ServerStatistics_Migration::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void ServerStatistics_Migration::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t ServerStatistics_Migration::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.table_id)
+  return _internal_table_id();
+}
+inline void ServerStatistics_Migration::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.table_id_ = value;
+}
+inline void ServerStatistics_Migration::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.table_id)
+}
+
+// required uint64 start_key_hash = 2;
+inline bool ServerStatistics_Migration::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void ServerStatistics_Migration::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t ServerStatistics_Migration::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void ServerStatistics_Migration::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.start_key_hash_ = value;
+}
+inline void ServerStatistics_Migration::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.start_key_hash)
+}
+
+// required uint64 end_key_hash = 3;
+inline bool ServerStatistics_Migration::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void ServerStatistics_Migration::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t ServerStatistics_Migration::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void ServerStatistics_Migration::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_key_hash_ = value;
+}
+inline void ServerStatistics_Migration::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.end_key_hash)
+}
+
+// required uint64 new_owner_id = 4;
+inline bool ServerStatistics_Migration::_internal_has_new_owner_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_new_owner_id() const {
+  return _internal_has_new_owner_id();
+}
+inline void ServerStatistics_Migration::clear_new_owner_id() {
+  _impl_.new_owner_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_new_owner_id() const {
+  return _impl_.new_owner_id_;
+}
+inline uint64_t ServerStatistics_Migration::new_owner_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.new_owner_id)
+  return _internal_new_owner_id();
+}
+inline void ServerStatistics_Migration::_internal_set_new_owner_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.new_owner_id_ = value;
+}
+inline void ServerStatistics_Migration::set_new_owner_id(uint64_t value) {
+  _internal_set_new_owner_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.new_owner_id)
+}
+
+// required string phase = 5;
+inline bool ServerStatistics_Migration::_internal_has_phase() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_phase() const {
+  return _internal_has_phase();
+}
+inline void ServerStatistics_Migration::clear_phase() {
+  _impl_.phase_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerStatistics_Migration::phase() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.phase)
+  return _internal_phase();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerStatistics_Migration::set_phase(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.phase_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.phase)
+}
+inline std::string* ServerStatistics_Migration::mutable_phase() {
+  std::string* _s = _internal_mutable_phase();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerStatistics.Migration.phase)
+  return _s;
+}
+inline const std::string& ServerStatistics_Migration::_internal_phase() const {
+  return _impl_.phase_.Get();
+}
+inline void ServerStatistics_Migration::_internal_set_phase(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.phase_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerStatistics_Migration::_internal_mutable_phase() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.phase_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerStatistics_Migration::release_phase() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerStatistics.Migration.phase)
+  if (!_internal_has_phase()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.phase_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.phase_.IsDefault()) {
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerStatistics_Migration::set_allocated_phase(std::string* phase) {
+  if (phase != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.phase_.SetAllocated(phase, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.phase_.IsDefault()) {
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerStatistics.Migration.phase)
+}
+
+// required double progress = 6;
+inline bool ServerStatistics_Migration::_internal_has_progress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_progress() const {
+  return _internal_has_progress();
+}
+inline void ServerStatistics_Migration::clear_progress() {
+  _impl_.progress_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double ServerStatistics_Migration::_internal_progress() const {
+  return _impl_.progress_;
+}
+inline double ServerStatistics_Migration::progress() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.progress)
+  return _internal_progress();
+}
+inline void ServerStatistics_Migration::_internal_set_progress(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.progress_ = value;
+}
+inline void ServerStatistics_Migration::set_progress(double value) {
+  _internal_set_progress(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.progress)
+}
+
+// required uint64 objects_sent = 7;
+inline bool ServerStatistics_Migration::_internal_has_objects_sent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_objects_sent() const {
+  return _internal_has_objects_sent();
+}
+inline void ServerStatistics_Migration::clear_objects_sent() {
+  _impl_.objects_sent_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_objects_sent() const {
+  return _impl_.objects_sent_;
+}
+inline uint64_t ServerStatistics_Migration::objects_sent() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.objects_sent)
+  return _internal_objects_sent();
+}
+inline void ServerStatistics_Migration::_internal_set_objects_sent(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.objects_sent_ = value;
+}
+inline void ServerStatistics_Migration::set_objects_sent(uint64_t value) {
+  _internal_set_objects_sent(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.objects_sent)
+}
+
+// required uint64 tombstones_sent = 8;
+inline bool ServerStatistics_Migration::_internal_has_tombstones_sent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_tombstones_sent() const {
+  return _internal_has_tombstones_sent();
+}
+inline void ServerStatistics_Migration::clear_tombstones_sent() {
+  _impl_.tombstones_sent_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_tombstones_sent() const {
+  return _impl_.tombstones_sent_;
+}
+inline uint64_t ServerStatistics_Migration::tombstones_sent() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.tombstones_sent)
+  return _internal_tombstones_sent();
+}
+inline void ServerStatistics_Migration::_internal_set_tombstones_sent(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.tombstones_sent_ = value;
+}
+inline void ServerStatistics_Migration::set_tombstones_sent(uint64_t value) {
+  _internal_set_tombstones_sent(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.tombstones_sent)
+}
+
+// required uint64 bytes_sent = 9;
+inline bool ServerStatistics_Migration::_internal_has_bytes_sent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_bytes_sent() const {
+  return _internal_has_bytes_sent();
+}
+inline void ServerStatistics_Migration::clear_bytes_sent() {
+  _impl_.bytes_sent_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_bytes_sent() const {
+  return _impl_.bytes_sent_;
+}
+inline uint64_t ServerStatistics_Migration::bytes_sent() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.bytes_sent)
+  return _internal_bytes_sent();
+}
+inline void ServerStatistics_Migration::_internal_set_bytes_sent(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.bytes_sent_ = value;
+}
+inline void ServerStatistics_Migration::set_bytes_sent(uint64_t value) {
+  _internal_set_bytes_sent(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.bytes_sent)
+}
+
+// required uint64 segments_sent = 10;
+inline bool ServerStatistics_Migration::_internal_has_segments_sent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_segments_sent() const {
+  return _internal_has_segments_sent();
+}
+inline void ServerStatistics_Migration::clear_segments_sent() {
+  _impl_.segments_sent_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t ServerStatistics_Migration::_internal_segments_sent() const {
+  return _impl_.segments_sent_;
+}
+inline uint64_t ServerStatistics_Migration::segments_sent() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.segments_sent)
+  return _internal_segments_sent();
+}
+inline void ServerStatistics_Migration::_internal_set_segments_sent(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.segments_sent_ = value;
+}
+inline void ServerStatistics_Migration::set_segments_sent(uint64_t value) {
+  _internal_set_segments_sent(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.segments_sent)
+}
+
+// required double elapsed_seconds = 11;
+inline bool ServerStatistics_Migration::_internal_has_elapsed_seconds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_elapsed_seconds() const {
+  return _internal_has_elapsed_seconds();
+}
+inline void ServerStatistics_Migration::clear_elapsed_seconds() {
+  _impl_.elapsed_seconds_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double ServerStatistics_Migration::_internal_elapsed_seconds() const {
+  return _impl_.elapsed_seconds_;
+}
+inline double ServerStatistics_Migration::elapsed_seconds() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.elapsed_seconds)
+  return _internal_elapsed_seconds();
+}
+inline void ServerStatistics_Migration::_internal_set_elapsed_seconds(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.elapsed_seconds_ = value;
+}
+inline void ServerStatistics_Migration::set_elapsed_seconds(double value) {
+  _internal_set_elapsed_seconds(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.elapsed_seconds)
+}
+
+// required double bytes_per_second = 12;
+inline bool ServerStatistics_Migration::_internal_has_bytes_per_second() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ServerStatistics_Migration::has_bytes_per_second() const {
+  return _internal_has_bytes_per_second();
+}
+inline void ServerStatistics_Migration::clear_bytes_per_second() {
+  _impl_.bytes_per_second_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double ServerStatistics_Migration::_internal_bytes_per_second() const {
+  return _impl_.bytes_per_second_;
+}
+inline double ServerStatistics_Migration::bytes_per_second() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.Migration.bytes_per_second)
+  return _internal_bytes_per_second();
+}
+inline void ServerStatistics_Migration::_internal_set_bytes_per_second(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.bytes_per_second_ = value;
+}
+inline void ServerStatistics_Migration::set_bytes_per_second(double value) {
+  _internal_set_bytes_per_second(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.Migration.bytes_per_second)
+}
+
+// -------------------------------------------------------------------
+
+// ServerStatistics
+
+// repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+inline int ServerStatistics::_internal_tabletentry_size() const {
+  return _impl_.tabletentry_.size();
+}
+inline int ServerStatistics::tabletentry_size() const {
+  return _internal_tabletentry_size();
+}
+inline void ServerStatistics::clear_tabletentry() {
+  _impl_.tabletentry_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* ServerStatistics::mutable_tabletentry(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _impl_.tabletentry_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >*
+ServerStatistics::mutable_tabletentry() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return &_impl_.tabletentry_;
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& ServerStatistics::_internal_tabletentry(int index) const {
+  return _impl_.tabletentry_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& ServerStatistics::tabletentry(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _internal_tabletentry(index);
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* ServerStatistics::_internal_add_tabletentry() {
+  return _impl_.tabletentry_.Add();
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* ServerStatistics::add_tabletentry() {
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* _add = _internal_add_tabletentry();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >&
+ServerStatistics::tabletentry() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _impl_.tabletentry_;
+}
+
+// required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+inline bool ServerStatistics::_internal_has_spin_lock_stats() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.spin_lock_stats_ != nullptr);
+  return value;
+}
+inline bool ServerStatistics::has_spin_lock_stats() const {
+  return _internal_has_spin_lock_stats();
+}
+inline const ::RAMCloud::ProtoBuf::SpinLockStatistics& ServerStatistics::_internal_spin_lock_stats() const {
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics* p = _impl_.spin_lock_stats_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::SpinLockStatistics&>(
+      ::RAMCloud::ProtoBuf::_SpinLockStatistics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::SpinLockStatistics& ServerStatistics::spin_lock_stats() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+  return _internal_spin_lock_stats();
+}
+inline void ServerStatistics::unsafe_arena_set_allocated_spin_lock_stats(
+    ::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spin_lock_stats_);
+  }
+  _impl_.spin_lock_stats_ = spin_lock_stats;
+  if (spin_lock_stats) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::release_spin_lock_stats() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* temp = _impl_.spin_lock_stats_;
+  _impl_.spin_lock_stats_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::unsafe_arena_release_spin_lock_stats() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* temp = _impl_.spin_lock_stats_;
+  _impl_.spin_lock_stats_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::_internal_mutable_spin_lock_stats() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.spin_lock_stats_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::SpinLockStatistics>(GetArenaForAllocation());
+    _impl_.spin_lock_stats_ = p;
+  }
+  return _impl_.spin_lock_stats_;
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::mutable_spin_lock_stats() {
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* _msg = _internal_mutable_spin_lock_stats();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+  return _msg;
+}
+inline void ServerStatistics::set_allocated_spin_lock_stats(::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spin_lock_stats_);
+  }
+  if (spin_lock_stats) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(spin_lock_stats));
+    if (message_arena != submessage_arena) {
+      spin_lock_stats = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, spin_lock_stats, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.spin_lock_stats_ = spin_lock_stats;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+}
+
+// optional .RAMCloud.ProtoBuf.ServerStatistics.HashTable hash_table = 3;
+inline bool ServerStatistics::_internal_has_hash_table() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hash_table_ != nullptr);
+  return value;
+}
+inline bool ServerStatistics::has_hash_table() const {
+  return _internal_has_hash_table();
+}
+inline void ServerStatistics::clear_hash_table() {
+  if (_impl_.hash_table_ != nullptr) _impl_.hash_table_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable& ServerStatistics::_internal_hash_table() const {
+  const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* p = _impl_.hash_table_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable&>(
+      ::RAMCloud::ProtoBuf::_ServerStatistics_HashTable_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_HashTable& ServerStatistics::hash_table() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.hash_table)
+  return _internal_hash_table();
+}
+inline void ServerStatistics::unsafe_arena_set_allocated_hash_table(
+    ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* hash_table) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hash_table_);
+  }
+  _impl_.hash_table_ = hash_table;
+  if (hash_table) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.ServerStatistics.hash_table)
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* ServerStatistics::release_hash_table() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* temp = _impl_.hash_table_;
+  _impl_.hash_table_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* ServerStatistics::unsafe_arena_release_hash_table() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerStatistics.hash_table)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* temp = _impl_.hash_table_;
+  _impl_.hash_table_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* ServerStatistics::_internal_mutable_hash_table() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.hash_table_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerStatistics_HashTable>(GetArenaForAllocation());
+    _impl_.hash_table_ = p;
+  }
+  return _impl_.hash_table_;
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* ServerStatistics::mutable_hash_table() {
+  ::RAMCloud::ProtoBuf::ServerStatistics_HashTable* _msg = _internal_mutable_hash_table();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerStatistics.hash_table)
+  return _msg;
+}
+inline void ServerStatistics::set_allocated_hash_table(::RAMCloud::ProtoBuf::ServerStatistics_HashTable* hash_table) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hash_table_;
+  }
+  if (hash_table) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hash_table);
+    if (message_arena != submessage_arena) {
+      hash_table = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hash_table, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.hash_table_ = hash_table;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerStatistics.hash_table)
+}
+
+// repeated .RAMCloud.ProtoBuf.ServerStatistics.Migration migration = 4;
+inline int ServerStatistics::_internal_migration_size() const {
+  return _impl_.migration_.size();
+}
+inline int ServerStatistics::migration_size() const {
+  return _internal_migration_size();
+}
+inline void ServerStatistics::clear_migration() {
+  _impl_.migration_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_Migration* ServerStatistics::mutable_migration(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerStatistics.migration)
+  return _impl_.migration_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_Migration >*
+ServerStatistics::mutable_migration() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.ServerStatistics.migration)
+  return &_impl_.migration_;
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_Migration& ServerStatistics::_internal_migration(int index) const {
+  return _impl_.migration_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_Migration& ServerStatistics::migration(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.migration)
+  return _internal_migration(index);
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_Migration* ServerStatistics::_internal_add_migration() {
+  return _impl_.migration_.Add();
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_Migration* ServerStatistics::add_migration() {
+  ::RAMCloud::ProtoBuf::ServerStatistics_Migration* _add = _internal_add_migration();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.ServerStatistics.migration)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_Migration >&
+ServerStatistics::migration() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.ServerStatistics.migration)
+  return _impl_.migration_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerStatistics_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,471 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerUpdate.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerUpdate_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerUpdate_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "MasterRecoveryInfo.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerUpdate_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerUpdate_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerUpdate_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerUpdate;
+struct ServerUpdateDefaultTypeInternal;
+extern ServerUpdateDefaultTypeInternal _ServerUpdate_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerUpdate* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerUpdate>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerUpdate) */ {
+ public:
+  inline ServerUpdate() : ServerUpdate(nullptr) {}
+  ~ServerUpdate() override;
+  explicit PROTOBUF_CONSTEXPR ServerUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerUpdate(const ServerUpdate& from);
+  ServerUpdate(ServerUpdate&& from) noexcept
+    : ServerUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerUpdate& operator=(const ServerUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerUpdate& operator=(ServerUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerUpdate* internal_default_instance() {
+    return reinterpret_cast<const ServerUpdate*>(
+               &_ServerUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerUpdate& a, ServerUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerUpdate& from) {
+    ServerUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerUpdate";
+  }
+  protected:
+  explicit ServerUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntryTypeFieldNumber = 1,
+    kMasterRecoveryInfoFieldNumber = 3,
+    kServerIdFieldNumber = 2,
+  };
+  // required string entry_type = 1;
+  bool has_entry_type() const;
+  private:
+  bool _internal_has_entry_type() const;
+  public:
+  void clear_entry_type();
+  const std::string& entry_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entry_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entry_type();
+  PROTOBUF_NODISCARD std::string* release_entry_type();
+  void set_allocated_entry_type(std::string* entry_type);
+  private:
+  const std::string& _internal_entry_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entry_type(const std::string& value);
+  std::string* _internal_mutable_entry_type();
+  public:
+
+  // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 3;
+  bool has_master_recovery_info() const;
+  private:
+  bool _internal_has_master_recovery_info() const;
+  public:
+  void clear_master_recovery_info();
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& master_recovery_info() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::MasterRecoveryInfo* release_master_recovery_info();
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* mutable_master_recovery_info();
+  void set_allocated_master_recovery_info(::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info);
+  private:
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& _internal_master_recovery_info() const;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* _internal_mutable_master_recovery_info();
+  public:
+  void unsafe_arena_set_allocated_master_recovery_info(
+      ::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info);
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* unsafe_arena_release_master_recovery_info();
+
+  // required fixed64 server_id = 2;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerUpdate)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entry_type_;
+    ::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info_;
+    uint64_t server_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerUpdate_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerUpdate
+
+// required string entry_type = 1;
+inline bool ServerUpdate::_internal_has_entry_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerUpdate::has_entry_type() const {
+  return _internal_has_entry_type();
+}
+inline void ServerUpdate::clear_entry_type() {
+  _impl_.entry_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerUpdate::entry_type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerUpdate.entry_type)
+  return _internal_entry_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerUpdate::set_entry_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entry_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerUpdate.entry_type)
+}
+inline std::string* ServerUpdate::mutable_entry_type() {
+  std::string* _s = _internal_mutable_entry_type();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerUpdate.entry_type)
+  return _s;
+}
+inline const std::string& ServerUpdate::_internal_entry_type() const {
+  return _impl_.entry_type_.Get();
+}
+inline void ServerUpdate::_internal_set_entry_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entry_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerUpdate::_internal_mutable_entry_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entry_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerUpdate::release_entry_type() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerUpdate.entry_type)
+  if (!_internal_has_entry_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entry_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerUpdate::set_allocated_entry_type(std::string* entry_type) {
+  if (entry_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entry_type_.SetAllocated(entry_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerUpdate.entry_type)
+}
+
+// required fixed64 server_id = 2;
+inline bool ServerUpdate::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerUpdate::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void ServerUpdate::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerUpdate::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t ServerUpdate::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerUpdate.server_id)
+  return _internal_server_id();
+}
+inline void ServerUpdate::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.server_id_ = value;
+}
+inline void ServerUpdate::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerUpdate.server_id)
+}
+
+// required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 3;
+inline bool ServerUpdate::_internal_has_master_recovery_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.master_recovery_info_ != nullptr);
+  return value;
+}
+inline bool ServerUpdate::has_master_recovery_info() const {
+  return _internal_has_master_recovery_info();
+}
+inline const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& ServerUpdate::_internal_master_recovery_info() const {
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo* p = _impl_.master_recovery_info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::MasterRecoveryInfo&>(
+      ::RAMCloud::ProtoBuf::_MasterRecoveryInfo_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& ServerUpdate::master_recovery_info() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerUpdate.master_recovery_info)
+  return _internal_master_recovery_info();
+}
+inline void ServerUpdate::unsafe_arena_set_allocated_master_recovery_info(
+    ::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.master_recovery_info_);
+  }
+  _impl_.master_recovery_info_ = master_recovery_info;
+  if (master_recovery_info) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.ServerUpdate.master_recovery_info)
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerUpdate::release_master_recovery_info() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* temp = _impl_.master_recovery_info_;
+  _impl_.master_recovery_info_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerUpdate::unsafe_arena_release_master_recovery_info() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerUpdate.master_recovery_info)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* temp = _impl_.master_recovery_info_;
+  _impl_.master_recovery_info_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerUpdate::_internal_mutable_master_recovery_info() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.master_recovery_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::MasterRecoveryInfo>(GetArenaForAllocation());
+    _impl_.master_recovery_info_ = p;
+  }
+  return _impl_.master_recovery_info_;
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerUpdate::mutable_master_recovery_info() {
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* _msg = _internal_mutable_master_recovery_info();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerUpdate.master_recovery_info)
+  return _msg;
+}
+inline void ServerUpdate::set_allocated_master_recovery_info(::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.master_recovery_info_);
+  }
+  if (master_recovery_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(master_recovery_info));
+    if (message_arena != submessage_arena) {
+      master_recovery_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, master_recovery_info, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.master_recovery_info_ = master_recovery_info;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerUpdate.master_recovery_info)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerUpdate_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,929 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: TableInformation.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_TableInformation_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_TableInformation_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_TableInformation_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_TableInformation_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_TableInformation_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class TableInformation;
+struct TableInformationDefaultTypeInternal;
+extern TableInformationDefaultTypeInternal _TableInformation_default_instance_;
+class TableInformation_TabletInfo;
+struct TableInformation_TabletInfoDefaultTypeInternal;
+extern TableInformation_TabletInfoDefaultTypeInternal _TableInformation_TabletInfo_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::TableInformation* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::TableInformation>(Arena*);
+template<> ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::TableInformation_TabletInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class TableInformation_TabletInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.TableInformation.TabletInfo) */ {
+ public:
+  inline TableInformation_TabletInfo() : TableInformation_TabletInfo(nullptr) {}
+  ~TableInformation_TabletInfo() override;
+  explicit PROTOBUF_CONSTEXPR TableInformation_TabletInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TableInformation_TabletInfo(const TableInformation_TabletInfo& from);
+  TableInformation_TabletInfo(TableInformation_TabletInfo&& from) noexcept
+    : TableInformation_TabletInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline TableInformation_TabletInfo& operator=(const TableInformation_TabletInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TableInformation_TabletInfo& operator=(TableInformation_TabletInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableInformation_TabletInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableInformation_TabletInfo* internal_default_instance() {
+    return reinterpret_cast<const TableInformation_TabletInfo*>(
+               &_TableInformation_TabletInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TableInformation_TabletInfo& a, TableInformation_TabletInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableInformation_TabletInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableInformation_TabletInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TableInformation_TabletInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableInformation_TabletInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TableInformation_TabletInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableInformation_TabletInfo& from) {
+    TableInformation_TabletInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableInformation_TabletInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.TableInformation.TabletInfo";
+  }
+  protected:
+  explicit TableInformation_TabletInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartKeyHashFieldNumber = 1,
+    kEndKeyHashFieldNumber = 2,
+    kMasterIdFieldNumber = 3,
+    kCtimeLogHeadIdFieldNumber = 8,
+    kCtimeLogHeadOffsetFieldNumber = 9,
+  };
+  // required uint64 start_key_hash = 1;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 2;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // required fixed64 master_id = 3;
+  bool has_master_id() const;
+  private:
+  bool _internal_has_master_id() const;
+  public:
+  void clear_master_id();
+  uint64_t master_id() const;
+  void set_master_id(uint64_t value);
+  private:
+  uint64_t _internal_master_id() const;
+  void _internal_set_master_id(uint64_t value);
+  public:
+
+  // required uint64 ctime_log_head_id = 8;
+  bool has_ctime_log_head_id() const;
+  private:
+  bool _internal_has_ctime_log_head_id() const;
+  public:
+  void clear_ctime_log_head_id();
+  uint64_t ctime_log_head_id() const;
+  void set_ctime_log_head_id(uint64_t value);
+  private:
+  uint64_t _internal_ctime_log_head_id() const;
+  void _internal_set_ctime_log_head_id(uint64_t value);
+  public:
+
+  // required uint32 ctime_log_head_offset = 9;
+  bool has_ctime_log_head_offset() const;
+  private:
+  bool _internal_has_ctime_log_head_offset() const;
+  public:
+  void clear_ctime_log_head_offset();
+  uint32_t ctime_log_head_offset() const;
+  void set_ctime_log_head_offset(uint32_t value);
+  private:
+  uint32_t _internal_ctime_log_head_offset() const;
+  void _internal_set_ctime_log_head_offset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.TableInformation.TabletInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t master_id_;
+    uint64_t ctime_log_head_id_;
+    uint32_t ctime_log_head_offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TableInformation_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TableInformation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.TableInformation) */ {
+ public:
+  inline TableInformation() : TableInformation(nullptr) {}
+  ~TableInformation() override;
+  explicit PROTOBUF_CONSTEXPR TableInformation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TableInformation(const TableInformation& from);
+  TableInformation(TableInformation&& from) noexcept
+    : TableInformation() {
+    *this = ::std::move(from);
+  }
+
+  inline TableInformation& operator=(const TableInformation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TableInformation& operator=(TableInformation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableInformation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableInformation* internal_default_instance() {
+    return reinterpret_cast<const TableInformation*>(
+               &_TableInformation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TableInformation& a, TableInformation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableInformation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableInformation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TableInformation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableInformation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TableInformation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableInformation& from) {
+    TableInformation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableInformation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.TableInformation";
+  }
+  protected:
+  explicit TableInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TableInformation_TabletInfo TabletInfo;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletInfoFieldNumber = 5,
+    kEntryTypeFieldNumber = 1,
+    kNameFieldNumber = 2,
+    kTableIdFieldNumber = 3,
+    kServerSpanFieldNumber = 4,
+  };
+  // repeated .RAMCloud.ProtoBuf.TableInformation.TabletInfo tablet_info = 5;
+  int tablet_info_size() const;
+  private:
+  int _internal_tablet_info_size() const;
+  public:
+  void clear_tablet_info();
+  ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* mutable_tablet_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableInformation_TabletInfo >*
+      mutable_tablet_info();
+  private:
+  const ::RAMCloud::ProtoBuf::TableInformation_TabletInfo& _internal_tablet_info(int index) const;
+  ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* _internal_add_tablet_info();
+  public:
+  const ::RAMCloud::ProtoBuf::TableInformation_TabletInfo& tablet_info(int index) const;
+  ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* add_tablet_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableInformation_TabletInfo >&
+      tablet_info() const;
+
+  // required string entry_type = 1;
+  bool has_entry_type() const;
+  private:
+  bool _internal_has_entry_type() const;
+  public:
+  void clear_entry_type();
+  const std::string& entry_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entry_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entry_type();
+  PROTOBUF_NODISCARD std::string* release_entry_type();
+  void set_allocated_entry_type(std::string* entry_type);
+  private:
+  const std::string& _internal_entry_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entry_type(const std::string& value);
+  std::string* _internal_mutable_entry_type();
+  public:
+
+  // required string name = 2;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required uint64 table_id = 3;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint32 server_span = 4;
+  bool has_server_span() const;
+  private:
+  bool _internal_has_server_span() const;
+  public:
+  void clear_server_span();
+  uint32_t server_span() const;
+  void set_server_span(uint32_t value);
+  private:
+  uint32_t _internal_server_span() const;
+  void _internal_set_server_span(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.TableInformation)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableInformation_TabletInfo > tablet_info_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entry_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t table_id_;
+    uint32_t server_span_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TableInformation_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TableInformation_TabletInfo
+
+// required uint64 start_key_hash = 1;
+inline bool TableInformation_TabletInfo::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableInformation_TabletInfo::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void TableInformation_TabletInfo::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t TableInformation_TabletInfo::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t TableInformation_TabletInfo::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.TabletInfo.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void TableInformation_TabletInfo::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.start_key_hash_ = value;
+}
+inline void TableInformation_TabletInfo::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.TabletInfo.start_key_hash)
+}
+
+// required uint64 end_key_hash = 2;
+inline bool TableInformation_TabletInfo::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TableInformation_TabletInfo::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void TableInformation_TabletInfo::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t TableInformation_TabletInfo::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t TableInformation_TabletInfo::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.TabletInfo.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void TableInformation_TabletInfo::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.end_key_hash_ = value;
+}
+inline void TableInformation_TabletInfo::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.TabletInfo.end_key_hash)
+}
+
+// required fixed64 master_id = 3;
+inline bool TableInformation_TabletInfo::_internal_has_master_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TableInformation_TabletInfo::has_master_id() const {
+  return _internal_has_master_id();
+}
+inline void TableInformation_TabletInfo::clear_master_id() {
+  _impl_.master_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t TableInformation_TabletInfo::_internal_master_id() const {
+  return _impl_.master_id_;
+}
+inline uint64_t TableInformation_TabletInfo::master_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.TabletInfo.master_id)
+  return _internal_master_id();
+}
+inline void TableInformation_TabletInfo::_internal_set_master_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.master_id_ = value;
+}
+inline void TableInformation_TabletInfo::set_master_id(uint64_t value) {
+  _internal_set_master_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.TabletInfo.master_id)
+}
+
+// required uint64 ctime_log_head_id = 8;
+inline bool TableInformation_TabletInfo::_internal_has_ctime_log_head_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TableInformation_TabletInfo::has_ctime_log_head_id() const {
+  return _internal_has_ctime_log_head_id();
+}
+inline void TableInformation_TabletInfo::clear_ctime_log_head_id() {
+  _impl_.ctime_log_head_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t TableInformation_TabletInfo::_internal_ctime_log_head_id() const {
+  return _impl_.ctime_log_head_id_;
+}
+inline uint64_t TableInformation_TabletInfo::ctime_log_head_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.TabletInfo.ctime_log_head_id)
+  return _internal_ctime_log_head_id();
+}
+inline void TableInformation_TabletInfo::_internal_set_ctime_log_head_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ctime_log_head_id_ = value;
+}
+inline void TableInformation_TabletInfo::set_ctime_log_head_id(uint64_t value) {
+  _internal_set_ctime_log_head_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.TabletInfo.ctime_log_head_id)
+}
+
+// required uint32 ctime_log_head_offset = 9;
+inline bool TableInformation_TabletInfo::_internal_has_ctime_log_head_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TableInformation_TabletInfo::has_ctime_log_head_offset() const {
+  return _internal_has_ctime_log_head_offset();
+}
+inline void TableInformation_TabletInfo::clear_ctime_log_head_offset() {
+  _impl_.ctime_log_head_offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t TableInformation_TabletInfo::_internal_ctime_log_head_offset() const {
+  return _impl_.ctime_log_head_offset_;
+}
+inline uint32_t TableInformation_TabletInfo::ctime_log_head_offset() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.TabletInfo.ctime_log_head_offset)
+  return _internal_ctime_log_head_offset();
+}
+inline void TableInformation_TabletInfo::_internal_set_ctime_log_head_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.ctime_log_head_offset_ = value;
+}
+inline void TableInformation_TabletInfo::set_ctime_log_head_offset(uint32_t value) {
+  _internal_set_ctime_log_head_offset(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.TabletInfo.ctime_log_head_offset)
+}
+
+// -------------------------------------------------------------------
+
+// TableInformation
+
+// required string entry_type = 1;
+inline bool TableInformation::_internal_has_entry_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableInformation::has_entry_type() const {
+  return _internal_has_entry_type();
+}
+inline void TableInformation::clear_entry_type() {
+  _impl_.entry_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TableInformation::entry_type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.entry_type)
+  return _internal_entry_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableInformation::set_entry_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entry_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.entry_type)
+}
+inline std::string* TableInformation::mutable_entry_type() {
+  std::string* _s = _internal_mutable_entry_type();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableInformation.entry_type)
+  return _s;
+}
+inline const std::string& TableInformation::_internal_entry_type() const {
+  return _impl_.entry_type_.Get();
+}
+inline void TableInformation::_internal_set_entry_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entry_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableInformation::_internal_mutable_entry_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entry_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableInformation::release_entry_type() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.TableInformation.entry_type)
+  if (!_internal_has_entry_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entry_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableInformation::set_allocated_entry_type(std::string* entry_type) {
+  if (entry_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entry_type_.SetAllocated(entry_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.TableInformation.entry_type)
+}
+
+// required string name = 2;
+inline bool TableInformation::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TableInformation::has_name() const {
+  return _internal_has_name();
+}
+inline void TableInformation::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TableInformation::name() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableInformation::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.name)
+}
+inline std::string* TableInformation::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableInformation.name)
+  return _s;
+}
+inline const std::string& TableInformation::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void TableInformation::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableInformation::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableInformation::release_name() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.TableInformation.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableInformation::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.TableInformation.name)
+}
+
+// required uint64 table_id = 3;
+inline bool TableInformation::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TableInformation::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void TableInformation::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t TableInformation::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t TableInformation::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.table_id)
+  return _internal_table_id();
+}
+inline void TableInformation::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.table_id_ = value;
+}
+inline void TableInformation::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.table_id)
+}
+
+// required uint32 server_span = 4;
+inline bool TableInformation::_internal_has_server_span() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TableInformation::has_server_span() const {
+  return _internal_has_server_span();
+}
+inline void TableInformation::clear_server_span() {
+  _impl_.server_span_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t TableInformation::_internal_server_span() const {
+  return _impl_.server_span_;
+}
+inline uint32_t TableInformation::server_span() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.server_span)
+  return _internal_server_span();
+}
+inline void TableInformation::_internal_set_server_span(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.server_span_ = value;
+}
+inline void TableInformation::set_server_span(uint32_t value) {
+  _internal_set_server_span(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableInformation.server_span)
+}
+
+// repeated .RAMCloud.ProtoBuf.TableInformation.TabletInfo tablet_info = 5;
+inline int TableInformation::_internal_tablet_info_size() const {
+  return _impl_.tablet_info_.size();
+}
+inline int TableInformation::tablet_info_size() const {
+  return _internal_tablet_info_size();
+}
+inline void TableInformation::clear_tablet_info() {
+  _impl_.tablet_info_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* TableInformation::mutable_tablet_info(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableInformation.tablet_info)
+  return _impl_.tablet_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableInformation_TabletInfo >*
+TableInformation::mutable_tablet_info() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.TableInformation.tablet_info)
+  return &_impl_.tablet_info_;
+}
+inline const ::RAMCloud::ProtoBuf::TableInformation_TabletInfo& TableInformation::_internal_tablet_info(int index) const {
+  return _impl_.tablet_info_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::TableInformation_TabletInfo& TableInformation::tablet_info(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableInformation.tablet_info)
+  return _internal_tablet_info(index);
+}
+inline ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* TableInformation::_internal_add_tablet_info() {
+  return _impl_.tablet_info_.Add();
+}
+inline ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* TableInformation::add_tablet_info() {
+  ::RAMCloud::ProtoBuf::TableInformation_TabletInfo* _add = _internal_add_tablet_info();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.TableInformation.tablet_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableInformation_TabletInfo >&
+TableInformation::tablet_info() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.TableInformation.tablet_info)
+  return _impl_.tablet_info_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_TableInformation_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,578 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: TabletRecovered.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_TabletRecovered_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_TabletRecovered_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_TabletRecovered_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_TabletRecovered_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_TabletRecovered_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class TabletRecovered;
+struct TabletRecoveredDefaultTypeInternal;
+extern TabletRecoveredDefaultTypeInternal _TabletRecovered_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::TabletRecovered* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::TabletRecovered>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class TabletRecovered final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.TabletRecovered) */ {
+ public:
+  inline TabletRecovered() : TabletRecovered(nullptr) {}
+  ~TabletRecovered() override;
+  explicit PROTOBUF_CONSTEXPR TabletRecovered(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TabletRecovered(const TabletRecovered& from);
+  TabletRecovered(TabletRecovered&& from) noexcept
+    : TabletRecovered() {
+    *this = ::std::move(from);
+  }
+
+  inline TabletRecovered& operator=(const TabletRecovered& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TabletRecovered& operator=(TabletRecovered&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TabletRecovered& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TabletRecovered* internal_default_instance() {
+    return reinterpret_cast<const TabletRecovered*>(
+               &_TabletRecovered_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TabletRecovered& a, TabletRecovered& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TabletRecovered* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TabletRecovered* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TabletRecovered* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TabletRecovered>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TabletRecovered& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TabletRecovered& from) {
+    TabletRecovered::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TabletRecovered* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.TabletRecovered";
+  }
+  protected:
+  explicit TabletRecovered(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntryTypeFieldNumber = 1,
+    kTableIdFieldNumber = 2,
+    kStartKeyHashFieldNumber = 3,
+    kEndKeyHashFieldNumber = 4,
+    kServerIdFieldNumber = 5,
+    kCtimeLogHeadIdFieldNumber = 6,
+    kCtimeLogHeadOffsetFieldNumber = 7,
+  };
+  // required string entry_type = 1;
+  bool has_entry_type() const;
+  private:
+  bool _internal_has_entry_type() const;
+  public:
+  void clear_entry_type();
+  const std::string& entry_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entry_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entry_type();
+  PROTOBUF_NODISCARD std::string* release_entry_type();
+  void set_allocated_entry_type(std::string* entry_type);
+  private:
+  const std::string& _internal_entry_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entry_type(const std::string& value);
+  std::string* _internal_mutable_entry_type();
+  public:
+
+  // required uint64 table_id = 2;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 3;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 4;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // required fixed64 server_id = 5;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required uint64 ctime_log_head_id = 6;
+  bool has_ctime_log_head_id() const;
+  private:
+  bool _internal_has_ctime_log_head_id() const;
+  public:
+  void clear_ctime_log_head_id();
+  uint64_t ctime_log_head_id() const;
+  void set_ctime_log_head_id(uint64_t value);
+  private:
+  uint64_t _internal_ctime_log_head_id() const;
+  void _internal_set_ctime_log_head_id(uint64_t value);
+  public:
+
+  // required uint32 ctime_log_head_offset = 7;
+  bool has_ctime_log_head_offset() const;
+  private:
+  bool _internal_has_ctime_log_head_offset() const;
+  public:
+  void clear_ctime_log_head_offset();
+  uint32_t ctime_log_head_offset() const;
+  void set_ctime_log_head_offset(uint32_t value);
+  private:
+  uint32_t _internal_ctime_log_head_offset() const;
+  void _internal_set_ctime_log_head_offset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.TabletRecovered)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entry_type_;
+    uint64_t table_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t server_id_;
+    uint64_t ctime_log_head_id_;
+    uint32_t ctime_log_head_offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TabletRecovered_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TabletRecovered
+
+// required string entry_type = 1;
+inline bool TabletRecovered::_internal_has_entry_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TabletRecovered::has_entry_type() const {
+  return _internal_has_entry_type();
+}
+inline void TabletRecovered::clear_entry_type() {
+  _impl_.entry_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TabletRecovered::entry_type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TabletRecovered.entry_type)
+  return _internal_entry_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TabletRecovered::set_entry_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entry_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TabletRecovered.entry_type)
+}
+inline std::string* TabletRecovered::mutable_entry_type() {
+  std::string* _s = _internal_mutable_entry_type();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TabletRecovered.entry_type)
+  return _s;
+}
+inline const std::string& TabletRecovered::_internal_entry_type() const {
+  return _impl_.entry_type_.Get();
+}
+inline void TabletRecovered::_internal_set_entry_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entry_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TabletRecovered::_internal_mutable_entry_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entry_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TabletRecovered::release_entry_type() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.TabletRecovered.entry_type)
+  if (!_internal_has_entry_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entry_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TabletRecovered::set_allocated_entry_type(std::string* entry_type) {
+  if (entry_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entry_type_.SetAllocated(entry_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entry_type_.IsDefault()) {
+    _impl_.entry_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.TabletRecovered.entry_type)
+}
+
+// required uint64 table_id = 2;
+inline bool TabletRecovered::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TabletRecovered::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void TabletRecovered::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t TabletRecovered::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t TabletRecovered::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TabletRecovered.table_id)
+  return _internal_table_id();
+}
+inline void TabletRecovered::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.table_id_ = value;
+}
+inline void TabletRecovered::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TabletRecovered.table_id)
+}
+
+// required uint64 start_key_hash = 3;
+inline bool TabletRecovered::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TabletRecovered::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void TabletRecovered::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t TabletRecovered::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t TabletRecovered::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TabletRecovered.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void TabletRecovered::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.start_key_hash_ = value;
+}
+inline void TabletRecovered::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TabletRecovered.start_key_hash)
+}
+
+// required uint64 end_key_hash = 4;
+inline bool TabletRecovered::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TabletRecovered::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void TabletRecovered::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t TabletRecovered::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t TabletRecovered::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TabletRecovered.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void TabletRecovered::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_key_hash_ = value;
+}
+inline void TabletRecovered::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TabletRecovered.end_key_hash)
+}
+
+// required fixed64 server_id = 5;
+inline bool TabletRecovered::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TabletRecovered::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void TabletRecovered::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t TabletRecovered::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t TabletRecovered::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TabletRecovered.server_id)
+  return _internal_server_id();
+}
+inline void TabletRecovered::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.server_id_ = value;
+}
+inline void TabletRecovered::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TabletRecovered.server_id)
+}
+
+// required uint64 ctime_log_head_id = 6;
+inline bool TabletRecovered::_internal_has_ctime_log_head_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool TabletRecovered::has_ctime_log_head_id() const {
+  return _internal_has_ctime_log_head_id();
+}
+inline void TabletRecovered::clear_ctime_log_head_id() {
+  _impl_.ctime_log_head_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t TabletRecovered::_internal_ctime_log_head_id() const {
+  return _impl_.ctime_log_head_id_;
+}
+inline uint64_t TabletRecovered::ctime_log_head_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TabletRecovered.ctime_log_head_id)
+  return _internal_ctime_log_head_id();
+}
+inline void TabletRecovered::_internal_set_ctime_log_head_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.ctime_log_head_id_ = value;
+}
+inline void TabletRecovered::set_ctime_log_head_id(uint64_t value) {
+  _internal_set_ctime_log_head_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TabletRecovered.ctime_log_head_id)
+}
+
+// required uint32 ctime_log_head_offset = 7;
+inline bool TabletRecovered::_internal_has_ctime_log_head_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool TabletRecovered::has_ctime_log_head_offset() const {
+  return _internal_has_ctime_log_head_offset();
+}
+inline void TabletRecovered::clear_ctime_log_head_offset() {
+  _impl_.ctime_log_head_offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t TabletRecovered::_internal_ctime_log_head_offset() const {
+  return _impl_.ctime_log_head_offset_;
+}
+inline uint32_t TabletRecovered::ctime_log_head_offset() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TabletRecovered.ctime_log_head_offset)
+  return _internal_ctime_log_head_offset();
+}
+inline void TabletRecovered::_internal_set_ctime_log_head_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.ctime_log_head_offset_ = value;
+}
+inline void TabletRecovered::set_ctime_log_head_offset(uint32_t value) {
+  _internal_set_ctime_log_head_offset(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TabletRecovered.ctime_log_head_offset)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_TabletRecovered_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -203,6 +203,13 @@ def broadcast(name, options, cluster_args, client_args):
             (obj_path, flatten_args(client_args), name), **cluster_args)
     print(get_client_log(), end='')
 
+def coordinatorLoaded(name, options, cluster_args, client_args):
+    if 'num_clients' not in cluster_args:
+        cluster_args['num_clients'] = 10
+    cluster.run(client='%s/ClusterPerf %s %s' %
+            (obj_path, flatten_args(client_args), name), **cluster_args)
+    print(get_client_log(), end='')
+
 def multiOp(name, options, cluster_args, client_args):
     cluster_args['timeout'] = 100
     if options.num_servers == None:
@@ -293,6 +300,7 @@ simple_tests = [
 ]
 
 graph_tests = [
+    Test("coordinatorLoaded", coordinatorLoaded),
     Test("multiWrite_oneMaster", multiOp),
     Test("multiRead_oneMaster", multiOp),
     Test("multiRead_oneObjectPerMaster", multiOp),
@@ -63,10 +63,15 @@ class Out:
 class Metric:
     """A single performance metric.
     """
-    def __init__(self, name, documentation):
-        """ name is the variable name to use for this metric """
+    def __init__(self, name, documentation, gauge=False):
+        """ name is the variable name to use for this metric; gauge is
+            True if the metric holds a value (such as a server id) rather
+            than a count, so per-thread copies are combined by taking the
+            maximum instead of the sum.
+        """
         self.name = name
         self.documentation = documentation
+        self.gauge = gauge
     def dump_header(self, out):
         out('/// %s' % self.documentation)
         out('RawMetric %s;' % self.name)
@@ -87,7 +92,8 @@ class Metric:
         """
         out('        case %s:' % (counter.value()))
         out('            return {"%s",' % path)
-        out('                    &%s};' % path)
+        out('                    &%s,' % path)
+        out('                    %s};' % ('true' if self.gauge else 'false'))
         counter.next()
 
 class Group:
@@ -107,23 +113,22 @@ class Group:
     def metric(self, name, documentation):
         self.metrics.append(Metric(name, documentation))
 
+    def gauge(self, name, documentation):
+        self.metrics.append(Metric(name, documentation, gauge=True))
+
     def group(self, group):
         self.groups.append(group)
 
     def dump_header(self, out):
         indent = ' ' * 4 * (out._indent + 2)
         out('/// %s' % self.documentation)
-        constructorBody = ''
         if self.name != 'RawMetrics':
             out('struct %s {' % self.name)
-        else:
-            constructorBody = 'init();'
         children = self.groups + self.metrics;
         out('    %s()' % self.name)
-        out('        : %s {%s}' %
-            (('\n%s, ' % (indent)).join(
-                [child.initializer() for child in children]),
-                constructorBody))
+        out('        : %s {}' %
+            ('\n%s, ' % (indent)).join(
+                [child.initializer() for child in children]))
         for child in children:
             child.dump_header(out.indent())
         if self.name != 'RawMetrics':
@@ -224,7 +229,7 @@ master.metric('replicationTicks',
 master.metric('replicationBytes',
     'bytes sent during recovery from first gRD response '
     'through log sync')
-master.metric('replicas',
+master.gauge('replicas',
     'number of backups on which to replicate each segment')
 master.metric('backupCloseTicks',
     'time closing segments in ReplicaManager')
@@ -238,7 +243,7 @@ master.metric('replicaRecoveries',
     'number of replicas which have started replica recreation')
 master.metric('openReplicaRecoveries',
     'of replicaRecoveries how many were for replicas which were open')
-master.metric('replicationTasks',
+master.gauge('replicationTasks',
     'max number of outstanding tasks in ReplicaManager')
 master.metric('replicationTransmitCopyTicks',
     'time spent copying outgoing rpcs in transport')
@@ -258,6 +263,18 @@ master.metric('recoverSegmentPostingWriteRpcTicks',
     'time spent during recoverSegment starting write rpcs in transport')
 master.metric('logSyncPostingWriteRpcTicks',
     'time spent during recovery final log sync starting write rpcs in transport')
+master.metric('replicationWindowStalls',
+    'times replication writes to a backup stalled because its write '
+    'window was full (retries during one stall count once)')
+master.metric('replicationWindowDecreases',
+    'times a backup\'s replication write window was cut due to congestion')
+master.gauge('replicationMaxBackupQueueDepth',
+    'max number of replication write rpcs outstanding to a single backup')
+master.metric('logSyncBatchCount',
+    'log syncs performed on behalf of deferred write replies')
+master.metric('logSyncBatchRpcs',
+    'write replies released by those syncs (divide by logSyncBatchCount '
+    'for the average batch size)')
 
 backup = Group('Backup', 'metrics for backups')
 backup.metric('recoveryCount',
@@ -344,6 +361,7 @@ rpc.metric('getServerConfigCount', 'number of invocations of GET_SERVER_CONFIG R
 rpc.metric('getLogMetricsCount', 'number of invocations of GET_LOG_METRICS RPC')
 rpc.metric('multiWriteCount', 'number of invocations of MULTI_WRITE RPC')
 rpc.metric('verifyMembershipCount', 'number of invocations of VERIFY_MEMBERSHIP RPC')
+rpc.metric('scanCount', 'number of invocations of SCAN RPC')
 rpc.metric('illegalRpcCount', 'number of invocations of RPCs with illegal opcodes')
 
 rpc.metric('rpc0Ticks', 'time spent executing RPC 0 (undefined)')
@@ -403,8 +421,70 @@ rpc.metric('getServerConfigTicks', 'time spent executing GET_SERVER_CONFIG RPC')
 rpc.metric('getLogMetricsTicks', 'time spent executing GET_LOG_METRICS RPC')
 rpc.metric('multiWriteTicks', 'time spent executing MULTI_WRITE RPC')
 rpc.metric('verifyMembershipTicks', 'number of invocations of VERIFY_MEMBERSHIP')
+rpc.metric('scanTicks', 'time spent executing SCAN RPC')
 rpc.metric('illegalRpcTicks', 'time spent executing RPCs with illegal opcodes')
 
+# Time RPCs spent queued in ServiceManager because their service had no
+# thread available (same order as above).
+rpc.metric('rpc0WaitTicks', 'time RPC 0 (undefined) waited for a worker thread')
+rpc.metric('rpc1WaitTicks', 'time RPC 1 (undefined) waited for a worker thread')
+rpc.metric('rpc2WaitTicks', 'time RPC 2 (undefined) waited for a worker thread')
+rpc.metric('rpc3WaitTicks', 'time RPC 3 (undefined) waited for a worker thread')
+rpc.metric('rpc4WaitTicks', 'time RPC 4 (undefined) waited for a worker thread')
+rpc.metric('rpc5WaitTicks', 'time RPC 5 (undefined) waited for a worker thread')
+rpc.metric('rpc6WaitTicks', 'time RPC 6 (undefined) waited for a worker thread')
+rpc.metric('pingWaitTicks', 'time PING RPC waited for a worker thread')
+rpc.metric('proxyPingWaitTicks', 'time PROXY_PING RPC waited for a worker thread')
+rpc.metric('killWaitTicks', 'time KILL RPC waited for a worker thread')
+rpc.metric('createTableWaitTicks', 'time CREATE_TABLE RPC waited for a worker thread')
+rpc.metric('getTableIdWaitTicks', 'time GET_TABLE_ID RPC waited for a worker thread')
+rpc.metric('dropTableWaitTicks', 'time DROP_TABLE RPC waited for a worker thread')
+rpc.metric('readWaitTicks', 'time READ RPC waited for a worker thread')
+rpc.metric('writeWaitTicks', 'time WRITE RPC waited for a worker thread')
+rpc.metric('removeWaitTicks', 'time REMOVE RPC waited for a worker thread')
+rpc.metric('enlistServerWaitTicks', 'time ENLIST_SERVER RPC waited for a worker thread')
+rpc.metric('getServerListWaitTicks', 'time GET_SERVER_LIST RPC waited for a worker thread')
+rpc.metric('getTabletMapWaitTicks', 'time GET_TABLET_MAP RPC waited for a worker thread')
+rpc.metric('recoverWaitTicks', 'time RECOVER RPC waited for a worker thread')
+rpc.metric('hintServerDownWaitTicks', 'time HINT_SERVER_DOWN RPC waited for a worker thread')
+rpc.metric('recoveryMasterFinishedWaitTicks', 'time RECOVERY_MASTER_FINISHED RPC waited for a worker thread')
+rpc.metric('enumerateWaitTicks', 'time ENUMERATE RPC waited for a worker thread')
+rpc.metric('setMasterRecoveryInfoWaitTicks', 'time SET_MASTER_RECOVERY_INFO RPC waited for a worker thread')
+rpc.metric('fillWithTestDataWaitTicks', 'time FILL_WITH_TEST_DATA RPC waited for a worker thread')
+rpc.metric('multiReadWaitTicks', 'time MULTI_READ RPC waited for a worker thread')
+rpc.metric('getMetricsWaitTicks', 'time GET_METRICS RPC waited for a worker thread')
+rpc.metric('rpc27WaitTicks', 'time RPC 27 (undefined) waited for a worker thread')
+rpc.metric('backupFreeWaitTicks', 'time BACKUP_FREE RPC waited for a worker thread')
+rpc.metric('backupGetRecoveryDataWaitTicks', 'time BACKUP_GETRECOVERYDATA RPC waited for a worker thread')
+rpc.metric('rpc30WaitTicks', 'time RPC 30 (undefined) waited for a worker thread')
+rpc.metric('backupStartReadingDataWaitTicks', 'time BACKUP_STARTREADINGDATA RPC waited for a worker thread')
+rpc.metric('backupWriteWaitTicks', 'time BACKUP_WRITE RPC waited for a worker thread')
+rpc.metric('backupRecoveryCompleteWaitTicks', 'time BACKUP_RECOVERYCOMPLETE RPC waited for a worker thread')
+rpc.metric('backupQuiesceWaitTicks', 'time BACKUP_QUIESCE RPC waited for a worker thread')
+rpc.metric('setServerListWaitTicks', 'time SET_SERVER_LIST RPC waited for a worker thread')
+rpc.metric('updateServerListWaitTicks', 'time BACKUP_STARTPARTITION RPC waited for a worker thread')
+rpc.metric('rpc37WaitTicks', 'time RPC 37 (undefined) waited for a worker thread')
+rpc.metric('rpc38WaitTicks', 'time RPC 38 (undefined) waited for a worker thread')
+rpc.metric('dropTabletOwnershipWaitTicks', 'time DROP_TABLET_OWNERSHIP RPC waited for a worker thread')
+rpc.metric('takeTabletOwnershipWaitTicks', 'time TAKE_TABLET_OWNERSHIP RPC waited for a worker thread')
+rpc.metric('backupAssignGroupWaitTicks', 'time BACKUP_ASSIGN_GROUP RPC waited for a worker thread')
+rpc.metric('getHeadOfLogWaitTicks', 'time GET_HEAD_OF_LOG RPC waited for a worker thread')
+rpc.metric('incrementWaitTicks', 'time INCREMENT RPC waited for a worker thread')
+rpc.metric('prepForMigrationWaitTicks', 'time PREP_FOR_MIGRATION RPC waited for a worker thread')
+rpc.metric('receiveMigrationDataWaitTicks', 'time RECEIVE_MIGRATION_DATA RPC waited for a worker thread')
+rpc.metric('reassignTabletOwnershipWaitTicks', 'time REASSIGN_TABLET_OWNERSHIP RPC waited for a worker thread')
+rpc.metric('migrateTabletWaitTicks', 'time MIGRATE_TABLET RPC waited for a worker thread')
+rpc.metric('isReplicaNeededWaitTicks', 'time IS_REPLICA_NEEDED RPC waited for a worker thread')
+rpc.metric('splitTabletWaitTicks', 'time SPLIT_TABLET RPC waited for a worker thread')
+rpc.metric('getServerStatisticsWaitTicks', 'time GET_SERVER_STATISTICS RPC waited for a worker thread')
+rpc.metric('setRuntimeOptionWaitTicks', 'time SET_RUNTIME_OPTION RPC waited for a worker thread')
+rpc.metric('getServerConfigWaitTicks', 'time GET_SERVER_CONFIG RPC waited for a worker thread')
+rpc.metric('getLogMetricsWaitTicks', 'time GET_LOG_METRICS RPC waited for a worker thread')
+rpc.metric('multiWriteWaitTicks', 'time MULTI_WRITE RPC waited for a worker thread')
+rpc.metric('verifyMembershipWaitTicks', 'time VERIFY_MEMBERSHIP RPC waited for a worker thread')
+rpc.metric('scanWaitTicks', 'time SCAN RPC waited for a worker thread')
+rpc.metric('illegalRpcWaitTicks', 'time RPCs with illegal opcodes waited for a worker thread')
+
 transmit = Group('Transmit', 'metrics related to transmitting messages')
 transmit.metric('ticks', 'elapsed time transmitting messages')
 transmit.metric('messageCount', 'number of messages transmitted')
@@ -451,10 +531,10 @@ definitions.group(backup);
 definitions.group(rpc);
 definitions.group(transport);
 definitions.group(temp);
-definitions.metric('serverId', 'server id assigned by coordinator')
-definitions.metric('pid', 'process ID on machine')
-definitions.metric('clockFrequency', 'cycles per second for the cpu')
-definitions.metric('segmentSize','size in bytes of segments')
+definitions.gauge('serverId', 'server id assigned by coordinator')
+definitions.gauge('pid', 'process ID on machine')
+definitions.gauge('clockFrequency', 'cycles per second for the cpu')
+definitions.gauge('segmentSize','size in bytes of segments')
 
 def writeBuildFiles(definitions):
     counter = Counter()
@@ -466,7 +546,7 @@ def writeBuildFiles(definitions):
     cc('    switch (i) {')
     definitions.dump_metric_info_code(cc, '', counter)
     cc('    }')
-    cc('    return {NULL, NULL};')
+    cc('    return {NULL, NULL, false};')
     cc('}')
     cc('} // namespace RAMCloud')
 
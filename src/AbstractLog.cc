@@ -177,6 +177,35 @@ AbstractLog::getEntry(Reference reference, Buffer& outBuffer)
     return (*segmentManager)[slot].getEntry(offset, outBuffer);
 }
 
+/**
+ * Start bringing the beginning of an appended entry (its header, and for
+ * objects the key and the start of the value) into the processor's caches,
+ * so that a later getEntry() on the same reference doesn't stall on memory.
+ *
+ * Unlike getEntry(), this may be given a reference read from the hash table
+ * without holding its bucket lock: such a reference may be stale, but the
+ * segment it refers to can't have been freed while the current RPC is
+ * running (see SegmentManager::freeUnreferencedSegments), and if the slot is
+ * no longer valid the prefetch is simply skipped.
+ *
+ * \param reference
+ *      Reference to the entry to prefetch.
+ */
+void
+AbstractLog::prefetchEntry(Reference reference)
+{
+    SegmentSlot slot = reference.getSlot(segmentSize);
+    uint32_t offset = reference.getOffset(segmentSize);
+    try {
+        const void* address;
+        uint32_t contiguous = (*segmentManager)[slot].peek(offset, &address);
+        if (contiguous > 0)
+            prefetch(address, std::min(contiguous, 2U * CACHE_LINE_SIZE));
+    } catch (const SegmentManagerException& e) {
+        // Stale reference; nothing to prefetch.
+    }
+}
+
 /**
  * Given a reference to an appended entry, return the identifier of the segment
  * that contains the entry. An example use of this is tombstones, which mark
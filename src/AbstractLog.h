@@ -235,6 +235,7 @@ class AbstractLog {
     LogEntryType getEntry(Reference reference,
                           Buffer& outBuffer);
     uint64_t getSegmentId(Reference reference);
+    void prefetchEntry(Reference reference);
     bool segmentExists(uint64_t segmentId);
 
     /*
@@ -190,6 +190,18 @@ TEST_F(AbstractLogTest, getSegmentId) {
     EXPECT_EQ(0, other);
 }
 
+TEST_F(AbstractLogTest, prefetchEntry) {
+    uint64_t data = 0x123456789ABCDEF0UL;
+    Buffer sourceBuffer;
+    sourceBuffer.append(&data, sizeof(data));
+    Log::Reference ref;
+    EXPECT_TRUE(l.append(LOG_ENTRY_TYPE_OBJ, sourceBuffer, &ref));
+    l.prefetchEntry(ref);
+
+    // References to slots without a segment are ignored.
+    l.prefetchEntry(Log::Reference(serverConfig.segmentSize * 1000UL));
+}
+
 TEST_F(AbstractLogTest, segmentExists) {
     EXPECT_FALSE(l.segmentExists(0));
     EXPECT_TRUE(l.segmentExists(1));
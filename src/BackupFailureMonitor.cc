@@ -181,4 +181,20 @@ BackupFailureMonitor::trackerChangesEnqueued()
     changesOrExit.notify_one();
 }
 
+/**
+ * Wake up the main loop so that it calls ReplicaManager::proceed() even if
+ * there are no cluster membership changes. Used when work has been scheduled
+ * on the ReplicaManager from outside of the log's normal replication path.
+ *
+ * This doesn't take #mutex, since the main loop may hold it while waiting
+ * for ReplicaManager::dataMutex and callers may not be able to block. As a
+ * result the wakeup can very occasionally be missed; the scheduled work is
+ * then done the next time the ReplicaManager makes progress for any reason.
+ */
+void
+BackupFailureMonitor::wakeUp()
+{
+    changesOrExit.notify_one();
+}
+
 } // namespace RAMCloud
@@ -48,6 +48,7 @@ class BackupFailureMonitor
     bool serverIsUp(ServerId serverId);
 
     void trackerChangesEnqueued();
+    void wakeUp();
 
   PRIVATE:
     void main();
@@ -23,6 +23,109 @@ namespace RAMCloud {
 
 enum { DISABLE_BACKGROUND_BUILDING = false };
 
+/**
+ * Used by performTask() when recovery segments are built by #builders.
+ * Hands each primary replica to the builders as soon as it has finished
+ * loading from storage, and logs how long building took once they have
+ * built every primary replica. Replicas are loaded in the order of
+ * #replicas, so this only waits on the next replica in that order.
+ */
+void
+BackupMasterRecovery::queueLoadedReplicas()
+{
+    Lock lock(buildMutex);
+    size_t numPrimaries = firstSecondaryReplica - replicas.begin();
+    if (numPrimariesBuilt == numPrimaries) {
+        readingDataTicks.destroy();
+        uint64_t ns =
+            Cycles::toNanoseconds(Cycles::rdtsc() - buildingStartTicks);
+        LOG(NOTICE, "Took %lu ms to filter %lu segments using %u threads",
+            ns / 1000 / 1000, numPrimaries, numBuilders);
+        return;
+    }
+
+    schedule();
+
+    while (nextToBuild != firstSecondaryReplica &&
+           nextToBuild->frame->isLoaded()) {
+        if (!nextToBuild->queued) {
+            nextToBuild->queued = true;
+            buildQueue.push_back(&*nextToBuild);
+            replicaQueued.notify_one();
+        }
+        ++nextToBuild;
+    }
+}
+
+/**
+ * Make a primary replica the next one that #builders build recovery segments
+ * for, since a recovery master is waiting for it. Does nothing if the
+ * replica is already being built.
+ *
+ * \param replica
+ *      Primary replica that a recovery master has asked for.
+ */
+void
+BackupMasterRecovery::buildNext(Replica* replica)
+{
+    Lock lock(buildMutex);
+    if (replica->queued) {
+        auto it = std::find(buildQueue.begin(), buildQueue.end(), replica);
+        if (it == buildQueue.end())
+            return;
+        buildQueue.erase(it);
+    }
+    replica->queued = true;
+    buildQueue.push_front(replica);
+    replicaQueued.notify_one();
+}
+
+/**
+ * Main loop of each of the #builders: build recovery segments for replicas
+ * taken from #buildQueue until stopBuilders() is called. If a replica
+ * hasn't finished loading from storage yet (because a recovery master asked
+ * for it early), this waits for it to load.
+ */
+void
+BackupMasterRecovery::builderMain()
+{
+    Lock lock(buildMutex);
+    while (true) {
+        while (buildQueue.empty() && !stopBuilding)
+            replicaQueued.wait(lock);
+        if (stopBuilding)
+            return;
+        Replica* replica = buildQueue.front();
+        buildQueue.pop_front();
+        lock.unlock();
+
+        LOG(DEBUG, "Starting to build recovery segments for (<%s,%lu>)",
+            crashedMasterId.toString().c_str(), replica->metadata->segmentId);
+        buildRecoverySegments(*replica);
+        replica->frame->unload();
+
+        lock.lock();
+        ++numPrimariesBuilt;
+    }
+}
+
+/**
+ * Tell #builders to exit once they finish the replica they are working on,
+ * if any, and wait for them to do so.
+ */
+void
+BackupMasterRecovery::stopBuilders()
+{
+    {
+        Lock lock(buildMutex);
+        stopBuilding = true;
+    }
+    replicaQueued.notify_all();
+    foreach (auto& builder, builders)
+        builder.join();
+    builders.clear();
+}
+
 // -- BackupMasterRecovery --
 
 /**
@@ -50,15 +153,20 @@ enum { DISABLE_BACKGROUND_BUILDING = false };
  * \param segmentSize
  *      Size of the replicas on storage. Needed for bounds-checking on the
  *      SegmentIterators which walk the stored replicas.
+ * \param numBuilders
+ *      Number of threads to build recovery segments for primary replicas
+ *      with. If 1, they are built one at a time on the task queue thread.
  */
 BackupMasterRecovery::BackupMasterRecovery(TaskQueue& taskQueue,
                                            uint64_t recoveryId,
                                            ServerId crashedMasterId,
-                                           uint32_t segmentSize)
+                                           uint32_t segmentSize,
+                                           uint32_t numBuilders)
     : Task(taskQueue)
     , recoveryId(recoveryId)
     , crashedMasterId(crashedMasterId)
     , partitions()
+    , partitionIndex()
     , segmentSize(segmentSize)
     , numPartitions()
     , replicas()
@@ -75,7 +183,23 @@ BackupMasterRecovery::BackupMasterRecovery(TaskQueue& taskQueue,
     , buildingStartTicks()
     , testingExtractDigest()
     , testingSkipBuild()
+    , numBuilders(numBuilders)
+    , builders()
+    , buildMutex()
+    , buildQueue()
+    , replicaQueued()
+    , stopBuilding(false)
+    , numPrimariesBuilt(0)
+{
+}
+
+/**
+ * Wait for any builder threads to finish the replica they are working on
+ * and exit.
+ */
+BackupMasterRecovery::~BackupMasterRecovery()
 {
+    stopBuilders();
 }
 
 /**
@@ -221,6 +345,7 @@ BackupMasterRecovery::setPartitionsAndSchedule(ProtoBuf::Tablets partitions)
     }
 
     this->partitions.construct(partitions);
+    partitionIndex.construct(*this->partitions);
 
     for (int i = 0; i < partitions.tablet_size(); ++i) {
         numPartitions = std::max(numPartitions,
@@ -236,6 +361,11 @@ BackupMasterRecovery::setPartitionsAndSchedule(ProtoBuf::Tablets partitions)
     LOG(DEBUG, "Kicked off building recovery segments");
     nextToBuild = replicas.begin();
     buildingStartTicks = Cycles::rdtsc();
+    if (numBuilders > 1 && !DISABLE_BACKGROUND_BUILDING) {
+        LOG(DEBUG, "Building recovery segments with %u threads", numBuilders);
+        for (uint32_t i = 0; i < numBuilders; i++)
+            builders.emplace_back(&BackupMasterRecovery::builderMain, this);
+    }
     schedule();
 }
 
@@ -248,7 +378,9 @@ BackupMasterRecovery::setPartitionsAndSchedule(ProtoBuf::Tablets partitions)
  * segment comes from a primary replica then do not block; if the recovery
  * segment hasn't been constructed yet the return status indicates the recovery
  * master should try to collect other recovery segments and come back for this
- * one later.
+ * one later. When recovery segments are built by a pool of threads, such a
+ * replica is built next, so replicas become available in the order that
+ * recovery masters ask for them.
  *
  * \param recoveryId
  *      Which master recovery this is for. The coordinator may schedule
@@ -311,6 +443,8 @@ BackupMasterRecovery::getRecoverySegment(uint64_t recoveryId,
 
     Fence::lfence();
     if (!replica->built) {
+        if (numBuilders > 1)
+            buildNext(replica);
         LOG(DEBUG, "Deferring because <%s,%lu> not yet filtered",
             crashedMasterId.toString().c_str(), segmentId);
         return STATUS_RETRY;
@@ -380,7 +514,9 @@ BackupMasterRecovery::getRecoveryId()
  * from the backup worker thread so building recovery segments for primary
  * replicas is done in the background. Works down #replicas in order starting
  * at the beginning (which #nextToBuild is initially set to in start()) until
- * the end of #replicas or a secondary replica is encountered.
+ * the end of #replicas or a secondary replica is encountered. If there are
+ * builder threads, loaded replicas are handed to them instead (see
+ * queueLoadedReplicas()).
  */
 void
 BackupMasterRecovery::performTask()
@@ -396,6 +532,11 @@ BackupMasterRecovery::performTask()
     if (DISABLE_BACKGROUND_BUILDING)
         return;
 
+    if (!builders.empty()) {
+        queueLoadedReplicas();
+        return;
+    }
+
     if (nextToBuild == firstSecondaryReplica) {
         readingDataTicks.destroy();
         uint64_t ns =
@@ -501,7 +642,9 @@ BackupMasterRecovery::populateStartResponse(Buffer* responseBuffer,
  * This method is NOT thread-safe for multiple simulatenous calls for the SAME
  * replica. Multiple invocations for different replicas is OK and expected.
  * BackupMasterRecovery serializes the processing of primary replicas via a
- * TaskQueue; primary replicas are ONLY processed by that task (performTask()).
+ * TaskQueue; primary replicas are ONLY processed by that task (performTask()),
+ * or, if there are #builders, by whichever builder takes the replica from
+ * #buildQueue (Replica::queued ensures only one does).
  * Secondaries are ONLY processed by the backup worker thread. Since the worker
  * thread serializes all rpcs secondary processing is serialized. Since the two
  * sets are disjoint it all works out.
@@ -532,10 +675,10 @@ BackupMasterRecovery::buildRecoverySegments(Replica& replica)
     uint64_t start = Cycles::rdtsc();
     try {
         if (!testingSkipBuild) {
-            assert(partitions);
+            assert(partitionIndex);
             RecoverySegmentBuilder::build(replicaData, segmentSize,
                                           replica.metadata->certificate,
-                                          *partitions,
+                                          *partitionIndex,
                                           recoverySegments.get());
         }
     } catch (const Exception& e) {
@@ -569,6 +712,7 @@ BackupMasterRecovery::Replica::Replica(const BackupStorage::FrameRef& frame)
     , recoverySegments()
     , recoveryException()
     , built()
+    , queued()
 {
 }
 
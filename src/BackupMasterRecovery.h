@@ -16,10 +16,15 @@
 #ifndef RAMCLOUD_BACKUPMASTERRECOVERY_H
 #define RAMCLOUD_BACKUPMASTERRECOVERY_H
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "Common.h"
 #include "BackupStorage.h"
 #include "Log.h"
 #include "ProtoBuf.h"
+#include "RecoverySegmentBuilder.h"
 #include "Segment.h"
 #include "ServerId.h"
 #include "TaskQueue.h"
@@ -58,12 +63,15 @@ class BackupReplicaMetadata;
  * 2) Calls to performTask() are serialized.
  * 3) FrameRefs delivered to start() remain valid until destruction.
  *
- * Primary replicas are ONLY filtered by the task queue thread serially.
+ * Primary replicas are ONLY filtered by the task queue thread serially,
+ * unless the recovery was created with more than one builder thread, in
+ * which case they are ONLY filtered by those threads (see #builders).
  * Secondary replicas are ONLY filtered by the sole backup worked thread
  * (and, hence, serially, as well).
- * The only miniscule synchronization it to ensure that all built
- * recovery segment information is flushed to main memory before it is used
- * by getRecoverySegment().
+ * Other than the handoff of primary replicas to builder threads (protected
+ * by #buildMutex) the only miniscule synchronization it to ensure that all
+ * built recovery segment information is flushed to main memory before it is
+ * used by getRecoverySegment().
  *
  * Destruction is non-trivial because the instance may become redundant while
  * it is filtering a replica. To solve this, users call free() which instructs
@@ -76,7 +84,9 @@ class BackupMasterRecovery : public Task {
     BackupMasterRecovery(TaskQueue& taskQueue,
                          uint64_t recoveryId,
                          ServerId crashedMasterId,
-                         uint32_t segmentSize);
+                         uint32_t segmentSize,
+                         uint32_t numBuilders = 1);
+    ~BackupMasterRecovery();
     void start(const std::vector<BackupStorage::FrameRef>& frames,
                Buffer* buffer,
                StartResponse* response);
@@ -96,6 +106,10 @@ class BackupMasterRecovery : public Task {
     struct Replica;
     void buildRecoverySegments(Replica& replica);
     bool getLogDigest(Replica& replica, Buffer* digestBuffer);
+    void queueLoadedReplicas();
+    void buildNext(Replica* replica);
+    void builderMain();
+    void stopBuilders();
 
     /**
      * Which master recovery this is for. The coordinator may schedule
@@ -123,6 +137,13 @@ class BackupMasterRecovery : public Task {
      */
     Tub<ProtoBuf::Tablets> partitions;
 
+    /**
+     * Sorted view of #partitions used to place each object in its recovery
+     * segment. Built along with #partitions so that the cost of sorting
+     * them is paid once per recovery rather than once per replica.
+     */
+    Tub<RecoverySegmentBuilder::PartitionIndex> partitionIndex;
+
     /**
      * Size of the replicas on storage. Needed for bounds-checking on the
      * SegmentIterators which walk the stored replicas.
@@ -204,6 +225,13 @@ class BackupMasterRecovery : public Task {
          */
         bool built;
 
+        /**
+         * Set once a primary replica has been handed to the builder threads
+         * (see #buildQueue), so that it is only built once. Protected by
+         * #buildMutex.
+         */
+        bool queued;
+
         DISALLOW_COPY_AND_ASSIGN(Replica);
     };
 
@@ -309,6 +337,51 @@ class BackupMasterRecovery : public Task {
      * buildRecoverySegments().
      */
     bool testingSkipBuild;
+
+    /**
+     * Number of threads to build recovery segments for primary replicas
+     * with. If 1, they are built one at a time by performTask() on the task
+     * queue thread instead. See
+     * ServerConfig::Backup::numRecoverySegmentBuilders.
+     */
+    uint32_t numBuilders;
+
+    /**
+     * Threads which build recovery segments for primary replicas in
+     * parallel, taking them from #buildQueue. Started by
+     * setPartitionsAndSchedule() if #numBuilders is more than 1; empty
+     * otherwise.
+     */
+    std::vector<std::thread> builders;
+
+    /**
+     * Protects #buildQueue, #stopBuilding, #numPrimariesBuilt, and
+     * Replica::queued.
+     */
+    std::mutex buildMutex;
+    typedef std::unique_lock<std::mutex> Lock;
+
+    /**
+     * Primary replicas which are ready to have their recovery segments
+     * built by #builders, in the order they should be built. Loaded replicas
+     * are added at the back by performTask(); replicas which a recovery
+     * master has asked for are moved to the front by getRecoverySegment().
+     */
+    std::deque<Replica*> buildQueue;
+
+    /// Notified when a replica is added to #buildQueue or when #stopBuilding
+    /// is set.
+    std::condition_variable replicaQueued;
+
+    /// Set to tell #builders to exit. See stopBuilders().
+    bool stopBuilding;
+
+    /**
+     * Number of primary replicas #builders have finished with. Used by
+     * performTask() to find out when background building is done.
+     */
+    size_t numPrimariesBuilt;
+
     DISALLOW_COPY_AND_ASSIGN(BackupMasterRecovery);
 };
 
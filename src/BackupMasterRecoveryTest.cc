@@ -268,6 +268,40 @@ TEST_F(BackupMasterRecoveryTest, getRecoverySegment) {
                  buffer.getOffset<char>(buffer.getTotalLength() - 10));
 }
 
+TEST_F(BackupMasterRecoveryTest, getRecoverySegment_buildNext) {
+    mockMetadata(88, true, true);
+    mockMetadata(89, true, true);
+    mockMetadata(90, true, true);
+    recovery.construct(taskQueue, 456lu, ServerId{99, 0}, segmentSize, 2);
+    recovery->testingExtractDigest = &mockExtractDigest;
+    recovery->start(frames, NULL, NULL);
+    // No builder threads are started until setPartitionsAndSchedule().
+    recovery->buildQueue.push_back(&recovery->replicas[0]);
+    recovery->replicas[0].queued = true;
+    recovery->buildQueue.push_back(&recovery->replicas[1]);
+    recovery->replicas[1].queued = true;
+
+    uint64_t segmentId = recovery->replicas[1].metadata->segmentId;
+    EXPECT_EQ(STATUS_RETRY,
+              recovery->getRecoverySegment(456, segmentId, 0, NULL, NULL));
+    ASSERT_EQ(2u, recovery->buildQueue.size());
+    EXPECT_EQ(&recovery->replicas[1], recovery->buildQueue[0]);
+    EXPECT_EQ(&recovery->replicas[0], recovery->buildQueue[1]);
+
+    segmentId = recovery->replicas[2].metadata->segmentId;
+    EXPECT_EQ(STATUS_RETRY,
+              recovery->getRecoverySegment(456, segmentId, 0, NULL, NULL));
+    ASSERT_EQ(3u, recovery->buildQueue.size());
+    EXPECT_EQ(&recovery->replicas[2], recovery->buildQueue[0]);
+    EXPECT_TRUE(recovery->replicas[2].queued);
+
+    // Replicas being built aren't requeued.
+    recovery->buildQueue.pop_front();
+    EXPECT_EQ(STATUS_RETRY,
+              recovery->getRecoverySegment(456, segmentId, 0, NULL, NULL));
+    EXPECT_EQ(2u, recovery->buildQueue.size());
+}
+
 TEST_F(BackupMasterRecoveryTest, getRecoverySegment_exceptionDuringBuild) {
     mockMetadata(88);
     recovery->start(frames, NULL, NULL);
@@ -326,6 +360,34 @@ TEST_F(BackupMasterRecoveryTest, performTask) {
     EXPECT_EQ("performTask: Took 0 ms to filter 1 segments", TestLog::get());
 }
 
+TEST_F(BackupMasterRecoveryTest, performTask_builderThreads) {
+    mockMetadata(88, true, true);
+    mockMetadata(89, true, true);
+    mockMetadata(90, true, true);
+    mockMetadata(91, true, false);
+    recovery.construct(taskQueue, 456lu, ServerId{99, 0}, segmentSize, 2);
+    recovery->testingSkipBuild = true;
+    recovery->start(frames, NULL, NULL);
+    recovery->setPartitionsAndSchedule(partitions);
+    EXPECT_EQ(2u, recovery->builders.size());
+
+    TestLog::Enable _;
+    for (int i = 0; i < 1000 && recovery->isScheduled(); i++) {
+        taskQueue.performTask();
+        usleep(1000);
+    }
+    EXPECT_FALSE(recovery->isScheduled());
+    EXPECT_TRUE(StringUtil::contains(TestLog::get(),
+        "ms to filter 3 segments using 2 threads"));
+    for (int i = 0; i < 3; i++)
+        EXPECT_TRUE(recovery->replicas[i].built);
+    EXPECT_FALSE(recovery->replicas[3].built);
+    EXPECT_EQ(3u, recovery->numPrimariesBuilt);
+
+    recovery->stopBuilders();
+    EXPECT_EQ(0u, recovery->builders.size());
+}
+
 namespace {
 bool buildRecoverySegmentsFilter(string s) {
     return s == "buildRecoverySegments";
@@ -81,7 +81,8 @@ BackupService::BackupService(Context* context,
                                             config->backup.writeRateLimit,
                                             maxNonVolatileBuffers,
                                             config->backup.file.c_str(),
-                                            O_DIRECT | O_SYNC));
+                                            O_DIRECT | O_SYNC,
+                                            config->backup.ioDepth));
     }
     if (storage->getMetadataSize() < sizeof(BackupReplicaMetadata))
         DIE("Storage metadata block too small to hold BackupReplicaMetadata");
@@ -468,10 +469,9 @@ BackupService::startReadingData(
     }
     BackupMasterRecovery* recovery;
     if (mustCreateRecovery) {
-        recovery = new BackupMasterRecovery(taskQueue,
-                                            reqHdr->recoveryId,
-                                            crashedMasterId,
-                                            segmentSize);
+        recovery = new BackupMasterRecovery(
+            taskQueue, reqHdr->recoveryId, crashedMasterId, segmentSize,
+            config->backup.numRecoverySegmentBuilders);
         recoveries[crashedMasterId] = recovery;
     }
     recovery = recoveries[crashedMasterId];
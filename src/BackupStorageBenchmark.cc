@@ -1,4 +1,4 @@
-/* Copyright (c) 2011 Stanford University
+/* Copyright (c) 2011-2013 Stanford University
  *
  * Permission to use, copy, modify, and distribute this software for any
  * purpose with or without fee is hereby granted, provided that the above
@@ -13,137 +13,76 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
-#include <thread>
-
-#include "BackupStorage.h"
+#include "Buffer.h"
 #include "Cycles.h"
-#include "Logging.h"
+#include "Logger.h"
 #include "Segment.h"
+#include "ShortMacros.h"
+#include "SingleFileStorage.h"
 
 using namespace RAMCloud;
 
-struct Store {
-    Store(SingleFileStorage& storage,
-          const char* segment,
-          BackupStorage::Handle* handle)
-        : storage(storage)
-        , segment(segment)
-        , handle(handle)
-    {
-    }
-
-    void
-    operator()()
-    {
-        uint64_t startTime = Cycles::rdtsc();
-        storage.putSegment(handle, segment);
-        LOG(DEBUG, "StoreOp took %lu us",
-            Cycles::toNanoseconds(Cycles::rdtsc() - startTime) / 1000);
-    }
-
-    SingleFileStorage& storage;
-    const char* segment;
-    BackupStorage::Handle* handle;
-};
-
+/**
+ * Measures how replica write and load bandwidth of SingleFileStorage
+ * changes with the number of IOs it keeps outstanding to the device
+ * (see SingleFileStorage::ioDepth).
+ */
 struct Bench {
-    explicit Bench(const char* backupFile)
+    Bench(const char* backupFile, uint32_t frameCount)
         : backupFile(backupFile)
-        , segmentCount(80 * 2)
-        , storage(Segment::SEGMENT_SIZE,
-                  segmentCount,
-                  backupFile,
-                  O_DIRECT | O_SYNC | O_NOATIME)
-        , allocated()
-        , scratch(SegmentAllocator::malloc(Segment::SEGMENT_SIZE))
-        , mb(static_cast<double>(Segment::SEGMENT_SIZE) / (1 << 20))
-    {
-    }
-
-    ~Bench()
+        , frameCount(frameCount)
+        , segmentSize(Segment::DEFAULT_SEGMENT_SIZE)
+        , scratch(new char[segmentSize])
+        , mb(static_cast<double>(segmentSize) / (1 << 20))
     {
-        SegmentAllocator::free(scratch);
+        memset(scratch.get(), 'x', segmentSize);
     }
 
+    /**
+     * Write #frameCount replicas and then load them all back using a
+     * storage instance which keeps up to \a ioDepth IOs outstanding.
+     * Logs the aggregate bandwidth of each phase.
+     */
     void
-    fill(const uint32_t count)
+    run(uint32_t ioDepth)
     {
-        double sum = 0., min = 100000.0, max = 0.;
-        for (uint32_t i = 0; i < count; i++) {
-            auto* handle = storage.allocate(0, i);
-            allocated.push_back(handle);
-            uint64_t start = Cycles::rdtsc();
-            storage.putSegment(handle, scratch);
-            uint64_t putTime = Cycles::rdtsc() - start;
-            double mbSec = mb / Cycles::toSeconds(putTime);
-            LOG(NOTICE, "Stored segment at %.1f MB/s", mbSec);
-            sum += mbSec;
-            max = std::max(max, mbSec);
-            min = std::min(min, mbSec);
+        SingleFileStorage storage(segmentSize, frameCount, 0, frameCount,
+                                  backupFile.c_str(),
+                                  O_DIRECT | O_SYNC | O_NOATIME, ioDepth);
+        Buffer source;
+        source.append(scratch.get(), segmentSize);
+        char metadata[] = "BackupStorageBenchmark";
+
+        std::vector<BackupStorage::FrameRef> frames;
+        uint64_t start = Cycles::rdtsc();
+        for (uint32_t i = 0; i < frameCount; ++i) {
+            frames.push_back(storage.open(false));
+            frames.back()->append(source, 0, segmentSize, 0,
+                                  metadata, sizeof(metadata));
+            frames.back()->close();
         }
-        LOG(WARNING, "=== Min/Avg/Max Put Bandwidth: %.1f %.1f %.1f ===",
-            min, sum / count, max);
-    }
-
-    void
-    testRead()
-    {
-        const uint32_t count = 80;
-
-        fill(count);
-        usleep(1000000);
-
-        double sum = 0., min = 100000.0, max = 0.;
-        foreach (auto* handle, allocated) {
-            uint64_t start = Cycles::rdtsc();
-            storage.getSegment(handle, scratch);
-            uint64_t getTime = Cycles::rdtsc() - start;
-            double mbSec = mb / Cycles::toSeconds(getTime);
-            LOG(NOTICE, "Fetched segment at %.1f MB/s", mbSec);
-            sum += mbSec;
-            max = std::max(max, mbSec);
-            min = std::min(min, mbSec);
-        }
-        LOG(WARNING, "=== Min/Avg/Max Get Bandwidth: %.1f %.1f %.1f ===",
-            min, sum / count, max);
-    }
-
-    void
-    testReadWithWriteInterference()
-    {
-        const uint32_t count = 80;
-
-        fill(count);
-        usleep(1000000);
-
-        auto writeList = allocated;
-        std::random_shuffle(writeList.begin(), writeList.end());
-
-        auto writeHandle = writeList.begin();
-
-        double sum = 0., min = 100000.0, max = 0.;
-        int i = 0;
-        foreach (auto* handle, allocated) {
-            if (!(i++ % 3))
-                std::thread(Store(storage, scratch, *(writeHandle++)));
-            uint64_t start = Cycles::rdtsc();
-            storage.getSegment(handle, scratch);
-            uint64_t getTime = Cycles::rdtsc() - start;
-            double mbSec = mb / Cycles::toSeconds(getTime);
-            LOG(NOTICE, "Fetched segment at %.1f MB/s", mbSec);
-            sum += mbSec;
-            max = std::max(max, mbSec);
-            min = std::min(min, mbSec);
-        }
-        LOG(WARNING, "=== Min/Avg/Max Get Bandwidth: %.1f %.1f %.1f ===",
-            min, sum / count, max);
+        storage.quiesce();
+        double writeSeconds = Cycles::toSeconds(Cycles::rdtsc() - start);
+
+        start = Cycles::rdtsc();
+        foreach (BackupStorage::FrameRef& frame, frames)
+            frame->startLoading();
+        foreach (BackupStorage::FrameRef& frame, frames)
+            frame->load();
+        double readSeconds = Cycles::toSeconds(Cycles::rdtsc() - start);
+
+        foreach (BackupStorage::FrameRef& frame, frames)
+            frame->free();
+
+        LOG(WARNING, "=== ioDepth %2u: write %7.1f MB/s, read %7.1f MB/s ===",
+            ioDepth, frameCount * mb / writeSeconds,
+            frameCount * mb / readSeconds);
     }
 
     const string backupFile;
-    const uint32_t segmentCount;
-    SingleFileStorage storage;
-    vector<BackupStorage::Handle*> allocated;
-    char* const scratch;
+    const uint32_t frameCount;
+    const uint32_t segmentSize;
+    std::unique_ptr<char[]> scratch;
     const double mb;
 
     DISALLOW_COPY_AND_ASSIGN(Bench);
@@ -155,10 +94,14 @@ main(int ac, char* av[])
     const char* backupFile = "/var/tmp/backup.log";
     if (ac > 1)
         backupFile = av[1];
-    LOG(WARNING, "Writing to %s", backupFile);
-
-    Bench(backupFile).testRead();
-    //Bench(backupFile).testReadWithWriteInterference();
+    uint32_t frameCount = 80;
+    if (ac > 2)
+        frameCount = downCast<uint32_t>(strtoul(av[2], NULL, 10));
+    LOG(WARNING, "Writing %u segments to %s", frameCount, backupFile);
+
+    Bench bench(backupFile, frameCount);
+    for (uint32_t ioDepth = 1; ioDepth <= 32; ioDepth *= 2)
+        bench.run(ioDepth);
 
     return 0;
 }
@@ -0,0 +1,203 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "BackupWriteWindow.h"
+#include "Cycles.h"
+#include "RawMetrics.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * Create a BackupWriteWindow with no write rpcs outstanding.
+ */
+BackupWriteWindow::BackupWriteWindow()
+    : backups()
+    , totalInFlight(0)
+{
+}
+
+/**
+ * Check whether another write rpc may be sent to a backup and, if so,
+ * account for it as outstanding. Every successful call must eventually be
+ * matched by a call to completed(), rejected(), or abandoned() for the
+ * same backup.
+ *
+ * \param backupId
+ *      Backup the caller would like to send a write rpc to.
+ * \return
+ *      True if the rpc may be sent now; false if either \a backupId's window
+ *      or the overall limit is full and the caller should retry later.
+ */
+bool
+BackupWriteWindow::tryStart(ServerId backupId)
+{
+    if (totalInFlight >= MAX_WRITE_RPCS_IN_FLIGHT)
+        return false;
+    Backup& backup = backups[backupId];
+    if (backup.inFlight >= static_cast<uint32_t>(backup.window)) {
+        if (!backup.stalled) {
+            backup.stalled = true;
+            ++metrics->master.replicationWindowStalls;
+        }
+        return false;
+    }
+    backup.stalled = false;
+    ++backup.inFlight;
+    ++totalInFlight;
+    if (backup.inFlight > metrics->master.replicationMaxBackupQueueDepth)
+        metrics->master.replicationMaxBackupQueueDepth = backup.inFlight;
+    return true;
+}
+
+/**
+ * Record that a write rpc to a backup finished successfully and adjust its
+ * window based on how long the rpc took.
+ *
+ * \param backupId
+ *      Backup the rpc was sent to; tryStart() must have succeeded for it.
+ * \param bytes
+ *      Replica data carried by the rpc.
+ * \param ticks
+ *      Cycles between sending the rpc and seeing it complete.
+ */
+void
+BackupWriteWindow::completed(ServerId backupId, uint32_t bytes, uint64_t ticks)
+{
+    abandoned(backupId);
+    Backup& backup = backups[backupId];
+
+    double ticksPerByte = static_cast<double>(ticks) /
+                          std::max(bytes, uint32_t(MIN_NORMALIZED_BYTES));
+    if (backup.baselineTicksPerByte == 0 ||
+        ticksPerByte < backup.baselineTicksPerByte) {
+        backup.baselineTicksPerByte = ticksPerByte;
+    } else {
+        // Let the baseline creep toward recent samples so that a single
+        // unusually fast rpc can't make the backup look congested forever.
+        backup.baselineTicksPerByte +=
+            (ticksPerByte - backup.baselineTicksPerByte) / 64;
+    }
+
+    if (ticksPerByte > CONGESTION_FACTOR * backup.baselineTicksPerByte) {
+        decrease(backup, ticks);
+    } else {
+        backup.window = std::min(backup.window + 1.0 / backup.window,
+                                 static_cast<double>(MAX_WINDOW));
+    }
+}
+
+/**
+ * Record that a backup rejected a write rpc because it was overloaded
+ * (for example, it had no buffers left to accept a new replica). This is
+ * taken as a congestion signal and the backup's window is cut.
+ *
+ * \param backupId
+ *      Backup the rpc was sent to; tryStart() must have succeeded for it.
+ * \param ticks
+ *      Cycles between sending the rpc and seeing it complete.
+ */
+void
+BackupWriteWindow::rejected(ServerId backupId, uint64_t ticks)
+{
+    abandoned(backupId);
+    decrease(backups[backupId], ticks);
+}
+
+/**
+ * Record that a write rpc to a backup is no longer outstanding without
+ * drawing any conclusions about the backup's speed (for example, because
+ * the rpc was canceled or the backup crashed).
+ *
+ * \param backupId
+ *      Backup the rpc was sent to; tryStart() must have succeeded for it.
+ */
+void
+BackupWriteWindow::abandoned(ServerId backupId)
+{
+    Backup& backup = backups[backupId];
+    assert(backup.inFlight > 0);
+    assert(totalInFlight > 0);
+    --backup.inFlight;
+    --totalInFlight;
+}
+
+/**
+ * Forget all state about a backup. Called when a backup crashes. State is
+ * kept if rpcs to the backup are still outstanding, since they must still
+ * be abandoned() later.
+ *
+ * \param backupId
+ *      Backup which is no longer part of the cluster.
+ */
+void
+BackupWriteWindow::removeBackup(ServerId backupId)
+{
+    auto it = backups.find(backupId);
+    if (it == backups.end() || it->second.inFlight > 0)
+        return;
+    backups.erase(it);
+}
+
+/**
+ * Return the number of write rpcs outstanding to a particular backup.
+ */
+uint32_t
+BackupWriteWindow::getInFlight(ServerId backupId) const
+{
+    auto it = backups.find(backupId);
+    if (it == backups.end())
+        return 0;
+    return it->second.inFlight;
+}
+
+/**
+ * Return the number of write rpcs a backup is currently allowed to have
+ * outstanding.
+ */
+uint32_t
+BackupWriteWindow::getWindow(ServerId backupId) const
+{
+    auto it = backups.find(backupId);
+    if (it == backups.end())
+        return INITIAL_WINDOW;
+    return static_cast<uint32_t>(it->second.window);
+}
+
+// - private -
+
+/**
+ * Halve a backup's window (but never below one rpc), unless it was already
+ * cut within the last round trip.
+ *
+ * \param backup
+ *      Backup whose window should shrink.
+ * \param roundTripTicks
+ *      Latency of the rpc which signaled congestion; cuts closer together
+ *      than this are assumed to be due to the same congestion episode.
+ */
+void
+BackupWriteWindow::decrease(Backup& backup, uint64_t roundTripTicks)
+{
+    uint64_t now = Cycles::rdtsc();
+    if (backup.lastDecrease != 0 &&
+        now - backup.lastDecrease < roundTripTicks)
+        return;
+    backup.lastDecrease = now;
+    backup.window = std::max(backup.window / 2, 1.0);
+    ++metrics->master.replicationWindowDecreases;
+}
+
+} // namespace RAMCloud
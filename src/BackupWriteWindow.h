@@ -0,0 +1,135 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_BACKUPWRITEWINDOW_H
+#define RAMCLOUD_BACKUPWRITEWINDOW_H
+
+#include <unordered_map>
+
+#include "Common.h"
+#include "ServerId.h"
+
+namespace RAMCloud {
+
+/**
+ * Decides how many replication write rpcs a master may have outstanding to
+ * each backup. Each backup gets its own window which grows while write rpcs
+ * to it complete promptly and is cut in half when the backup shows signs
+ * of congestion: either rpc latency (normalized by size) rises well above
+ * the best seen for that backup, or the backup rejects an open because it
+ * has run out of buffers. This is additive-increase/multiplicative-decrease
+ * much as in TCP congestion control, so fast backups are kept busy while
+ * slow ones are not allowed to soak up the master's replication capacity.
+ *
+ * A single instance is shared by all the ReplicatedSegments of a
+ * ReplicaManager. It is not thread-safe; all calls must be made with
+ * ReplicaManager::dataMutex held.
+ */
+class BackupWriteWindow {
+  PUBLIC:
+    /**
+     * Maximum number of simultaneously outstanding write rpcs to allow
+     * across all backups, regardless of their windows.
+     */
+    enum { MAX_WRITE_RPCS_IN_FLIGHT = 32 };
+
+    /// Window given to a backup the first time rpcs are sent to it.
+    enum { INITIAL_WINDOW = 2 };
+
+    /// Largest window any single backup can grow to.
+    enum { MAX_WINDOW = 8 };
+
+    /**
+     * Rpcs smaller than this are treated as if they were this large when
+     * normalizing latency, so that small rpcs (whose latency is dominated
+     * by fixed costs) don't look congested next to large ones.
+     */
+    enum { MIN_NORMALIZED_BYTES = 64 * 1024 };
+
+    /**
+     * A backup is considered congested when the normalized latency of a
+     * write rpc exceeds its baseline by more than this factor.
+     */
+    enum { CONGESTION_FACTOR = 3 };
+
+    BackupWriteWindow();
+
+    bool tryStart(ServerId backupId);
+    void completed(ServerId backupId, uint32_t bytes, uint64_t ticks);
+    void rejected(ServerId backupId, uint64_t ticks);
+    void abandoned(ServerId backupId);
+    void removeBackup(ServerId backupId);
+
+    /// Return the number of write rpcs outstanding to all backups.
+    uint32_t getInFlight() const { return totalInFlight; }
+    uint32_t getInFlight(ServerId backupId) const;
+    uint32_t getWindow(ServerId backupId) const;
+
+  PRIVATE:
+    /// Congestion state kept for each backup written to.
+    struct Backup {
+        Backup()
+            : inFlight(0)
+            , window(INITIAL_WINDOW)
+            , baselineTicksPerByte(0)
+            , lastDecrease(0)
+            , stalled(false)
+        {}
+
+        /// Write rpcs currently outstanding to this backup.
+        uint32_t inFlight;
+
+        /**
+         * Number of write rpcs allowed to be outstanding to this backup.
+         * Fractional so it can grow by about one rpc per round trip.
+         */
+        double window;
+
+        /**
+         * Lowest normalized latency recently seen for a write rpc to this
+         * backup, in cycles per byte. 0 until the first rpc completes. Drifts
+         * up slowly so the baseline can follow real changes in the backup.
+         */
+        double baselineTicksPerByte;
+
+        /**
+         * Cycles::rdtsc() when the window was last cut. Used to cut the
+         * window at most once per round trip, since all the rpcs in flight
+         * during a congestion episode will report it.
+         */
+        uint64_t lastDecrease;
+
+        /**
+         * True if the last tryStart() for this backup was refused because
+         * its window was full. Used so that a stall is counted once, not
+         * once for every retry made while it lasts.
+         */
+        bool stalled;
+    };
+
+    void decrease(Backup& backup, uint64_t roundTripTicks);
+
+    /// Per-backup state; entries are created on the first tryStart().
+    std::unordered_map<ServerId, Backup> backups;
+
+    /// Write rpcs outstanding across all backups.
+    uint32_t totalInFlight;
+
+    DISALLOW_COPY_AND_ASSIGN(BackupWriteWindow);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_BACKUPWRITEWINDOW_H
@@ -0,0 +1,143 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "BackupWriteWindow.h"
+#include "RawMetrics.h"
+
+namespace RAMCloud {
+
+class BackupWriteWindowTest : public ::testing::Test {
+  public:
+    BackupWriteWindow window;
+    ServerId backupId1;
+    ServerId backupId2;
+
+    BackupWriteWindowTest()
+        : window()
+        , backupId1(1, 0)
+        , backupId2(2, 0)
+    {
+        metrics->master.replicationWindowStalls = 0;
+        metrics->master.replicationWindowDecreases = 0;
+        metrics->master.replicationMaxBackupQueueDepth = 0;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(BackupWriteWindowTest);
+};
+
+TEST_F(BackupWriteWindowTest, tryStart) {
+    EXPECT_TRUE(window.tryStart(backupId1));
+    EXPECT_TRUE(window.tryStart(backupId1));
+    EXPECT_FALSE(window.tryStart(backupId1));
+    EXPECT_EQ(1lu, metrics->master.replicationWindowStalls);
+    EXPECT_EQ(2lu, metrics->master.replicationMaxBackupQueueDepth);
+
+    // Retries during the same stall aren't counted again, but a new stall
+    // after a write gets through is.
+    EXPECT_FALSE(window.tryStart(backupId1));
+    EXPECT_EQ(1lu, metrics->master.replicationWindowStalls);
+    window.abandoned(backupId1);
+    EXPECT_TRUE(window.tryStart(backupId1));
+    EXPECT_FALSE(window.tryStart(backupId1));
+    EXPECT_EQ(2lu, metrics->master.replicationWindowStalls);
+
+    // A full window for one backup doesn't hold up others.
+    EXPECT_TRUE(window.tryStart(backupId2));
+    EXPECT_EQ(2u, window.getInFlight(backupId1));
+    EXPECT_EQ(1u, window.getInFlight(backupId2));
+    EXPECT_EQ(3u, window.getInFlight());
+}
+
+TEST_F(BackupWriteWindowTest, tryStart_totalLimit) {
+    window.totalInFlight = BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT;
+    EXPECT_FALSE(window.tryStart(backupId1));
+    EXPECT_EQ(0u, window.getInFlight(backupId1));
+}
+
+TEST_F(BackupWriteWindowTest, completed_grows) {
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(window.tryStart(backupId1));
+        window.completed(backupId1, 1024 * 1024, 1000);
+    }
+    EXPECT_EQ(0u, window.getInFlight());
+    EXPECT_EQ(uint32_t(BackupWriteWindow::MAX_WINDOW),
+              window.getWindow(backupId1));
+    EXPECT_EQ(0lu, metrics->master.replicationWindowDecreases);
+}
+
+TEST_F(BackupWriteWindowTest, completed_congested) {
+    window.backups[backupId1].window = 8;
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.completed(backupId1, 1024 * 1024, 1000);
+    EXPECT_EQ(8u, window.getWindow(backupId1));
+
+    // Ten times slower for the same amount of data.
+    ASSERT_TRUE(window.tryStart(backupId1));
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.completed(backupId1, 1024 * 1024, 10000000000lu);
+    EXPECT_EQ(4u, window.getWindow(backupId1));
+    EXPECT_EQ(1lu, metrics->master.replicationWindowDecreases);
+
+    // Only cut once per round trip.
+    window.completed(backupId1, 1024 * 1024, 10000000000lu);
+    EXPECT_EQ(4u, window.getWindow(backupId1));
+    EXPECT_EQ(1lu, metrics->master.replicationWindowDecreases);
+}
+
+TEST_F(BackupWriteWindowTest, completed_smallRpcsNotCongested) {
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.completed(backupId1, 1024 * 1024, 16000);
+    // A tiny rpc with an eighth of the latency isn't a congestion signal
+    // even though its per-byte cost is much higher.
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.completed(backupId1, 10, 2000);
+    EXPECT_EQ(0lu, metrics->master.replicationWindowDecreases);
+}
+
+TEST_F(BackupWriteWindowTest, rejected) {
+    window.backups[backupId1].window = 6;
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.rejected(backupId1, 1000);
+    EXPECT_EQ(0u, window.getInFlight());
+    EXPECT_EQ(3u, window.getWindow(backupId1));
+
+    window.backups[backupId1].lastDecrease = 0;
+    window.backups[backupId1].window = 1;
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.rejected(backupId1, 1000);
+    EXPECT_EQ(1u, window.getWindow(backupId1));
+}
+
+TEST_F(BackupWriteWindowTest, abandoned) {
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.abandoned(backupId1);
+    EXPECT_EQ(0u, window.getInFlight());
+    EXPECT_EQ(0u, window.getInFlight(backupId1));
+    EXPECT_EQ(uint32_t(BackupWriteWindow::INITIAL_WINDOW),
+              window.getWindow(backupId1));
+}
+
+TEST_F(BackupWriteWindowTest, removeBackup) {
+    window.removeBackup(backupId1);
+    ASSERT_TRUE(window.tryStart(backupId1));
+    window.removeBackup(backupId1);
+    EXPECT_EQ(1u, window.backups.count(backupId1));
+    window.abandoned(backupId1);
+    window.removeBackup(backupId1);
+    EXPECT_EQ(0u, window.backups.count(backupId1));
+}
+
+}  // namespace RAMCloud
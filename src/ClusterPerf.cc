@@ -45,6 +45,7 @@
 namespace po = boost::program_options;
 
 #include "RamCloud.h"
+#include "CoordinatorClient.h"
 #include "CycleCounter.h"
 #include "Cycles.h"
 #include "KeyUtil.h"
@@ -1012,6 +1013,132 @@ broadcast()
     printTime("broadcast", Cycles::toSeconds(totalTime)/count, description);
 }
 
+/**
+ * Time one kind of read-only coordinator RPC.
+ *
+ * \param tabletMap
+ *      True means time fetching the full tablet map; false means time
+ *      looking up the id of a table.
+ * \param ms
+ *      Run the test for this many milliseconds.
+ *
+ * \return
+ *      The average time, in seconds, for one RPC.
+ */
+double
+timeCoordinatorRead(bool tabletMap, double ms)
+{
+    uint64_t runCycles = Cycles::fromSeconds(ms/1e03);
+    uint64_t start = Cycles::rdtsc();
+    uint64_t elapsed;
+    int count = 0;
+    while (true) {
+        for (int i = 0; i < 10; i++) {
+            if (tabletMap) {
+                ProtoBuf::Tablets tablets;
+                CoordinatorClient::getTabletMap(&context, &tablets);
+            } else {
+                cluster->getTableId("data");
+            }
+        }
+        count += 10;
+        elapsed = Cycles::rdtsc() - start;
+        if (elapsed >= runCycles)
+            break;
+    }
+    return Cycles::toSeconds(elapsed)/count;
+}
+
+// This benchmark measures the latency and throughput of the coordinator
+// for read-only RPCs (table id lookups and tablet map fetches) when several
+// clients are issuing them simultaneously.  It then repeats the measurement
+// with one of the slaves creating and dropping tables throughout, to show
+// how much readers are held up behind operations that modify the
+// coordinator's state.
+void
+coordinatorLoaded()
+{
+    const char* key = "coordinatorLoaded";
+    uint16_t keyLength = downCast<uint16_t>(strlen(key));
+
+    if (clientIndex > 0) {
+        // Slaves execute the following code, which creates load on the
+        // coordinator until the master clears the flag object.
+        while (true) {
+            char command[20];
+            char flag[20];
+            getCommand(command, sizeof(command));
+            if (strcmp(command, "read") == 0 ||
+                    strcmp(command, "mutate") == 0) {
+                bool mutate = (strcmp(command, "mutate") == 0);
+                char tableName[50];
+                snprintf(tableName, sizeof(tableName), "coordinatorLoaded%d",
+                        clientIndex);
+                setSlaveState("running");
+                int count = 0;
+                while (true) {
+                    if (mutate) {
+                        cluster->createTable(tableName);
+                        cluster->dropTable(tableName);
+                    } else {
+                        ProtoBuf::Tablets tablets;
+                        CoordinatorClient::getTabletMap(&context, &tablets);
+                    }
+                    count++;
+                    if (mutate || (count % 100) == 0) {
+                        readObject(dataTable, key, keyLength, flag,
+                                sizeof(flag));
+                        if (strcmp(flag, "run") != 0)
+                            break;
+                    }
+                }
+                RAMCLOUD_LOG(NOTICE, "%s: %d operations", command, count);
+                setSlaveState("idle");
+            } else if (strcmp(command, "done") == 0) {
+                setSlaveState("done");
+                return;
+            } else {
+                RAMCLOUD_LOG(ERROR, "unknown command %s", command);
+                return;
+            }
+        }
+    }
+
+    // The master executes the following code, which starts up zero or more
+    // slaves to generate load, then times the coordinator RPCs.
+    printf("# RAMCloud coordinator performance for read-only RPCs as a\n"
+           "# function of load (1 or more clients all fetching the tablet\n"
+           "# map repeatedly), without and with another client creating\n"
+           "# and dropping tables.\n");
+    printf("# Generated by 'clusterperf.py coordinatorLoaded'\n");
+    printf("#\n");
+    printf("# numClients  mutating  getTableId(us)  getTabletMap(us)  "
+           "throughput(total kmaps/sec)\n");
+    printf("#---------------------------------------------------------"
+           "-----------------------------\n");
+    for (int mutate = 0; mutate < 2; mutate++) {
+        // When mutating, slave 1 modifies tables and the others read.
+        int firstReader = 1 + mutate;
+        if (firstReader > numClients)
+            break;
+        for (int numReaders = 0; numReaders <= numClients - firstReader;
+                numReaders++) {
+            cluster->write(dataTable, key, keyLength, "run");
+            if (mutate)
+                sendCommand("mutate", "running", 1, 1);
+            sendCommand("read", "running", firstReader, numReaders);
+            double tableIdTime = timeCoordinatorRead(false, 100);
+            double tabletMapTime = timeCoordinatorRead(true, 100);
+            cluster->write(dataTable, key, keyLength, "");
+            sendCommand(NULL, "idle", 1, numReaders + mutate);
+            printf("%5d      %5d     %10.1f      %10.1f         %8.1f\n",
+                    numReaders + 1, mutate, tableIdTime*1e06,
+                    tabletMapTime*1e06, (numReaders + 1)/(1e03*tabletMapTime));
+        }
+    }
+    sendCommand("done", "done", 1, numClients-1);
+}
+
 /**
  * This method contains the core of all the "multiRead" tests.
  * It writes objsPerMaster objects on numMasters servers
@@ -1964,6 +2091,7 @@ struct TestInfo {
 TestInfo tests[] = {
     {"basic", basic},
     {"broadcast", broadcast},
+    {"coordinatorLoaded", coordinatorLoaded},
     {"multiWrite_oneMaster", multiWrite_oneMaster},
     {"multiRead_oneMaster", multiRead_oneMaster},
     {"multiRead_oneObjectPerMaster", multiRead_oneObjectPerMaster},
@@ -220,19 +220,64 @@ CoordinatorClient::getTabletMap(Context* context,
     rpc.wait(tabletMap);
 }
 
+/**
+ * Retrieve just the parts of the tablet map that have changed since the
+ * caller last fetched it, or just the tablets of a single table. This is
+ * much cheaper than getTabletMap() in large clusters, where the full map is
+ * big and most of it rarely changes.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param generation
+ *      The generation returned with the update the caller's copy of the
+ *      tablet map was last brought up to date with, or 0 if it has none.
+ * \param sinceVersion
+ *      The version returned with that update, or 0 if the caller has no
+ *      copy of the tablet map.
+ * \param tableId
+ *      If WireFormat::GetTabletMap::ALL_TABLES, \a update will bring the
+ *      caller's whole copy of the map up to date. Otherwise it will hold
+ *      just the current tablets of this table.
+ * \param[out] update
+ *      Filled in with the changes. If the coordinator can't tell what
+ *      changed since \a sinceVersion (for instance, because it restarted)
+ *      this holds the full tablet map.
+ */
+void
+CoordinatorClient::getTabletMapUpdate(Context* context, uint64_t generation,
+        uint64_t sinceVersion, uint64_t tableId, TabletMapUpdate* update)
+{
+    GetTabletMapRpc rpc(context, generation, sinceVersion, tableId);
+    rpc.wait(update);
+}
+
 /**
  * Constructor for GetTabletMapRpc: initiates an RPC in the same way as
- * #CoordinatorClient::getTabletMap, but returns once the RPC has been
- * initiated, without waiting for it to complete.
+ * #CoordinatorClient::getTabletMapUpdate, but returns once the RPC has
+ * been initiated, without waiting for it to complete.
  *
  * \param context
  *      Overall information about this RAMCloud server or client.
+ * \param generation
+ *      Generation of the caller's copy of the tablet map, or 0 if it has
+ *      none.
+ * \param sinceVersion
+ *      Version of the caller's copy of the tablet map, or 0 to fetch the
+ *      whole map.
+ * \param tableId
+ *      Table whose tablets should be fetched, or
+ *      WireFormat::GetTabletMap::ALL_TABLES.
  */
-GetTabletMapRpc::GetTabletMapRpc(Context* context)
+GetTabletMapRpc::GetTabletMapRpc(Context* context, uint64_t generation,
+        uint64_t sinceVersion, uint64_t tableId)
     : CoordinatorRpcWrapper(context,
             sizeof(WireFormat::GetTabletMap::Response))
 {
-    allocHeader<WireFormat::GetTabletMap>();
+    WireFormat::GetTabletMap::Request* reqHdr(
+            allocHeader<WireFormat::GetTabletMap>());
+    reqHdr->generation = generation;
+    reqHdr->sinceVersion = sinceVersion;
+    reqHdr->tableId = tableId;
     send();
 }
 
@@ -252,10 +297,42 @@ GetTabletMapRpc::wait(ProtoBuf::Tablets* tabletMap)
             getResponseHeader<WireFormat::GetTabletMap>());
     if (respHdr->common.status != STATUS_OK)
         ClientException::throwException(HERE, respHdr->common.status);
-    ProtoBuf::parseFromResponse(response, sizeof(*respHdr),
+    uint32_t offset = sizeof(*respHdr) +
+            respHdr->numChangedTables * downCast<uint32_t>(sizeof(uint64_t));
+    ProtoBuf::parseFromResponse(response, offset,
                                 respHdr->tabletMapLength, tabletMap);
 }
 
+/**
+ * Wait for a getTabletMap RPC to complete, and return the same results as
+ * #CoordinatorClient::getTabletMapUpdate.
+ *
+ * \param[out] update
+ *      Will be filled in with the changes to the tablet map.
+ */
+void
+GetTabletMapRpc::wait(CoordinatorClient::TabletMapUpdate* update)
+{
+    waitInternal(context->dispatch);
+    const WireFormat::GetTabletMap::Response* respHdr(
+            getResponseHeader<WireFormat::GetTabletMap>());
+    if (respHdr->common.status != STATUS_OK)
+        ClientException::throwException(HERE, respHdr->common.status);
+    update->generation = respHdr->generation;
+    update->version = respHdr->version;
+    update->fullMap = respHdr->fullMap;
+    update->changedTables.clear();
+    uint32_t offset = sizeof(*respHdr);
+    for (uint32_t i = 0; i < respHdr->numChangedTables; i++) {
+        update->changedTables.push_back(
+                *response->getOffset<uint64_t>(offset));
+        offset += downCast<uint32_t>(sizeof(uint64_t));
+    }
+    update->tablets.Clear();
+    ProtoBuf::parseFromResponse(response, offset,
+                                respHdr->tabletMapLength, &update->tablets);
+}
+
 /**
  * This method is invoked to notify the coordinator of problems communicating
  * with a particular server, suggesting that the server may have crashed.  The
@@ -37,6 +37,40 @@ namespace RAMCloud {
  */
 class CoordinatorClient {
   public:
+    /**
+     * The changes to the tablet map returned by getTabletMapUpdate().
+     */
+    struct TabletMapUpdate {
+        TabletMapUpdate()
+            : generation(0)
+            , version(0)
+            , fullMap(false)
+            , changedTables()
+            , tablets()
+        {}
+
+        /// Generation of the coordinator's tablet map; pass it back in the
+        /// next request so the coordinator can tell if the versions are
+        /// comparable.
+        uint64_t generation;
+
+        /// Version of the tablet map that applying this update brings the
+        /// caller's copy up to.
+        uint64_t version;
+
+        /// If true, #tablets is the entire tablet map and should replace
+        /// the caller's copy.
+        bool fullMap;
+
+        /// If #fullMap is false, the ids of the tables whose tablets have
+        /// changed; #tablets holds all the current tablets of these tables
+        /// (possibly none, if they were dropped).
+        vector<uint64_t> changedTables;
+
+        /// The tablets returned.
+        ProtoBuf::Tablets tablets;
+    };
+
     static ServerId enlistServer(Context* context, ServerId replacesId,
             ServiceMask serviceMask, string localServiceLocator,
             uint32_t readSpeed);
@@ -47,6 +81,9 @@ class CoordinatorClient {
     static void getServerList(Context* context,
             ProtoBuf::ServerList* serverList);
     static void getTabletMap(Context* context, ProtoBuf::Tablets* tabletMap);
+    static void getTabletMapUpdate(Context* context, uint64_t generation,
+            uint64_t sinceVersion, uint64_t tableId,
+            TabletMapUpdate* update);
     static void hintServerCrashed(Context* context, ServerId serverId);
     static void reassignTabletOwnership(Context* context, uint64_t tableId,
             uint64_t firstKey, uint64_t lastKey, ServerId newOwnerId,
@@ -102,9 +139,12 @@ class GetServerListRpc : public CoordinatorRpcWrapper {
  */
 class GetTabletMapRpc : public CoordinatorRpcWrapper {
     public:
-    explicit GetTabletMapRpc(Context* context);
+    explicit GetTabletMapRpc(Context* context, uint64_t generation = 0,
+            uint64_t sinceVersion = 0,
+            uint64_t tableId = WireFormat::GetTabletMap::ALL_TABLES);
     ~GetTabletMapRpc() {}
     void wait(ProtoBuf::Tablets* tabletMap);
+    void wait(CoordinatorClient::TabletMapUpdate* update);
 
     PRIVATE:
     DISALLOW_COPY_AND_ASSIGN(GetTabletMapRpc);
@@ -55,6 +55,8 @@ CoordinatorServerList::CoordinatorServerList(Context* context)
     , logIdServerListVersion(NO_ID)
     , logIdServerUpUpdate(NO_ID)
     , logIdServerReplicationUpUpdate(NO_ID)
+    , snapshotLock("CoordinatorServerList::snapshotLock")
+    , fullListSnapshot()
 {
     context->coordinatorServerList = this;
     startUpdater();
@@ -156,6 +158,43 @@ CoordinatorServerList::enlistServer(
     return newServerId;
 }
 
+/**
+ * Return whether a server is in the list and up, like isUp(), except that
+ * if some operation is in progress on the list (and perhaps waiting on
+ * LogCabin) this answers from the list as of the last update pushed to the
+ * cluster rather than waiting for the operation to finish. Used to answer
+ * read-only RPCs without queueing them behind enlistments and crashes.
+ *
+ * \param serverId
+ *      Identifier of the server to look for.
+ */
+bool
+CoordinatorServerList::isUpNonblocking(ServerId serverId)
+{
+    Lock lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        std::shared_ptr<const ProtoBuf::ServerList> snapshot;
+        {
+            std::lock_guard<SpinLock> _(snapshotLock);
+            snapshot = fullListSnapshot;
+        }
+        if (snapshot) {
+            foreach (const ProtoBuf::ServerList::Entry& entry,
+                     snapshot->server()) {
+                if (entry.server_id() == serverId.getId()) {
+                    return entry.status() ==
+                            static_cast<uint32_t>(ServerStatus::UP);
+                }
+            }
+        }
+        // The snapshot only has masters and backups; for anything else
+        // we have to wait.
+        lock.lock();
+    }
+    ServerDetails* details = iget(serverId);
+    return (details != NULL) && (details->status == ServerStatus::UP);
+}
+
 /**
  * Get the number of masters in the list; does not include servers in
  * crashed status.
@@ -266,12 +305,40 @@ CoordinatorServerList::recoveryCompleted(ServerId serverId)
  * \param services
  *      If a server has *any* service included in \a services it will be
  *      included in the serialization; otherwise, it is skipped.
+ *
+ * If some operation is in progress on the list (and perhaps waiting on
+ * LogCabin), the list is serialized as of the last update pushed to the
+ * cluster, rather than waiting for the operation to finish.
  */
 void
 CoordinatorServerList::serialize(ProtoBuf::ServerList& protoBuf,
                                  ServiceMask services) const
 {
-    Lock lock(mutex);
+    Lock lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        std::shared_ptr<const ProtoBuf::ServerList> snapshot;
+        {
+            std::lock_guard<SpinLock> _(snapshotLock);
+            snapshot = fullListSnapshot;
+        }
+        if (snapshot) {
+            foreach (const ProtoBuf::ServerList::Entry& entry,
+                     snapshot->server()) {
+                ServiceMask entryServices =
+                        ServiceMask::deserialize(entry.services());
+                if ((entryServices.has(WireFormat::MASTER_SERVICE) &&
+                     services.has(WireFormat::MASTER_SERVICE)) ||
+                    (entryServices.has(WireFormat::BACKUP_SERVICE) &&
+                     services.has(WireFormat::BACKUP_SERVICE))) {
+                    *protoBuf.add_server() = entry;
+                }
+            }
+            protoBuf.set_version_number(snapshot->version_number());
+            protoBuf.set_type(ProtoBuf::ServerList_Type_FULL_LIST);
+            return;
+        }
+        lock.lock();
+    }
     serialize(lock, protoBuf, services);
 }
 
@@ -1466,6 +1533,14 @@ CoordinatorServerList::pushUpdate(const Lock& lock, uint64_t updateVersion)
     // prepare full server list
     serialize(lock, full);
 
+    // Readers use it too, while later operations are in progress.
+    std::shared_ptr<const ProtoBuf::ServerList> snapshot(
+            new ProtoBuf::ServerList(full));
+    {
+        std::lock_guard<SpinLock> _(snapshotLock);
+        fullListSnapshot = snapshot;
+    }
+
     updates.emplace_back(update, full);
 
     // Link the previous tail with the new tail in the deque.
@@ -18,6 +18,7 @@
 
 #include <condition_variable>
 #include <deque>
+#include <memory>
 
 #include <Client/Client.h> // NOLINT
 
@@ -34,6 +35,7 @@
 #include "AbstractServerList.h"
 #include "ServiceMask.h"
 #include "ServerId.h"
+#include "SpinLock.h"
 #include "Tub.h"
 
 #include "ServerIdRpcWrapper.h"
@@ -240,6 +242,7 @@ class CoordinatorServerList : public AbstractServerList{
     uint32_t backupCount() const;
     ServerId enlistServer(ServerId replacesId, ServiceMask serviceMask,
                           const uint32_t readSpeed, const char* serviceLocator);
+    bool isUpNonblocking(ServerId serverId);
     uint32_t masterCount() const;
     Entry operator[](ServerId serverId) const;
     Entry operator[](size_t index) const;
@@ -977,6 +980,21 @@ class CoordinatorServerList : public AbstractServerList{
      * replication id update needs to be sent out to the entire cluster.
      */
     EntryId logIdServerReplicationUpUpdate;
+
+    /**
+     * Protects #fullListSnapshot.
+     */
+    mutable SpinLock snapshotLock;
+
+    /**
+     * Full list of masters and backups as of the last update pushed to the
+     * cluster (see pushUpdate()); NULL until the first one. Readers that
+     * find #mutex held by an operation in progress (which may be waiting
+     * on LogCabin) answer from this instead of waiting; see serialize()
+     * and isUpNonblocking().
+     */
+    std::shared_ptr<const ProtoBuf::ServerList> fullListSnapshot;
+
     DISALLOW_COPY_AND_ASSIGN(CoordinatorServerList);
 };
 } // namespace RAMCloud
@@ -452,6 +452,58 @@ TEST_F(CoordinatorServerListTest, serialize) {
     }
 }
 
+static void
+serializeInThread(CoordinatorServerList* sl, ProtoBuf::ServerList* serverList,
+                  ServiceMask services)
+{
+    sl->serialize(*serverList, services);
+}
+
+static void
+isUpNonblockingInThread(CoordinatorServerList* sl, ServerId serverId,
+                        bool* isUp)
+{
+    *isUp = sl->isUpNonblocking(serverId);
+}
+
+TEST_F(CoordinatorServerListTest, serialize_snapshot) {
+    ServerId master = generateUniqueId();
+    add(master, "", {WireFormat::MASTER_SERVICE}, 100);
+    ServerId backup = generateUniqueId();
+    add(backup, "", {WireFormat::BACKUP_SERVICE}, 100);
+    bool isUp = false;
+    EXPECT_TRUE(sl->isUpNonblocking(master));
+
+    // Some operation is in progress; its changes aren't visible until
+    // they are pushed to the cluster.
+    Lock lock(sl->mutex);
+    sl->crashed(lock, master);
+    {
+        ProtoBuf::ServerList serverList;
+        std::thread(serializeInThread, sl, &serverList,
+                    ServiceMask{WireFormat::MASTER_SERVICE}).join();
+        ASSERT_EQ(1, serverList.server_size());
+        EXPECT_EQ(master.getId(), serverList.server(0).server_id());
+        EXPECT_EQ(ServerStatus::UP,
+                  ServerStatus(serverList.server(0).status()));
+        EXPECT_EQ(sl->version, serverList.version_number());
+    }
+    {
+        ProtoBuf::ServerList serverList;
+        std::thread(serializeInThread, sl, &serverList,
+                    ServiceMask{WireFormat::BACKUP_SERVICE}).join();
+        ASSERT_EQ(1, serverList.server_size());
+        EXPECT_EQ(backup.getId(), serverList.server(0).server_id());
+    }
+    std::thread(isUpNonblockingInThread, sl, master, &isUp).join();
+    EXPECT_TRUE(isUp);
+
+    sl->version++;
+    sl->pushUpdate(lock, sl->version);
+    std::thread(isUpNonblockingInThread, sl, master, &isUp).join();
+    EXPECT_FALSE(isUp);
+}
+
 TEST_F(CoordinatorServerListTest, serverCrashed_backup) {
     ServerId id = sl->enlistServer({}, {WireFormat::BACKUP_SERVICE},
                                    0, "mock:host=backup");
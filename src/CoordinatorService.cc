@@ -43,6 +43,8 @@ CoordinatorService::CoordinatorService(Context* context,
     , logCabinHelper()
     , expectedEntryId(LogCabin::Client::NO_ID)
     , forceServerDownForTesting(false)
+    , mutationMutex()
+    , tabletBalancer(context, *tableManager, &runtimeOptions, mutationMutex)
 {
     if (strcmp(LogCabinLocator.c_str(), "testing") == 0) {
         LOG(NOTICE, "Connecting to mock LogCabin cluster for testing.");
@@ -72,10 +74,16 @@ CoordinatorService::CoordinatorService(Context* context,
 
     // Replay the entire log (if any) before we start servicing the RPCs.
     coordinatorRecovery.replay();
+
+    // Unit tests don't want tablets moving around behind their backs any
+    // more than they want recoveries starting.
+    if (startRecoveryManager)
+        tabletBalancer.start();
 }
 
 CoordinatorService::~CoordinatorService()
 {
+    tabletBalancer.halt();
     recoveryManager.halt();
 }
 
@@ -83,6 +91,10 @@ void
 CoordinatorService::dispatch(WireFormat::Opcode opcode,
                              Rpc* rpc)
 {
+    std::unique_lock<std::mutex> mutationLock(mutationMutex, std::defer_lock);
+    if (!isReadOnly(opcode))
+        mutationLock.lock();
+
     switch (opcode) {
         case WireFormat::CreateTable::opcode:
             callHandler<WireFormat::CreateTable, CoordinatorService,
@@ -145,6 +157,24 @@ CoordinatorService::dispatch(WireFormat::Opcode opcode,
     }
 }
 
+/**
+ * Return true if RPCs with the given opcode never modify the coordinator's
+ * state, so they can run concurrently with any other RPC.
+ */
+bool
+CoordinatorService::isReadOnly(WireFormat::Opcode opcode)
+{
+    switch (opcode) {
+        case WireFormat::GetTableId::opcode:
+        case WireFormat::GetServerList::opcode:
+        case WireFormat::GetTabletMap::opcode:
+        case WireFormat::VerifyMembership::opcode:
+            return true;
+        default:
+            return false;
+    }
+}
+
 /**
  * Top-level server method to handle the CREATE_TABLE request.
  * \copydetails Service::ping
@@ -295,10 +325,20 @@ CoordinatorService::getTabletMap(
     WireFormat::GetTabletMap::Response* respHdr,
     Rpc* rpc)
 {
-    ProtoBuf::Tablets tablets;
-    tableManager->serialize(*serverList, tablets);
-    respHdr->tabletMapLength = serializeToResponse(rpc->replyPayload,
-                                                   &tablets);
+    std::shared_ptr<const TableManager::TabletMapUpdate> update =
+        tableManager->getTabletMapUpdate(*serverList, reqHdr->generation,
+                                         reqHdr->sinceVersion,
+                                         reqHdr->tableId);
+    respHdr->generation = update->generation;
+    respHdr->version = update->version;
+    respHdr->fullMap = update->fullMap;
+    respHdr->numChangedTables = update->numChangedTables;
+    respHdr->tabletMapLength = update->tabletMapLength;
+    uint32_t length = downCast<uint32_t>(update->payload.size());
+    if (length > 0) {
+        memcpy(new(rpc->replyPayload, APPEND) char[length],
+               update->payload.data(), length);
+    }
 }
 
 /**
@@ -483,7 +523,7 @@ CoordinatorService::verifyMembership(
     Rpc* rpc)
 {
     ServerId serverId(reqHdr->serverId);
-    if (!serverList->isUp(serverId)) {
+    if (!serverList->isUpNonblocking(serverId)) {
         respHdr->common.status = STATUS_CALLER_NOT_IN_CLUSTER;
         LOG(WARNING, "Membership verification failed for %s",
             serverList->toString(serverId).c_str());
@@ -17,6 +17,7 @@
 #define RAMCLOUD_COORDINATORSERVICE_H
 
 #include <Client/Client.h>
+#include <mutex>
 
 #include "ServerList.pb.h"
 #include "Tablets.pb.h"
@@ -32,6 +33,7 @@
 #include "RuntimeOptions.h"
 #include "Service.h"
 #include "TableManager.h"
+#include "TabletBalancer.h"
 #include "TransportManager.h"
 
 namespace RAMCloud {
@@ -49,7 +51,18 @@ class CoordinatorService : public Service {
     void dispatch(WireFormat::Opcode opcode,
                   Rpc* rpc);
 
+    /**
+     * Read-only RPCs (see isReadOnly()) run concurrently with each other
+     * and with the one RPC at a time that may modify the coordinator's
+     * state.
+     */
+    virtual int maxThreads() {
+        return 4;
+    }
+
   PRIVATE:
+    static bool isReadOnly(WireFormat::Opcode opcode);
+
     // - rpc handlers -
     void createTable(const WireFormat::CreateTable::Request* reqHdr,
                      WireFormat::CreateTable::Response* respHdr,
@@ -176,6 +189,21 @@ class CoordinatorService : public Service {
      */
     bool forceServerDownForTesting;
 
+    /**
+     * Held by dispatch() while handling any RPC that isn't read-only, so
+     * that those run one at a time, as they did when the coordinator was
+     * single-threaded (among other things, they all append to LogCabin
+     * conditionally on #expectedEntryId). Read-only RPCs don't take it;
+     * they rely on the TableManager and CoordinatorServerList serving
+     * consistent snapshots while a modification is in progress.
+     */
+    std::mutex mutationMutex;
+
+    /**
+     * Moves tablets from overloaded masters to underloaded ones.
+     */
+    TabletBalancer tabletBalancer;
+
     friend class CoordinatorServiceRecovery;
     friend class CoordinatorServerList;
 
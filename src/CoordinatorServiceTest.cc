@@ -146,6 +146,36 @@ TEST_F(CoordinatorServiceTest, getTabletMap) {
               tabletMapProtoBuf.ShortDebugString());
 }
 
+TEST_F(CoordinatorServiceTest, getTabletMap_update) {
+    ramcloud->createTable("foo");
+    CoordinatorClient::TabletMapUpdate update;
+    CoordinatorClient::getTabletMapUpdate(&context, 0, 0,
+            WireFormat::GetTabletMap::ALL_TABLES, &update);
+    EXPECT_TRUE(update.fullMap);
+    EXPECT_EQ(0u, update.changedTables.size());
+    EXPECT_EQ(1, update.tablets.tablet_size());
+    EXPECT_EQ(service->context->tableManager->getVersion(), update.version);
+
+    ramcloud->createTable("bar");
+    uint64_t generation = update.generation;
+    uint64_t version = update.version;
+    CoordinatorClient::getTabletMapUpdate(&context, generation, version,
+            WireFormat::GetTabletMap::ALL_TABLES, &update);
+    EXPECT_FALSE(update.fullMap);
+    ASSERT_EQ(1u, update.changedTables.size());
+    EXPECT_EQ(2u, update.changedTables[0]);
+    ASSERT_EQ(1, update.tablets.tablet_size());
+    EXPECT_EQ(2u, update.tablets.tablet(0).table_id());
+    EXPECT_EQ("mock:host=master",
+              update.tablets.tablet(0).service_locator());
+
+    CoordinatorClient::getTabletMapUpdate(&context, 0, 0, 1, &update);
+    EXPECT_FALSE(update.fullMap);
+    ASSERT_EQ(1u, update.changedTables.size());
+    EXPECT_EQ(1u, update.changedTables[0]);
+    EXPECT_EQ(1, update.tablets.tablet_size());
+}
+
 TEST_F(CoordinatorServiceTest, setRuntimeOption) {
     ramcloud->testingSetRuntimeOption("failRecoveryMasters", "1 2 3");
     ASSERT_EQ(3u, service->runtimeOptions.failRecoveryMasters.size());
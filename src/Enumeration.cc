@@ -36,6 +36,19 @@ struct EnumerateBucketArgs {
     /// Iterator containing information about previous tablet configurations.
     EnumerationIterator* iter;
 
+    /// The bucket being enumerated. While the hash table is shrinking, the
+    /// bucket may also yield entries belonging to other buckets; those are
+    /// skipped.
+    uint64_t bucketIndex;
+
+    /// If true, only objects whose key hash is #keyHash are wanted. Used
+    /// when enumerating by KeyHashIndex, where the entries looked at may
+    /// include objects with other key hashes that share the same bucket.
+    bool exactKeyHash;
+
+    /// See #exactKeyHash.
+    uint64_t keyHash;
+
     /// A vector in which to place the resulting objects.
     std::vector<Log::Reference>* objectReferences;
 };
@@ -72,7 +85,14 @@ enumerateBucket(uint64_t reference, void* cookie)
     KeyHash keyHash = key.getHash();
     if (key.getTableId() != args.tableId ||
         keyHash < args.requestedTabletStartHash ||
-        args.iter->top().tabletEndHash < keyHash) {
+        args.iter->top().tabletEndHash < keyHash ||
+        (args.exactKeyHash && keyHash != args.keyHash)) {
+        return;
+    }
+
+    uint64_t secondaryHash = 0;
+    if (HashTable::findBucketIndex(args.iter->top().numBuckets, key,
+                                   &secondaryHash) != args.bucketIndex) {
         return;
     }
 
@@ -213,10 +233,8 @@ class ObjectHashComparator {
  * \param[in,out] iter
  *      The iterator provided by the client. The iterator object will
  *      be modified with state that should be returned to the client.
- * \param log
- *      The log containing the objects referenced in the objectMap.
- * \param objectMap
- *      The hash table of objects living on this server.
+ * \param objectManager
+ *      The ObjectManager storing the objects living on this server.
  * \param[out] payload
  *      A Buffer to hold the resulting objects.
  * \param maxPayloadBytes
@@ -228,8 +246,7 @@ Enumeration::Enumeration(uint64_t tableId,
                          uint64_t actualTabletEndHash,
                          uint64_t* nextTabletStartHash,
                          EnumerationIterator& iter,
-                         Log& log,
-                         HashTable& objectMap,
+                         ObjectManager& objectManager,
                          Buffer& payload, uint32_t maxPayloadBytes)
     : tableId(tableId)
     , requestedTabletStartHash(requestedTabletStartHash)
@@ -237,8 +254,9 @@ Enumeration::Enumeration(uint64_t tableId,
     , actualTabletEndHash(actualTabletEndHash)
     , nextTabletStartHash(nextTabletStartHash)
     , iter(iter)
-    , log(log)
-    , objectMap(objectMap)
+    , objectManager(objectManager)
+    , log(*objectManager.getLog())
+    , objectMap(*objectManager.getObjectMap())
     , payload(payload)
     , maxPayloadBytes(maxPayloadBytes)
 {
@@ -254,6 +272,11 @@ Enumeration::Enumeration(uint64_t tableId,
 void
 Enumeration::complete()
 {
+    if (objectManager.keyHashIndex) {
+        completeFromIndex();
+        return;
+    }
+
     // Check iterator state to see if the tablet configuration has
     // changed since the last call to enumerateTablet().
     if (iter.size() == 0 ||
@@ -278,12 +301,26 @@ Enumeration::complete()
     args.requestedTabletStartHash = requestedTabletStartHash;
     args.log = &log;
     args.iter = &iter;
+    args.exactKeyHash = false;
+    args.keyHash = 0;
     args.objectReferences = &objectRefs;
     void* cookie = static_cast<void*>(&args);
     for (; bucketIndex < numBuckets && !payloadFull; bucketIndex++) {
         objectRefs.clear();
         bucketStart = payload.getTotalLength();
-        objectMap.forEachInBucket(enumerateBucket, cookie, bucketIndex);
+        args.bucketIndex = bucketIndex;
+
+        // Scan the bucket under its lock, so that a concurrent resize can't
+        // move its entries while we look at them. If a resize finished since
+        // we started, stop here: the client's next request will push a new
+        // iterator frame for the new table geometry.
+        {
+            ObjectManager::HashTableBucketLock lock(objectManager,
+                                                    bucketIndex);
+            if (objectMap.getNumBuckets() != numBuckets)
+                break;
+            objectMap.forEachInBucket(enumerateBucket, cookie, bucketIndex);
+        }
         int64_t overflow = appendObjectsToBuffer(log, &payload, objectRefs,
                                                  maxPayloadBytes);
         payloadFull = overflow >= 0;
@@ -316,10 +353,105 @@ Enumeration::complete()
     // At end of iteration, bucketIndex points to next (uncovered) bucket.
     iter.top().bucketIndex = bucketIndex;
 
-    // Check end of tablet.
+    checkEndOfTablet(bucketIndex >= numBuckets, initialPayloadLength);
+}
+
+/**
+ * Implements complete() on a master that keeps a KeyHashIndex. Rather than
+ * walk every bucket of the hash table, walk the tablet's key hashes in
+ * increasing order and look each one up, so that the cost is proportional
+ * to the number of objects in the tablet.
+ *
+ * Progress is recorded in the iterator as though the hash table had a
+ * single bucket: the frame's numBuckets is 1, bucketIndex becomes 1 once
+ * the tablet is done, and until then bucketNextHash is the smallest key
+ * hash not yet returned. This means frames written this way filter objects
+ * correctly if the client moves on to a master that enumerates by bucket,
+ * and vice versa.
+ */
+void
+Enumeration::completeFromIndex()
+{
+    if (iter.size() == 0 ||
+        iter.top().tabletStartHash != actualTabletStartHash ||
+        iter.top().tabletEndHash != actualTabletEndHash ||
+        iter.top().numBuckets != 1) {
+
+        EnumerationIterator::Frame frame(
+            actualTabletStartHash, actualTabletEndHash, 1, 0, 0);
+        iter.push(frame);
+    }
+
+    uint32_t initialPayloadLength = payload.getTotalLength();
+    bool payloadFull = false;
+    std::vector<Log::Reference> objectRefs;
+    EnumerateBucketArgs args;
+    args.tableId = tableId;
+    args.requestedTabletStartHash = requestedTabletStartHash;
+    args.log = &log;
+    args.iter = &iter;
+    args.bucketIndex = 0;
+    args.exactKeyHash = true;
+    args.objectReferences = &objectRefs;
+    std::vector<uint64_t> keyHashes;
+    while (iter.top().bucketIndex == 0 && !payloadFull) {
+        keyHashes.clear();
+        objectManager.keyHashIndex->lookup(tableId,
+                std::max(requestedTabletStartHash, iter.top().bucketNextHash),
+                actualTabletEndHash, 100, &keyHashes);
+        if (keyHashes.empty()) {
+            iter.top().bucketIndex = 1;
+            break;
+        }
+
+        foreach (uint64_t keyHash, keyHashes) {
+            objectRefs.clear();
+            uint32_t keyHashStart = payload.getTotalLength();
+            args.keyHash = keyHash;
+            {
+                ObjectManager::HashTableBucketLock lock(objectManager,
+                        objectManager.getBucketIndex(keyHash));
+                HashTable::Candidates candidates = objectMap.lookup(keyHash);
+                for (; !candidates.isDone(); candidates.next())
+                    enumerateBucket(candidates.getReference(), &args);
+            }
+
+            // Objects with the same key hash are returned together, since
+            // the iterator can't record progress part way through a hash.
+            if (appendObjectsToBuffer(log, &payload, objectRefs,
+                                      maxPayloadBytes) >= 0) {
+                payload.truncateEnd(payload.getTotalLength() - keyHashStart);
+                iter.top().bucketNextHash = keyHash;
+                payloadFull = true;
+                break;
+            }
+            if (keyHash == actualTabletEndHash) {
+                iter.top().bucketIndex = 1;
+                break;
+            }
+            iter.top().bucketNextHash = keyHash + 1;
+        }
+    }
+
+    checkEndOfTablet(iter.top().bucketIndex != 0, initialPayloadLength);
+}
+
+/**
+ * Set #nextTabletStartHash, and if the tablet has been completely
+ * enumerated, pop its frames off the iterator.
+ *
+ * \param tabletScanned
+ *      True if every object in the tablet has been considered.
+ * \param initialPayloadLength
+ *      Length of #payload before this Enumeration added to it. The tablet
+ *      is done only once a request returns nothing more from it.
+ */
+void
+Enumeration::checkEndOfTablet(bool tabletScanned,
+                              uint32_t initialPayloadLength)
+{
     *nextTabletStartHash = requestedTabletStartHash;
-    if (bucketIndex >= numBuckets &&
-            payload.getTotalLength() == initialPayloadLength) {
+    if (tabletScanned && payload.getTotalLength() == initialPayloadLength) {
         while (iter.size() > 0 &&
                iter.top().tabletEndHash <= actualTabletEndHash) {
             iter.pop();
@@ -20,6 +20,7 @@
 #include "EnumerationIterator.h"
 #include "HashTable.h"
 #include "Log.h"
+#include "ObjectManager.h"
 
 namespace RAMCloud {
 
@@ -29,10 +30,11 @@ namespace RAMCloud {
  * instantiated from MasterService::enumeration().
  *
  * Each Enumeration iterates through the master's hash table in bucket
- * order, collecting objects from the requested tablet into a buffer,
- * until the buffer fills up. The Enumeration also updates the
- * provided EnumerationIterator with the state necessary to resume on
- * the next EnumerationRPC.
+ * order (or, on a master with a KeyHashIndex, in key hash order),
+ * collecting objects from the requested tablet into a buffer, until the
+ * buffer fills up. The Enumeration also updates the provided
+ * EnumerationIterator with the state necessary to resume on the next
+ * EnumerationRPC.
  */
 class Enumeration {
   public:
@@ -42,12 +44,14 @@ class Enumeration {
                 uint64_t actualTabletEndHash,
                 uint64_t* nextTabletStartHash,
                 EnumerationIterator& iter,
-                Log& log,
-                HashTable& objectMap,
+                ObjectManager& objectManager,
                 Buffer& payload, uint32_t maxPayloadBytes);
     void complete();
 
   PRIVATE:
+    void completeFromIndex();
+    void checkEndOfTablet(bool tabletScanned, uint32_t initialPayloadLength);
+
     /// The table containing the tablet being enumerated.
     uint64_t tableId;
 
@@ -66,6 +70,10 @@ class Enumeration {
     /// The iterator provided by the client.
     EnumerationIterator& iter;
 
+    /// The ObjectManager storing the objects. Its bucket locks keep the hash
+    /// table from being resized under us while we scan a bucket.
+    ObjectManager& objectManager;
+
     /// The log we're enumerating over. Needed to look up hash table references.
     Log& log;
 
@@ -16,6 +16,12 @@
 #ifndef RAMCLOUD_HASHTABLE_H
 #define RAMCLOUD_HASHTABLE_H
 
+#if __GNUC__ >= 4 && __GNUC_MINOR__ >= 5
+#include <atomic>
+#else
+#include <cstdatomic>
+#endif
+
 #include "Common.h"
 #include "BitOps.h"
 #include "CycleCounter.h"
@@ -23,6 +29,7 @@
 #include "Memory.h"
 #include "MurmurHash3.h"
 #include "Key.h"
+#include "Tub.h"
 
 namespace RAMCloud {
 
@@ -52,6 +59,29 @@ namespace RAMCloud {
  * buckets). In this case, the last hash table entry in each of the
  * non-terminal cache lines has a pointer to the next cache line instead of a
  * log reference.
+ *
+ * \section resize Resizing
+ *
+ * The number of buckets can be changed while the table is in use. A resize
+ * allocates a second bucket array (prepareResize()), makes it visible to
+ * lookups and inserts (startResize()), moves entries over a few buckets at a
+ * time (migrateUnit()), and finally frees the old array (finishResize()).
+ * Entries are moved in "migration units": unit u consists of every bucket in
+ * either array whose index is congruent to u modulo the smaller of the two
+ * array sizes, so all of a key's possible locations belong to the same unit.
+ * Lookups and inserts consult #migratedUnits to decide which array holds a
+ * key's bucket. Callers that serialize access to buckets with striped locks
+ * keyed by the low bits of the bucket index (as ObjectManager does) therefore
+ * only need to hold the lock for a unit's index while migrating it, as long
+ * as both arrays have at least as many buckets as there are locks.
+ *
+ * Until finishResize() is called, getNumBuckets() and the bucket indexes
+ * accepted by forEachInBucket() refer to the old array. When the table is
+ * growing, bucket-at-a-time scans see each entry exactly once regardless of
+ * migration progress. When it is shrinking, the old buckets of a migrated
+ * unit have been merged, so forEachInBucket() on any of them visits the
+ * entries of all of them; scans that need exactly the old bucket's entries
+ * must filter by key hash.
  */
 class HashTable {
   PRIVATE:
@@ -435,6 +465,12 @@ class HashTable {
     explicit HashTable(uint64_t numBuckets)
         : numBuckets(BitOps::powerOfTwoLessOrEqual(numBuckets))
         , buckets(this->numBuckets * sizeof(CacheLine))
+        , resizing(false)
+        , newNumBuckets(0)
+        , newBuckets()
+        , numMigrationUnits(0)
+        , migratedUnits(0)
+        , resizeCount(0)
     {
         if (numBuckets != this->numBuckets) {
             RAMCLOUD_LOG(DEBUG,
@@ -469,12 +505,30 @@ class HashTable {
      */
     Candidates
     lookup(Key& key)
+    {
+        return lookup(key.getHash());
+    }
+
+    /**
+     * Find possible references to elements in the hash table whose keys
+     * have a given hash. This is like lookup(Key&), but is useful when only
+     * the hash is known (see KeyHashIndex). The caller must check which
+     * candidates actually have the hash.
+     *
+     * \param[in] keyHash
+     *      Hash of the key, as returned by Key::getHash().
+     * \return
+     *      A HashTable::Candidates object is returned that can be used to
+     *      iterate over all potential matches.
+     */
+    Candidates
+    lookup(uint64_t keyHash)
     {
         // Find the bucket using 64 bit hash of the key. Any collisions
         // arising out of this hashing will be detected / resolved by the
         // caller as it examines possible candidates.
         uint64_t secondaryHash;
-        CacheLine *bucket = findBucket(key, &secondaryHash);
+        CacheLine *bucket = findBucket(keyHash, &secondaryHash);
         return Candidates(bucket, secondaryHash);
     }
 
@@ -495,29 +549,7 @@ class HashTable {
     {
         uint64_t secondaryHash;
         CacheLine* bucket = findBucket(key, &secondaryHash);
-        while (true) {
-            Entry* entry = bucket->entries;
-            for (size_t i = 0; i < ENTRIES_PER_CACHE_LINE; i++) {
-                if (entry->isAvailable()) {
-                    entry->setReference(secondaryHash, reference);
-                    return;
-                }
-                entry++;
-            }
-
-            Entry* last = &bucket->entries[ENTRIES_PER_CACHE_LINE - 1];
-            bucket = last->getChainPointer();
-            if (bucket == NULL) {
-                // no empty space found, allocate a new cache line
-                void *buf = Memory::xmemalign(HERE, sizeof(CacheLine),
-                                              sizeof(CacheLine));
-                bucket = static_cast<CacheLine *>(buf);
-                bucket->entries[0] = *last;
-                for (size_t i = 1; i < ENTRIES_PER_CACHE_LINE; i++)
-                    bucket->entries[i].clear();
-                last->setChainPointer(bucket);
-            }
-        }
+        insertIntoBucket(bucket, secondaryHash, reference);
     }
 
     /**
@@ -529,6 +561,8 @@ class HashTable {
      *      An opaque parameter to pass to the callback function.
      * \param bucket
      *      An index into the HashTable's buckets.  Must be < #numBuckets.
+     *      While the table is shrinking, elements of other buckets may be
+     *      visited too (see the resize section of the class documentation).
      * \return
      *      The total number of callbacks fired (i.e. the number of elements
      *      in the HashTable).
@@ -538,22 +572,21 @@ class HashTable {
                     void *cookie,
                     uint64_t bucket)
     {
-        uint64_t numCalls = 0;
-        CacheLine *cl = &buckets.get()[bucket];
-        while (1) {
-            for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++) {
-                Entry *e = &cl->entries[j];
-                if (!e->isAvailable() && e->getChainPointer() == NULL) {
-                    callback(e->getReference(), cookie);
-                    numCalls++;
-                }
-            }
-
-            Entry *entry = &cl->entries[ENTRIES_PER_CACHE_LINE - 1];
-            cl = entry->getChainPointer();
-            if (cl == NULL)
-                break;
+        if (expect_true(!resizing) ||
+          (bucket & (numMigrationUnits - 1)) >= migratedUnits) {
+            return forEachInChain(callback, cookie, &buckets.get()[bucket]);
         }
+
+        // The bucket's migration unit has already been moved to the new
+        // array. If the table is growing, the unit is just this bucket and
+        // its entries are now spread over several new buckets. If it is
+        // shrinking, they have been merged into a single new bucket along
+        // with those of the unit's other old buckets. Either way, visit the
+        // whole unit.
+        uint64_t unit = bucket & (numMigrationUnits - 1);
+        uint64_t numCalls = 0;
+        for (uint64_t i = unit; i < newNumBuckets; i += numMigrationUnits)
+            numCalls += forEachInChain(callback, cookie, &newBuckets->get()[i]);
         return numCalls;
     }
 
@@ -573,12 +606,245 @@ class HashTable {
     {
         uint64_t numCalls = 0;
 
-        for (uint64_t i = 0; i < numBuckets; i++)
-            numCalls += forEachInBucket(callback, cookie, i);
+        // Visit each bucket of each array directly, rather than going
+        // through forEachInBucket(), so that elements are seen exactly once
+        // even while the table is shrinking.
+        for (uint64_t i = 0; i < numBuckets; i++) {
+            if (expect_false(resizing) &&
+              (i & (numMigrationUnits - 1)) < migratedUnits) {
+                continue;
+            }
+            numCalls += forEachInChain(callback, cookie, &buckets.get()[i]);
+        }
+        for (uint64_t i = 0; resizing && i < newNumBuckets; i++) {
+            if ((i & (numMigrationUnits - 1)) < migratedUnits) {
+                numCalls += forEachInChain(callback, cookie,
+                                           &newBuckets->get()[i]);
+            }
+        }
 
         return numCalls;
     }
 
+    /**
+     * Count the entries and cache lines in one bucket's chain. Used to
+     * estimate the table's load factor and chain lengths. Must not be
+     * called while a resize is in progress.
+     *
+     * \param bucket
+     *      An index into the HashTable's buckets. Must be < #numBuckets.
+     * \param[out] numEntries
+     *      The number of references stored in the bucket.
+     * \param[out] numCacheLines
+     *      The number of cache lines in the bucket's chain (at least 1).
+     */
+    void
+    getBucketOccupancy(uint64_t bucket,
+                       uint32_t* numEntries,
+                       uint32_t* numCacheLines)
+    {
+        assert(!resizing);
+        *numEntries = 0;
+        *numCacheLines = 0;
+        CacheLine *cl = &buckets.get()[bucket];
+        while (cl != NULL) {
+            (*numCacheLines)++;
+            for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++) {
+                Entry *e = &cl->entries[j];
+                if (!e->isAvailable() && e->getChainPointer() == NULL)
+                    (*numEntries)++;
+            }
+            cl = cl->entries[ENTRIES_PER_CACHE_LINE - 1].getChainPointer();
+        }
+    }
+
+    /**
+     * The first step of resizing the table: allocate (and zero) a bucket
+     * array of the new size. The table is not otherwise affected, so this
+     * may run concurrently with other operations on the table; it is split
+     * from startResize() so that callers can do the (potentially slow)
+     * allocation without excluding other users of the table.
+     *
+     * \param newSize
+     *      The desired number of buckets. Rounded down to a power of two.
+     * \throw Exception
+     *      An exception is thrown if the new size is 0 or if a resize
+     *      is already in progress.
+     */
+    void
+    prepareResize(uint64_t newSize)
+    {
+        newSize = BitOps::powerOfTwoLessOrEqual(newSize);
+        if (newSize == 0)
+            throw Exception(HERE, "HashTable resize to 0 buckets?!");
+        if (resizing || newBuckets)
+            throw Exception(HERE, "HashTable resize already in progress");
+        newBuckets.construct(newSize * sizeof(CacheLine));
+        newNumBuckets = newSize;
+    }
+
+    /**
+     * Begin directing lookups and inserts to the bucket array allocated by
+     * prepareResize(). Buckets are migrated afterwards with migrateUnit().
+     * The caller must ensure that no other thread is accessing the table.
+     */
+    void
+    startResize()
+    {
+        assert(!resizing && newBuckets);
+        numMigrationUnits = std::min(numBuckets, newNumBuckets);
+        migratedUnits = 0;
+        resizing = true;
+        RAMCLOUD_LOG(NOTICE, "Resizing HashTable from %lu to %lu buckets",
+                     numBuckets, newNumBuckets);
+    }
+
+    /**
+     * Move the entries of the next migration unit (see #getMigratedUnits())
+     * from the old bucket array to the new one. The caller must ensure that
+     * no other thread is accessing any bucket of the unit in either array.
+     *
+     * \param getKeyHash
+     *      Returns the key hash (see Key::getHash()) of the element
+     *      identified by the reference passed in. The table only stores
+     *      part of each key's hash, so it needs this to place entries in
+     *      the new array.
+     * \param cookie
+     *      An opaque parameter to pass to \a getKeyHash.
+     */
+    void
+    migrateUnit(uint64_t (*getKeyHash)(uint64_t, void *), void *cookie)
+    {
+        assert(resizing);
+        uint64_t unit = migratedUnits;
+        assert(unit < numMigrationUnits);
+        for (uint64_t i = unit; i < numBuckets; i += numMigrationUnits) {
+            CacheLine* first = &buckets.get()[i];
+            CacheLine* cl = first;
+            while (cl != NULL) {
+                Entry* last = &cl->entries[ENTRIES_PER_CACHE_LINE - 1];
+                CacheLine* next = last->getChainPointer();
+                for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++) {
+                    Entry* e = &cl->entries[j];
+                    if (e->isAvailable() || e->getChainPointer() != NULL)
+                        continue;
+                    uint64_t reference = e->getReference();
+                    uint64_t secondaryHash;
+                    uint64_t index = findBucketIndex(newNumBuckets,
+                                                     getKeyHash(reference,
+                                                                cookie),
+                                                     &secondaryHash);
+                    insertIntoBucket(&newBuckets->get()[index],
+                                     secondaryHash, reference);
+                }
+                if (cl != first)
+                    free(cl);
+                cl = next;
+            }
+            for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++)
+                first->entries[j].clear();
+        }
+        migratedUnits = unit + 1;
+    }
+
+    /**
+     * Complete a resize once every unit has been migrated: the new bucket
+     * array replaces the old one, which is freed. The caller must ensure
+     * that no other thread is accessing the table.
+     */
+    void
+    finishResize()
+    {
+        assert(resizing && migratedUnits == numMigrationUnits);
+        buckets.swap(*newBuckets);
+        numBuckets = newNumBuckets;
+        newBuckets.destroy();
+        resizing = false;
+        newNumBuckets = 0;
+        numMigrationUnits = 0;
+        migratedUnits = 0;
+        resizeCount++;
+        RAMCLOUD_LOG(NOTICE, "HashTable resize to %lu buckets complete",
+                     numBuckets);
+    }
+
+    /**
+     * Return whether a resize has been started and not yet finished.
+     */
+    bool
+    isResizing() const
+    {
+        return resizing;
+    }
+
+    /**
+     * Return the number of migration units that must be moved to complete
+     * the resize in progress (0 if the table is not being resized).
+     */
+    uint64_t
+    getMigrationUnits() const
+    {
+        return numMigrationUnits;
+    }
+
+    /**
+     * Return the number of migration units moved so far by the resize in
+     * progress. This is also the index of the next unit migrateUnit() will
+     * move.
+     */
+    uint64_t
+    getMigratedUnits() const
+    {
+        return migratedUnits;
+    }
+
+    /**
+     * Return the number of buckets the table is being resized to, or 0 if
+     * it is not being resized.
+     */
+    uint64_t
+    getNewNumBuckets() const
+    {
+        return newNumBuckets;
+    }
+
+    /**
+     * Return the number of resizes that have completed. Bucket-at-a-time
+     * scans can compare this before and after a pass to find out whether
+     * the bucket indexes changed meaning part way through.
+     */
+    uint64_t
+    getResizeCount() const
+    {
+        return resizeCount;
+    }
+
+    /**
+     * Look up several keys at once. This is equivalent to calling
+     * lookup(Key&) on each key, except that the buckets for all of the keys
+     * are prefetched before any of them is examined, so the cache misses
+     * overlap rather than being taken one after another. The caller can
+     * then prefetch whatever the candidates refer to before comparing keys.
+     * As with lookup(Key&), the caller must keep the buckets from being
+     * modified or resized for as long as it uses the candidates.
+     *
+     * \param keys
+     *      Keys to look up.
+     * \param numKeys
+     *      Number of entries in \a keys.
+     * \param[out] candidates
+     *      Array of at least \a numKeys elements; candidates[i] is set to
+     *      the result of lookup(*keys[i]).
+     */
+    void
+    lookup(Key* keys[], uint32_t numKeys, Candidates candidates[])
+    {
+        for (uint32_t i = 0; i < numKeys; i++)
+            prefetchBucket(*keys[i]);
+        for (uint32_t i = 0; i < numKeys; i++)
+            candidates[i] = lookup(*keys[i]);
+    }
+
     /**
      * Prefetch the cacheline associated with the given key.
      */
@@ -634,7 +900,24 @@ class HashTable {
     static uint64_t
     findBucketIndex(uint64_t numBuckets, Key& key, uint64_t *secondaryHash)
     {
-        uint64_t hashValue = key.getHash();
+        return findBucketIndex(numBuckets, key.getHash(), secondaryHash);
+    }
+
+    /**
+     * Find the bucket index corresponding to a particular key hash.
+     * \param[in] numBuckets
+     *      The number of buckets in the HashTable.
+     * \param[in] hashValue
+     *      The key's hash, as returned by Key::getHash().
+     * \param[out] secondaryHash
+     *      The secondary hash bits (16 bits).
+     * \return
+     *      The bucket index corresponding to the given hash.
+     */
+    static uint64_t
+    findBucketIndex(uint64_t numBuckets, uint64_t hashValue,
+                    uint64_t *secondaryHash)
+    {
         uint64_t bucketHash = hashValue & 0x0000ffffffffffffUL;
         *secondaryHash = hashValue >> 48;
         return (bucketHash & (numBuckets - 1));
@@ -663,16 +946,99 @@ class HashTable {
      */
     CacheLine *
     findBucket(Key& key, uint64_t *secondaryHash) //const
+    {
+        return findBucket(key.getHash(), secondaryHash);
+    }
+
+    /**
+     * Find the bucket corresponding to a particular key hash.
+     * \copydetails findBucket(Key&, uint64_t*)
+     */
+    CacheLine *
+    findBucket(uint64_t keyHash, uint64_t *secondaryHash) //const
     {
         uint64_t bucketIndex =
-                findBucketIndex(numBuckets, key, secondaryHash);
+                findBucketIndex(numBuckets, keyHash, secondaryHash);
+        if (expect_false(resizing) &&
+          (bucketIndex & (numMigrationUnits - 1)) < migratedUnits) {
+            bucketIndex = findBucketIndex(newNumBuckets, keyHash,
+                                          secondaryHash);
+            return &newBuckets->get()[bucketIndex];
+        }
         return &buckets.get()[bucketIndex];
     }
 
     /**
-     * The number of buckets allocated to the table.
+     * Add a reference to the first free entry in a bucket, chaining a new
+     * cache line onto the bucket if it is full.
+     * \param[in] bucket
+     *      The first cache line of the bucket.
+     * \param[in] secondaryHash
+     *      The secondary hash bits computed from the reference's key.
+     * \param[in] reference
+     *      Reference to the new element to insert into the hash table.
      */
-    const uint64_t numBuckets;
+    void
+    insertIntoBucket(CacheLine* bucket, uint64_t secondaryHash,
+                     uint64_t reference)
+    {
+        while (true) {
+            Entry* entry = bucket->entries;
+            for (size_t i = 0; i < ENTRIES_PER_CACHE_LINE; i++) {
+                if (entry->isAvailable()) {
+                    entry->setReference(secondaryHash, reference);
+                    return;
+                }
+                entry++;
+            }
+
+            Entry* last = &bucket->entries[ENTRIES_PER_CACHE_LINE - 1];
+            bucket = last->getChainPointer();
+            if (bucket == NULL) {
+                // no empty space found, allocate a new cache line
+                void *buf = Memory::xmemalign(HERE, sizeof(CacheLine),
+                                              sizeof(CacheLine));
+                bucket = static_cast<CacheLine *>(buf);
+                bucket->entries[0] = *last;
+                for (size_t i = 1; i < ENTRIES_PER_CACHE_LINE; i++)
+                    bucket->entries[i].clear();
+                last->setChainPointer(bucket);
+            }
+        }
+    }
+
+    /**
+     * Apply the given callback function to each element stored in a chain
+     * of cache lines. Helper for forEachInBucket().
+     */
+    uint64_t
+    forEachInChain(void (*callback)(uint64_t, void *),
+                   void *cookie,
+                   CacheLine *cl)
+    {
+        uint64_t numCalls = 0;
+        while (1) {
+            for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++) {
+                Entry *e = &cl->entries[j];
+                if (!e->isAvailable() && e->getChainPointer() == NULL) {
+                    callback(e->getReference(), cookie);
+                    numCalls++;
+                }
+            }
+
+            Entry *entry = &cl->entries[ENTRIES_PER_CACHE_LINE - 1];
+            cl = entry->getChainPointer();
+            if (cl == NULL)
+                break;
+        }
+        return numCalls;
+    }
+
+    /**
+     * The number of buckets allocated to the table. While a resize is in
+     * progress this is the size of the old array.
+     */
+    uint64_t numBuckets;
 
     /**
      * The array of buckets.
@@ -680,7 +1046,47 @@ class HashTable {
      */
     LargeBlockOfMemory<CacheLine> buckets;
 
-    friend void hashTableBenchmark(uint64_t nkeys, uint64_t nlines);
+    /**
+     * True between startResize() and finishResize(); lookups and inserts
+     * must then check whether their bucket has been migrated to
+     * #newBuckets.
+     */
+    bool resizing;
+
+    /**
+     * The number of buckets in #newBuckets; 0 if no resize is pending.
+     */
+    uint64_t newNumBuckets;
+
+    /**
+     * The bucket array being migrated to during a resize. Allocated by
+     * prepareResize() and swapped into #buckets by finishResize().
+     */
+    Tub<LargeBlockOfMemory<CacheLine>> newBuckets;
+
+    /**
+     * The number of migration units in the resize in progress: the smaller
+     * of #numBuckets and #newNumBuckets. See the resize section of the
+     * HashTable documentation.
+     */
+    uint64_t numMigrationUnits;
+
+    /**
+     * Migration units below this index live in #newBuckets; the rest are
+     * still in #buckets. Only changed by migrateUnit() while the caller
+     * excludes access to the unit being moved, so a thread that holds a
+     * unit's lock always sees a consistent answer for that unit.
+     */
+    std::atomic<uint64_t> migratedUnits;
+
+    /**
+     * The number of resizes completed by finishResize(). Read without
+     * synchronization by scans that need to detect a resize.
+     */
+    std::atomic<uint64_t> resizeCount;
+
+    friend void hashTableBenchmark(uint64_t nkeys, uint64_t nlines,
+                                   uint32_t batchSize);
     DISALLOW_COPY_AND_ASSIGN(HashTable);
 };
 
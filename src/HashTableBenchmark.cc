@@ -47,8 +47,68 @@ class TestObject {
 
 } // anonymous namespace
 
+/**
+ * Look up every key the way ObjectManager::prefetchObjects does for
+ * multi-ops: in groups of \a batchSize, first fetching all of the groups'
+ * buckets, then prefetching the objects they refer to, and only then
+ * comparing keys.
+ *
+ * \return
+ *      Total cycles spent doing the lookups.
+ */
+uint64_t
+batchedLookups(HashTable& ht, uint64_t nkeys, uint32_t batchSize)
+{
+    Tub<Key>* keys = new Tub<Key>[batchSize];
+    Key** keyPointers = new Key*[batchSize];
+    uint64_t* keyValues = new uint64_t[batchSize];
+    HashTable::Candidates* candidates = new HashTable::Candidates[batchSize];
+
+    uint64_t start = Cycles::rdtsc();
+    for (uint64_t i = 0; i < nkeys; i += batchSize) {
+        uint32_t n = downCast<uint32_t>(std::min(uint64_t(batchSize),
+                                                 nkeys - i));
+        for (uint32_t j = 0; j < n; j++) {
+            keyValues[j] = i + j;
+            keyPointers[j] = keys[j].construct(0, &keyValues[j],
+                    static_cast<uint16_t>(sizeof(keyValues[j])));
+        }
+        ht.lookup(keyPointers, n, candidates);
+        for (uint32_t j = 0; j < n; j++) {
+            if (!candidates[j].isDone()) {
+                prefetch(reinterpret_cast<TestObject*>(
+                        candidates[j].getReference()));
+            }
+        }
+        for (uint32_t j = 0; j < n; j++) {
+            bool success = false;
+            HashTable::Candidates& c = candidates[j];
+            while (!c.isDone()) {
+                TestObject* candidateObject =
+                    reinterpret_cast<TestObject*>(c.getReference());
+                Key candidateKey(0,
+                                 &candidateObject->key,
+                                 sizeof(candidateObject->key));
+                if (candidateKey == *keyPointers[j]) {
+                    success = true;
+                    break;
+                }
+                c.next();
+            }
+            assert(success);
+        }
+    }
+    uint64_t cycles = Cycles::rdtsc() - start;
+
+    delete[] candidates;
+    delete[] keyValues;
+    delete[] keyPointers;
+    delete[] keys;
+    return cycles;
+}
+
 void
-hashTableBenchmark(uint64_t nkeys, uint64_t nlines)
+hashTableBenchmark(uint64_t nkeys, uint64_t nlines, uint32_t batchSize)
 {
     uint64_t i;
     HashTable ht(nlines);
@@ -142,6 +202,18 @@ hashTableBenchmark(uint64_t nkeys, uint64_t nlines)
     printf("    external avg: %lu ticks, %lu nsec\n", i / nkeys,
         Cycles::toNanoseconds(i / nkeys));
 
+    if (batchSize > 0) {
+        printf("running batched lookup measurements...");
+        fflush(stdout);
+        i = batchedLookups(ht, nkeys, batchSize);
+        printf("done!\n");
+
+        printf("== batched lookup() (%u keys per batch) ==\n", batchSize);
+
+        printf("    external avg: %lu ticks, %lu nsec\n", i / nkeys,
+            Cycles::toNanoseconds(i / nkeys));
+    }
+
     uint64_t *histogram = static_cast<uint64_t *>(
         Memory::xmalloc(HERE, nlines * sizeof(histogram[0])));
     memset(histogram, 0, sizeof(nlines * sizeof(histogram[0])));
@@ -185,6 +257,7 @@ main(int argc, char **argv)
     Context context(true);
 
     uint64_t hashTableMegs, numberOfKeys;
+    uint32_t batchSize;
     double loadFactor;
 
     OptionsDescription benchmarkOptions("HashTableBenchmark");
@@ -200,7 +273,12 @@ main(int argc, char **argv)
         ("NumberOfKeys,n",
          ProgramOptions::value<uint64_t>(&numberOfKeys)->
             default_value(0),
-         "Number of keys to insert into the HashTable (overrides LoadFactor)");
+         "Number of keys to insert into the HashTable (overrides LoadFactor)")
+        ("BatchSize,b",
+         ProgramOptions::value<uint32_t>(&batchSize)->
+            default_value(16),
+         "Also measure lookups done this many keys at a time with "
+         "prefetching, as multi-ops do (0 means skip this)");
 
     OptionParser optionParser(benchmarkOptions, argc, argv);
 
@@ -216,6 +294,6 @@ main(int argc, char **argv)
                           static_cast<double>(totalEntries));
     }
 
-    hashTableBenchmark(numberOfKeys, numberOfCachelines);
+    hashTableBenchmark(numberOfKeys, numberOfCachelines, batchSize);
     return 0;
 }
@@ -659,6 +659,36 @@ TEST_F(HashTableTest, lookup) {
     delete v;
 }
 
+TEST_F(HashTableTest, lookup_batch) {
+    HashTable ht(1);
+    TestObject *v = new TestObject(0, "0");
+    TestObject *w = new TestObject(0, "1");
+    Key vKey(v->tableId, v->stringKeyPtr, v->stringKeyLength);
+    Key wKey(w->tableId, w->stringKeyPtr, w->stringKeyLength);
+    Key missingKey(0, "2", 1);
+    replace(&ht, vKey, v->u64Address());
+    replace(&ht, wKey, w->u64Address());
+
+    Key* keys[] = {&wKey, &missingKey, &vKey};
+    HashTable::Candidates candidates[3];
+    ht.lookup(keys, 3, candidates);
+
+    // Each result matches what a single lookup would return.
+    for (uint32_t i = 0; i < 3; i++) {
+        HashTable::Candidates expected = ht.lookup(*keys[i]);
+        while (!expected.isDone()) {
+            EXPECT_FALSE(candidates[i].isDone());
+            EXPECT_EQ(expected.getReference(), candidates[i].getReference());
+            expected.next();
+            candidates[i].next();
+        }
+        EXPECT_TRUE(candidates[i].isDone());
+    }
+
+    delete w;
+    delete v;
+}
+
 #if 0
 TEST_F(HashTableTest, remove) {
     HashTable ht(1);
@@ -808,4 +838,177 @@ TEST_F(HashTableTest, forEach) {
         EXPECT_EQ(1U, checkoff[i].count);
 }
 
+TEST_F(HashTableTest, getBucketOccupancy) {
+    HashTable ht(1);
+    uint32_t numEntries, numCacheLines;
+    ht.getBucketOccupancy(0, &numEntries, &numCacheLines);
+    EXPECT_EQ(0U, numEntries);
+    EXPECT_EQ(1U, numCacheLines);
+
+    TestObject objects[20];
+    for (uint32_t i = 0; i < arrayLength(objects); i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        ht.insert(key, objects[i].u64Address());
+    }
+
+    // 7 + 7 + 6 entries: non-terminal cache lines give up an entry to the
+    // chain pointer.
+    ht.getBucketOccupancy(0, &numEntries, &numCacheLines);
+    EXPECT_EQ(20U, numEntries);
+    EXPECT_EQ(3U, numCacheLines);
+}
+
+TEST_F(HashTableTest, prepareResize) {
+    HashTable ht(4);
+    EXPECT_THROW(ht.prepareResize(0), Exception);
+    ht.prepareResize(9);
+    EXPECT_EQ(8U, ht.getNewNumBuckets());
+    EXPECT_FALSE(ht.isResizing());
+    EXPECT_THROW(ht.prepareResize(16), Exception);
+}
+
+/**
+ * HashTable::migrateUnit() callback for tables whose references are
+ * TestObject pointers.
+ */
+static uint64_t
+test_resize_keyHash(uint64_t ref, void *cookie)
+{
+    TestObject* object = reinterpret_cast<TestObject*>(ref);
+    Key key(object->tableId, object->stringKeyPtr, object->stringKeyLength);
+    return key.getHash();
+}
+
+/**
+ * Fill a hash table with TestObjects (keys "0", "1", ...) for the resize
+ * tests.
+ */
+static void
+test_resize_fill(HashTable& ht, TestObject* objects, uint32_t numObjects)
+{
+    for (uint32_t i = 0; i < numObjects; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        ht.insert(key, objects[i].u64Address());
+    }
+}
+
+TEST_F(HashTableTest, resize_grow) {
+    HashTable ht(2);
+    uint32_t numObjects = 256;
+    TestObject* objects = new TestObject[numObjects + 1];
+    test_resize_fill(ht, objects, numObjects);
+
+    ht.prepareResize(16);
+    ht.startResize();
+    EXPECT_TRUE(ht.isResizing());
+    EXPECT_EQ(2U, ht.getMigrationUnits());
+    ht.migrateUnit(test_resize_keyHash, NULL);
+    EXPECT_EQ(1U, ht.getMigratedUnits());
+
+    // Half migrated: everything can still be found, new entries go to
+    // whichever array their bucket currently lives in, and each entry is
+    // visited once per old bucket.
+    objects[numObjects].setKey("new");
+    Key newKey(objects[numObjects].tableId,
+               objects[numObjects].stringKeyPtr,
+               objects[numObjects].stringKeyLength);
+    replace(&ht, newKey, objects[numObjects].u64Address());
+    uint64_t outRef;
+    for (uint32_t i = 0; i <= numObjects; i++) {
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        EXPECT_TRUE(lookup(&ht, key, outRef));
+        EXPECT_EQ(objects[i].u64Address(), outRef);
+    }
+    uint64_t numCalls = 0;
+    for (uint64_t i = 0; i < ht.getNumBuckets(); i++) {
+        numCalls += ht.forEachInBucket(test_forEach_callback,
+                                       reinterpret_cast<void *>(57), i);
+    }
+    EXPECT_EQ(numObjects + 1, numCalls);
+    for (uint32_t i = 0; i <= numObjects; i++)
+        EXPECT_EQ(1U, objects[i].count);
+
+    ht.migrateUnit(test_resize_keyHash, NULL);
+    ht.finishResize();
+    EXPECT_FALSE(ht.isResizing());
+    EXPECT_EQ(16U, ht.getNumBuckets());
+    EXPECT_EQ(1U, ht.getResizeCount());
+    for (uint32_t i = 0; i <= numObjects; i++) {
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        EXPECT_TRUE(lookup(&ht, key, outRef));
+        EXPECT_EQ(objects[i].u64Address(), outRef);
+    }
+    EXPECT_EQ(numObjects + 1, ht.forEach(test_forEach_callback,
+                                         reinterpret_cast<void *>(57)));
+    for (uint32_t i = 0; i <= numObjects; i++)
+        EXPECT_EQ(2U, objects[i].count);
+
+    // The table no longer has long chains.
+    uint32_t maxCacheLines = 0;
+    for (uint64_t i = 0; i < ht.getNumBuckets(); i++) {
+        uint32_t numEntries, numCacheLines;
+        ht.getBucketOccupancy(i, &numEntries, &numCacheLines);
+        maxCacheLines = std::max(maxCacheLines, numCacheLines);
+    }
+    EXPECT_GT(10U, maxCacheLines);
+    delete[] objects;
+}
+
+TEST_F(HashTableTest, resize_shrink) {
+    HashTable ht(16);
+    uint32_t numObjects = 256;
+    TestObject* objects = new TestObject[numObjects];
+    test_resize_fill(ht, objects, numObjects);
+
+    ht.prepareResize(4);
+    ht.startResize();
+    EXPECT_EQ(4U, ht.getMigrationUnits());
+    ht.migrateUnit(test_resize_keyHash, NULL);
+    ht.migrateUnit(test_resize_keyHash, NULL);
+
+    uint64_t outRef;
+    for (uint32_t i = 0; i < numObjects; i++) {
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        EXPECT_TRUE(lookup(&ht, key, outRef));
+        EXPECT_EQ(objects[i].u64Address(), outRef);
+    }
+
+    // forEach() sees everything exactly once even though buckets have been
+    // merged; forEachInBucket() on any merged bucket visits the whole
+    // migration unit.
+    EXPECT_EQ(numObjects, ht.forEach(test_forEach_callback,
+                                     reinterpret_cast<void *>(57)));
+    for (uint32_t i = 0; i < numObjects; i++)
+        EXPECT_EQ(1U, objects[i].count);
+    EXPECT_EQ(ht.forEachInBucket(test_forEach_callback,
+                                 reinterpret_cast<void *>(57), 0),
+              ht.forEachInBucket(test_forEach_callback,
+                                 reinterpret_cast<void *>(57), 4));
+
+    ht.migrateUnit(test_resize_keyHash, NULL);
+    ht.migrateUnit(test_resize_keyHash, NULL);
+    ht.finishResize();
+    EXPECT_EQ(4U, ht.getNumBuckets());
+    for (uint32_t i = 0; i < numObjects; i++) {
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        EXPECT_TRUE(lookup(&ht, key, outRef));
+        EXPECT_EQ(objects[i].u64Address(), outRef);
+    }
+    delete[] objects;
+}
+
 } // namespace RAMCloud
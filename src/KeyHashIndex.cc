@@ -0,0 +1,152 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "KeyHashIndex.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty index.
+ */
+KeyHashIndex::KeyHashIndex()
+    : shards()
+{
+}
+
+/**
+ * Record that a key has been added to the hash table.
+ *
+ * \param tableId
+ *      Table containing the key.
+ * \param keyHash
+ *      The key's hash, as returned by Key::getHash().
+ */
+void
+KeyHashIndex::insert(uint64_t tableId, uint64_t keyHash)
+{
+    Shard& shard = getShard(keyHash);
+    std::lock_guard<SpinLock> lock(shard.lock);
+    shard.hashes[std::make_pair(tableId, keyHash)]++;
+}
+
+/**
+ * Record that a key has been removed from the hash table. Each call must
+ * match an earlier call to insert.
+ *
+ * \param tableId
+ *      Table containing the key.
+ * \param keyHash
+ *      The key's hash, as returned by Key::getHash().
+ */
+void
+KeyHashIndex::remove(uint64_t tableId, uint64_t keyHash)
+{
+    Shard& shard = getShard(keyHash);
+    std::lock_guard<SpinLock> lock(shard.lock);
+    HashCountMap::iterator it =
+        shard.hashes.find(std::make_pair(tableId, keyHash));
+    assert(it != shard.hashes.end());
+    if (it == shard.hashes.end())
+        return;
+    if (--it->second == 0)
+        shard.hashes.erase(it);
+}
+
+/**
+ * Find the key hashes in a range of a table that have at least one key in
+ * the hash table.
+ *
+ * \param tableId
+ *      Table to look in.
+ * \param firstKeyHash
+ *      Smallest key hash to return.
+ * \param lastKeyHash
+ *      Largest key hash to return.
+ * \param maxKeyHashes
+ *      Return at most this many key hashes: the smallest ones in the range.
+ * \param[out] keyHashes
+ *      The key hashes found are appended here in increasing order. If fewer
+ *      than \a maxKeyHashes are appended, there are no more in the range.
+ */
+void
+KeyHashIndex::lookup(uint64_t tableId, uint64_t firstKeyHash,
+                     uint64_t lastKeyHash, uint32_t maxKeyHashes,
+                     vector<uint64_t>* keyHashes)
+{
+    size_t start = keyHashes->size();
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        Shard& shard = shards[i];
+        std::lock_guard<SpinLock> lock(shard.lock);
+        HashCountMap::iterator it =
+            shard.hashes.lower_bound(std::make_pair(tableId, firstKeyHash));
+        for (uint32_t n = 0; n < maxKeyHashes && it != shard.hashes.end() &&
+                it->first.first == tableId && it->first.second <= lastKeyHash;
+                n++, it++) {
+            keyHashes->push_back(it->first.second);
+        }
+    }
+
+    // Each shard contributed its smallest hashes; keep the smallest overall.
+    std::sort(keyHashes->begin() + start, keyHashes->end());
+    if (keyHashes->size() - start > maxKeyHashes)
+        keyHashes->resize(start + maxKeyHashes);
+}
+
+/**
+ * Find the tables that have at least one key in the hash table.
+ *
+ * \param[out] tableIds
+ *      The identifiers of the tables are appended here in increasing order,
+ *      without duplicates.
+ */
+void
+KeyHashIndex::getTableIds(vector<uint64_t>* tableIds)
+{
+    size_t start = tableIds->size();
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        Shard& shard = shards[i];
+        std::lock_guard<SpinLock> lock(shard.lock);
+        HashCountMap::iterator it = shard.hashes.begin();
+        while (it != shard.hashes.end()) {
+            uint64_t tableId = it->first.first;
+            tableIds->push_back(tableId);
+            if (tableId == ~0UL)
+                break;
+            it = shard.hashes.lower_bound(std::make_pair(tableId + 1, 0UL));
+        }
+    }
+
+    std::sort(tableIds->begin() + start, tableIds->end());
+    tableIds->erase(std::unique(tableIds->begin() + start, tableIds->end()),
+                    tableIds->end());
+}
+
+/**
+ * Return the number of distinct (tableId, keyHash) pairs in the index.
+ */
+uint64_t
+KeyHashIndex::size()
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        std::lock_guard<SpinLock> lock(shards[i].lock);
+        total += shards[i].hashes.size();
+    }
+    return total;
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,100 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_KEYHASHINDEX_H
+#define RAMCLOUD_KEYHASHINDEX_H
+
+#include <map>
+
+#include "Common.h"
+#include "SpinLock.h"
+
+namespace RAMCloud {
+
+/**
+ * A KeyHashIndex records, for each table, the key hashes of the keys that
+ * currently have an entry in a master's object hash table, in sorted order.
+ * It lets the objects of one tablet (a contiguous range of key hashes within
+ * a table) be found in time proportional to the number of objects in the
+ * tablet, rather than by scanning the whole hash table or log. This makes
+ * migrating, enumerating, and dropping a small tablet on a large master
+ * cheap.
+ *
+ * The index holds only key hashes; the objects themselves are found by
+ * looking each hash up in the hash table (see HashTable::lookup). Several
+ * keys may share a hash, so each hash has a count of the keys with it.
+ *
+ * The index is maintained by ObjectManager whenever a key is added to or
+ * removed from the hash table, while holding that key's bucket lock. Since
+ * that doesn't serialize updates to keys in different buckets, the index
+ * is divided into shards by key hash, each with its own lock.
+ *
+ * Each indexed key costs a std::map node (about 64 bytes), so the index is
+ * optional (see ServerConfig::Master::useKeyHashIndex).
+ *
+ * This class is thread-safe.
+ */
+class KeyHashIndex {
+  PUBLIC:
+    KeyHashIndex();
+    void insert(uint64_t tableId, uint64_t keyHash);
+    void remove(uint64_t tableId, uint64_t keyHash);
+    void lookup(uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+                uint32_t maxKeyHashes, vector<uint64_t>* keyHashes);
+    void getTableIds(vector<uint64_t>* tableIds);
+    uint64_t size();
+
+  PRIVATE:
+    /// Number of independently locked pieces the index is divided into.
+    /// Must be a power of two.
+    enum { NUM_SHARDS = 16 };
+
+    /// Maps a (tableId, keyHash) pair to the number of keys with it.
+    typedef std::map<std::pair<uint64_t, uint64_t>, uint32_t> HashCountMap;
+
+    /**
+     * One piece of the index, holding the key hashes whose low bits equal
+     * its index in #shards.
+     */
+    struct Shard {
+        Shard()
+            : lock("KeyHashIndex::Shard::lock")
+            , hashes()
+        {
+        }
+
+        /// Protects #hashes.
+        SpinLock lock;
+
+        /// The key hashes in this shard, in order.
+        HashCountMap hashes;
+    };
+
+    /// Return the shard in which a key hash is recorded.
+    Shard&
+    getShard(uint64_t keyHash)
+    {
+        return shards[keyHash & (NUM_SHARDS - 1)];
+    }
+
+    /// The index, divided into pieces by key hash.
+    Shard shards[NUM_SHARDS];
+
+    DISALLOW_COPY_AND_ASSIGN(KeyHashIndex);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_KEYHASHINDEX_H
@@ -0,0 +1,102 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+
+#include "KeyHashIndex.h"
+
+namespace RAMCloud {
+
+/**
+ * Unit tests for KeyHashIndex.
+ */
+class KeyHashIndexTest : public ::testing::Test {
+  public:
+    KeyHashIndex index;
+
+    KeyHashIndexTest()
+        : index()
+    {
+    }
+
+    string
+    lookup(uint64_t tableId, uint64_t first, uint64_t last, uint32_t max)
+    {
+        vector<uint64_t> keyHashes;
+        index.lookup(tableId, first, last, max, &keyHashes);
+        string result;
+        foreach (uint64_t keyHash, keyHashes) {
+            if (result.size() > 0)
+                result += " ";
+            result += format("%lu", keyHash);
+        }
+        return result;
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(KeyHashIndexTest);
+};
+
+TEST_F(KeyHashIndexTest, insertAndRemove) {
+    index.insert(1, 5);
+    index.insert(1, 5);
+    index.insert(2, 5);
+    EXPECT_EQ(2U, index.size());
+
+    index.remove(1, 5);
+    EXPECT_EQ("5", lookup(1, 0, ~0UL, 10));
+    index.remove(1, 5);
+    EXPECT_EQ("", lookup(1, 0, ~0UL, 10));
+    EXPECT_EQ("5", lookup(2, 0, ~0UL, 10));
+    EXPECT_EQ(1U, index.size());
+}
+
+TEST_F(KeyHashIndexTest, lookup) {
+    for (uint64_t keyHash = 0; keyHash < 100; keyHash++) {
+        index.insert(1, keyHash);
+        index.insert(2, keyHash);
+    }
+    index.insert(1, ~0UL);
+
+    EXPECT_EQ("10 11 12 13 14", lookup(1, 10, 14, 100));
+    EXPECT_EQ("10 11 12", lookup(1, 10, 14, 3));
+    EXPECT_EQ("98 99 18446744073709551615", lookup(1, 98, ~0UL, 100));
+    EXPECT_EQ("", lookup(3, 0, ~0UL, 100));
+
+    // Results are appended.
+    vector<uint64_t> keyHashes(1, 1234);
+    index.lookup(2, 50, 51, 10, &keyHashes);
+    EXPECT_EQ(3U, keyHashes.size());
+    EXPECT_EQ(1234U, keyHashes[0]);
+    EXPECT_EQ(50U, keyHashes[1]);
+}
+
+TEST_F(KeyHashIndexTest, getTableIds) {
+    vector<uint64_t> tableIds;
+    index.getTableIds(&tableIds);
+    EXPECT_EQ(0U, tableIds.size());
+
+    for (uint64_t keyHash = 0; keyHash < 40; keyHash++)
+        index.insert(7, keyHash);
+    index.insert(3, 1);
+    index.insert(~0UL, 2);
+    index.getTableIds(&tableIds);
+    ASSERT_EQ(3U, tableIds.size());
+    EXPECT_EQ(3U, tableIds[0]);
+    EXPECT_EQ(7U, tableIds[1]);
+    EXPECT_EQ(~0UL, tableIds[2]);
+}
+
+} // namespace RAMCloud
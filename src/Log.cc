@@ -20,6 +20,7 @@
 #include "LogCleaner.h"
 #include "ServerConfig.h"
 #include "ShortMacros.h"
+#include "ThreadId.h"
 
 namespace RAMCloud {
 
@@ -66,6 +67,8 @@ Log::Log(Context* context,
       context(context),
       cleaner(NULL),
       syncLock("Log::syncLock"),
+      streams(),
+      streamsBlocked(0),
       metrics()
 {
     cleaner = new LogCleaner(context,
@@ -73,6 +76,9 @@ Log::Log(Context* context,
                              *segmentManager,
                              *replicaManager,
                              *entryHandlers);
+
+    for (uint32_t i = 0; i < config->master.logAppendStreams; i++)
+        streams.push_back(std::unique_ptr<AppendStream>(new AppendStream()));
 }
 
 /**
@@ -83,6 +89,73 @@ Log::~Log()
     delete cleaner;
 }
 
+/**
+ * Append multiple entries to the log atomically. This behaves exactly like
+ * AbstractLog::append, except that if the log has append streams the entries
+ * are appended to the calling thread's stream rather than to the head. All of
+ * the entries end up in the same segment either way.
+ *
+ * \param appends
+ *      Array containing the entries to append. References to the entries
+ *      are also returned here.
+ * \param numAppends
+ *      Number of entries in the appends array.
+ * \return
+ *      True if the append succeeded, false if there was insufficient space
+ *      to complete the operation.
+ */
+bool
+Log::append(AppendVector* appends, uint32_t numAppends)
+{
+    Tub<Lock> lock;
+    AppendStream* stream = chooseStream(lock);
+    if (stream != NULL) {
+        if (appendToStream(stream, appends, numAppends))
+            return true;
+        lock.destroy();
+    }
+    return AbstractLog::append(appends, numAppends);
+}
+
+/**
+ * \overload
+ */
+bool
+Log::append(LogEntryType type,
+            const void* buffer,
+            uint32_t length,
+            Reference* outReference)
+{
+    Tub<Lock> lock;
+    AppendStream* stream = chooseStream(lock);
+    if (stream != NULL) {
+        AppendVector append;
+        append.type = type;
+        append.buffer.append(buffer, length);
+        if (appendToStream(stream, &append, 1)) {
+            if (outReference != NULL)
+                *outReference = append.reference;
+            return true;
+        }
+        lock.destroy();
+    }
+    return AbstractLog::append(type, buffer, length, outReference);
+}
+
+/**
+ * \overload
+ */
+bool
+Log::append(LogEntryType type,
+            Buffer& buffer,
+            Reference* outReference)
+{
+    return append(type,
+                  buffer.getRange(0, buffer.getTotalLength()),
+                  buffer.getTotalLength(),
+                  outReference);
+}
+
 /**
  * Enable the cleaner if it isn't already running.
  */
@@ -112,6 +185,23 @@ void
 Log::getMetrics(ProtoBuf::LogMetrics& m)
 {
     AbstractLog::getMetrics(m);
+
+    uint64_t appendCalls = 0;
+    uint64_t appendTicks = 0;
+    uint64_t bytesAppended = 0;
+    uint64_t metadataBytesAppended = 0;
+    foreach (std::unique_ptr<AppendStream>& stream, streams) {
+        appendCalls += stream->appendCalls;
+        appendTicks += stream->appendTicks;
+        bytesAppended += stream->bytesAppended;
+        metadataBytesAppended += stream->metadataBytesAppended;
+    }
+    m.set_total_append_calls(m.total_append_calls() + appendCalls);
+    m.set_total_append_ticks(m.total_append_ticks() + appendTicks);
+    m.set_total_bytes_appended(m.total_bytes_appended() + bytesAppended);
+    m.set_total_metadata_bytes_appended(m.total_metadata_bytes_appended() +
+                                        metadataBytesAppended);
+
     m.set_total_sync_calls(metrics.totalSyncCalls);
     m.set_total_sync_ticks(metrics.totalSyncTicks);
     cleaner->getMetrics(*m.mutable_cleaner_metrics());
@@ -139,12 +229,20 @@ Log::getMetrics(ProtoBuf::LogMetrics& m)
  * that may arrive out-of-order). The log also currently operates strictly
  * in-order, so there'd be no opportunity for small writes to skip ahead of
  * large ones anyway.
+ *
+ * If the log has append streams, their current segments are synced as well,
+ * since the caller's appends may have gone to any of them.
  */
 void
 Log::sync()
 {
     CycleCounter<uint64_t> __(&metrics.totalSyncTicks);
 
+    // Stream locks must be taken before syncLock and appendLock, so do the
+    // streams first.
+    foreach (std::unique_ptr<AppendStream>& stream, streams)
+        syncStream(stream.get());
+
     Tub<Lock> lock;
     lock.construct(appendLock);
     metrics.totalSyncCalls++;
@@ -215,9 +313,40 @@ Log::sync()
  * want to recover that data if a failure occurrs. Fortunately, its data would
  * be at strictly lower positions in the log, so it's easy to filter during
  * recovery.
+ *
+ * For this to hold with append streams, whose segments may have lower ids
+ * than the new head, every stream's segment is closed as well. Appends made
+ * after this returns go to stream segments allocated after the new head.
  */
 Log::Position
 Log::rollHeadOver()
+{
+    lockStreams();
+    foreach (std::unique_ptr<AppendStream>& stream, streams)
+        retireStream(stream.get());
+    Position position = rollHead();
+    unlockStreams();
+    return position;
+}
+
+/******************************************************************************
+ * PRIVATE METHODS
+ ******************************************************************************/
+
+/**
+ * Roll the log over to a new head, writing a new LogDigest, and sync it to
+ * backups. Unlike rollHeadOver(), this leaves the append streams alone, so
+ * it is enough for making segments added to the log durable (as when a
+ * SideLog is committed or a stream starts a new segment), but the position
+ * returned does not bound later stream appends.
+ *
+ * Must not be called with appendLock or syncLock held.
+ *
+ * \return
+ *      The position of the end of the new head.
+ */
+Log::Position
+Log::rollHead()
 {
     Lock lock(syncLock);
     Lock lock2(appendLock);
@@ -236,10 +365,6 @@ Log::rollHeadOver()
     return Position(head->id, head->getAppendedLength());
 }
 
-/******************************************************************************
- * PRIVATE METHODS
- ******************************************************************************/
-
 /**
  * Allocate a new head segment for the log. This is used by the AbstractLog
  * superclass when a new segment is needed.
@@ -262,4 +387,222 @@ Log::allocNextSegment(bool mustNotFail)
         return segmentManager->allocHeadSegment();
 }
 
+/**
+ * Pick the append stream the calling thread should append to and lock it.
+ * Threads are spread across streams by ThreadId, so a given thread always
+ * uses the same stream.
+ *
+ * \param[out] lock
+ *      Constructed to hold the lock of the stream returned, if any.
+ * \return
+ *      The stream to append to, or NULL if the log has no streams or they
+ *      are blocked by a LogIterator, in which case the caller should append
+ *      to the head.
+ */
+Log::AppendStream*
+Log::chooseStream(Tub<Lock>& lock)
+{
+    if (streams.empty())
+        return NULL;
+
+    AppendStream* stream = streams[ThreadId::get() % streams.size()].get();
+    lock.construct(stream->lock);
+    if (streamsBlocked > 0) {
+        lock.destroy();
+        return NULL;
+    }
+    return stream;
+}
+
+/**
+ * Append entries atomically to the current segment of an append stream,
+ * starting a new one if they don't fit. This is the stream counterpart of
+ * AbstractLog::append.
+ *
+ * Must be called with the stream's lock held.
+ *
+ * \param stream
+ *      Stream to append to.
+ * \param appends
+ *      Array containing the entries to append. References to the entries
+ *      are also returned here.
+ * \param numAppends
+ *      Number of entries in the appends array.
+ * \return
+ *      True if the entries were appended. False if no segment could be
+ *      allocated for them, in which case the caller should try the head.
+ */
+bool
+Log::appendToStream(AppendStream* stream,
+                    AppendVector* appends,
+                    uint32_t numAppends)
+{
+    CycleCounter<uint64_t> _(&stream->appendTicks);
+
+    uint32_t lengths[numAppends];
+    for (uint32_t i = 0; i < numAppends; i++)
+        lengths[i] = appends[i].buffer.getTotalLength();
+
+    LogSegment* segment = stream->segment;
+    if (segment == NULL || !segment->hasSpaceFor(lengths, numAppends)) {
+        if (!rollStreamOver(stream))
+            return false;
+        segment = stream->segment;
+        if (!segment->hasSpaceFor(lengths, numAppends))
+            throw FatalError(HERE, "too much data to append to one segment");
+    }
+
+    stream->appendCalls++;
+    for (uint32_t i = 0; i < numAppends; i++) {
+        uint32_t bytesUsedBefore = segment->getAppendedLength();
+        uint32_t segmentOffset;
+        if (!segment->append(appends[i].type, appends[i].buffer,
+                             &segmentOffset)) {
+            throw FatalError(HERE, "Guaranteed append managed to fail");
+        }
+        appends[i].reference = Reference(segment->slot, segmentOffset,
+                                         segmentSize);
+
+        uint32_t lengthWithMetadata =
+            segment->getAppendedLength() - bytesUsedBefore;
+        segment->liveBytes += lengthWithMetadata;
+        stream->bytesAppended += lengths[i];
+        stream->metadataBytesAppended += lengthWithMetadata - lengths[i];
+    }
+
+    return true;
+}
+
+/**
+ * Give an append stream a new segment to append to, closing its current one.
+ * The new segment is named in a durable LogDigest before this returns, so
+ * that whatever is appended to it is recovered after a crash.
+ *
+ * Must be called with the stream's lock held.
+ *
+ * \param stream
+ *      Stream that needs a new segment.
+ * \return
+ *      True if the stream has a new segment. False if out of memory, in which
+ *      case the stream is left with no segment.
+ */
+bool
+Log::rollStreamOver(AppendStream* stream)
+{
+    LogSegment* newSegment = segmentManager->allocStreamSegment();
+    retireStream(stream);
+    if (newSegment == NULL)
+        return false;
+
+    // The new segment is in the STREAM state, so the digest in the new head
+    // names it.
+    rollHead();
+    stream->segment = newSegment;
+    return true;
+}
+
+/**
+ * Close an append stream's current segment, if it has one, and wait for all
+ * of its contents to be replicated. This is needed because sync() only looks
+ * at each stream's current segment. The segment remains part of the log.
+ *
+ * Must be called with the stream's lock held.
+ *
+ * \param stream
+ *      Stream whose segment is to be closed.
+ */
+void
+Log::retireStream(AppendStream* stream)
+{
+    LogSegment* segment = stream->segment;
+    if (segment == NULL)
+        return;
+
+    segment->close();
+    segment->replicatedSegment->close();
+    segment->replicatedSegment->sync();
+    segment->syncedLength = segment->getAppendedLength();
+    segmentManager->streamSegmentClosed(segment);
+    stream->segment = NULL;
+}
+
+/**
+ * Wait for everything appended to an append stream's current segment to be
+ * replicated. Like sync(), this batches the appends of all threads that
+ * sync the same segment at about the same time.
+ *
+ * \param stream
+ *      Stream to sync. Its lock must not be held by the caller.
+ */
+void
+Log::syncStream(AppendStream* stream)
+{
+    Tub<Lock> lock;
+    lock.construct(stream->lock);
+
+    LogSegment* segment = stream->segment;
+    if (segment == NULL ||
+      segment->syncedLength == segment->getAppendedLength()) {
+        return;
+    }
+
+    Segment::Certificate certificate;
+    uint32_t appendedLength = segment->getAppendedLength(&certificate);
+
+    // ReplicatedSegment::sync() is thread-safe, so, unlike the head, streams
+    // don't need syncLock; each stream's syncs only wait on one another.
+    lock.destroy();
+    segment->replicatedSegment->sync(appendedLength, &certificate);
+
+    lock.construct(stream->lock);
+    if (stream->segment == segment && segment->syncedLength < appendedLength)
+        segment->syncedLength = appendedLength;
+}
+
+/**
+ * Take the locks of all append streams, in index order.
+ */
+void
+Log::lockStreams()
+{
+    foreach (std::unique_ptr<AppendStream>& stream, streams)
+        stream->lock.lock();
+}
+
+/**
+ * Release the locks taken by lockStreams().
+ */
+void
+Log::unlockStreams()
+{
+    foreach (std::unique_ptr<AppendStream>& stream, streams)
+        stream->lock.unlock();
+}
+
+/**
+ * Send all appends to the head until unblockStreams() is called. Used by
+ * LogIterator so that the segments of append streams don't change while
+ * they are being iterated over: once this returns, no stream appends are in
+ * progress either.
+ */
+void
+Log::blockStreams()
+{
+    lockStreams();
+    streamsBlocked++;
+    unlockStreams();
+}
+
+/**
+ * Undo one call to blockStreams().
+ */
+void
+Log::unblockStreams()
+{
+    lockStreams();
+    assert(streamsBlocked > 0);
+    streamsBlocked--;
+    unlockStreams();
+}
+
 } // namespace
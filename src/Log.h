@@ -17,6 +17,7 @@
 #define RAMCLOUD_LOG_H
 
 #include <stdint.h>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -63,10 +64,13 @@ class ServerConfig;
  * replicated. If the data must be made durable before continuing, code must
  * explicitly invoke the sync() method to flush all previous appends to backups.
  *
- * This class is thread-safe. Multiple threads may invoke append() in parallel,
- * but all appends are serialized by a single SpinLock. The sync() method will
- * batch multiple append operations to backups to improve throughput, especially
- * when individual entries are small.
+ * This class is thread-safe. Multiple threads may invoke append() in parallel.
+ * By default all appends are serialized by a single SpinLock and copied into
+ * the head segment. If ServerConfig::Master::logAppendStreams is set, appends
+ * are instead spread by thread across that many append streams, each with its
+ * own lock and open segment (see AppendStream), so that they no longer contend
+ * with one another. The sync() method will batch multiple append operations to
+ * backups to improve throughput, especially when individual entries are small.
  */
 class Log : public AbstractLog {
   public:
@@ -79,6 +83,14 @@ class Log : public AbstractLog {
         ReplicaManager* replicaManager);
     ~Log();
 
+    bool append(AppendVector* appends, uint32_t numAppends);
+    bool append(LogEntryType type,
+                const void* buffer,
+                uint32_t length,
+                Reference* outReference = NULL);
+    bool append(LogEntryType type,
+                Buffer& buffer,
+                Reference* outReference = NULL);
     void enableCleaner();
     void disableCleaner();
     void getMetrics(ProtoBuf::LogMetrics& m);
@@ -86,7 +98,56 @@ class Log : public AbstractLog {
     Log::Position rollHeadOver();
 
   PRIVATE:
+    /**
+     * An append stream is an open segment, apart from the head, that a
+     * subset of appending threads copy their entries into under the stream's
+     * own lock. Stream segments are named in every LogDigest written while
+     * they are open (see SegmentManager::allocStreamSegment), and a new one
+     * is only appended to once a digest naming it is durable, so recovery
+     * sees everything in them just as it sees everything in the head.
+     */
+    struct AppendStream {
+        AppendStream()
+            : lock("Log::AppendStream::lock")
+            , segment(NULL)
+            , appendCalls(0)
+            , appendTicks(0)
+            , bytesAppended(0)
+            , metadataBytesAppended(0)
+        {
+        }
+
+        /// Serializes appends to #segment and changes to #segment.
+        SpinLock lock;
+
+        /// Segment currently being appended to. NULL before the stream's first
+        /// append and after it is retired by Log::rollHeadOver().
+        LogSegment* segment;
+
+        /// Counterparts of the AbstractLog metrics of the same names for
+        /// appends made through this stream, kept per stream since those are
+        /// only protected by appendLock.
+        uint64_t appendCalls;
+        uint64_t appendTicks;
+        uint64_t bytesAppended;
+        uint64_t metadataBytesAppended;
+
+        DISALLOW_COPY_AND_ASSIGN(AppendStream);
+    };
+
     LogSegment* allocNextSegment(bool mustNotFail);
+    AppendStream* chooseStream(Tub<Lock>& lock);
+    bool appendToStream(AppendStream* stream,
+                        AppendVector* appends,
+                        uint32_t numAppends);
+    bool rollStreamOver(AppendStream* stream);
+    void retireStream(AppendStream* stream);
+    void syncStream(AppendStream* stream);
+    Log::Position rollHead();
+    void lockStreams();
+    void unlockStreams();
+    void blockStreams();
+    void unblockStreams();
 
     INTRUSIVE_LIST_TYPEDEF(LogSegment, listEntries) SegmentList;
 
@@ -109,6 +170,17 @@ class Log : public AbstractLog {
     /// this one must be acquired first to avoid deadlock.
     SpinLock syncLock;
 
+    /// Append streams that appends are spread across by thread; empty if all
+    /// appends go to the head. When several of these locks are needed they are
+    /// taken in index order, and always before #syncLock and appendLock.
+    vector<std::unique_ptr<AppendStream>> streams;
+
+    /// Number of LogIterators in existence. While nonzero, appends bypass the
+    /// streams and go to the head, so that stream segments don't change under
+    /// the iterators. Only changed with every stream's lock held, so it can be
+    /// read with any one of them held.
+    uint32_t streamsBlocked;
+
     /// Various event counters and performance measurements taken during log
     /// operation.
     class Metrics {
@@ -0,0 +1,163 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <thread>
+
+#include "Cycles.h"
+#include "Logger.h"
+#include "ObjectManager.h"
+#include "Seglet.h"
+#include "TabletManager.h"
+
+namespace RAMCloud {
+
+/**
+ * Measures how master write throughput scales with the number of threads
+ * writing, with and without log append streams (see Log::AppendStream).
+ * Each thread writes its own set of small objects straight into an
+ * ObjectManager and syncs after every write, as MasterService does. There
+ * are no backups, so the cost measured is that of appending to the log and
+ * updating the hash table.
+ */
+class LogAppendBenchmark {
+
+  public:
+    Context context;
+    ServerConfig config;
+    ServerList serverList;
+    TabletManager tabletManager;
+    ServerId serverId;
+    ObjectManager* objectManager;
+
+    LogAppendBenchmark(string logSize, string hashTableSize,
+        uint32_t appendStreams)
+        : context()
+        , config(ServerConfig::forTesting())
+        , serverList(&context)
+        , tabletManager()
+        , serverId(1, 1)
+        , objectManager(NULL)
+    {
+        Logger::get().setLogLevels(WARNING);
+        config.localLocator = "bogus";
+        config.coordinatorLocator = "bogus";
+        config.setLogAndHashTableSize(logSize, hashTableSize);
+        config.services = {};
+        config.master.numReplicas = 0;
+        config.master.disableLogCleaner = true;
+        config.master.logAppendStreams = appendStreams;
+        config.segmentSize = Segment::DEFAULT_SEGMENT_SIZE;
+        config.segletSize = Seglet::DEFAULT_SEGLET_SIZE;
+        objectManager = new ObjectManager(&context,
+                                          &serverId,
+                                          &config,
+                                          &tabletManager);
+        tabletManager.addTablet(0, 0, ~0UL, TabletManager::NORMAL);
+    }
+
+    ~LogAppendBenchmark()
+    {
+        delete objectManager;
+    }
+
+    /**
+     * Body of each writing thread.
+     *
+     * \param benchmark
+     *      The benchmark being run.
+     * \param threadIndex
+     *      Distinguishes the keys written by this thread from those of
+     *      the others.
+     * \param numObjects
+     *      Number of objects to write.
+     * \param dataBytes
+     *      Size of the value of each object.
+     */
+    static void
+    writer(LogAppendBenchmark* benchmark, uint64_t threadIndex,
+           uint32_t numObjects, uint32_t dataBytes)
+    {
+        char objectData[dataBytes];
+        memset(objectData, 'x', dataBytes);
+
+        for (uint64_t i = 0; i < numObjects; i++) {
+            uint64_t keyVal = (threadIndex << 32) | i;
+            Key key(0, &keyVal, sizeof(keyVal));
+            Buffer value;
+            value.append(objectData, dataBytes);
+            Status status =
+                benchmark->objectManager->writeObject(key, value, NULL, NULL);
+            if (status != STATUS_OK) {
+                fprintf(stderr, "Failed to write object! Out of memory?\n");
+                exit(1);
+            }
+            benchmark->objectManager->syncChanges();
+        }
+    }
+
+    /**
+     * Write objects from the given number of threads and return the total
+     * number of objects written per second.
+     */
+    double
+    run(uint32_t numThreads, uint32_t numObjects, uint32_t dataBytes)
+    {
+        vector<std::thread*> threads;
+        uint64_t before = Cycles::rdtsc();
+        for (uint32_t i = 0; i < numThreads; i++) {
+            threads.push_back(new std::thread(writer, this, i, numObjects,
+                                              dataBytes));
+        }
+        foreach (std::thread* thread, threads) {
+            thread->join();
+            delete thread;
+        }
+        uint64_t ticks = Cycles::rdtsc() - before;
+
+        return numThreads * numObjects / Cycles::toSeconds(ticks);
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(LogAppendBenchmark);
+};
+
+}  // namespace RAMCloud
+
+int
+main()
+{
+    uint32_t numObjects = 200000;
+    uint32_t dataBytes = 100;
+    uint32_t threadCounts[] = { 1, 2, 4, 8, 0 };
+
+    printf("%u writes of %u-byte objects per thread\n", numObjects, dataBytes);
+    printf("threads   head only (writes/s)   one stream per thread "
+           "(writes/s)\n");
+    for (int i = 0; threadCounts[i] != 0; i++) {
+        uint32_t numThreads = threadCounts[i];
+        double headOnly;
+        double streams;
+        {
+            RAMCloud::LogAppendBenchmark benchmark("2048", "10%", 0);
+            headOnly = benchmark.run(numThreads, numObjects, dataBytes);
+        }
+        {
+            RAMCloud::LogAppendBenchmark benchmark("2048", "10%", numThreads);
+            streams = benchmark.run(numThreads, numObjects, dataBytes);
+        }
+        printf("%7u   %20.0f   %31.0f\n", numThreads, headOnly, streams);
+    }
+
+    return 0;
+}
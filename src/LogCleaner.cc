@@ -15,6 +15,7 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <functional>
 
 #include "Common.h"
 #include "Fence.h"
@@ -186,6 +187,22 @@ LogCleaner::cleanerThreadEntry(LogCleaner* logCleaner, Context* context)
     LOG(NOTICE, "LogCleaner thread stopping");
 }
 
+/**
+ * Static entry point for the helper threads that process all but the first
+ * work unit of a disk cleaning pass. This is invoked via the std::thread()
+ * constructor from doDiskCleaning().
+ */
+void
+LogCleaner::diskCleaningUnitEntry(LogCleaner* logCleaner,
+                                  DiskCleaningUnit* unit)
+{
+    try {
+        logCleaner->cleanDiskCleaningUnit(unit);
+    } catch (const Exception& e) {
+        DIE("Fatal error in disk cleaning thread: %s", e.what());
+    }
+}
+
 /**
  * Main cleaning loop, constantly invoked via cleanerThreadEntry(). If there
  * is cleaning to be done, do it now return. If no work is to be done, sleep for
@@ -346,6 +363,12 @@ LogCleaner::doMemoryCleaning()
  * Perform a disk cleaning pass if possible. Doing so involves choosing segments
  * to clean, extracting entries from those segments, writing them out into new
  * "survivor" segments, and alerting the segment manager upon completion.
+ *
+ * The chosen segments are split into up to #numThreads work units that are
+ * relocated in parallel: the calling thread handles the first unit and a
+ * temporary thread is spun for each of the others. All survivors are reported
+ * to the segment manager in a single cleaningComplete() call, so the log sees
+ * the pass as one atomic change regardless of how many units there were.
  */
 uint64_t
 LogCleaner::doDiskCleaning(bool lowOnDiskSpace)
@@ -361,11 +384,13 @@ LogCleaner::doDiskCleaning(bool lowOnDiskSpace)
     if (segmentsToClean.size() == 0)
         return 0;
 
-    // Extract the currently live entries of the segments we're cleaning and
-    // sort them by age.
-    EntryVector entries;
-    getSortedEntries(segmentsToClean, entries);
-
+    // TODO(Steve): Push all of this crap into LogCleanerMetrics. It already
+    // knows about the various parts of cleaning, so why not have simple calls
+    // into it at interesting points of cleaning and let it extract the needed
+    // metrics?
+    //
+    // Note that the histograms are not thread-safe, so these samples must be
+    // taken before the work units below are handed to other threads.
     uint64_t maxLiveBytes = 0;
     uint32_t segletsBefore = 0;
     foreach (LogSegment* segment, segmentsToClean) {
@@ -374,11 +399,40 @@ LogCleaner::doDiskCleaning(bool lowOnDiskSpace)
             onDiskMetrics.totalEmptySegmentsCleaned++;
         maxLiveBytes += liveBytes;
         segletsBefore += segment->getSegletsAllocated();
+
+        onDiskMetrics.totalMemoryBytesInCleanedSegments +=
+            segment->getSegletsAllocated() * segletSize;
+        onDiskMetrics.totalDiskBytesInCleanedSegments += segmentSize;
+        onDiskMetrics.cleanedSegmentMemoryHistogram.storeSample(
+            segment->getMemoryUtilization());
+        onDiskMetrics.cleanedSegmentDiskHistogram.storeSample(
+            segment->getDiskUtilization());
+    }
+
+    // Relocate the live entries of each work unit to survivor segments. Each
+    // unit sorts its own entries by age, so segregation happens within, rather
+    // than across, units.
+    DiskCleaningUnitVector units;
+    getDiskCleaningUnits(segmentsToClean, units);
+
+    vector<std::thread*> helpers;
+    for (size_t i = 1; i < units.size(); i++) {
+        helpers.push_back(
+            new std::thread(diskCleaningUnitEntry, this, &units[i]));
+    }
+    cleanDiskCleaningUnit(&units[0]);
+    foreach (std::thread* helper, helpers) {
+        helper->join();
+        delete helper;
     }
 
-    // Relocate the live entries to survivor segments.
     LogSegmentVector survivors;
-    uint64_t entryBytesAppended = relocateLiveEntries(entries, survivors);
+    uint64_t entryBytesAppended = 0;
+    foreach (DiskCleaningUnit& unit, units) {
+        survivors.insert(survivors.end(),
+                         unit.survivors.begin(), unit.survivors.end());
+        entryBytesAppended += unit.entryBytesAppended;
+    }
 
     uint32_t segmentsAfter = downCast<uint32_t>(survivors.size());
     uint32_t segletsAfter = 0;
@@ -403,6 +457,7 @@ LogCleaner::doDiskCleaning(bool lowOnDiskSpace)
     onDiskMetrics.totalSegmentsCleaned += segmentsToClean.size();
     onDiskMetrics.totalSurvivorsCreated += survivors.size();
     onDiskMetrics.totalRuns++;
+    onDiskMetrics.totalWorkUnits += units.size();
     if (lowOnDiskSpace)
         onDiskMetrics.totalLowDiskSpaceRuns++;
 
@@ -582,6 +637,66 @@ LogCleaner::getSegmentsToClean(LogSegmentVector& outSegmentsToClean)
         chosenIndices.size(), totalSeglets);
 }
 
+/**
+ * Split the segments chosen for a disk cleaning pass into independent work
+ * units that may be cleaned in parallel. At most #numThreads units are formed
+ * (and never more than there are segments). Segments are assigned, largest
+ * first, to whichever unit currently has the fewest live bytes so that each
+ * unit takes roughly the same amount of time to relocate.
+ *
+ * \param segmentsToClean
+ *      Segments chosen by getSegmentsToClean().
+ * \param[out] outUnits
+ *      Vector in which the work units are returned. Every segment in
+ *      segmentsToClean ends up in exactly one unit.
+ */
+void
+LogCleaner::getDiskCleaningUnits(LogSegmentVector& segmentsToClean,
+                                 DiskCleaningUnitVector& outUnits)
+{
+    size_t numUnits = std::min(static_cast<size_t>(std::max(numThreads, 1)),
+                               segmentsToClean.size());
+    outUnits.resize(numUnits);
+
+    // Snapshot the live byte counts first: they may shrink concurrently as
+    // objects are freed, which must not change the ordering mid-sort.
+    typedef std::pair<uint64_t, LogSegment*> SizedSegment;
+    vector<SizedSegment> sorted;
+    foreach (LogSegment* segment, segmentsToClean)
+        sorted.push_back(SizedSegment(segment->liveBytes, segment));
+    std::sort(sorted.begin(), sorted.end(), std::greater<SizedSegment>());
+
+    foreach (SizedSegment& sized, sorted) {
+        DiskCleaningUnit* lightest = &outUnits[0];
+        foreach (DiskCleaningUnit& unit, outUnits) {
+            if (unit.liveBytes < lightest->liveBytes)
+                lightest = &unit;
+        }
+        lightest->segments.push_back(sized.second);
+        lightest->liveBytes += sized.first;
+    }
+
+    TEST_LOG("%lu segments split into %lu units",
+        segmentsToClean.size(), outUnits.size());
+}
+
+/**
+ * Extract, sort, and relocate the live entries of a single disk cleaning work
+ * unit. This may run concurrently with other units from the same pass; it
+ * only touches state belonging to the unit and thread-safe metrics.
+ *
+ * \param unit
+ *      The work unit to clean. Its survivors and entryBytesAppended fields are
+ *      filled in.
+ */
+void
+LogCleaner::cleanDiskCleaningUnit(DiskCleaningUnit* unit)
+{
+    EntryVector entries;
+    getSortedEntries(unit->segments, entries);
+    unit->entryBytesAppended = relocateLiveEntries(entries, unit->survivors);
+}
+
 /**
  * Sort the given segment entries by their timestamp. Used to sort the survivor
  * data that is written out to multiple segments during disk cleaning. This
@@ -629,20 +744,6 @@ LogCleaner::getSortedEntries(LogSegmentVector& segmentsToClean,
 
     sortEntriesByTimestamp(outEntries);
 
-    // TODO(Steve): Push all of this crap into LogCleanerMetrics. It already
-    // knows about the various parts of cleaning, so why not have simple calls
-    // into it at interesting points of cleaning and let it extract the needed
-    // metrics?
-    foreach (LogSegment* segment, segmentsToClean) {
-        onDiskMetrics.totalMemoryBytesInCleanedSegments +=
-            segment->getSegletsAllocated() * segletSize;
-        onDiskMetrics.totalDiskBytesInCleanedSegments += segmentSize;
-        onDiskMetrics.cleanedSegmentMemoryHistogram.storeSample(
-            segment->getMemoryUtilization());
-        onDiskMetrics.cleanedSegmentDiskHistogram.storeSample(
-            segment->getDiskUtilization());
-    }
-
     TEST_LOG("%lu entries extracted from %lu segments",
         outEntries.size(), segmentsToClean.size());
 }
@@ -39,7 +39,9 @@ class ServerConfig;
  * The LogCleaner defragments a Log's closed segments, writing out any live
  * data to new "survivor" segments and reclaiming space used by dead log
  * entries. The cleaner runs in parallel with regular log operations in its
- * own thread.
+ * own thread(s). Disk cleaning passes are further split into independent
+ * work units that relocate their live entries in parallel (see
+ * DiskCleaningUnit).
  *
  * The cleaner employs some heuristics to aid efficiency. For instance, it
  * tries to minimise the cost of cleaning by choosing segments that have a
@@ -201,7 +203,41 @@ class LogCleaner {
         uint32_t threadNumber;
     };
 
+    /**
+     * A disjoint subset of the segments chosen in a single disk cleaning pass.
+     * Each unit extracts, sorts, and relocates the live entries of its own
+     * segments into its own survivors, so units can be processed concurrently
+     * without coordinating with one another. The survivors of all units are
+     * handed to the SegmentManager together once every unit has finished.
+     */
+    class DiskCleaningUnit {
+      public:
+        DiskCleaningUnit()
+            : segments()
+            , survivors()
+            , liveBytes(0)
+            , entryBytesAppended(0)
+        {
+        }
+
+        /// Segments this unit is responsible for cleaning.
+        LogSegmentVector segments;
+
+        /// Survivor segments this unit's live entries were relocated to.
+        LogSegmentVector survivors;
+
+        /// Sum of the live bytes in #segments when the unit was formed. Used
+        /// to balance the work across units.
+        uint64_t liveBytes;
+
+        /// Number of bytes appended to #survivors (see relocateLiveEntries()).
+        uint64_t entryBytesAppended;
+    };
+    typedef std::vector<DiskCleaningUnit> DiskCleaningUnitVector;
+
     static void cleanerThreadEntry(LogCleaner* logCleaner, Context* context);
+    static void diskCleaningUnitEntry(LogCleaner* logCleaner,
+                                      DiskCleaningUnit* unit);
     void doWork(CleanerThreadState* state);
     uint64_t doMemoryCleaning();
     uint64_t doDiskCleaning(bool lowOnDiskSpace);
@@ -209,6 +245,9 @@ class LogCleaner {
     void sortSegmentsByCostBenefit(LogSegmentVector& segments);
     void debugDumpSegments(LogSegmentVector& segments);
     void getSegmentsToClean(LogSegmentVector& outSegmentsToClean);
+    void getDiskCleaningUnits(LogSegmentVector& segmentsToClean,
+                              DiskCleaningUnitVector& outUnits);
+    void cleanDiskCleaningUnit(DiskCleaningUnit* unit);
     void sortEntriesByTimestamp(EntryVector& entries);
     void getSortedEntries(LogSegmentVector& segmentsToClean,
                           EntryVector& outEntries);
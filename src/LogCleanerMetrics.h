@@ -198,6 +198,7 @@ class OnDisk {
           totalSurvivorsCreated(0),
           totalRuns(0),
           totalLowDiskSpaceRuns(0),
+          totalWorkUnits(0),
           totalEntriesScanned(),
           totalLiveEntriesScanned(),
           totalScannedEntryLengths(),
@@ -249,6 +250,7 @@ class OnDisk {
         m.set_total_survivors_created(totalSurvivorsCreated);
         m.set_total_runs(totalRuns);
         m.set_total_low_disk_space_runs(totalLowDiskSpaceRuns);
+        m.set_total_work_units(totalWorkUnits);
 
         foreach (uint64_t count, totalEntriesScanned)
             m.add_total_entries_scanned(count);
@@ -351,6 +353,11 @@ class OnDisk {
     /// out of disk space (rather than ran out of memory).
     Metric64BitType totalLowDiskSpaceRuns;
 
+    /// Total number of independent work units the disk cleaner runs were
+    /// split into. Units within a run are relocated in parallel, each on its
+    /// own thread (see LogCleaner::doDiskCleaning).
+    Metric64BitType totalWorkUnits;
+
     /// Total number of each log entry the disk cleaner has encountered while
     /// cleaning segments. These counts include both dead and alive entries.
     Metric64BitType totalEntriesScanned[TOTAL_LOG_ENTRY_TYPES];
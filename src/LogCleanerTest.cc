@@ -247,6 +247,7 @@ TEST_F(LogCleanerTest, doDiskCleaning) {
     EXPECT_EQ(
         "doDiskCleaning: called | "
         "getSegmentsToClean: 1 segments selected with 128 allocated segments | "
+        "getDiskCleaningUnits: 1 segments split into 1 units | "
         "getSortedEntries: 3 entries extracted from 1 segments | "
         "relocate: type 1, size 24 | "
         "relocate: type 4, size 12 | "
@@ -393,6 +394,40 @@ TEST_F(LogCleanerTest, sortEntriesByTimestamp) {
     EXPECT_EQ(5U, entries[3].timestamp);
 }
 
+TEST_F(LogCleanerTest, getDiskCleaningUnits) {
+    LogSegmentVector segments;
+    uint32_t liveBytes[] = { 100, 700, 300, 400, 500 };
+    for (size_t i = 0; i < arrayLength(liveBytes); i++) {
+        segments.push_back(segmentManager.allocHeadSegment());
+        segments.back()->liveBytes = liveBytes[i];
+    }
+
+    // Never more units than threads.
+    LogCleaner::DiskCleaningUnitVector units;
+    cleaner.getDiskCleaningUnits(segments, units);
+    EXPECT_EQ(1U, units.size());
+    EXPECT_EQ(5U, units[0].segments.size());
+    EXPECT_EQ(2000U, units[0].liveBytes);
+
+    // Largest segments first, each to the lightest unit.
+    const_cast<int&>(cleaner.numThreads) = 2;
+    units.clear();
+    cleaner.getDiskCleaningUnits(segments, units);
+    EXPECT_EQ(2U, units.size());
+    EXPECT_EQ(1000U, units[0].liveBytes);
+    EXPECT_EQ(1000U, units[1].liveBytes);
+    EXPECT_EQ(segments[1], units[0].segments[0]);
+    EXPECT_EQ(segments[4], units[1].segments[0]);
+
+    // Never more units than segments.
+    const_cast<int&>(cleaner.numThreads) = 8;
+    units.clear();
+    cleaner.getDiskCleaningUnits(segments, units);
+    EXPECT_EQ(5U, units.size());
+    foreach (LogCleaner::DiskCleaningUnit& unit, units)
+        EXPECT_EQ(1U, unit.segments.size());
+}
+
 TEST_F(LogCleanerTest, getSortedEntries) {
     LogSegmentVector segments;
     LogSegment* a = segmentManager.allocHeadSegment();
@@ -56,14 +56,29 @@ namespace RAMCloud {
  *
  * Do note that running in parallel with cleaning means that the same entry may
  * be iterated over multiple times (i.e. if the cleaner has relocated it).
+ *
+ * If the log has append streams, all appends go to the head while any iterator
+ * exists (see Log::blockStreams), so the open stream segments are as immutable
+ * as the closed ones and are iterated over like them.
+ *
+ * \param log
+ *      The log to iterate over.
+ * \param firstSegmentId
+ *      Segments with identifiers lower than this are skipped. This is useful
+ *      for catching up on entries appended since some earlier point (for
+ *      instance, the position returned by Log::rollHeadOver) without walking
+ *      the entire log. Defaults to 0 (iterate over every segment).
  */
-LogIterator::LogIterator(Log& log)
+LogIterator::LogIterator(Log& log, uint64_t firstSegmentId)
     : log(log),
       segmentList(),
       currentIterator(),
-      currentSegmentId(Segment::INVALID_SEGMENT_ID),
+      // next() starts with the segment after this one. For the default of 0
+      // this is Segment::INVALID_SEGMENT_ID.
+      currentSegmentId(firstSegmentId - 1),
       headLocked(false)
 {
+    log.blockStreams();
     log.segmentManager->logIteratorCreated();
 
     // If there's no log head yet we need to preclude any appends.
@@ -86,6 +101,7 @@ LogIterator::~LogIterator()
     if (headLocked)
         log.appendLock.unlock();
     log.segmentManager->logIteratorDestroyed();
+    log.unblockStreams();
 }
 
 /**
@@ -247,6 +247,9 @@ LogMetricsStringer::getDiskCleanerMetrics()
     s += ls + format("  Avg Survivors per Disk Run:    %.2f\n",
         d(survivorsCreated) / d(totalRuns));
 
+    s += ls + format("  Avg Parallel Units per Run:    %.2f\n",
+        d(onDiskMetrics.total_work_units()) / d(totalRuns));
+
     s += ls + format("  Disk Space Freeing Rate:       %.3f MB/s "
         "(%.3f MB/s active)\n",
         d(diskFreed) / elapsedTime / 1024 / 1024,
@@ -0,0 +1,164 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "Dispatch.h"
+#include "LogSyncQueue.h"
+#include "ObjectManager.h"
+#include "RawMetrics.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty queue. No thread is started until the first RPC is
+ * queued.
+ *
+ * \param context
+ *      Overall information about the RAMCloud server.
+ * \param objectManager
+ *      The ObjectManager whose log is synced before queued replies are sent.
+ */
+LogSyncQueue::LogSyncQueue(Context* context, ObjectManager* objectManager)
+    : context(context)
+    , objectManager(objectManager)
+    , mutex()
+    , workOrExit()
+    , pending()
+    , exiting(false)
+    , exited(false)
+    , thread()
+{
+}
+
+/**
+ * Release any queued RPCs, halt the thread (if running), and destroy this.
+ */
+LogSyncQueue::~LogSyncQueue()
+{
+    halt();
+}
+
+/**
+ * Queue an RPC whose reply must not be sent until the changes it made to the
+ * log have been replicated. This should be invoked after those changes have
+ * been appended (so the next sync is guaranteed to cover them) and after the
+ * reply is complete. Ownership of the RPC passes to this queue, which sends
+ * the reply once the log has been synced.
+ *
+ * \param rpc
+ *      The RPC to reply to once the log is synced.
+ */
+void
+LogSyncQueue::enqueue(Transport::ServerRpc* rpc)
+{
+    Lock lock(mutex);
+    pending.push_back(rpc);
+    if (!thread)
+        thread.construct(&LogSyncQueue::main, this);
+    workOrExit.notify_one();
+}
+
+/**
+ * Send the replies of any queued RPCs (after syncing the log) and stop the
+ * thread. Calling halt() on a queue whose thread was never started or has
+ * already been halted has no effect. The thread will be started again if
+ * more RPCs are queued.
+ */
+void
+LogSyncQueue::halt()
+{
+    Lock lock(mutex);
+    if (!thread)
+        return;
+    exiting = true;
+    workOrExit.notify_one();
+
+    // The thread needs the dispatcher in order to send its final replies;
+    // if this is the dispatch thread, keep polling until the thread is done
+    // (otherwise the two would deadlock).
+    Dispatch& dispatch = *context->dispatch;
+    while (!exited) {
+        lock.unlock();
+        if (dispatch.isDispatchThread())
+            dispatch.poll();
+        else
+            std::this_thread::yield();
+        lock.lock();
+    }
+    lock.unlock();
+    thread->join();
+    lock.lock();
+    thread.destroy();
+    exiting = false;
+    exited = false;
+}
+
+/**
+ * Main loop of the thread started by enqueue(): wait for RPCs to be queued,
+ * then sync the log on behalf of everything queued so far and send the
+ * replies. Returns once halt() has been called and nothing is left queued.
+ */
+void
+LogSyncQueue::main()
+try {
+    while (syncBatch()) {
+        // Keep going.
+    }
+    Lock _(mutex);
+    exited = true;
+} catch (const std::exception& e) {
+    LOG(ERROR, "Fatal error in LogSyncQueue: %s", e.what());
+    throw;
+} catch (...) {
+    LOG(ERROR, "Unknown fatal error in LogSyncQueue.");
+    throw;
+}
+
+/**
+ * Wait until RPCs have been queued, then take all of them, sync the log once,
+ * and send their replies. This is the body of main(), separated out for
+ * testing.
+ *
+ * \return
+ *      False means halt() has been invoked and there was nothing left to
+ *      sync, so the caller should exit; true means a batch was released.
+ */
+bool
+LogSyncQueue::syncBatch()
+{
+    vector<Transport::ServerRpc*> batch;
+    {
+        Lock lock(mutex);
+        while (pending.empty()) {
+            if (exiting)
+                return false;
+            workOrExit.wait(lock);
+        }
+        batch.swap(pending);
+    }
+
+    // Every RPC in the batch appended its changes before it was queued, so a
+    // single sync now covers all of them.
+    objectManager->syncChanges();
+    metrics->master.logSyncBatchCount++;
+    metrics->master.logSyncBatchRpcs += batch.size();
+
+    Dispatch::Lock _(context->dispatch);
+    foreach (Transport::ServerRpc* rpc, batch)
+        rpc->sendReply();
+    return true;
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,98 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_LOGSYNCQUEUE_H
+#define RAMCLOUD_LOGSYNCQUEUE_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Common.h"
+#include "Transport.h"
+#include "Tub.h"
+
+namespace RAMCloud {
+
+class ObjectManager;
+
+/**
+ * Holds the replies of RPCs that modified the log (writes, removes, etc.)
+ * until those modifications have been replicated to backups, so that the
+ * worker threads that executed the RPCs don't have to wait for replication
+ * themselves.
+ *
+ * A worker appends its changes to the log and then, rather than syncing the
+ * log, defers its reply to this queue (see Service::Rpc::deferReply) and goes
+ * on to the next RPC. A separate thread repeatedly takes every RPC that has
+ * been queued, syncs the log once on behalf of all of them, and then sends all
+ * of their replies. This acts as a group commit: while one sync is in
+ * progress, further RPCs accumulate and are covered by the next sync.
+ *
+ * The thread is started the first time an RPC is queued and is halted (after
+ * releasing any queued RPCs) when the queue is destroyed.
+ */
+class LogSyncQueue {
+  PUBLIC:
+    LogSyncQueue(Context* context, ObjectManager* objectManager);
+    ~LogSyncQueue();
+
+    void enqueue(Transport::ServerRpc* rpc);
+    void halt();
+
+  PRIVATE:
+    void main();
+    bool syncBatch();
+
+    /// Shared RAMCloud information; used to lock the dispatcher when sending
+    /// replies.
+    Context* context;
+
+    /// The ObjectManager whose log the queued RPCs modified.
+    ObjectManager* objectManager;
+
+    /**
+     * Protects all fields below, so that workers and the thread running main()
+     * can safely communicate.
+     */
+    std::mutex mutex;
+
+    /// unique_lock is used to lock #mutex since the lock needs to be
+    /// relinquished when waiting on #workOrExit.
+    typedef std::unique_lock<std::mutex> Lock;
+
+    /// Signalled when an RPC is queued or when main() should exit.
+    std::condition_variable workOrExit;
+
+    /// RPCs whose changes are in the log but that have not yet been covered
+    /// by a sync. Their replies are fully formed.
+    vector<Transport::ServerRpc*> pending;
+
+    /// Set by halt() to tell main() to exit once #pending is empty.
+    bool exiting;
+
+    /// Set by main() just before it returns, so that halt() knows when it may
+    /// stop polling the dispatcher and join the thread.
+    bool exited;
+
+    /// Thread running main(); constructed by the first call to enqueue().
+    Tub<std::thread> thread;
+
+    DISALLOW_COPY_AND_ASSIGN(LogSyncQueue);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_LOGSYNCQUEUE_H
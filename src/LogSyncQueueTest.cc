@@ -0,0 +1,137 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "LogSyncQueue.h"
+#include "MockTransport.h"
+#include "ObjectManager.h"
+#include "RawMetrics.h"
+#include "ServerList.h"
+#include "ServiceManager.h"
+
+namespace RAMCloud {
+
+class LogSyncQueueTest : public ::testing::Test {
+  public:
+    Context context;
+    ServerId serverId;
+    ServerList serverList;
+    ServerConfig masterConfig;
+    TabletManager tabletManager;
+    ObjectManager objectManager;
+    MockTransport transport;
+    LogSyncQueue queue;
+
+    LogSyncQueueTest()
+        : context()
+        , serverId(5)
+        , serverList(&context)
+        , masterConfig(ServerConfig::forTesting())
+        , tabletManager()
+        , objectManager(&context, &serverId, &masterConfig, &tabletManager)
+        , transport(&context)
+        , queue(&context, &objectManager)
+    {
+        objectManager.initOnceEnlisted();
+    }
+
+    // Poll the dispatcher (which the queue needs in order to send replies)
+    // until the given number of replies have been sent, but give up if this
+    // takes too long.
+    void
+    waitForReplies(int count)
+    {
+        for (int i = 0; i < 1000; i++) {
+            context.dispatch->poll();
+            int replies = 0;
+            size_t pos = 0;
+            while ((pos = transport.outputLog.find("serverReply", pos)) !=
+                    string::npos) {
+                replies++;
+                pos++;
+            }
+            if (replies >= count)
+                return;
+            usleep(1000);
+        }
+    }
+
+    // Create an RPC whose reply has already been filled in.
+    Transport::ServerRpc*
+    newRpc(const char* reply)
+    {
+        MockTransport::MockServerRpc* rpc =
+            new MockTransport::MockServerRpc(&transport, "0x10000");
+        rpc->replyPayload.fillFromString(reply);
+        return rpc;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(LogSyncQueueTest);
+};
+
+TEST_F(LogSyncQueueTest, enqueue) {
+    uint64_t batches = metrics->master.logSyncBatchCount;
+    uint64_t rpcs = metrics->master.logSyncBatchRpcs;
+    EXPECT_FALSE(queue.thread);
+
+    queue.enqueue(newRpc("1 2"));
+    EXPECT_TRUE(queue.thread);
+    queue.enqueue(newRpc("3 4"));
+    waitForReplies(2);
+    EXPECT_EQ("serverReply: 1 2 | serverReply: 3 4", transport.outputLog);
+    EXPECT_LE(1U, metrics->master.logSyncBatchCount - batches);
+    EXPECT_EQ(2U, metrics->master.logSyncBatchRpcs - rpcs);
+}
+
+TEST_F(LogSyncQueueTest, halt) {
+    // Nothing to do if the thread never started.
+    queue.halt();
+    EXPECT_FALSE(queue.thread);
+
+    // Queued replies are released before the thread exits, even though
+    // halt() is running in the dispatch thread.
+    queue.enqueue(newRpc("1 2"));
+    queue.halt();
+    EXPECT_EQ("serverReply: 1 2", transport.outputLog);
+    EXPECT_FALSE(queue.thread);
+    EXPECT_FALSE(queue.exiting);
+    EXPECT_FALSE(queue.exited);
+
+    // The thread restarts if more RPCs are queued.
+    transport.clearOutput();
+    queue.enqueue(newRpc("3 4"));
+    EXPECT_TRUE(queue.thread);
+    waitForReplies(1);
+    EXPECT_EQ("serverReply: 3 4", transport.outputLog);
+}
+
+TEST_F(LogSyncQueueTest, deferReply) {
+    Buffer request, reply;
+    Service::Rpc inlineRpc(NULL, &request, &reply);
+    EXPECT_FALSE(inlineRpc.deferReply(&queue));
+    EXPECT_TRUE(inlineRpc.syncQueue == NULL);
+
+    Worker worker(&context);
+    Service::Rpc rpc(&worker, &request, &reply);
+    EXPECT_TRUE(rpc.deferReply(&queue));
+    EXPECT_EQ(&queue, rpc.syncQueue);
+
+    // Too late to defer once the reply has been sent.
+    Service::Rpc repliedRpc(&worker, &request, &reply);
+    repliedRpc.sendReply();
+    EXPECT_FALSE(repliedRpc.deferReply(&queue));
+}
+
+}  // namespace RAMCloud
@@ -18,7 +18,10 @@
 #include "Segment.h"
 #include "ServerRpcPool.h"
 #include "Log.h"
+#include "LogDigest.h"
 #include "LogEntryTypes.h"
+#include "LogIterator.h"
+#include "SegmentIterator.h"
 #include "Memory.h"
 #include "ServerConfig.h"
 #include "StringUtil.h"
@@ -70,6 +73,64 @@ class LogTest : public ::testing::Test {
     DISALLOW_COPY_AND_ASSIGN(LogTest);
 };
 
+/**
+ * A Log with a single append stream, plus its own segment manager.
+ */
+class StreamLog {
+  public:
+    ServerConfig serverConfig;
+    SegletAllocator allocator;
+    SegmentManager segmentManager;
+    Log log;
+
+    explicit StreamLog(LogTest* test)
+        : serverConfig(withOneStream(test->serverConfig)),
+          allocator(&serverConfig),
+          segmentManager(&test->context, &serverConfig, &test->serverId,
+                         allocator, test->replicaManager),
+          log(&test->context, &serverConfig, &test->entryHandlers,
+              &segmentManager, &test->replicaManager)
+    {
+        log.sync();
+    }
+
+    static ServerConfig
+    withOneStream(ServerConfig config)
+    {
+        config.master.logAppendStreams = 1;
+        return config;
+    }
+
+    /// Return the stream's current segment.
+    LogSegment*
+    stream()
+    {
+        return log.streams[0]->segment;
+    }
+
+    /// Return true if the head's digest names the given segment.
+    bool
+    digestNames(LogSegment* segment)
+    {
+        for (SegmentIterator it(*log.head); !it.isDone(); it.next()) {
+            if (it.getType() != LOG_ENTRY_TYPE_LOGDIGEST)
+                continue;
+
+            Buffer buffer;
+            it.appendToBuffer(buffer);
+            LogDigest digest(buffer.getRange(0, buffer.getTotalLength()),
+                             buffer.getTotalLength());
+            for (uint32_t i = 0; i < digest.size(); i++) {
+                if (digest[i] == segment->id)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(StreamLog);
+};
+
 TEST_F(LogTest, constructor) {
     SegletAllocator allocator2(&serverConfig);
     SegmentManager segmentManager2(&context, &serverConfig, &serverId,
@@ -96,6 +157,101 @@ TEST_F(LogTest, destructor) {
               "~LogCleaner: destroyed", TestLog::get());
 }
 
+TEST_F(LogTest, append_noStreams) {
+    Log::Reference reference;
+    EXPECT_TRUE(l.append(LOG_ENTRY_TYPE_OBJ, "hi", 2, &reference));
+    EXPECT_EQ(l.head->slot, reference.getSlot(serverConfig.segmentSize));
+    EXPECT_EQ(0U, l.streams.size());
+}
+
+TEST_F(LogTest, append_stream) {
+    StreamLog sl(this);
+    EXPECT_EQ(static_cast<LogSegment*>(NULL), sl.stream());
+
+    Log::Reference reference;
+    EXPECT_TRUE(sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2, &reference));
+    LogSegment* segment = sl.stream();
+    ASSERT_NE(static_cast<LogSegment*>(NULL), segment);
+    EXPECT_EQ(segment->slot, reference.getSlot(serverConfig.segmentSize));
+    Buffer buffer;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, sl.log.getEntry(reference, buffer));
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+
+    // The head was rolled over to name the stream's segment in a digest.
+    EXPECT_GT(sl.log.head->id, segment->id);
+    EXPECT_TRUE(sl.digestNames(segment));
+    EXPECT_EQ(1U, sl.log.streams[0]->appendCalls);
+
+    // Multiple entries go to the same segment.
+    Log::AppendVector appends[2];
+    appends[0].type = LOG_ENTRY_TYPE_OBJ;
+    appends[0].buffer.append("a", 1);
+    appends[1].type = LOG_ENTRY_TYPE_OBJTOMB;
+    appends[1].buffer.append("b", 1);
+    EXPECT_TRUE(sl.log.append(appends, 2));
+    EXPECT_EQ(segment, sl.stream());
+    EXPECT_EQ(segment->slot,
+              appends[1].reference.getSlot(serverConfig.segmentSize));
+
+    ProtoBuf::LogMetrics m;
+    sl.log.getMetrics(m);
+    EXPECT_EQ(2U, m.total_append_calls());
+    EXPECT_EQ(4U, m.total_bytes_appended());
+}
+
+TEST_F(LogTest, append_streamFull) {
+    StreamLog sl(this);
+    char data[1000];
+    memset(data, 0, sizeof(data));
+    sl.log.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
+    LogSegment* first = sl.stream();
+    while (sl.stream() == first)
+        sl.log.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
+
+    // The full segment was closed and synced, and remains part of the log.
+    EXPECT_EQ(SegmentManager::NEWLY_CLEANABLE,
+              sl.segmentManager.states[first->slot]);
+    EXPECT_EQ(first->getAppendedLength(), first->syncedLength);
+    EXPECT_TRUE(sl.digestNames(first));
+    EXPECT_TRUE(sl.digestNames(sl.stream()));
+}
+
+TEST_F(LogTest, append_streamOutOfMemory) {
+    StreamLog sl(this);
+    while (sl.segmentManager.allocSideSegment(0, NULL) != NULL) {
+        // eat up all free segments
+    }
+
+    // Falls back on the head, which still has room.
+    Log::Reference reference;
+    EXPECT_TRUE(sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2, &reference));
+    EXPECT_EQ(static_cast<LogSegment*>(NULL), sl.stream());
+    EXPECT_EQ(sl.log.head->slot, reference.getSlot(serverConfig.segmentSize));
+}
+
+TEST_F(LogTest, append_streamsBlocked) {
+    StreamLog sl(this);
+    sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    LogSegment* segment = sl.stream();
+    uint32_t length = segment->getAppendedLength();
+
+    Log::Reference reference;
+    {
+        LogIterator it(sl.log);
+        EXPECT_EQ(1U, sl.log.streamsBlocked);
+    }
+    EXPECT_EQ(0U, sl.log.streamsBlocked);
+
+    sl.log.blockStreams();
+    EXPECT_TRUE(sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2, &reference));
+    EXPECT_EQ(sl.log.head->slot, reference.getSlot(serverConfig.segmentSize));
+    EXPECT_EQ(length, segment->getAppendedLength());
+    sl.log.unblockStreams();
+
+    EXPECT_TRUE(sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2, &reference));
+    EXPECT_EQ(segment->slot, reference.getSlot(serverConfig.segmentSize));
+}
+
 TEST_F(LogTest, enableCleaner_and_disableCleaner) {
     {
         TestLog::Enable _;
@@ -149,6 +305,26 @@ TEST_F(LogTest, sync) {
     EXPECT_GT(l.metrics.totalSyncTicks, 0U);
 }
 
+TEST_F(LogTest, sync_streams) {
+    StreamLog sl(this);
+    sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    LogSegment* segment = sl.stream();
+    EXPECT_NE(segment->syncedLength, segment->getAppendedLength());
+
+    TestLog::Enable _(syncFilter);
+    sl.log.sync();
+    EXPECT_EQ(segment->syncedLength, segment->getAppendedLength());
+    EXPECT_EQ(format("sync: syncing segment %lu to offset %u | "
+                     "sync: sync not needed: already fully replicated",
+                     segment->id, segment->syncedLength),
+              TestLog::get());
+
+    TestLog::reset();
+    sl.log.sync();
+    EXPECT_EQ("sync: sync not needed: already fully replicated",
+              TestLog::get());
+}
+
 TEST_F(LogTest, rollHeadOver) {
     Log::Position oldPos = Log::Position(0, 0);
     LogSegment* oldHead = l.head;
@@ -161,6 +337,35 @@ TEST_F(LogTest, rollHeadOver) {
     EXPECT_NE(oldHead, l.head);
 }
 
+TEST_F(LogTest, rollHeadOver_streams) {
+    StreamLog sl(this);
+    sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    LogSegment* segment = sl.stream();
+
+    Log::Position position = sl.log.rollHeadOver();
+    EXPECT_EQ(static_cast<LogSegment*>(NULL), sl.stream());
+    EXPECT_EQ(SegmentManager::NEWLY_CLEANABLE,
+              sl.segmentManager.states[segment->slot]);
+    EXPECT_EQ(segment->getAppendedLength(), segment->syncedLength);
+    EXPECT_TRUE(sl.digestNames(segment));
+
+    // Later appends land beyond the position returned.
+    sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    EXPECT_GT(sl.stream()->id, position.getSegmentId());
+}
+
+TEST_F(LogTest, rollHead) {
+    StreamLog sl(this);
+    sl.log.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    LogSegment* segment = sl.stream();
+    LogSegment* oldHead = sl.log.head;
+
+    sl.log.rollHead();
+    EXPECT_NE(oldHead, sl.log.head);
+    EXPECT_EQ(segment, sl.stream());
+    EXPECT_TRUE(sl.digestNames(segment));
+}
+
 TEST_F(LogTest, allocNextSegment) {
     Log::Lock lock(l.appendLock);
 
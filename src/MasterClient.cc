@@ -149,6 +149,70 @@ GetHeadOfLogRpc::wait()
     return { respHdr->headSegmentId, respHdr->headSegmentOffset };
 }
 
+/**
+ * Retrieve a master's statistics about its tablets, such as how often
+ * each has been read and written. This is the same information returned
+ * by RamCloud::getServerStatistics, but the master is named by its
+ * ServerId rather than its service locator.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the target server.
+ * \param[out] serverStats
+ *      Filled in with statistics about the server.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+void
+MasterClient::getMasterStatistics(Context* context, ServerId serverId,
+        ProtoBuf::ServerStatistics* serverStats)
+{
+    GetMasterStatisticsRpc rpc(context, serverId);
+    rpc.wait(serverStats);
+}
+
+/**
+ * Constructor for GetMasterStatisticsRpc: initiates an RPC in the same way
+ * as #MasterClient::getMasterStatistics, but returns once the RPC has been
+ * initiated, without waiting for it to complete.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the target server.
+ */
+GetMasterStatisticsRpc::GetMasterStatisticsRpc(Context* context,
+        ServerId serverId)
+    : ServerIdRpcWrapper(context, serverId,
+            sizeof(WireFormat::GetServerStatistics::Response))
+{
+    allocHeader<WireFormat::GetServerStatistics>();
+    send();
+}
+
+/**
+ * Wait for a getMasterStatistics RPC to complete.
+ *
+ * \param[out] serverStats
+ *      Filled in with statistics about the server.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+void
+GetMasterStatisticsRpc::wait(ProtoBuf::ServerStatistics* serverStats)
+{
+    waitAndCheckErrors();
+    const WireFormat::GetServerStatistics::Response* respHdr(
+            getResponseHeader<WireFormat::GetServerStatistics>());
+    ProtoBuf::parseFromResponse(response, sizeof(*respHdr),
+            respHdr->serverStatsLength, serverStats);
+}
+
 /**
  * Return whether a replica for a segment created by a given master may still
  * be needed for recovery. Backups use this when restarting after a failure
@@ -240,6 +304,75 @@ IsReplicaNeededRpc::wait()
     return respHdr->needed;
 }
 
+/**
+ * Ask a master to migrate one of its tablets to another master. This is
+ * the same operation as RamCloud::migrateTablet, but the current owner is
+ * named by its ServerId rather than found through the tablet map; the
+ * coordinator uses it to rebalance load. The RPC doesn't return until the
+ * migration is complete.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the master that currently owns the tablet.
+ * \param tableId
+ *      Identifier for the table.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet range to be migrated.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet range to be migrated.
+ * \param newOwnerMasterId
+ *      Identifier for the master that is to own the tablet.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ * \throw UnknownTabletException
+ *      \a serverId doesn't own a tablet spanning the given range.
+ */
+void
+MasterClient::migrateMasterTablet(Context* context, ServerId serverId,
+        uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+        ServerId newOwnerMasterId)
+{
+    MigrateMasterTabletRpc rpc(context, serverId, tableId, firstKeyHash,
+            lastKeyHash, newOwnerMasterId);
+    rpc.wait();
+}
+
+/**
+ * Constructor for MigrateMasterTabletRpc: initiates an RPC in the same way
+ * as #MasterClient::migrateMasterTablet, but returns once the RPC has been
+ * initiated, without waiting for it to complete.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the master that currently owns the tablet.
+ * \param tableId
+ *      Identifier for the table.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet range to be migrated.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet range to be migrated.
+ * \param newOwnerMasterId
+ *      Identifier for the master that is to own the tablet.
+ */
+MigrateMasterTabletRpc::MigrateMasterTabletRpc(Context* context,
+        ServerId serverId, uint64_t tableId, uint64_t firstKeyHash,
+        uint64_t lastKeyHash, ServerId newOwnerMasterId)
+    : ServerIdRpcWrapper(context, serverId,
+            sizeof(WireFormat::MigrateTablet::Response))
+{
+    WireFormat::MigrateTablet::Request* reqHdr(
+            allocHeader<WireFormat::MigrateTablet>());
+    reqHdr->tableId = tableId;
+    reqHdr->firstKeyHash = firstKeyHash;
+    reqHdr->lastKeyHash = lastKeyHash;
+    reqHdr->newOwnerMasterId = newOwnerMasterId.getId();
+    send();
+}
+
 /**
  * Request that a master decide whether it will accept a migrated tablet
  * and set up any necessary state to begin receiving tablet data from the
@@ -41,8 +41,13 @@ class MasterClient {
     static void dropTabletOwnership(Context* context, ServerId serverId,
             uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash);
     static Log::Position getHeadOfLog(Context* context, ServerId serverId);
+    static void getMasterStatistics(Context* context, ServerId serverId,
+            ProtoBuf::ServerStatistics* serverStats);
     static bool isReplicaNeeded(Context* context, ServerId serverId,
             ServerId backupServerId, uint64_t segmentId);
+    static void migrateMasterTablet(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            ServerId newOwnerMasterId);
     static void prepForMigration(Context* context, ServerId serverId,
             uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
             uint64_t expectedObjects, uint64_t expectedBytes);
@@ -92,6 +97,20 @@ class GetHeadOfLogRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(GetHeadOfLogRpc);
 };
 
+/**
+ * Encapsulates the state of a MasterClient::getMasterStatistics
+ * request, allowing it to execute asynchronously.
+ */
+class GetMasterStatisticsRpc : public ServerIdRpcWrapper {
+  public:
+    GetMasterStatisticsRpc(Context* context, ServerId serverId);
+    ~GetMasterStatisticsRpc() {}
+    void wait(ProtoBuf::ServerStatistics* serverStats);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(GetMasterStatisticsRpc);
+};
+
 /**
  * Encapsulates the state of a MasterClient::isReplicaNeeded
  * request, allowing it to execute asynchronously.
@@ -107,6 +126,23 @@ class IsReplicaNeededRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(IsReplicaNeededRpc);
 };
 
+/**
+ * Encapsulates the state of a MasterClient::migrateMasterTablet
+ * request, allowing it to execute asynchronously.
+ */
+class MigrateMasterTabletRpc : public ServerIdRpcWrapper {
+  public:
+    MigrateMasterTabletRpc(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            ServerId newOwnerMasterId);
+    ~MigrateMasterTabletRpc() {}
+    /// \copydoc ServerIdRpcWrapper::waitAndCheckErrors
+    void wait() {waitAndCheckErrors();}
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(MigrateMasterTabletRpc);
+};
+
 /**
  * Encapsulates the state of a MasterClient::prepForMigration
  * request, allowing it to execute asynchronously.
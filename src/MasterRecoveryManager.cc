@@ -71,9 +71,12 @@ class MaybeStartRecoveryTask : public Task {
                     "another recovery is active for the same ServerId",
                     recovery->crashedServerId.toString().c_str());
             } else {
-                if (mgr.runtimeOptions)
+                if (mgr.runtimeOptions) {
                     recovery->testingFailRecoveryMasters =
                         mgr.runtimeOptions->popFailRecoveryMasters();
+                    recovery->partitionBytes =
+                        mgr.runtimeOptions->getRecoveryPartitionBytes();
+                }
                 recovery->schedule();
                 mgr.activeRecoveries[recovery->getRecoveryId()] = recovery;
                 mgr.waitingRecoveries.pop();
@@ -13,6 +13,7 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -36,6 +37,10 @@
 
 namespace RAMCloud {
 
+#ifdef TESTING
+void (*MasterService::migrateTabletCatchUpHook)(MasterService* service) = NULL;
+#endif
+
 // struct MasterService::Replica
 
 /**
@@ -56,6 +61,64 @@ MasterService::Replica::Replica(uint64_t backupId, uint64_t segmentId,
 {
 }
 
+// struct MasterService::MigrationProgress
+
+/**
+ * Constructor.
+ * \param tableId
+ *      Table containing the tablet being migrated.
+ * \param firstKeyHash
+ *      Smallest key hash in the tablet being migrated.
+ * \param lastKeyHash
+ *      Largest key hash in the tablet being migrated.
+ * \param newOwnerMasterId
+ *      The master the tablet is being sent to.
+ */
+MasterService::MigrationProgress::MigrationProgress(uint64_t tableId,
+                                                    uint64_t firstKeyHash,
+                                                    uint64_t lastKeyHash,
+                                                    ServerId newOwnerMasterId)
+    : tableId(tableId)
+    , firstKeyHash(firstKeyHash)
+    , lastKeyHash(lastKeyHash)
+    , newOwnerMasterId(newOwnerMasterId)
+    , phase("copying")
+    , scanProgress(0)
+    , objectsSent(0)
+    , tombstonesSent(0)
+    , bytesSent(0)
+    , segmentsSent(0)
+    , startTicks(Cycles::rdtsc())
+{
+}
+
+/**
+ * Fill in a GetServerStatistics protocol buffer entry describing this
+ * migration.
+ *
+ * \param[out] migration
+ *      Protocol buffer to fill in.
+ */
+void
+MasterService::MigrationProgress::serialize(
+                            ProtoBuf::ServerStatistics_Migration* migration)
+{
+    double elapsed = Cycles::toSeconds(Cycles::rdtsc() - startTicks);
+    migration->set_table_id(tableId);
+    migration->set_start_key_hash(firstKeyHash);
+    migration->set_end_key_hash(lastKeyHash);
+    migration->set_new_owner_id(newOwnerMasterId.getId());
+    migration->set_phase(phase);
+    migration->set_progress(scanProgress);
+    migration->set_objects_sent(objectsSent);
+    migration->set_tombstones_sent(tombstonesSent);
+    migration->set_bytes_sent(bytesSent);
+    migration->set_segments_sent(segmentsSent);
+    migration->set_elapsed_seconds(elapsed);
+    migration->set_bytes_per_second(elapsed > 0
+        ? static_cast<double>(bytesSent) / elapsed : 0);
+}
+
 // --- MasterService ---
 
 /**
@@ -73,9 +136,12 @@ MasterService::MasterService(Context* context,
     , config(config)
     , tabletManager()
     , objectManager(context, &serverId, config, &tabletManager)
+    , logSyncQueue(context, &objectManager)
     , initCalled(false)
     , maxMultiReadResponseSize(Transport::MAX_RPC_LEN)
     , disableCount(0)
+    , activeMigrations()
+    , migrationLock("MasterService::migrationLock")
 {
 }
 
@@ -158,6 +224,10 @@ MasterService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
             callHandler<WireFormat::Remove, MasterService,
                         &MasterService::remove>(rpc);
             break;
+        case WireFormat::Scan::opcode:
+            callHandler<WireFormat::Scan, MasterService,
+                        &MasterService::scan>(rpc);
+            break;
         case WireFormat::SplitMasterTablet::opcode:
             callHandler<WireFormat::SplitMasterTablet, MasterService,
                         &MasterService::splitMasterTablet>(rpc);
@@ -176,6 +246,31 @@ MasterService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
     }
 }
 
+/**
+ * Serve READ requests, and MULTI_OP reads, directly in the dispatch thread
+ * if every object involved is no larger than config->master.maxInlineReadBytes
+ * and its hash table bucket isn't locked by a worker. Anything else is left
+ * for a worker thread.
+ *
+ * \copydetails Service::dispatchInline
+ */
+bool
+MasterService::dispatchInline(WireFormat::Opcode opcode, Rpc* rpc)
+{
+    if (config->master.maxInlineReadBytes == 0 || !initCalled ||
+            disableCount > 0)
+        return false;
+
+    switch (opcode) {
+        case WireFormat::Read::opcode:
+            return readInline(rpc);
+        case WireFormat::MultiOp::opcode:
+            return multiReadInline(rpc);
+        default:
+            return false;
+    }
+}
+
 
 /**
  * Perform once-only initialization for the master service after having
@@ -237,8 +332,7 @@ MasterService::enumerate(const WireFormat::Enumerate::Request* reqHdr,
     Enumeration enumeration(reqHdr->tableId, reqHdr->tabletFirstHash,
                             actualTabletStartHash, actualTabletEndHash,
                             &respHdr->tabletFirstHash, iter,
-                            *objectManager.getLog(),
-                            *objectManager.getObjectMap(),
+                            objectManager,
                             *rpc->replyPayload, maxPayloadBytes);
     enumeration.complete();
     respHdr->payloadBytes = rpc->replyPayload->getTotalLength()
@@ -249,6 +343,69 @@ MasterService::enumerate(const WireFormat::Enumerate::Request* reqHdr,
     respHdr->iteratorBytes = iteratorBytes;
 }
 
+/**
+ * Top-level server method to handle the SCAN request: return the objects
+ * of one tablet whose keys fall in a range, in key order.
+ *
+ * \copydetails Service::ping
+ */
+void
+MasterService::scan(const WireFormat::Scan::Request* reqHdr,
+                    WireFormat::Scan::Response* respHdr,
+                    Rpc* rpc)
+{
+    TabletManager::Tablet tablet;
+    bool found = tabletManager.getTablet(reqHdr->tableId,
+                                         reqHdr->tabletFirstHash,
+                                         &tablet);
+    if (!found) {
+        respHdr->common.status = STATUS_UNKNOWN_TABLET;
+        return;
+    }
+
+    uint32_t reqOffset = sizeof32(*reqHdr);
+    string startKey, endKey;
+    if (reqHdr->startKeyLength > 0) {
+        const void* key = rpc->requestPayload->getRange(reqOffset,
+                reqHdr->startKeyLength);
+        if (key == NULL)
+            throw MessageTooShortError(HERE);
+        startKey.assign(static_cast<const char*>(key), reqHdr->startKeyLength);
+        reqOffset += reqHdr->startKeyLength;
+    }
+    if (reqHdr->endKeyLength > 0) {
+        const void* key = rpc->requestPayload->getRange(reqOffset,
+                reqHdr->endKeyLength);
+        if (key == NULL)
+            throw MessageTooShortError(HERE);
+        endKey.assign(static_cast<const char*>(key), reqHdr->endKeyLength);
+    }
+
+    // As in enumerate, filter by the hash the client asked for rather than
+    // the start of the tablet we own, in case tablets have been merged
+    // since the client's previous request. scanObjects keeps the objects
+    // and the next key it returns within this limit together.
+    uint32_t maxPayloadBytes = downCast<uint32_t>(Transport::MAX_RPC_LEN
+            - sizeof(*respHdr));
+    string nextKey;
+    bool done = objectManager.scanObjects(reqHdr->tableId,
+            reqHdr->tabletFirstHash, tablet.endKeyHash, startKey, endKey,
+            maxPayloadBytes, rpc->replyPayload, &nextKey);
+    respHdr->payloadBytes = rpc->replyPayload->getTotalLength()
+            - sizeof32(*respHdr);
+
+    if (done) {
+        // Wraps to 0 after the last tablet, which ends the scan.
+        respHdr->tabletFirstHash = tablet.endKeyHash + 1;
+        respHdr->nextKeyLength = 0;
+    } else {
+        respHdr->tabletFirstHash = reqHdr->tabletFirstHash;
+        respHdr->nextKeyLength = downCast<uint16_t>(nextKey.size());
+        memcpy(new(rpc->replyPayload, APPEND) char[nextKey.size()],
+               nextKey.data(), nextKey.size());
+    }
+}
+
 /**
  * Obtain various metrics from the log and return to the caller. Used to
  * remotely monitor the log's utilization and performance.
@@ -378,6 +535,12 @@ MasterService::getServerStatistics(
     ProtoBuf::ServerStatistics serverStats;
     tabletManager.getStatistics(&serverStats);
     SpinLock::getStatistics(serverStats.mutable_spin_lock_stats());
+    objectManager.getHashTableStatistics(serverStats.mutable_hash_table());
+    {
+        std::lock_guard<SpinLock> lock(migrationLock);
+        foreach (MigrationProgress* migration, activeMigrations)
+            migration->serialize(serverStats.add_migration());
+    }
     respHdr->serverStatsLength = serializeToResponse(rpc->replyPayload,
                                                     &serverStats);
 }
@@ -409,6 +572,65 @@ MasterService::multiOp(const WireFormat::MultiOp::Request* reqHdr,
     }
 }
 
+namespace {
+/// Number of value bytes that follow the key of a multi-read part (none).
+uint32_t
+partValueLength(const WireFormat::MultiOp::Request::ReadPart* part)
+{
+    return 0;
+}
+
+/// Number of value bytes that follow the key of a multi-write part.
+uint32_t
+partValueLength(const WireFormat::MultiOp::Request::WritePart* part)
+{
+    return part->valueLength;
+}
+} // anonymous namespace
+
+/**
+ * Parse the keys of the next few parts of a multi-op request and hand them
+ * to ObjectManager::prefetchObjects, so that the hash table and log cache
+ * misses for those objects overlap instead of being taken one object at a
+ * time as the parts are processed. Stops early (without complaint) at a
+ * malformed part; the caller will detect and report it.
+ *
+ * \param requestPayload
+ *      The multi-op request.
+ * \param reqOffset
+ *      Offset in \a requestPayload of the first part to prefetch.
+ * \param count
+ *      Number of parts remaining in the request; at most
+ *      ObjectManager::MAX_PREFETCH_BATCH of them are prefetched.
+ */
+template<typename Part>
+void
+MasterService::prefetchMultiOpObjects(Buffer* requestPayload,
+                                      uint32_t reqOffset,
+                                      uint32_t count)
+{
+    Tub<Key> keys[ObjectManager::MAX_PREFETCH_BATCH];
+    Key* keyPointers[ObjectManager::MAX_PREFETCH_BATCH];
+    count = std::min(count, ObjectManager::MAX_PREFETCH_BATCH);
+
+    uint32_t numKeys = 0;
+    while (numKeys < count) {
+        const Part* part = requestPayload->getOffset<Part>(reqOffset);
+        if (part == NULL)
+            break;
+        reqOffset += sizeof32(Part);
+        const void* stringKey = requestPayload->getRange(reqOffset,
+                                                         part->keyLength);
+        if (stringKey == NULL)
+            break;
+        reqOffset += part->keyLength + partValueLength(part);
+        keyPointers[numKeys] = keys[numKeys].construct(part->tableId,
+                stringKey, part->keyLength);
+        numKeys++;
+    }
+    objectManager.prefetchObjects(keyPointers, numKeys);
+}
+
 /**
  * Top-level server method to handle the MULTI_READ request.
  *
@@ -461,6 +683,11 @@ MasterService::multiRead(const WireFormat::MultiOp::Request* reqHdr,
             break;
         }
 
+        if (i % ObjectManager::MAX_PREFETCH_BATCH == 0) {
+            prefetchMultiOpObjects<WireFormat::MultiOp::Request::ReadPart>(
+                    rpc->requestPayload, reqOffset, numRequests - i);
+        }
+
         const WireFormat::MultiOp::Request::ReadPart *currentReq =
             rpc->requestPayload->getOffset<
                 WireFormat::MultiOp::Request::ReadPart>(reqOffset);
@@ -488,6 +715,86 @@ MasterService::multiRead(const WireFormat::MultiOp::Request* reqHdr,
     }
 }
 
+/**
+ * Dispatch-thread version of multiRead (see dispatchInline).
+ *
+ * \param rpc
+ *      A MULTI_OP request; only READ operations are handled.
+ * \return
+ *      True if the response is complete; false if the request must be
+ *      handed to a worker (the reply payload is then left empty).
+ */
+bool
+MasterService::multiReadInline(Rpc* rpc)
+{
+    const WireFormat::MultiOp::Request* reqHdr =
+        rpc->requestPayload->getStart<WireFormat::MultiOp::Request>();
+    if (reqHdr == NULL || reqHdr->type != WireFormat::MultiOp::OpType::READ)
+        return false;
+    checkServerId(&reqHdr->common);
+
+    WireFormat::MultiOp::Response* respHdr =
+        new(rpc->replyPayload, APPEND) WireFormat::MultiOp::Response;
+    memset(respHdr, 0, sizeof(*respHdr));
+    respHdr->count = reqHdr->count;
+
+    bool complete = true;
+    uint32_t reqOffset = sizeof32(*reqHdr);
+    for (uint32_t i = 0; i < reqHdr->count; i++) {
+        if (i % ObjectManager::MAX_PREFETCH_BATCH == 0) {
+            prefetchMultiOpObjects<WireFormat::MultiOp::Request::ReadPart>(
+                    rpc->requestPayload, reqOffset, reqHdr->count - i);
+        }
+
+        const WireFormat::MultiOp::Request::ReadPart *currentReq =
+            rpc->requestPayload->getOffset<
+                WireFormat::MultiOp::Request::ReadPart>(reqOffset);
+        if (currentReq == NULL) {
+            complete = false;
+            break;
+        }
+        reqOffset += sizeof32(WireFormat::MultiOp::Request::ReadPart);
+        const void* stringKey = rpc->requestPayload->getRange(
+            reqOffset, currentReq->keyLength);
+        reqOffset += currentReq->keyLength;
+        if (stringKey == NULL) {
+            complete = false;
+            break;
+        }
+        Key key(currentReq->tableId, stringKey, currentReq->keyLength);
+
+        Buffer buffer;
+        Status status;
+        uint64_t version = 0;
+        if (!objectManager.tryReadSmallObject(key,
+                config->master.maxInlineReadBytes, &buffer, NULL, &version,
+                &status)) {
+            complete = false;
+            break;
+        }
+
+        WireFormat::MultiOp::Response::ReadPart* currentResp =
+                   new(rpc->replyPayload, APPEND)
+                       WireFormat::MultiOp::Response::ReadPart();
+        currentResp->status = status;
+        currentResp->version = version;
+        if (status == STATUS_OK) {
+            currentResp->length = buffer.getTotalLength();
+            rpc->replyPayload->append(&buffer);
+        }
+
+        // Truncating oversized responses is left to multiRead.
+        if (rpc->replyPayload->getTotalLength() > maxMultiReadResponseSize) {
+            complete = false;
+            break;
+        }
+    }
+
+    if (!complete)
+        rpc->replyPayload->truncateEnd(rpc->replyPayload->getTotalLength());
+    return complete;
+}
+
 /**
  * Top-level server method to handle the MULTI_REMOVE request.
  *
@@ -552,7 +859,7 @@ MasterService::multiRemove(const WireFormat::MultiOp::Request* reqHdr,
 
     // All of the individual removes were done asynchronously. We must sync
     // them to backups before returning to the caller.
-    objectManager.syncChanges();
+    syncChangesBeforeReply(rpc);
 }
 
 /**
@@ -584,6 +891,11 @@ MasterService::multiWrite(const WireFormat::MultiOp::Request* reqHdr,
     // Each iteration extracts one request from the rpc, writes the object
     // if possible, and appends a status and version to the response buffer.
     for (uint32_t i = 0; i < numRequests; i++) {
+        if (i % ObjectManager::MAX_PREFETCH_BATCH == 0) {
+            prefetchMultiOpObjects<WireFormat::MultiOp::Request::WritePart>(
+                    rpc->requestPayload, reqOffset, numRequests - i);
+        }
+
         const WireFormat::MultiOp::Request::WritePart *currentReq =
             rpc->requestPayload->getOffset<
                 WireFormat::MultiOp::Request::WritePart>(reqOffset);
@@ -627,7 +939,7 @@ MasterService::multiWrite(const WireFormat::MultiOp::Request* reqHdr,
 
     // All of the individual writes were done asynchronously. Sync the objects
     // now to propagate them in bulk to backups.
-    objectManager.syncChanges();
+    syncChangesBeforeReply(rpc);
 }
 
 /**
@@ -670,6 +982,51 @@ MasterService::read(const WireFormat::Read::Request* reqHdr,
     rpc->replyPayload->append(&buffer);
 }
 
+/**
+ * Dispatch-thread version of read (see dispatchInline).
+ *
+ * \param rpc
+ *      A READ request.
+ * \return
+ *      True if the response is complete; false if the request must be
+ *      handed to a worker (the reply payload is then left empty).
+ */
+bool
+MasterService::readInline(Rpc* rpc)
+{
+    const WireFormat::Read::Request* reqHdr =
+        rpc->requestPayload->getStart<WireFormat::Read::Request>();
+    if (reqHdr == NULL)
+        return false;
+    checkServerId(&reqHdr->common);
+    const void* stringKey = rpc->requestPayload->getRange(sizeof32(*reqHdr),
+                                                        reqHdr->keyLength);
+    if (stringKey == NULL)
+        return false;
+    Key key(reqHdr->tableId, stringKey, reqHdr->keyLength);
+
+    RejectRules rejectRules = reqHdr->rejectRules;
+    Buffer buffer;
+    Status status;
+    uint64_t version = 0;
+    if (!objectManager.tryReadSmallObject(key,
+            config->master.maxInlineReadBytes, &buffer, &rejectRules,
+            &version, &status))
+        return false;
+
+    WireFormat::Read::Response* respHdr =
+        new(rpc->replyPayload, APPEND) WireFormat::Read::Response;
+    memset(respHdr, 0, sizeof(*respHdr));
+    respHdr->common.status = status;
+    respHdr->version = version;
+    if (status != STATUS_OK)
+        return true;
+
+    respHdr->length = buffer.getTotalLength();
+    rpc->replyPayload->append(&buffer);
+    return true;
+}
+
 /**
  * Top-level server method to handle the DROP_TABLET_OWNERSHIP request.
  *
@@ -856,12 +1213,229 @@ MasterService::prepForMigration(
     }
 }
 
+namespace MasterServiceInternal {
+/**
+ * Packs the log entries of a tablet being migrated into Segments and sends
+ * them to the tablet's new owner. Several segments may be in flight at once,
+ * so that the new owner replays one while the next is being filled, and the
+ * rate at which data is sent may be limited. While an instance exists, its
+ * migration is listed in MasterService::activeMigrations so that progress is
+ * reported by GetServerStatistics.
+ */
+class MigrationSender {
+  PUBLIC:
+    MigrationSender(MasterService* service,
+                    uint64_t tableId,
+                    uint64_t firstKeyHash,
+                    uint64_t lastKeyHash,
+                    ServerId newOwnerMasterId)
+        : service(service)
+        , progress(tableId, firstKeyHash, lastKeyHash, newOwnerMasterId)
+        , bytesPerSecond(service->config->master.migrationBytesPerSecond)
+        , transfers()
+        , current(0)
+        , pendingEntries(0)
+        , pendingObjects(0)
+        , pendingTombstones(0)
+        , pendingBytes(0)
+    {
+        std::lock_guard<SpinLock> lock(service->migrationLock);
+        service->activeMigrations.push_back(&progress);
+    }
+
+    ~MigrationSender()
+    {
+        std::lock_guard<SpinLock> lock(service->migrationLock);
+        service->activeMigrations.remove(&progress);
+    }
+
+    /**
+     * Add a log entry to the data being migrated. If the current segment
+     * is full, it is sent first.
+     *
+     * \param type
+     *      Type of the entry (an object or a tombstone).
+     * \param buffer
+     *      Contents of the entry.
+     * \return
+     *      False if the entry is too big to fit even in an empty segment,
+     *      otherwise true.
+     */
+    bool
+    append(LogEntryType type, Buffer& buffer)
+    {
+        if (!transfers[current].segment)
+            transfers[current].segment.construct();
+        if (!transfers[current].segment->append(type, buffer)) {
+            send();
+            transfers[current].segment.construct();
+            if (!transfers[current].segment->append(type, buffer))
+                return false;
+        }
+
+        pendingEntries++;
+        if (type == LOG_ENTRY_TYPE_OBJ)
+            pendingObjects++;
+        else
+            pendingTombstones++;
+        pendingBytes += buffer.getTotalLength();
+        return true;
+    }
+
+    /**
+     * Send the last, partially filled, segment (if there is one) and wait
+     * until the new owner has acknowledged everything sent.
+     */
+    void
+    finish()
+    {
+        if (pendingEntries > 0) {
+            LOG(DEBUG, "Sending last migration segment");
+            send();
+        }
+        for (uint32_t i = 0; i < arrayLength(transfers); i++)
+            reclaim(&transfers[i]);
+    }
+
+    /// Set MigrationProgress::phase.
+    void
+    setPhase(const char* phase)
+    {
+        std::lock_guard<SpinLock> lock(service->migrationLock);
+        progress.phase = phase;
+    }
+
+    /// Set MigrationProgress::scanProgress.
+    void
+    setScanProgress(double scanProgress)
+    {
+        std::lock_guard<SpinLock> lock(service->migrationLock);
+        progress.scanProgress = scanProgress;
+    }
+
+    /// The MasterService whose tablet is being migrated.
+    MasterService* service;
+
+    /// Describes the migration. The counts only include data in segments
+    /// that have been sent.
+    MasterService::MigrationProgress progress;
+
+    /// If nonzero, send() sleeps as needed to keep the average rate at which
+    /// data is sent below this many bytes per second.
+    uint64_t bytesPerSecond;
+
+  PRIVATE:
+    /**
+     * A segment of migration data and the RPC sending it, if any.
+     */
+    struct Transfer {
+        Transfer() : segment(), rpc() {}
+
+        /// Segment being filled or sent. Empty if neither.
+        Tub<Segment> segment;
+
+        /// RPC sending #segment, if it has been sent but not yet reclaimed.
+        /// Declared after #segment so that it is destroyed first.
+        Tub<ReceiveMigrationDataRpc> rpc;
+    };
+
+    /// Number of segments that may be in flight to the new owner while
+    /// another is being filled.
+    enum { MAX_OUTSTANDING_SEGMENTS = 2 };
+
+    /**
+     * Close the segment being filled, start sending it, and make room for
+     * the next one (waiting for the oldest outstanding RPC if necessary).
+     */
+    void
+    send()
+    {
+        Transfer* transfer = &transfers[current];
+        transfer->segment->close();
+        LOG(DEBUG, "Sending migration segment");
+        transfer->rpc.construct(service->context, progress.newOwnerMasterId,
+                                progress.tableId, progress.firstKeyHash,
+                                transfer->segment.get());
+
+        {
+            std::lock_guard<SpinLock> lock(service->migrationLock);
+            progress.objectsSent += pendingObjects;
+            progress.tombstonesSent += pendingTombstones;
+            progress.bytesSent += pendingBytes;
+            progress.segmentsSent++;
+        }
+        pendingEntries = pendingObjects = pendingTombstones = pendingBytes = 0;
+
+        current = (current + 1) % arrayLength(transfers);
+        reclaim(&transfers[current]);
+        throttle();
+    }
+
+    /**
+     * Wait for the RPC (if any) sending a transfer's segment to complete, then
+     * free the segment.
+     */
+    void
+    reclaim(Transfer* transfer)
+    {
+        if (transfer->rpc) {
+            transfer->rpc->wait();
+            transfer->rpc.destroy();
+        }
+        transfer->segment.destroy();
+    }
+
+    /**
+     * If rate limiting is enabled, sleep until sending the bytes sent so far
+     * would not have exceeded #bytesPerSecond.
+     */
+    void
+    throttle()
+    {
+        if (bytesPerSecond == 0)
+            return;
+        double elapsed = Cycles::toSeconds(Cycles::rdtsc() -
+                                           progress.startTicks);
+        double allowed = static_cast<double>(progress.bytesSent) /
+                         static_cast<double>(bytesPerSecond);
+        if (allowed > elapsed)
+            usleep(static_cast<useconds_t>((allowed - elapsed) * 1e06));
+    }
+
+    /// Segments being filled or in flight, used round-robin.
+    Transfer transfers[MAX_OUTSTANDING_SEGMENTS + 1];
+
+    /// Index in #transfers of the segment currently being filled.
+    uint32_t current;
+
+    /// Counts of what has been appended to the current segment, added to
+    /// #progress once it is sent.
+    uint64_t pendingEntries;
+    uint64_t pendingObjects;
+    uint64_t pendingTombstones;
+    uint64_t pendingBytes;
+
+    DISALLOW_COPY_AND_ASSIGN(MigrationSender);
+};
+} // namespace MasterServiceInternal
+
 /**
  * Top-level server method to handle the MIGRATE_TABLET request.
  *
  * This is used to manually initiate the migration of a tablet (or piece of a
  * tablet) that this master owns to another master.
  *
+ * Migration happens in two passes. First the tablet's objects are copied out
+ * of the hash table, a bucket at a time, and streamed to the new owner. This
+ * pass holds no locks for long and doesn't keep the log cleaner from running,
+ * so it may proceed at a leisurely pace (see
+ * ServerConfig::Master::migrationBytesPerSecond). Then a short catch-up pass
+ * iterates over just the log segments created since the copy began, sending
+ * any objects and tombstones written in the meantime. Appends are paused at
+ * the end of this pass until ownership has been transferred, and until then
+ * the log cleaner keeps all of the tablet's tombstones (see
+ * ObjectManager::TombstoneProtector).
+ *
  * \copydetails Service::ping
  */
 void
@@ -906,18 +1480,63 @@ MasterService::migrateTablet(const WireFormat::MigrateTablet::Request* reqHdr,
         firstKeyHash, lastKeyHash, tableId,
         context->serverList->toString(newOwnerMasterId).c_str());
 
-    // We'll send over objects in Segment containers for better network
-    // efficiency and convenience.
-    Tub<Segment> transferSeg;
+    // An object copied below and then deleted may be cleaned from the log
+    // before the catch-up pass runs; its tombstone is then all that tells
+    // the new owner to delete it, so the cleaner must keep the tablet's
+    // tombstones until ownership has moved.
+    ObjectManager::TombstoneProtector tombstoneProtector(&objectManager,
+            tableId, firstKeyHash, lastKeyHash);
+
+    // Everything appended to the log from here on will be in this segment or
+    // a later one, so these are all the catch-up pass needs to look at.
+    Log* log = objectManager.getLog();
+    uint64_t catchUpSegmentId = log->rollHeadOver().getSegmentId();
+
+    MasterServiceInternal::MigrationSender sender(this, tableId, firstKeyHash,
+                                                  lastKeyHash,
+                                                  newOwnerMasterId);
+
+    // Copy out and send the tablet's current objects. Objects written or
+    // removed during this loop may or may not be seen; the catch-up pass
+    // takes care of them.
+    ObjectManager::TabletScan scan(tableId, firstKeyHash, lastKeyHash);
+    while (!scan.isDone()) {
+        Buffer objects;
+        vector<uint32_t> lengths;
+        objectManager.copyTabletObjects(&scan, 1024 * 1024, &objects,
+                                        &lengths);
+
+        // We hold no references into the log at this point, so there's no
+        // need for this RPC to keep the log from reclaiming cleaned segments.
+        rpc->renewEpoch();
+
+        uint32_t offset = 0;
+        foreach (uint32_t length, lengths) {
+            Buffer object;
+            object.append(objects.getRange(offset, length), length);
+            offset += length;
+            if (!sender.append(LOG_ENTRY_TYPE_OBJ, object)) {
+                LOG(ERROR, "Tablet migration failed: could not fit object "
+                    "into empty segment (obj bytes %u)", length);
+                respHdr->common.status = STATUS_INTERNAL_ERROR;
+                return;
+            }
+        }
+        sender.setScanProgress(scan.getProgress());
+    }
 
-    // TODO(rumble/slaughter): These should probably be metrics.
-    uint64_t totalObjects = 0;
-    uint64_t totalTombstones = 0;
-    uint64_t totalBytes = 0;
+#ifdef TESTING
+    if (migrateTabletCatchUpHook != NULL)
+        migrateTabletCatchUpHook(this);
+#endif
+
+    // The catch-up pass should be short, so don't slow it down.
+    sender.setPhase("catching up");
+    sender.bytesPerSecond = 0;
 
     // Hold on to the iterator since it locks the head Segment, avoiding any
     // additional appends once we've finished iterating.
-    LogIterator it(*objectManager.getLog());
+    LogIterator it(*log, catchUpSegmentId);
     for (; !it.isDone(); it.next()) {
         LogEntryType type = it.getType();
         if (type != LOG_ENTRY_TYPE_OBJ && type != LOG_ENTRY_TYPE_OBJTOMB) {
@@ -950,69 +1569,38 @@ MasterService::migrateTablet(const WireFormat::MigrateTablet::Request* reqHdr,
             Object iteratorObject(buffer);
             if (iteratorObject.getVersion() < currentVersion)
                 continue;
-
-            totalObjects++;
-        } else {
-            // We must always send tombstones, since an object we may have sent
-            // could have been deleted more recently. We could be smarter and
-            // more selective here, but that'd require keeping extra state to
-            // know what we've already sent.
-            //
-            // TODO(rumble/slaughter) Actually, we can do better. The stupid way
-            //      is to track each object or tombstone we've sent. The smarter
-            //      way is to just record the Log::Position when we started
-            //      iterating and only send newer tombstones.
-
-            totalTombstones++;
         }
 
-        totalBytes += buffer.getTotalLength();
-
-        if (!transferSeg)
-            transferSeg.construct();
-
-        // If we can't fit it, send the current buffer and retry.
-        if (!transferSeg->append(type, buffer)) {
-            transferSeg->close();
-            LOG(DEBUG, "Sending migration segment");
-            MasterClient::receiveMigrationData(context, newOwnerMasterId,
-                tableId, firstKeyHash, transferSeg.get());
-
-            transferSeg.destroy();
-            transferSeg.construct();
-
-            // If it doesn't fit this time, we're in trouble.
-            if (!transferSeg->append(type, buffer)) {
-                LOG(ERROR, "Tablet migration failed: could not fit object "
-                    "into empty segment (obj bytes %u)",
-                    buffer.getTotalLength());
-                respHdr->common.status = STATUS_INTERNAL_ERROR;
-                return;
-            }
+        // Tombstones are always sent, since the object they delete may have
+        // been sent during the copy. Only tombstones written since the copy
+        // began are seen here, so there shouldn't be many.
+        if (!sender.append(type, buffer)) {
+            LOG(ERROR, "Tablet migration failed: could not fit object "
+                "into empty segment (obj bytes %u)",
+                buffer.getTotalLength());
+            respHdr->common.status = STATUS_INTERNAL_ERROR;
+            return;
         }
     }
-
-    if (transferSeg) {
-        transferSeg->close();
-        LOG(DEBUG, "Sending last migration segment");
-        MasterClient::receiveMigrationData(context, newOwnerMasterId,
-            tableId, firstKeyHash, transferSeg.get());
-        transferSeg.destroy();
-    }
+    sender.finish();
 
     // Now that all data has been transferred, we can reassign ownership of
     // the tablet. If this succeeds, we are free to drop the tablet. The
     // data is all on the other machine and the coordinator knows to use it
     // for any recoveries.
+    sender.setPhase("transferring ownership");
     CoordinatorClient::reassignTabletOwnership(context,
         tableId, firstKeyHash, lastKeyHash, newOwnerMasterId,
         newOwnerLogHead.getSegmentId(), newOwnerLogHead.getSegmentOffset());
 
+    MigrationProgress& progress = sender.progress;
     LOG(NOTICE, "Migration succeeded for tablet [0x%lx,0x%lx] in "
         "tableId %lu; sent %lu objects and %lu tombstones to %s, "
         "%lu bytes in total",
-        firstKeyHash, lastKeyHash, tableId, totalObjects, totalTombstones,
-        context->serverList->toString(newOwnerMasterId).c_str(), totalBytes);
+        firstKeyHash, lastKeyHash, tableId, progress.objectsSent,
+        progress.tombstonesSent,
+        context->serverList->toString(newOwnerMasterId).c_str(),
+        progress.bytesSent);
 
     tabletManager.deleteTablet(tableId, firstKeyHash, lastKeyHash);
 
@@ -1282,8 +1870,18 @@ MasterService::recover(uint64_t recoveryId,
 
     // The SideLog we'll append recovered entries to. It will be committed after
     // replay completes on all segments, making all of the recovered data
-    // durable.
+    // durable. If replay is divided among threads, each has its own SideLog
+    // (see ObjectManager::ReplayThreadPool).
     SideLog sideLog(objectManager.getLog());
+    vector<SideLog*> sideLogs(1, &sideLog);
+    std::vector<std::unique_ptr<SideLog>> extraSideLogs;
+    for (uint32_t i = 1; i < config->master.recoveryReplayThreadCount; i++) {
+        extraSideLogs.emplace_back(new SideLog(objectManager.getLog()));
+        sideLogs.push_back(extraSideLogs.back().get());
+    }
+    Tub<ObjectManager::ReplayThreadPool> replayThreads;
+    if (sideLogs.size() > 1)
+        replayThreads.construct(&objectManager, sideLogs);
 
     // Start RPCs
     auto replicaIt = notStarted;
@@ -1341,12 +1939,18 @@ MasterService::recover(uint64_t recoveryId,
                 metrics->master.segmentReadTicks += grdTime;
 
                 if (!gotFirstGRD) {
+                    // The counters read here are bumped by other threads
+                    // (the dispatch thread, workers, replay threads), each
+                    // in its own RawMetrics shard, so use their totals.
                     metrics->master.replicationBytes =
-                        0 - metrics->transport.transmit.byteCount;
+                        0 - RawMetrics::total(
+                                metrics->transport.transmit.byteCount);
                     metrics->master.replicationTransmitCopyTicks =
-                        0 - metrics->transport.transmit.copyTicks;
+                        0 - RawMetrics::total(
+                                metrics->transport.transmit.copyTicks);
                     metrics->master.replicationTransmitActiveTicks =
-                        0 - metrics->transport.infiniband.transmitActiveTicks;
+                        0 - RawMetrics::total(metrics->transport.infiniband.
+                                              transmitActiveTicks);
                     metrics->master.replicationPostingWriteRpcTicks = 0;
                     metrics->master.replayMemoryReadBytes = 0 -
                         // tx
@@ -1354,24 +1958,25 @@ MasterService::recover(uint64_t recoveryId,
                         // tx copy
                          metrics->master.replicationBytes +
                         // backup write copy
-                         metrics->backup.writeCopyBytes +
+                         RawMetrics::total(metrics->backup.writeCopyBytes) +
                         // read from filtering objects
-                         metrics->backup.storageReadBytes +
+                         RawMetrics::total(metrics->backup.storageReadBytes) +
                         // log append copy
-                         metrics->master.liveObjectBytes);
+                         RawMetrics::total(metrics->master.liveObjectBytes));
                     metrics->master.replayMemoryWrittenBytes = 0 -
                         // tx copy
                         (metrics->master.replicationBytes +
                         // backup write copy
-                         metrics->backup.writeCopyBytes +
+                         RawMetrics::total(metrics->backup.writeCopyBytes) +
                         // disk read into memory
-                         metrics->backup.storageReadBytes +
+                         RawMetrics::total(metrics->backup.storageReadBytes) +
                         // copy from filtering objects
-                         metrics->backup.storageReadBytes +
+                         RawMetrics::total(metrics->backup.storageReadBytes) +
                         // rx into memory
-                         metrics->transport.receive.byteCount +
+                         RawMetrics::total(
+                                metrics->transport.receive.byteCount) +
                         // log append copy
-                         metrics->master.liveObjectBytes);
+                         RawMetrics::total(metrics->master.liveObjectBytes));
                     gotFirstGRD = true;
                 }
                 if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
@@ -1397,7 +2002,10 @@ MasterService::recover(uint64_t recoveryId,
                             ReplicatedSegment::recoveryStart),
                         task->replica.segmentId, responseLen);
                 }
-                objectManager.replaySegment(&sideLog, it);
+                if (replayThreads)
+                    replayThreads->replaySegment(it);
+                else
+                    objectManager.replaySegment(&sideLog, it);
                 usefulTime += Cycles::rdtsc() - startUseful;
                 TEST_LOG("Segment %lu replay complete",
                          task->replica.segmentId);
@@ -1486,46 +2094,54 @@ MasterService::recover(uint64_t recoveryId,
 
     {
         CycleCounter<RawMetric> logSyncTicks(&metrics->master.logSyncTicks);
-        LOG(NOTICE, "Committing the SideLog...");
+        LOG(NOTICE, "Committing the SideLog%s...",
+            sideLogs.size() > 1 ? "s" : "");
         metrics->master.logSyncBytes =
-            0 - metrics->transport.transmit.byteCount;
+            0 - RawMetrics::total(metrics->transport.transmit.byteCount);
         metrics->master.logSyncTransmitCopyTicks =
-            0 - metrics->transport.transmit.copyTicks;
+            0 - RawMetrics::total(metrics->transport.transmit.copyTicks);
         metrics->master.logSyncTransmitActiveTicks =
-            0 - metrics->transport.infiniband.transmitActiveTicks;
+            0 - RawMetrics::total(
+                    metrics->transport.infiniband.transmitActiveTicks);
         metrics->master.logSyncPostingWriteRpcTicks =
-            0 - metrics->master.replicationPostingWriteRpcTicks;
-        sideLog.commit();
-        metrics->master.logSyncBytes += metrics->transport.transmit.byteCount;
+            0 - RawMetrics::total(
+                    metrics->master.replicationPostingWriteRpcTicks);
+        foreach (SideLog* replayLog, sideLogs)
+            replayLog->commit();
+        metrics->master.logSyncBytes +=
+            RawMetrics::total(metrics->transport.transmit.byteCount);
         metrics->master.logSyncTransmitCopyTicks +=
-            metrics->transport.transmit.copyTicks;
+            RawMetrics::total(metrics->transport.transmit.copyTicks);
         metrics->master.logSyncTransmitActiveTicks +=
-            metrics->transport.infiniband.transmitActiveTicks;
+            RawMetrics::total(
+                metrics->transport.infiniband.transmitActiveTicks);
         metrics->master.logSyncPostingWriteRpcTicks +=
-            metrics->master.replicationPostingWriteRpcTicks;
+            RawMetrics::total(
+                metrics->master.replicationPostingWriteRpcTicks);
         LOG(NOTICE, "SideLog finished committing (data is durable).");
     }
 
-    metrics->master.replicationBytes += metrics->transport.transmit.byteCount;
+    metrics->master.replicationBytes +=
+        RawMetrics::total(metrics->transport.transmit.byteCount);
     metrics->master.replicationTransmitCopyTicks +=
-        metrics->transport.transmit.copyTicks;
+        RawMetrics::total(metrics->transport.transmit.copyTicks);
     // See the lines with "0 -" above to get the purpose of each of these
     // fields in this metric.
     metrics->master.replayMemoryReadBytes +=
         (metrics->master.replicationBytes +
          metrics->master.replicationBytes +
-         metrics->backup.writeCopyBytes +
-         metrics->backup.storageReadBytes +
-         metrics->master.liveObjectBytes);
+         RawMetrics::total(metrics->backup.writeCopyBytes) +
+         RawMetrics::total(metrics->backup.storageReadBytes) +
+         RawMetrics::total(metrics->master.liveObjectBytes));
     metrics->master.replayMemoryWrittenBytes +=
         (metrics->master.replicationBytes +
-         metrics->backup.writeCopyBytes +
-         metrics->backup.storageReadBytes +
-         metrics->transport.receive.byteCount +
-         metrics->backup.storageReadBytes +
-         metrics->master.liveObjectBytes);
+         RawMetrics::total(metrics->backup.writeCopyBytes) +
+         RawMetrics::total(metrics->backup.storageReadBytes) +
+         RawMetrics::total(metrics->transport.receive.byteCount) +
+         RawMetrics::total(metrics->backup.storageReadBytes) +
+         RawMetrics::total(metrics->master.liveObjectBytes));
     metrics->master.replicationTransmitActiveTicks +=
-        metrics->transport.infiniband.transmitActiveTicks;
+        RawMetrics::total(metrics->transport.infiniband.transmitActiveTicks);
 
     double totalSecs = Cycles::toSeconds(Cycles::rdtsc() - start);
     double usefulSecs = Cycles::toSeconds(usefulTime);
@@ -1706,7 +2322,7 @@ MasterService::remove(const WireFormat::Remove::Request* reqHdr,
                                                         &rejectRules,
                                                         &respHdr->version);
     if (respHdr->common.status == STATUS_OK)
-        objectManager.syncChanges();
+        syncChangesBeforeReply(rpc);
 }
 
 /**
@@ -1747,10 +2363,10 @@ MasterService::increment(const WireFormat::Increment::Request* reqHdr,
         &rejectRules, &respHdr->version);
     if (*status != STATUS_OK)
         return;
-    objectManager.syncChanges();
 
     // Return new value
     respHdr->newValue = newValue;
+    syncChangesBeforeReply(rpc);
 }
 
 /**
@@ -1793,6 +2409,25 @@ MasterService::write(const WireFormat::Write::Request* reqHdr,
     respHdr->common.status = objectManager.writeObject(key,
         buffer, &rejectRules, &respHdr->version);
     if (respHdr->common.status == STATUS_OK)
+        syncChangesBeforeReply(rpc);
+}
+
+/**
+ * Make sure that the log modifications made while servicing an RPC have been
+ * replicated before its reply is sent. When possible the worker thread does
+ * not wait for this: the reply is handed to #logSyncQueue, which syncs the
+ * log once for a whole batch of such RPCs and then sends their replies. This
+ * must be the last thing the handler does, since the reply may be sent at
+ * any time once it returns.
+ *
+ * \param rpc
+ *      The RPC whose changes must be durable before it is replied to. Its
+ *      reply must be complete.
+ */
+void
+MasterService::syncChangesBeforeReply(Rpc* rpc)
+{
+    if (!rpc->deferReply(&logSyncQueue))
         objectManager.syncChanges();
 }
 
@@ -16,10 +16,13 @@
 #ifndef RAMCLOUD_MASTERSERVICE_H
 #define RAMCLOUD_MASTERSERVICE_H
 
+#include <list>
+
 #include "Common.h"
 #include "CoordinatorClient.h"
 #include "Log.h"
 #include "LogCleaner.h"
+#include "LogSyncQueue.h"
 #include "HashTable.h"
 #include "Object.h"
 #include "ObjectManager.h"
@@ -39,6 +42,7 @@ namespace RAMCloud {
 
 // forward declaration
 namespace MasterServiceInternal {
+class MigrationSender;
 class RecoveryTask;
 }
 
@@ -54,6 +58,8 @@ class MasterService : public Service {
     virtual ~MasterService();
     void dispatch(WireFormat::Opcode opcode,
                   Rpc* rpc);
+    bool dispatchInline(WireFormat::Opcode opcode,
+                        Rpc* rpc);
     int maxThreads() { return config->master.masterServiceThreadCount; }
 
     /*
@@ -108,9 +114,47 @@ class MasterService : public Service {
         State state;
     };
 
+    /**
+     * Describes the progress of a tablet migration that this master is
+     * sending to another master. Used to report on migrations through
+     * GetServerStatistics while they run.
+     */
+    struct MigrationProgress {
+        MigrationProgress(uint64_t tableId, uint64_t firstKeyHash,
+                          uint64_t lastKeyHash, ServerId newOwnerMasterId);
+        void serialize(ProtoBuf::ServerStatistics_Migration* migration);
+
+        /// Identifies the tablet being migrated.
+        uint64_t tableId;
+        uint64_t firstKeyHash;
+        uint64_t lastKeyHash;
+
+        /// The master the tablet is being sent to.
+        ServerId newOwnerMasterId;
+
+        /// Human-readable name of the current step of the migration; see
+        /// ServerStatistics.proto.
+        const char* phase;
+
+        /// Fraction of the hash table scanned while copying the tablet.
+        double scanProgress;
+
+        /// Counts of what has been sent to the new owner so far.
+        uint64_t objectsSent;
+        uint64_t tombstonesSent;
+        uint64_t bytesSent;
+        uint64_t segmentsSent;
+
+        /// Cycles::rdtsc() time when the migration started.
+        uint64_t startTicks;
+    };
+
     void enumerate(const WireFormat::Enumerate::Request* reqHdr,
                    WireFormat::Enumerate::Response* respHdr,
                    Rpc* rpc);
+    void scan(const WireFormat::Scan::Request* reqHdr,
+              WireFormat::Scan::Response* respHdr,
+              Rpc* rpc);
     void getLogMetrics(const WireFormat::GetLogMetrics::Request* reqHdr,
                        WireFormat::GetLogMetrics::Response* respHdr,
                        Rpc* rpc);
@@ -141,6 +185,8 @@ class MasterService : public Service {
     void read(const WireFormat::Read::Request* reqHdr,
               WireFormat::Read::Response* respHdr,
               Rpc* rpc);
+    bool readInline(Rpc* rpc);
+    bool multiReadInline(Rpc* rpc);
     void getServerStatistics(
         const WireFormat::GetServerStatistics::Request* reqHdr,
         WireFormat::GetServerStatistics::Response* respHdr,
@@ -180,6 +226,10 @@ class MasterService : public Service {
     void write(const WireFormat::Write::Request* reqHdr,
                WireFormat::Write::Response* respHdr,
                Rpc* rpc);
+    void syncChangesBeforeReply(Rpc* rpc);
+    template<typename Part>
+    void prefetchMultiOpObjects(Buffer* requestPayload, uint32_t reqOffset,
+                                uint32_t count);
 
   public:
     /// Shared RAMCloud information.
@@ -200,6 +250,14 @@ class MasterService : public Service {
      */
     ObjectManager objectManager;
 
+    /**
+     * Sends the replies of write, remove, and increment RPCs once their
+     * changes have been synced to backups, so that worker threads need not
+     * wait for replication themselves. Declared after #objectManager so that
+     * it is destroyed (and flushed) first.
+     */
+    LogSyncQueue logSyncQueue;
+
     /**
      * Used to ensure that init() is invoked before the dispatcher runs.
      */
@@ -221,9 +279,25 @@ class MasterService : public Service {
      */
     Atomic<int> disableCount;
 
+    /**
+     * Tablet migrations currently being sent by this master. There may be
+     * more than one, since each runs in its own worker thread. Protected by
+     * #migrationLock, which must also be held when modifying the elements.
+     */
+    std::list<MigrationProgress*> activeMigrations;
+
+    /// Protects #activeMigrations.
+    SpinLock migrationLock;
+
     /* Tombstone cleanup method used after recovery. */
     void removeTombstones();
 
+#ifdef TESTING
+    /// If set, migrateTablet() calls this between its copy and catch-up
+    /// passes, so tests can change the tablet in the middle of a migration.
+    static void (*migrateTabletCatchUpHook)(MasterService* service);
+#endif
+
   PRIVATE:
     void initOnceEnlisted();
 
@@ -237,6 +311,7 @@ class MasterService : public Service {
     friend void removeObjectIfFromUnknownTablet(uint64_t reference,
                                                 void *cookie);
     friend class RecoverSegmentBenchmark;
+    friend class MasterServiceInternal::MigrationSender;
     friend class MasterServiceInternal::RecoveryTask;
 
     DISALLOW_COPY_AND_ASSIGN(MasterService);
@@ -18,6 +18,7 @@
 #include "Buffer.h"
 #include "CoordinatorClient.h"
 #include "EnumerationIterator.h"
+#include "LogCleaner.h"
 #include "LogIterator.h"
 #include "MockCluster.h"
 #include "Memory.h"
@@ -458,6 +459,119 @@ TEST_F(MasterServiceTest, enumeration_mergeTablet) {
     EXPECT_EQ(0U, objects.getTotalLength());
 }
 
+TEST_F(MasterServiceTest, enumeration_keyHashIndex) {
+    service->objectManager.keyHashIndex.construct();
+    uint64_t version0, version1;
+    ramcloud->write(1, "678910", 6, "ghijkl", 6, NULL, &version1, false);
+    ramcloud->write(1, "012345", 6, "abcdef", 6, NULL, &version0, false);
+
+    // (tableId = 1, key = "012345") hashes to 0x7fc19e9dda158f61
+    // (tableId = 1, key = "678910") hashes to 0xb1e38b2242e1bbf4
+
+    // Objects come back in key hash order.
+    Buffer iter, nextIter, finalIter, objects;
+    uint64_t nextTabletStartHash;
+    EnumerateTableRpc rpc(ramcloud.get(), 1, 0, iter, objects);
+    nextTabletStartHash = rpc.wait(nextIter);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(84U, objects.getTotalLength());
+    Buffer buffer1;
+    buffer1.append(objects.getRange(4, 38), 38);
+    Object object1(buffer1);
+    EXPECT_EQ(0, memcmp("012345", object1.getKey(), 6));
+    Buffer buffer2;
+    buffer2.append(objects.getRange(46, 38), 38);
+    Object object2(buffer2);
+    EXPECT_EQ(0, memcmp("678910", object2.getKey(), 6));
+
+    EnumerateTableRpc rpc2(ramcloud.get(), 1, nextTabletStartHash, nextIter,
+                           objects);
+    nextTabletStartHash = rpc2.wait(finalIter);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(0U, objects.getTotalLength());
+
+    // Frames left by a master that enumerates by bucket still filter out
+    // objects already returned (see enumeration_mergeTablet).
+    iter.reset();
+    EnumerationIterator initialIter(iter, 0, 0);
+    EnumerationIterator::Frame preMergeConfiguration(
+        0x0000000000000000LLU, 0x8fffffffffffffffLLU,
+        service->objectManager.objectMap.getNumBuckets(),
+        service->objectManager.objectMap.getNumBuckets()*4/5, 0U);
+    initialIter.push(preMergeConfiguration);
+    initialIter.serialize(iter);
+    EnumerateTableRpc rpc3(ramcloud.get(), 1, 0, iter, objects);
+    nextTabletStartHash = rpc3.wait(nextIter);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(42U, objects.getTotalLength());
+    Buffer buffer3;
+    buffer3.append(objects.getRange(4, 38), 38);
+    Object object3(buffer3);
+    EXPECT_EQ(0, memcmp("678910", object3.getKey(), 6));
+}
+
+TEST_F(MasterServiceTest, scan_basics) {
+    service->objectManager.orderedKeyIndex.construct();
+    ramcloud->write(1, "678910", 6, "ghijkl", 6);
+    ramcloud->write(1, "012345", 6, "abcdef", 6);
+    ramcloud->write(1, "999999", 6, "mnopqr", 6);
+
+    // Objects come back in key order, stopping before the end key.
+    Buffer state, objects;
+    uint64_t nextTabletStartHash = ramcloud->scanTable(1, 0, "0", 1,
+            "9", 1, state, objects);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(0U, state.getTotalLength());
+    EXPECT_EQ(84U, objects.getTotalLength());
+    EXPECT_EQ(38U, *objects.getOffset<uint32_t>(0));
+    Buffer buffer1;
+    buffer1.append(objects.getRange(4, 38), 38);
+    Object object1(buffer1);
+    EXPECT_EQ(0, memcmp("012345", object1.getKey(), 6));
+    Buffer buffer2;
+    buffer2.append(objects.getRange(46, 38), 38);
+    Object object2(buffer2);
+    EXPECT_EQ(0, memcmp("678910", object2.getKey(), 6));
+
+    // No upper bound.
+    nextTabletStartHash = ramcloud->scanTable(1, 0, "6", 1, "", 0,
+            state, objects);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(84U, objects.getTotalLength());
+}
+
+TEST_F(MasterServiceTest, scan_continuation) {
+    service->objectManager.orderedKeyIndex.construct();
+    ramcloud->write(1, "012345", 6, "abcdef", 6);
+    ramcloud->write(1, "678910", 6, "ghijkl", 6);
+
+    // Resume from a key returned by an earlier (full) response.
+    Buffer state, objects;
+    state.append("5", 1);
+    ScanTableRpc rpc(ramcloud.get(), 1, 0, "0", 1, "", 0, state, objects);
+    uint64_t nextTabletStartHash = rpc.wait(state);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(0U, state.getTotalLength());
+    EXPECT_EQ(42U, objects.getTotalLength());
+    Buffer buffer1;
+    buffer1.append(objects.getRange(4, 38), 38);
+    Object object1(buffer1);
+    EXPECT_EQ(0, memcmp("678910", object1.getKey(), 6));
+}
+
+TEST_F(MasterServiceTest, scan_noIndex) {
+    Buffer state, objects;
+    EXPECT_THROW(ramcloud->scanTable(1, 0, "", 0, "", 0, state, objects),
+                 UnimplementedRequestError);
+}
+
+TEST_F(MasterServiceTest, scan_tableNotOnServer) {
+    TestLog::Enable _;
+    Buffer state, objects;
+    ScanTableRpc rpc(ramcloud.get(), 99, 0, "", 0, "", 0, state, objects);
+    EXPECT_THROW(rpc.wait(state), TableDoesntExistException);
+}
+
 TEST_F(MasterServiceTest, read_basics) {
     ramcloud->write(1, "0", 1, "abcdef", 6);
     Buffer value;
@@ -498,6 +612,91 @@ TEST_F(MasterServiceTest, read_rejectRules) {
     EXPECT_EQ(1U, version);
 }
 
+TEST_F(MasterServiceTest, dispatchInline_read) {
+    ramcloud->write(1, "0", 1, "abcdef", 6);
+    Buffer request, reply;
+    WireFormat::Read::Request* reqHdr =
+        new(&request, APPEND) WireFormat::Read::Request;
+    memset(reqHdr, 0, sizeof(*reqHdr));
+    reqHdr->common.opcode = WireFormat::READ;
+    reqHdr->common.service = WireFormat::MASTER_SERVICE;
+    reqHdr->tableId = 1;
+    reqHdr->keyLength = 1;
+    request.append("0", 1);
+    Service::Rpc rpc(NULL, &request, &reply);
+
+    // Disabled by default.
+    EXPECT_FALSE(service->dispatchInline(WireFormat::READ, &rpc));
+
+    // Object too large.
+    ServerConfig* config = const_cast<ServerConfig*>(service->config);
+    config->master.maxInlineReadBytes = 5;
+    EXPECT_FALSE(service->dispatchInline(WireFormat::READ, &rpc));
+    EXPECT_EQ(0U, reply.getTotalLength());
+
+    // Bucket locked by someone else.
+    config->master.maxInlineReadBytes = 6;
+    Key key(1, "0", 1);
+    {
+        ObjectManager::HashTableBucketLock lock(service->objectManager, key);
+        EXPECT_FALSE(service->dispatchInline(WireFormat::READ, &rpc));
+    }
+
+    EXPECT_TRUE(service->dispatchInline(WireFormat::READ, &rpc));
+    const WireFormat::Read::Response* respHdr =
+        reply.getStart<WireFormat::Read::Response>();
+    EXPECT_EQ(STATUS_OK, respHdr->common.status);
+    EXPECT_EQ(1U, respHdr->version);
+    EXPECT_EQ(6U, respHdr->length);
+    EXPECT_EQ("abcdef", TestUtil::toString(&reply, sizeof32(*respHdr),
+                                           respHdr->length));
+    config->master.maxInlineReadBytes = 0;
+}
+
+TEST_F(MasterServiceTest, dispatchInline_multiRead) {
+    ramcloud->write(1, "0", 1, "abc", 3);
+    ramcloud->write(1, "1", 1, "abcdefgh", 8);
+    Buffer request, reply;
+    WireFormat::MultiOp::Request* reqHdr =
+        new(&request, APPEND) WireFormat::MultiOp::Request;
+    memset(reqHdr, 0, sizeof(*reqHdr));
+    reqHdr->common.opcode = WireFormat::MULTI_OP;
+    reqHdr->common.service = WireFormat::MASTER_SERVICE;
+    reqHdr->type = WireFormat::MultiOp::OpType::READ;
+    reqHdr->count = 2;
+    new(&request, APPEND) WireFormat::MultiOp::Request::ReadPart(1, 1);
+    request.append("0", 1);
+    new(&request, APPEND) WireFormat::MultiOp::Request::ReadPart(1, 1);
+    request.append("1", 1);
+    Service::Rpc rpc(NULL, &request, &reply);
+
+    // The second object is too large, so a worker must do the whole thing.
+    ServerConfig* config = const_cast<ServerConfig*>(service->config);
+    config->master.maxInlineReadBytes = 4;
+    EXPECT_FALSE(service->dispatchInline(WireFormat::MULTI_OP, &rpc));
+    EXPECT_EQ(0U, reply.getTotalLength());
+
+    config->master.maxInlineReadBytes = 8;
+    EXPECT_TRUE(service->dispatchInline(WireFormat::MULTI_OP, &rpc));
+    const WireFormat::MultiOp::Response* respHdr =
+        reply.getStart<WireFormat::MultiOp::Response>();
+    EXPECT_EQ(STATUS_OK, respHdr->common.status);
+    EXPECT_EQ(2U, respHdr->count);
+    uint32_t offset = sizeof32(*respHdr);
+    const WireFormat::MultiOp::Response::ReadPart* part =
+        reply.getOffset<WireFormat::MultiOp::Response::ReadPart>(offset);
+    EXPECT_EQ(STATUS_OK, part->status);
+    EXPECT_EQ(3U, part->length);
+    offset += sizeof32(*part);
+    EXPECT_EQ("abc", TestUtil::toString(&reply, offset, part->length));
+    offset += part->length;
+    part = reply.getOffset<WireFormat::MultiOp::Response::ReadPart>(offset);
+    EXPECT_EQ(STATUS_OK, part->status);
+    EXPECT_EQ(2U, part->version);
+    EXPECT_EQ(8U, part->length);
+    config->master.maxInlineReadBytes = 0;
+}
+
 TEST_F(MasterServiceTest, multiRead_basics) {
     uint64_t tableId1 = ramcloud->createTable("table1");
     ramcloud->write(tableId1, "0", 1, "firstVal", 8);
@@ -1157,6 +1356,40 @@ TEST_F(MasterServiceTest, GetServerStatistics) {
 }
 
 
+TEST_F(MasterServiceTest, GetServerStatistics_migration) {
+    MasterService::MigrationProgress progress(1, 2, 3, ServerId(4, 0));
+    progress.phase = "catching up";
+    progress.scanProgress = 1.0;
+    progress.objectsSent = 5;
+    progress.tombstonesSent = 6;
+    progress.bytesSent = 7;
+    progress.segmentsSent = 8;
+    service->activeMigrations.push_back(&progress);
+
+    ProtoBuf::ServerStatistics serverStats;
+    ramcloud->getServerStatistics("mock:host=master", serverStats);
+    service->activeMigrations.clear();
+
+    ASSERT_EQ(1, serverStats.migration_size());
+    const ProtoBuf::ServerStatistics_Migration& migration =
+        serverStats.migration(0);
+    EXPECT_EQ(1U, migration.table_id());
+    EXPECT_EQ(2U, migration.start_key_hash());
+    EXPECT_EQ(3U, migration.end_key_hash());
+    EXPECT_EQ(ServerId(4, 0).getId(), migration.new_owner_id());
+    EXPECT_EQ("catching up", migration.phase());
+    EXPECT_EQ(1.0, migration.progress());
+    EXPECT_EQ(5U, migration.objects_sent());
+    EXPECT_EQ(6U, migration.tombstones_sent());
+    EXPECT_EQ(7U, migration.bytes_sent());
+    EXPECT_EQ(8U, migration.segments_sent());
+    EXPECT_LT(0, migration.elapsed_seconds());
+    EXPECT_LT(0, migration.bytes_per_second());
+
+    ramcloud->getServerStatistics("mock:host=master", serverStats);
+    EXPECT_EQ(0, serverStats.migration_size());
+}
+
 TEST_F(MasterServiceTest, splitMasterTablet) {
 
     MasterClient::splitMasterTablet(&context, masterServer->serverId, 1,
@@ -1405,7 +1638,6 @@ TEST_F(MasterServiceTest, migrateTablet_movingData) {
     ramcloud->migrateTablet(tbl, 0, -1, master2->serverId);
     EXPECT_EQ("migrateTablet: Migrating tablet [0x0,0xffffffffffffffff] "
         "in tableId 1 to server 3.0 at mock:host=master2 | "
-        "migrateTablet: Sending last migration segment | "
         "migrateTablet: Migration succeeded for tablet "
         "[0x0,0xffffffffffffffff] in tableId 1; sent 1 objects and "
         "0 tombstones to server 3.0 at mock:host=master2, 35 bytes in total",
@@ -1425,6 +1657,60 @@ TEST_F(MasterServiceTest, migrateTablet_movingData) {
     EXPECT_LT(ctimeCoord, master2HeadPositionAfter);
 }
 
+// Table whose object "hi" deleteAndCleanDuringMigration deletes.
+static uint64_t deletedDuringMigrationTableId;
+
+// Used as MasterService::migrateTabletCatchUpHook: deletes an object the
+// migration has already copied, then cleans the log twice, first freeing
+// the segment the object was in and then relocating its tombstone.
+static void
+deleteAndCleanDuringMigration(MasterService* service)
+{
+    ObjectManager& objectManager = service->objectManager;
+    SegmentManager& segmentManager = objectManager.segmentManager;
+    Log& log = objectManager.log;
+    LogCleaner* cleaner = log.cleaner;
+
+    Key key(deletedDuringMigrationTableId, "hi", 2);
+    EXPECT_EQ(STATUS_OK, objectManager.removeObject(key, NULL, NULL));
+    log.sync();
+
+    for (int pass = 0; pass < 2; pass++) {
+        segmentManager.cleanableSegments(cleaner->candidates);
+        cleaner->doDiskCleaning(false);
+        log.rollHeadOver();
+        segmentManager.freeUnreferencedSegments();
+    }
+}
+
+TEST_F(MasterServiceTest, migrateTablet_deleteCleanedDuringMigration) {
+    ramcloud->createTable("migrationTable");
+    uint64_t tbl = ramcloud->getTableId("migrationTable");
+    ramcloud->write(tbl, "hi", 2, "abcdefg", 7);
+
+    ServerConfig master2Config = masterConfig;
+    master2Config.master.numReplicas = 0;
+    master2Config.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(master2Config);
+    master2->master->objectManager.log.sync();
+
+    // The object is copied, then deleted and cleaned out of the log before
+    // the catch-up pass; its tombstone must still reach the new owner.
+    deletedDuringMigrationTableId = tbl;
+    MasterService::migrateTabletCatchUpHook = deleteAndCleanDuringMigration;
+    TestLog::Enable _(migrateTabletFilter);
+    ramcloud->migrateTablet(tbl, 0, -1, master2->serverId);
+    MasterService::migrateTabletCatchUpHook = NULL;
+    EXPECT_TRUE(TestUtil::matchesPosixRegex(
+        "sent 1 objects and 1 tombstones", TestLog::get()));
+
+    Key key(tbl, "hi", 2);
+    Buffer value;
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST,
+              master2->master->objectManager.readObject(key, &value, NULL,
+                                                        NULL));
+}
+
 static bool
 receiveMigrationDataFilter(string s)
 {
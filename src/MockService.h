@@ -30,7 +30,7 @@ class MockService : public Service {
   public:
 
     explicit MockService(int threadLimit = 3) : mutex(), log(),
-            gate(0), sendReply(false),
+            gate(0), sendReply(false), handleInline(false),
             threadLimit(threadLimit) { }
     virtual ~MockService() {}
     virtual void dispatch(WireFormat::Opcode opcode, Rpc* rpc)
@@ -73,6 +73,13 @@ class MockService : public Service {
         // requests, in the hopes of flushing out any timing problems.
         usleep(downCast<uint32_t>(generateRandom() & 0x3f));
     }
+    virtual bool dispatchInline(WireFormat::Opcode opcode, Rpc* rpc)
+    {
+        if (!handleInline)
+            return false;
+        *(new(rpc->replyPayload, APPEND) int32_t) = 99;
+        return true;
+    }
     virtual int maxThreads() {
         return threadLimit;
     }
@@ -96,6 +103,10 @@ class MockService : public Service {
     /// invoke sendReply before returning.
     bool sendReply;
 
+    /// The following variable may be set to true to cause the service to
+    /// complete every request offered to dispatchInline (the reply is 99).
+    bool handleInline;
+
     /// Return value from maxThreads.
     int threadLimit;
 
@@ -96,6 +96,8 @@ MultiOp::MultiOp(RamCloud* ramcloud, WireFormat::MultiOp::OpType type,
     , canceled(false)
     , workQueue()
     , startIndex(0)
+    , maxPartRpcBytes(DEFAULT_PART_RPC_BYTES)
+    , responseBytesPerObject(0)
     , test_ignoreBufferOverflow(false)
 {
     workQueue.reserve(numRequests);
@@ -244,12 +246,19 @@ MultiOp::startRpcs()
                         continue;
                     }
 
-                    rpc->requests[rpc->reqHdr->count] = request;
+                    rpc->requests.push_back(request);
                     rpc->reqHdr->count++;
+                    rpc->expectedResponseLength += responseBytesPerObject;
                     request->status = UNDERWAY;
                     removeRequestAt(i);
 
-                    if (rpc->reqHdr->count == PartRpc::MAX_OBJECTS_PER_RPC) {
+                    // Send the RPC once it is full, so that later objects
+                    // for this master go in another RPC that can be
+                    // outstanding at the same time.
+                    if (rpc->reqHdr->count == PartRpc::MAX_OBJECTS_PER_RPC
+                            || lengthAfter >= maxPartRpcBytes
+                            || rpc->expectedResponseLength >=
+                               maxPartRpcBytes) {
                         activeRpcCnt++;
                         rpc->send();
                     }
@@ -373,6 +382,13 @@ MultiOp::finishRpc(MultiOp::PartRpc* rpc) {
         }
     }
 
+    // Remember how large responses are, so that later part RPCs can be
+    // sized to the byte budget.
+    if (i > 0) {
+        responseBytesPerObject = (respOffset -
+                sizeof32(WireFormat::MultiOp::Response)) / i;
+    }
+
     // When we get here, it's possible that we aborted part way through
     // because we hit the end of the buffer. For all objects we haven't
     // currently processed, reset their statuses to indicate that these
@@ -458,6 +474,7 @@ MultiOp::PartRpc::PartRpc(RamCloud* ramcloud,
     , ramcloud(ramcloud)
     , session(session)
     , requests()
+    , expectedResponseLength(0)
     , reqHdr(allocHeader<WireFormat::MultiOp>())
 {
     reqHdr->type = type;
@@ -86,14 +86,23 @@ class MultiOp {
         /// Session that will be used to transmit the RPC.
         Transport::SessionRef session;
 
-        /// Information about all of the objects that are being requested
-        /// in this RPC.
+        /// Upper limit on the number of objects in a single RPC. Normally
+        /// the byte budget (MultiOp::maxPartRpcBytes) fills an RPC first;
+        /// this just bounds the work a master does for one RPC when objects
+        /// are tiny.
 #ifdef TESTING
         static const uint32_t MAX_OBJECTS_PER_RPC = 3;
 #else
-        static const uint32_t MAX_OBJECTS_PER_RPC = 75;
+        static const uint32_t MAX_OBJECTS_PER_RPC = 1000;
 #endif
-        MultiOpObject* requests[MAX_OBJECTS_PER_RPC];
+
+        /// Information about all of the objects that are being requested
+        /// in this RPC.
+        vector<MultiOpObject*> requests;
+
+        /// Number of bytes we expect the response to this RPC to contain,
+        /// based on the sizes of responses seen so far in this MultiOp.
+        uint32_t expectedResponseLength;
 
         /// Header for the RPC (used to update count as objects are added).
         WireFormat::MultiOp::Request* reqHdr;
@@ -118,6 +127,12 @@ class MultiOp {
     static const uint32_t maxRequestSize = Transport::MAX_RPC_LEN -
                                         sizeof(WireFormat::MultiOp::Request);
 
+    /// Default value for #maxPartRpcBytes. Part RPCs are kept well below the
+    /// maximum RPC size so that several can be outstanding to each master:
+    /// the master can work on one while the next is on the wire, and the
+    /// results of each are consumed as soon as it returns.
+    static const uint32_t DEFAULT_PART_RPC_BYTES = Transport::MAX_RPC_LEN / 8;
+
     /// Overall client state information.
     RamCloud* ramcloud;
 
@@ -151,6 +166,15 @@ class MultiOp {
     /// Marks the start of unfinished requests in requestIndecies.
     uint32_t startIndex;
 
+    /// A part RPC is sent as soon as either its request or its expected
+    /// response reaches this many bytes.
+    uint32_t maxPartRpcBytes;
+
+    /// Average number of response bytes per object in the most recently
+    /// completed part RPC; used to predict how large the response to a new
+    /// part RPC will be. Zero means no response has been seen yet.
+    uint32_t responseBytesPerObject;
+
     /// Used for tests only. True = ignores buffer size checking in finishRpc.
     /// Needed since test responses don't put anything in the response buffer.
     bool test_ignoreBufferOverflow;
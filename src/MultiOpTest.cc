@@ -143,6 +143,7 @@ class MultiOpTest : public ::testing::Test {
         uint32_t appendSize;
         uint32_t appendCalls;   // num times appendRequest has been called
         uint32_t readCalls;     // num times readResponse has been called
+        uint32_t responseSize;  // bytes each readResponse call consumes
 
         // Encodes what to return for bool and status in readResponse().
         // Returns false and STATUS_OK if empty.
@@ -157,6 +158,7 @@ class MultiOpTest : public ::testing::Test {
               , appendSize(appendSize)
               , appendCalls(0)
               , readCalls(0)
+              , responseSize(0)
               , missingDataInResponse()
               , returnStatuses()
         {
@@ -180,6 +182,7 @@ class MultiOpTest : public ::testing::Test {
         {
             TEST_LOG("read response at %u ", *respOffset);
             readCalls++;
+            *respOffset += responseSize;
 
             if (!returnStatuses.empty()) {
                 request->status = returnStatuses.front();
@@ -377,6 +380,40 @@ TEST_F(MultiOpTest, startRpcs_largeAppends) {
     EXPECT_EQ(STATUS_OK, requests[1]->status);
 }
 
+TEST_F(MultiOpTest, startRpcs_requestByteBudget) {
+    MultiOpObject* requests[] = {&objects[0], &objects[1]};
+
+    // Each RPC fills its byte budget with a single request, so the second
+    // request goes in a second RPC to the same master.
+    MultiOpTester request(ramcloud.get(), requests, 0, 100);
+    request.maxPartRpcBytes = 100;
+    request.workQueue.assign(requests, requests + 2);
+    request.numRequests = 2;
+    EXPECT_FALSE(request.startRpcs());
+    EXPECT_EQ("mock:host=master1(1) mock:host=master1(1)", rpcStatus(request));
+
+    request.wait();
+    EXPECT_EQ(STATUS_OK, requests[0]->status);
+    EXPECT_EQ(STATUS_OK, requests[1]->status);
+}
+
+TEST_F(MultiOpTest, startRpcs_responseByteBudget) {
+    MultiOpObject* requests[] = {&objects[0], &objects[1], &objects[2]};
+
+    // Responses are expected to hold 60 bytes per object, so only two
+    // objects fit in the first RPC.
+    MultiOpTester request(ramcloud.get(), requests, 0);
+    request.maxPartRpcBytes = 100;
+    request.responseBytesPerObject = 60;
+    request.workQueue.assign(requests, requests + 3);
+    request.numRequests = 3;
+    EXPECT_FALSE(request.startRpcs());
+    EXPECT_EQ("mock:host=master1(2) mock:host=master1(1)", rpcStatus(request));
+    EXPECT_EQ(120U, request.rpcs[0]->expectedResponseLength);
+    EXPECT_EQ(60U, request.rpcs[1]->expectedResponseLength);
+    request.wait();
+}
+
 TEST_F(MultiOpTest, startRpcs_requestTooLarge) {
     MultiOpObject* requests[] = {&objects[0]};
 
@@ -541,6 +578,18 @@ bool finishRpcFlushFilter(string s) {
 }
 }
 
+TEST_F(MultiOpTest, PartRpc_finish_recordsResponseSize) {
+    MultiOpObject* requests[] = {&objects[0], &objects[1]};
+    session1->dontNotify = true;
+    MultiOpTester request(ramcloud.get(), requests, 2);
+    EXPECT_EQ(0U, request.responseBytesPerObject);
+
+    request.responseSize = 40;
+    session1->lastNotifier->completed();
+    EXPECT_TRUE(request.isReady());
+    EXPECT_EQ(40U, request.responseBytesPerObject);
+}
+
 TEST_F(MultiOpTest, PartRpc_unknownTable) {
     TestLog::Enable _(finishRpcFlushFilter);
     MultiOpObject* requests[] = {&objects[0], &objects[1],
@@ -13,6 +13,9 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <algorithm>
+#include <set>
+
 #include "Cycles.h"
 #include "ObjectFinder.h"
 #include "ShortMacros.h"
@@ -35,6 +38,12 @@ class RealTabletMapFetcher : public ObjectFinder::TabletMapFetcher {
     void getTabletMap(ProtoBuf::Tablets& tabletMap) {
         CoordinatorClient::getTabletMap(context, &tabletMap);
     }
+    void getTabletMapUpdate(uint64_t generation, uint64_t sinceVersion,
+                            uint64_t tableId,
+                            CoordinatorClient::TabletMapUpdate& update) {
+        CoordinatorClient::getTabletMapUpdate(context, generation,
+                                              sinceVersion, tableId, &update);
+    }
   private:
     Context* context;
 
@@ -51,10 +60,38 @@ class RealTabletMapFetcher : public ObjectFinder::TabletMapFetcher {
 ObjectFinder::ObjectFinder(Context* context)
     : context(context)
     , tabletMap()
+    , tabletMapGeneration(0)
+    , tabletMapVersion(0)
+    , haveFullMap(false)
+    , tabletMapStale(false)
+    , tabletIndex()
     , tabletMapFetcher(new RealTabletMapFetcher(context))
 {
 }
 
+/**
+ * Constructor that fetches tablet maps from somewhere other than the
+ * coordinator (used by benchmarks that need a large, synthetic tablet map).
+ * \param context
+ *      Overall information about this client.
+ * \param tabletMapFetcher
+ *      Used to fetch the tablet map whenever the cache must be refreshed.
+ *      The ObjectFinder takes ownership of this object and deletes it
+ *      when the ObjectFinder is destroyed.
+ */
+ObjectFinder::ObjectFinder(Context* context,
+                           TabletMapFetcher* tabletMapFetcher)
+    : context(context)
+    , tabletMap()
+    , tabletMapGeneration(0)
+    , tabletMapVersion(0)
+    , haveFullMap(false)
+    , tabletMapStale(false)
+    , tabletIndex()
+    , tabletMapFetcher(tabletMapFetcher)
+{
+}
+
 /**
  * Lookup the master for a particular key in a given table.
  *
@@ -128,20 +165,28 @@ ObjectFinder::lookupTablet(uint64_t table, KeyHash keyHash)
     * to spin until it is recovered.
     */
     bool haveRefreshed = false;
+    if (tabletMapStale) {
+        // Doesn't count as a refresh: if the table isn't cached this only
+        // brings the rest of the map up to date.
+        refreshTabletMap(table);
+    }
     while (true) {
-        foreach (const ProtoBuf::Tablets::Tablet& tablet, tabletMap.tablet()) {
-            if (tablet.table_id() == table &&
-                tablet.start_key_hash() <= keyHash &&
-                keyHash <= tablet.end_key_hash()) {
-                if (tablet.state() == ProtoBuf::Tablets_Tablet_State_NORMAL) {
-                    // TODO(ongaro): add cache
+        // Find the last tablet in the index that starts at or before
+        // (table, keyHash); it's the only one that could contain keyHash.
+        TabletIndexEntry probe = {table, keyHash, 0, NULL};
+        std::vector<TabletIndexEntry>::const_iterator it =
+            std::upper_bound(tabletIndex.begin(), tabletIndex.end(), probe);
+        if (it != tabletIndex.begin()) {
+            --it;
+            if (it->tableId == table && keyHash <= it->endKeyHash) {
+                const ProtoBuf::Tablets::Tablet& tablet = *it->tablet;
+                if (tablet.state() == ProtoBuf::Tablets_Tablet_State_NORMAL)
                     return tablet;
-                } else {
-                    // tablet is recovering or something, try again
-                    if (haveRefreshed)
-                        usleep(10000);
-                    goto refresh_and_retry;
-                }
+
+                // tablet is recovering or something, try again
+                if (haveRefreshed)
+                    usleep(10000);
+                goto refresh_and_retry;
             }
         }
         // tablet not found in local tablet map cache
@@ -149,7 +194,7 @@ ObjectFinder::lookupTablet(uint64_t table, KeyHash keyHash)
             throw TableDoesntExistException(HERE);
         }
         refresh_and_retry:
-        tabletMapFetcher->getTabletMap(tabletMap);
+        refreshTabletMap(table);
         haveRefreshed = true;
     }
 }
@@ -167,13 +212,13 @@ ObjectFinder::waitForTabletDown()
     flush();
 
     for (;;) {
+        refreshTabletMap();
         foreach (const ProtoBuf::Tablets::Tablet& tablet, tabletMap.tablet()) {
             if (tablet.state() != ProtoBuf::Tablets_Tablet_State_NORMAL) {
                 return;
             }
         }
         usleep(200);
-        tabletMapFetcher->getTabletMap(tabletMap);
     }
 }
 
@@ -191,6 +236,7 @@ ObjectFinder::waitForAllTabletsNormal(uint64_t timeoutNs)
 
     uint64_t start = Cycles::rdtsc();
     while (Cycles::toNanoseconds(Cycles::rdtsc() - start) < timeoutNs) {
+        refreshTabletMap();
         bool allNormal = true;
         foreach (const ProtoBuf::Tablets::Tablet& tablet, tabletMap.tablet()) {
             if (tablet.state() != ProtoBuf::Tablets_Tablet_State_NORMAL) {
@@ -201,8 +247,93 @@ ObjectFinder::waitForAllTabletsNormal(uint64_t timeoutNs)
         if (allNormal && tabletMap.tablet_size() > 0)
             return;
         usleep(200);
-        tabletMapFetcher->getTabletMap(tabletMap);
     }
 }
 
+/**
+ * Bring the cached tablet map up to date and rebuild #tabletIndex from it.
+ * All lookups go through the index, so this must be used instead of
+ * calling tabletMapFetcher directly.
+ *
+ * If the cached map is versioned only the tables that changed since its
+ * version are fetched. To avoid pulling the whole map from the coordinator
+ * just to look up one key, a lookup in a table that isn't cached fetches
+ * only the tablets of that table; the first such fetch also makes the
+ * cached map versioned, so later refreshes can fetch deltas. Deltas only
+ * bring the cached tables up to date, so a caller that asks for the whole
+ * map gets it in full unless the cache already holds every table.
+ *
+ * \param tableId
+ *      The table a lookup needs, or WireFormat::GetTabletMap::ALL_TABLES
+ *      if the caller needs every table.
+ */
+void
+ObjectFinder::refreshTabletMap(uint64_t tableId)
+{
+    uint64_t sinceVersion = tabletMapVersion;
+    if (tableId == WireFormat::GetTabletMap::ALL_TABLES) {
+        if (!haveFullMap)
+            sinceVersion = 0;
+    } else if (tabletMapVersion != 0 &&
+               (tabletMapStale || haveTable(tableId))) {
+        tableId = WireFormat::GetTabletMap::ALL_TABLES;
+    }
+
+    CoordinatorClient::TabletMapUpdate update;
+    tabletMapFetcher->getTabletMapUpdate(tabletMapGeneration,
+                                         sinceVersion, tableId, update);
+    tabletIndex.clear();
+    if (update.fullMap) {
+        tabletMap.Swap(&update.tablets);
+    } else {
+        // Replace all the cached tablets of the tables that changed. If the
+        // coordinator's map is from a different generation nothing in the
+        // cache can be trusted.
+        std::set<uint64_t> changed(update.changedTables.begin(),
+                                   update.changedTables.end());
+        ProtoBuf::Tablets merged;
+        if (update.generation == tabletMapGeneration) {
+            foreach (const ProtoBuf::Tablets::Tablet& tablet,
+                     tabletMap.tablet()) {
+                if (changed.find(tablet.table_id()) == changed.end())
+                    *merged.add_tablet() = tablet;
+            }
+        }
+        merged.MergeFrom(update.tablets);
+        tabletMap.Swap(&merged);
+    }
+    if (update.fullMap)
+        haveFullMap = true;
+    else if (update.generation != tabletMapGeneration)
+        haveFullMap = false;
+    if (tableId == WireFormat::GetTabletMap::ALL_TABLES ||
+            update.generation != tabletMapGeneration) {
+        tabletMapGeneration = update.generation;
+        tabletMapVersion = update.version;
+    }
+    tabletMapStale = false;
+
+    tabletIndex.reserve(tabletMap.tablet_size());
+    foreach (const ProtoBuf::Tablets::Tablet& tablet, tabletMap.tablet()) {
+        TabletIndexEntry entry = {tablet.table_id(),
+                                  tablet.start_key_hash(),
+                                  tablet.end_key_hash(),
+                                  &tablet};
+        tabletIndex.push_back(entry);
+    }
+    std::sort(tabletIndex.begin(), tabletIndex.end());
+}
+
+/**
+ * Return true if #tabletIndex has any tablets of the given table.
+ */
+bool
+ObjectFinder::haveTable(uint64_t tableId) const
+{
+    TabletIndexEntry probe = {tableId, 0, 0, NULL};
+    std::vector<TabletIndexEntry>::const_iterator it =
+        std::lower_bound(tabletIndex.begin(), tabletIndex.end(), probe);
+    return it != tabletIndex.end() && it->tableId == tableId;
+}
+
 } // namespace RAMCloud
@@ -36,6 +36,7 @@ class ObjectFinder {
     class TabletMapFetcher; // forward declaration, see full declaration below
 
     explicit ObjectFinder(Context* context);
+    ObjectFinder(Context* context, TabletMapFetcher* tabletMapFetcher);
 
     Transport::SessionRef lookup(uint64_t table, const void* key,
                                  uint16_t keyLength);
@@ -44,11 +45,17 @@ class ObjectFinder {
                                                   KeyHash keyHash);
 
     /**
-     * Jettison all tablet map entries forcing a fetch of fresh mappings
-     * on subsequent lookups.
+     * Force a fetch of fresh mappings on subsequent lookups. If the cached
+     * tablet map is versioned, it is kept and just the changes to it are
+     * fetched on the next lookup; otherwise all its entries are jettisoned.
      */
     void flush() {
         RAMCLOUD_TEST_LOG("flushing object map");
+        if (tabletMapVersion != 0) {
+            tabletMapStale = true;
+            return;
+        }
+        tabletIndex.clear();
         tabletMap.Clear();
     }
 
@@ -56,6 +63,10 @@ class ObjectFinder {
     void waitForAllTabletsNormal(uint64_t timeoutNs = ~0lu);
 
   PRIVATE:
+    bool haveTable(uint64_t tableId) const;
+    void refreshTabletMap(
+            uint64_t tableId = WireFormat::GetTabletMap::ALL_TABLES);
+
     /**
      * Shared RAMCloud information.
      */
@@ -66,6 +77,69 @@ class ObjectFinder {
      */
     ProtoBuf::Tablets tabletMap;
 
+    /**
+     * Generation of the coordinator's tablet map that #tabletMap came from.
+     * See TableManager::generation.
+     */
+    uint64_t tabletMapGeneration;
+
+    /**
+     * Version of the coordinator's tablet map that every tablet in
+     * #tabletMap is at least as recent as, or 0 if #tabletMap isn't
+     * versioned (it is empty, or the fetcher doesn't support versions).
+     * Refreshes only fetch the tables that changed after this version.
+     */
+    uint64_t tabletMapVersion;
+
+    /**
+     * True if #tabletMap has held every table since it was last fetched in
+     * full. Lookups fetch just the tables they need, and deltas only cover
+     * the tables already cached, so callers that need the whole map (see
+     * waitForAllTabletsNormal()) must fetch it in full while this is false.
+     */
+    bool haveFullMap;
+
+    /**
+     * Set by flush() when #tabletMap is versioned: the map may be out of
+     * date, so the next lookup refreshes it before using it.
+     */
+    bool tabletMapStale;
+
+    /**
+     * One entry in #tabletIndex; describes the key hash range covered by
+     * a single tablet in #tabletMap.
+     */
+    struct TabletIndexEntry {
+        /// Table the tablet belongs to.
+        uint64_t tableId;
+
+        /// Lowest key hash covered by the tablet.
+        uint64_t startKeyHash;
+
+        /// Highest key hash covered by the tablet (inclusive).
+        uint64_t endKeyHash;
+
+        /// The tablet itself; points into #tabletMap.
+        const ProtoBuf::Tablets::Tablet* tablet;
+
+        bool
+        operator<(const TabletIndexEntry& other) const
+        {
+            if (tableId != other.tableId)
+                return tableId < other.tableId;
+            return startKeyHash < other.startKeyHash;
+        }
+    };
+
+    /**
+     * The tablets of #tabletMap sorted by (tableId, startKeyHash), so that
+     * lookupTablet() can find the tablet owning a key hash with a binary
+     * search instead of scanning the whole map. Rebuilt by
+     * refreshTabletMap() every time #tabletMap is fetched and cleared
+     * along with it in flush().
+     */
+    std::vector<TabletIndexEntry> tabletIndex;
+
     /**
      * Update the local tablet map cache. Usually, calling
      * tabletMapFetcher.getTabletMap() is the same as calling
@@ -86,6 +160,23 @@ class ObjectFinder::TabletMapFetcher {
     virtual ~TabletMapFetcher() {}
     /// See CoordinatorClient::getTabletMap.
     virtual void getTabletMap(ProtoBuf::Tablets& tabletMap) = 0;
+
+    /**
+     * See CoordinatorClient::getTabletMapUpdate. The default implementation
+     * is for fetchers that don't support versions: it always returns the
+     * full tablet map, unversioned.
+     */
+    virtual void getTabletMapUpdate(uint64_t generation,
+                                    uint64_t sinceVersion,
+                                    uint64_t tableId,
+                                    CoordinatorClient::TabletMapUpdate& update)
+    {
+        update.generation = 0;
+        update.version = 0;
+        update.fullMap = true;
+        update.changedTables.clear();
+        getTabletMap(update.tablets);
+    }
 };
 
 } // end RAMCloud
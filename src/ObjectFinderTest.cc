@@ -57,6 +57,73 @@ struct Refresher : public ObjectFinder::TabletMapFetcher {
     uint32_t called;
 };
 
+/**
+ * Returns a tablet map with several tablets per table, listed out of
+ * order, to exercise the sorted tablet index.
+ */
+struct SplitRefresher : public ObjectFinder::TabletMapFetcher {
+    SplitRefresher() : called(0) {}
+    void addTablet(ProtoBuf::Tablets& tabletMap, uint64_t tableId,
+                   uint64_t start, uint64_t end, const char* locator) {
+        ProtoBuf::Tablets_Tablet& tablet(*tabletMap.add_tablet());
+        tablet.set_table_id(tableId);
+        tablet.set_start_key_hash(start);
+        tablet.set_end_key_hash(end);
+        tablet.set_state(ProtoBuf::Tablets_Tablet_State_NORMAL);
+        tablet.set_service_locator(locator);
+    }
+    void getTabletMap(ProtoBuf::Tablets& tabletMap) {
+        called++;
+        tabletMap.clear_tablet();
+        addTablet(tabletMap, 2, 0, ~0UL, "mock:host=c");
+        addTablet(tabletMap, 1, 1000, ~0UL, "mock:host=b2");
+        addTablet(tabletMap, 1, 0, 99, "mock:host=b0");
+        addTablet(tabletMap, 1, 100, 999, "mock:host=b1");
+        addTablet(tabletMap, 0, 0, ~0UL, "mock:host=a");
+    }
+    uint32_t called;
+};
+
+/**
+ * Serves versioned updates to the tablet map: each call returns the next
+ * queued update and logs the arguments it was called with.
+ */
+struct VersionedRefresher : public ObjectFinder::TabletMapFetcher {
+    VersionedRefresher() : updates(), calls() {}
+    void getTabletMap(ProtoBuf::Tablets& tabletMap) {
+        FAIL();
+    }
+    void getTabletMapUpdate(uint64_t generation, uint64_t sinceVersion,
+                            uint64_t tableId,
+                            CoordinatorClient::TabletMapUpdate& update) {
+        calls += format("%s%lu %lu %ld", calls.empty() ? "" : " | ",
+                        generation, sinceVersion, tableId);
+        update = updates.front();
+        updates.pop_front();
+    }
+    void queue(uint64_t generation, uint64_t version, bool fullMap,
+               uint64_t changedTable, uint64_t tableId,
+               const char* locator) {
+        CoordinatorClient::TabletMapUpdate update;
+        update.generation = generation;
+        update.version = version;
+        update.fullMap = fullMap;
+        if (!fullMap)
+            update.changedTables.push_back(changedTable);
+        if (locator) {
+            ProtoBuf::Tablets_Tablet& tablet(*update.tablets.add_tablet());
+            tablet.set_table_id(tableId);
+            tablet.set_start_key_hash(0);
+            tablet.set_end_key_hash(~0UL);
+            tablet.set_state(ProtoBuf::Tablets_Tablet_State_NORMAL);
+            tablet.set_service_locator(locator);
+        }
+        updates.push_back(update);
+    }
+    std::deque<CoordinatorClient::TabletMapUpdate> updates;
+    string calls;
+};
+
 class ObjectFinderTest : public ::testing::Test {
   public:
     Context context;
@@ -119,4 +186,127 @@ TEST_F(ObjectFinderTest, lookup_hash) {
                 getServiceLocator());
 }
 
+TEST_F(ObjectFinderTest, lookupTablet_sortedIndex) {
+    SplitRefresher* splitRefresher = new SplitRefresher();
+    objectFinder->tabletMapFetcher.reset(splitRefresher);
+
+    EXPECT_EQ("mock:host=b0",
+              objectFinder->lookupTablet(1, 0).service_locator());
+    EXPECT_EQ("mock:host=b0",
+              objectFinder->lookupTablet(1, 99).service_locator());
+    EXPECT_EQ("mock:host=b1",
+              objectFinder->lookupTablet(1, 100).service_locator());
+    EXPECT_EQ("mock:host=b1",
+              objectFinder->lookupTablet(1, 999).service_locator());
+    EXPECT_EQ("mock:host=b2",
+              objectFinder->lookupTablet(1, ~0UL).service_locator());
+    EXPECT_EQ("mock:host=a",
+              objectFinder->lookupTablet(0, ~0UL).service_locator());
+    EXPECT_EQ("mock:host=c",
+              objectFinder->lookupTablet(2, 0).service_locator());
+    EXPECT_EQ(1U, splitRefresher->called);
+    EXPECT_EQ(5U, objectFinder->tabletIndex.size());
+
+    EXPECT_THROW(objectFinder->lookupTablet(3, 0),
+                 TableDoesntExistException);
+    EXPECT_EQ(2U, splitRefresher->called);
+
+    objectFinder->flush();
+    EXPECT_EQ(0U, objectFinder->tabletIndex.size());
+    EXPECT_EQ("mock:host=b1",
+              objectFinder->lookupTablet(1, 500).service_locator());
+    EXPECT_EQ(3U, splitRefresher->called);
+}
+
+TEST_F(ObjectFinderTest, lookupTablet_gapInTable) {
+    SplitRefresher* splitRefresher = new SplitRefresher();
+    objectFinder->tabletMapFetcher.reset(splitRefresher);
+    objectFinder->refreshTabletMap();
+    objectFinder->tabletMap.mutable_tablet(3)->set_end_key_hash(500);
+    objectFinder->tabletIndex[2].endKeyHash = 500;
+
+    // Key hash 600 falls between two tablets of table 1 in the cache, so
+    // the map is refetched (which fills the gap).
+    EXPECT_EQ("mock:host=b1",
+              objectFinder->lookupTablet(1, 600).service_locator());
+    EXPECT_EQ(2U, splitRefresher->called);
+}
+
+TEST_F(ObjectFinderTest, refreshTabletMap_versioned) {
+    VersionedRefresher* versioned = new VersionedRefresher();
+    objectFinder->tabletMapFetcher.reset(versioned);
+
+    // With no map, lookups fetch just the table they need.
+    versioned->queue(7, 5, false, 1, 1, "mock:host=a");
+    versioned->queue(7, 6, false, 2, 2, "mock:host=b");
+    EXPECT_EQ("mock:host=a",
+              objectFinder->lookupTablet(1, 0).service_locator());
+    EXPECT_EQ("mock:host=b",
+              objectFinder->lookupTablet(2, 0).service_locator());
+    EXPECT_EQ("0 0 1 | 7 5 2", versioned->calls);
+    EXPECT_EQ(5lu, objectFinder->tabletMapVersion);
+
+    // Flushing a versioned map keeps it, and the next lookup fetches only
+    // what changed.
+    versioned->calls = "";
+    objectFinder->flush();
+    EXPECT_EQ(2u, objectFinder->tabletIndex.size());
+    versioned->queue(7, 8, false, 1, 1, "mock:host=c");
+    EXPECT_EQ("mock:host=c",
+              objectFinder->lookupTablet(1, 0).service_locator());
+    EXPECT_EQ("mock:host=b",
+              objectFinder->lookupTablet(2, 0).service_locator());
+    EXPECT_EQ("7 5 -1", versioned->calls);
+    EXPECT_EQ(8lu, objectFinder->tabletMapVersion);
+
+    // A dropped table disappears from the cache.
+    versioned->calls = "";
+    versioned->queue(7, 9, false, 2, 2, NULL);
+    versioned->queue(7, 9, false, 2, 2, NULL);
+    objectFinder->flush();
+    EXPECT_THROW(objectFinder->lookupTablet(2, 0),
+                 TableDoesntExistException);
+    EXPECT_EQ("7 8 -1 | 7 9 2", versioned->calls);
+    EXPECT_EQ(1u, objectFinder->tabletIndex.size());
+
+    // A full map replaces everything.
+    versioned->calls = "";
+    versioned->queue(3, 1, true, 0, 4, "mock:host=d");
+    objectFinder->refreshTabletMap();
+    EXPECT_EQ(1u, objectFinder->tabletIndex.size());
+    EXPECT_EQ("mock:host=d",
+              objectFinder->lookupTablet(4, 0).service_locator());
+    EXPECT_EQ(3lu, objectFinder->tabletMapGeneration);
+    EXPECT_EQ(1lu, objectFinder->tabletMapVersion);
+}
+
+TEST_F(ObjectFinderTest, refreshTabletMap_wholeMapAfterLookups) {
+    VersionedRefresher* versioned = new VersionedRefresher();
+    objectFinder->tabletMapFetcher.reset(versioned);
+
+    // A lookup fetches just its own table, but makes the map versioned.
+    versioned->queue(7, 5, false, 1, 1, "mock:host=a");
+    objectFinder->lookupTablet(1, 0);
+    EXPECT_FALSE(objectFinder->haveFullMap);
+
+    // Asking for the whole map then fetches it in full rather than a
+    // delta of the tables seen so far; after that, deltas will do.
+    versioned->calls = "";
+    versioned->queue(7, 6, true, 0, 2, "mock:host=b");
+    versioned->queue(7, 6, false, 2, 2, "mock:host=b");
+    objectFinder->refreshTabletMap();
+    EXPECT_TRUE(objectFinder->haveFullMap);
+    objectFinder->refreshTabletMap();
+    EXPECT_EQ("7 0 -1 | 7 6 -1", versioned->calls);
+
+    // A partial fetch from a new generation leaves only that table.
+    versioned->calls = "";
+    versioned->queue(8, 1, false, 3, 3, "mock:host=c");
+    versioned->queue(8, 2, true, 0, 3, "mock:host=c");
+    objectFinder->lookupTablet(3, 0);
+    EXPECT_FALSE(objectFinder->haveFullMap);
+    objectFinder->waitForAllTabletsNormal();
+    EXPECT_EQ("7 6 3 | 8 0 -1", versioned->calls);
+}
+
 }  // namespace RAMCloud
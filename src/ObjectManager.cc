@@ -18,6 +18,7 @@
 #include "Dispatch.h"
 #include "Enumeration.h"
 #include "EnumerationIterator.h"
+#include "Fence.h"
 #include "LogEntryRelocator.h"
 #include "ObjectManager.h"
 #include "ShortMacros.h"
@@ -66,11 +67,26 @@ ObjectManager::ObjectManager(Context* context,
     , objectMap(config->master.hashTableBytes / HashTable::bytesPerCacheLine())
     , anyWrites(false)
     , hashTableBucketLocks()
+    , tombstoneProtectorsLock("ObjectManager::tombstoneProtectorsLock")
+    , tombstoneProtectors()
     , replaySegmentReturnCount(0)
     , tombstoneRemover()
+    , hashTableResizer()
+    , tabletStatsReporter()
+    , keyHashIndex()
+    , orderedKeyIndex()
 {
     for (size_t i = 0; i < arrayLength(hashTableBucketLocks); i++)
         hashTableBucketLocks[i].setName("hashTableBucketLock");
+
+    if (config->master.hashTableMaxBytes != 0) {
+        hashTableResizer.construct(this, config->master.hashTableMaxBytes /
+                                         HashTable::bytesPerCacheLine());
+    }
+    if (config->master.useKeyHashIndex)
+        keyHashIndex.construct();
+    if (config->master.useOrderedKeyIndex)
+        orderedKeyIndex.construct();
 }
 
 /**
@@ -78,6 +94,8 @@ ObjectManager::ObjectManager(Context* context,
  */
 ObjectManager::~ObjectManager()
 {
+    if (hashTableResizer)
+        hashTableResizer->stop();
     replicaManager.haltFailureMonitor();
 }
 
@@ -98,8 +116,12 @@ ObjectManager::initOnceEnlisted()
     if (!config->master.disableLogCleaner)
         log.enableCleaner();
 
+    if (hashTableResizer)
+        hashTableResizer->start();
+
     Dispatch::Lock lock(context->dispatch);
     tombstoneRemover.construct(this, &objectMap);
+    tabletStatsReporter.construct(this);
 }
 
 /**
@@ -281,37 +303,117 @@ ObjectManager::readObject(Key& key,
                           uint64_t* outVersion)
 {
     HashTableBucketLock lock(*this, key);
+    Status status;
+    readObjectLocked(lock, key, ~0U, outBuffer, rejectRules, outVersion,
+                     &status);
+    return status;
+}
+
+/**
+ * Read an object, but only if that can be done without waiting for a bucket
+ * lock and the object's value is small. This is used to serve reads directly
+ * in the dispatch thread (see MasterService::dispatchInline); if it returns
+ * false the caller should use readObject() instead.
+ *
+ * \param key
+ *      Key of the object being read.
+ * \param maxLength
+ *      Give up if the object's value is longer than this many bytes.
+ * \param outBuffer
+ *      Buffer to populate with the value of the object, if found.
+ * \param rejectRules
+ *      If non-NULL, use the specified rules to perform a conditional read.
+ * \param outVersion
+ *      If non-NULL and the object is found, the version is returned here.
+ * \param[out] outStatus
+ *      If true is returned, the status readObject() would have returned.
+ *
+ * \return
+ *      True if the read was carried out; false if the object's bucket was
+ *      locked by another thread or its value is longer than maxLength.
+ */
+bool
+ObjectManager::tryReadSmallObject(Key& key,
+                                  uint32_t maxLength,
+                                  Buffer* outBuffer,
+                                  RejectRules* rejectRules,
+                                  uint64_t* outVersion,
+                                  Status* outStatus)
+{
+    HashTableBucketLock lock(*this, key, std::try_to_lock);
+    if (!lock.ownsLock())
+        return false;
+    return readObjectLocked(lock, key, maxLength, outBuffer, rejectRules,
+                            outVersion, outStatus);
+}
 
+/**
+ * Shared implementation of readObject() and tryReadSmallObject(). The
+ * caller must hold the bucket lock for the key.
+ *
+ * \param lock
+ *      The bucket lock for \a key, held by the caller.
+ * \param key
+ *      Key of the object being read.
+ * \param maxLength
+ *      Give up if the object's value is longer than this many bytes.
+ * \param outBuffer
+ *      Buffer to populate with the value of the object, if found.
+ * \param rejectRules
+ *      If non-NULL, use the specified rules to perform a conditional read.
+ * \param outVersion
+ *      If non-NULL and the object is found, the version is returned here.
+ * \param[out] outStatus
+ *      If true is returned, the status of the read.
+ * \return
+ *      False if the object's value is longer than maxLength (in which case
+ *      nothing has been done), otherwise true.
+ */
+bool
+ObjectManager::readObjectLocked(HashTableBucketLock& lock,
+                                Key& key,
+                                uint32_t maxLength,
+                                Buffer* outBuffer,
+                                RejectRules* rejectRules,
+                                uint64_t* outVersion,
+                                Status* outStatus)
+{
     // If the tablet doesn't exist in the NORMAL state, we must plead ignorance.
+    *outStatus = STATUS_UNKNOWN_TABLET;
     TabletManager::Tablet tablet;
     if (!tabletManager->getTablet(key, &tablet))
-        return STATUS_UNKNOWN_TABLET;
+        return true;
     if (tablet.state != TabletManager::NORMAL)
-        return STATUS_UNKNOWN_TABLET;
+        return true;
 
     Buffer buffer;
     LogEntryType type;
     uint64_t version;
     Log::Reference reference;
+    *outStatus = STATUS_OBJECT_DOESNT_EXIST;
     bool found = lookup(lock, key, type, buffer, &version, &reference);
     if (!found || type != LOG_ENTRY_TYPE_OBJ)
-        return STATUS_OBJECT_DOESNT_EXIST;
+        return true;
+
+    Object object(buffer);
+    if (object.getDataLength() > maxLength)
+        return false;
 
     if (outVersion != NULL)
         *outVersion = version;
 
     if (rejectRules != NULL) {
-        Status status = rejectOperation(rejectRules, version);
-        if (status != STATUS_OK)
-            return status;
+        *outStatus = rejectOperation(rejectRules, version);
+        if (*outStatus != STATUS_OK)
+            return true;
     }
 
-    Object object(buffer);
     object.appendDataToBuffer(*outBuffer);
 
     tabletManager->incrementReadCount(key);
 
-    return STATUS_OK;
+    *outStatus = STATUS_OK;
+    return true;
 }
 
 /**
@@ -436,6 +538,43 @@ ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
     }
 }
 
+/**
+ * Prepare for reading or writing a batch of objects (e.g. the objects named
+ * in a multi-read or multi-write) by pulling the hash table buckets for all
+ * of their keys, and then the log entries those buckets refer to, into the
+ * processor's caches. Looking up each object in turn would take two or three
+ * dependent cache misses per object; doing this first lets the misses for
+ * the whole batch overlap. Nothing is modified: the subsequent readObject()
+ * or writeObject() calls behave exactly as they otherwise would, only faster.
+ *
+ * \param keys
+ *      Keys of the objects that are about to be accessed.
+ * \param numKeys
+ *      Number of entries in \a keys; at most #MAX_PREFETCH_BATCH.
+ */
+void
+ObjectManager::prefetchObjects(Key* keys[], uint32_t numKeys)
+{
+    assert(numKeys <= MAX_PREFETCH_BATCH);
+
+    // Computing a bucket's address doesn't dereference the table, so all of
+    // the buckets can be prefetched without locks.
+    for (uint32_t i = 0; i < numKeys; i++)
+        objectMap.prefetchBucket(*keys[i]);
+
+    // Walking a bucket's chain does, and an online resize may free chained
+    // cache lines or the old bucket array underneath us, so each bucket is
+    // examined only while holding its lock. The references found may still
+    // be stale by the time the entries are used; AbstractLog::prefetchEntry
+    // tolerates that.
+    for (uint32_t i = 0; i < numKeys; i++) {
+        HashTableBucketLock lock(*this, *keys[i]);
+        HashTable::Candidates candidates = objectMap.lookup(*keys[i]);
+        if (!candidates.isDone())
+            log.prefetchEntry(Log::Reference(candidates.getReference()));
+    }
+}
+
 /**
  * This class is used by replaySegment to increment the number of times that
  * that method returns, regardless of the return path. That counter is used
@@ -469,6 +608,63 @@ class DelayedIncrementer {
     DISALLOW_COPY_AND_ASSIGN(DelayedIncrementer);
 };
 
+/**
+ * This class is used by replaySegment to step a SegmentIterator either
+ * through every entry of a segment or, when the segment is being replayed
+ * by a ReplayThreadPool, through just the entries of one thread's slice.
+ */
+class ReplayCursor {
+  public:
+    /**
+     * \param it
+     *      Iterator to step; positioned on the first entry to replay.
+     * \param entryOffsets
+     *      Offsets of the entries to visit, in order, or NULL to visit
+     *      every entry starting from the iterator's current one.
+     */
+    ReplayCursor(SegmentIterator& it, const vector<uint32_t>* entryOffsets)
+        : it(it)
+        , entryOffsets(entryOffsets)
+        , position(0)
+    {
+        if (entryOffsets != NULL)
+            seekToPosition();
+    }
+
+    /**
+     * Move the iterator on to the next entry to replay.
+     */
+    void
+    next()
+    {
+        if (entryOffsets == NULL) {
+            it.next();
+            return;
+        }
+        position++;
+        seekToPosition();
+    }
+
+  PRIVATE:
+    void
+    seekToPosition()
+    {
+        it.seek(position < entryOffsets->size() ? (*entryOffsets)[position]
+                                                : ~0U);
+    }
+
+    /// The iterator being stepped.
+    SegmentIterator& it;
+
+    /// Offsets of the entries to visit, or NULL to visit them all.
+    const vector<uint32_t>* entryOffsets;
+
+    /// Index in #entryOffsets of the entry #it is on.
+    size_t position;
+
+    DISALLOW_COPY_AND_ASSIGN(ReplayCursor);
+};
+
 /**
  * Replay the entries within a segment and store the appropriate objects. 
  * This method is used during recovery to replay a portion of a failed
@@ -493,9 +689,14 @@ class DelayedIncrementer {
  * \param it
  *       SegmentIterator which is pointing to the start of the recovery segment
  *       to be replayed into the log.
+ * \param entryOffsets
+ *      If non-NULL, replay only the entries at these offsets in the segment
+ *      (one thread's slice; see ReplayThreadPool). The caller is then
+ *      responsible for keeping replication moving.
  */
 void
-ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it)
+ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
+                             const vector<uint32_t>* entryOffsets)
 {
     uint64_t startReplicationTicks = metrics->master.replicaManagerTicks;
     uint64_t startReplicationPostingWriteRpcTicks =
@@ -524,18 +725,21 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it)
         returnCountIncrementer(&replaySegmentReturnCount);
 
     SegmentIterator prefetcher = it;
-    prefetcher.next();
+    ReplayCursor prefetchCursor(prefetcher, entryOffsets);
+    prefetchCursor.next();
+    ReplayCursor cursor(it, entryOffsets);
 
     uint64_t bytesIterated = 0;
     while (expect_true(!it.isDone())) {
         prefetchHashTableBucket(&prefetcher);
-        prefetcher.next();
+        prefetchCursor.next();
 
         LogEntryType type = it.getType();
 
         if (bytesIterated > 50000) {
             bytesIterated = 0;
-            replicaManager.proceed();
+            if (entryOffsets == NULL)
+                replicaManager.proceed();
         }
         bytesIterated += it.getLength();
 
@@ -715,7 +919,7 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it)
             }
         }
 
-        it.next();
+        cursor.next();
     }
 
     metrics->master.backupInRecoverTicks +=
@@ -737,6 +941,161 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it)
     metrics->master.safeVersionNonRecoveryCount += safeVersionNonRecoveryCount;
 }
 
+/**
+ * Construct a ReplayThreadPool and start its threads.
+ *
+ * \param objectManager
+ *      The ObjectManager to replay segments into.
+ * \param sideLogs
+ *      One SideLog for each thread to replay into. All of them must be
+ *      committed before the replayed data is durable.
+ */
+ObjectManager::ReplayThreadPool::ReplayThreadPool(ObjectManager* objectManager,
+                                                  vector<SideLog*>& sideLogs)
+    : objectManager(objectManager)
+    , sideLogs(sideLogs)
+    , mutex()
+    , segmentReady()
+    , segment()
+    , segmentCount(0)
+    , slices(sideLogs.size())
+    , errors(sideLogs.size())
+    , slicesRemaining(0)
+    , stop(false)
+    , threads()
+{
+    for (uint32_t shard = 0; shard < sideLogs.size(); shard++)
+        threads.emplace_back(&ReplayThreadPool::workerMain, this, shard);
+}
+
+/**
+ * Stop the pool's threads. Must not be called while replaySegment() is
+ * running.
+ */
+ObjectManager::ReplayThreadPool::~ReplayThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        stop = true;
+    }
+    segmentReady.notify_all();
+    foreach (std::thread& thread, threads)
+        thread.join();
+}
+
+/**
+ * Replay the entries within a recovery segment using the pool's threads.
+ * The calling thread walks the segment once to divide its entries among
+ * the threads, then keeps replication moving until they have all finished.
+ * See ObjectManager::replaySegment for the semantics of replay.
+ *
+ * \param it
+ *       SegmentIterator which is pointing to the start of the recovery segment
+ *       to be replayed into the log.
+ * \throw Exception
+ *      Any exception thrown while replaying is rethrown once every thread
+ *      has finished.
+ */
+void
+ObjectManager::ReplayThreadPool::replaySegment(SegmentIterator& it)
+{
+    uint32_t numShards = downCast<uint32_t>(threads.size());
+    foreach (vector<uint32_t>& slice, slices)
+        slice.clear();
+    for (SegmentIterator i = it; !i.isDone(); i.next()) {
+        slices[objectManager->getReplayShard(i, numShards)].push_back(
+                i.getOffset());
+    }
+
+    uint64_t startReplicationTicks = metrics->master.replicaManagerTicks;
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        segment.construct(it);
+        foreach (std::exception_ptr& error, errors)
+            error = std::exception_ptr();
+        slicesRemaining = numShards;
+        segmentCount++;
+    }
+    segmentReady.notify_all();
+
+    while (slicesRemaining > 0)
+        objectManager->replicaManager.proceed();
+    metrics->master.backupInRecoverTicks +=
+        metrics->master.replicaManagerTicks - startReplicationTicks;
+
+    foreach (std::exception_ptr& error, errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+/**
+ * Main loop of each thread in a ReplayThreadPool: wait for a segment, replay
+ * this thread's slice of it, and repeat until the pool is destroyed.
+ *
+ * \param shard
+ *      Which of the threads this is.
+ */
+void
+ObjectManager::ReplayThreadPool::workerMain(uint32_t shard)
+{
+    uint64_t lastSegmentCount = 0;
+    while (true) {
+        Tub<SegmentIterator> it;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (segmentCount == lastSegmentCount && !stop)
+                segmentReady.wait(lock);
+            if (stop)
+                return;
+            lastSegmentCount = segmentCount;
+            it.construct(*segment);
+        }
+        try {
+            objectManager->replaySegment(sideLogs[shard], *it, &slices[shard]);
+        } catch (...) {
+            errors[shard] = std::current_exception();
+        }
+        slicesRemaining--;
+    }
+}
+
+/**
+ * Decide which thread of a ReplayThreadPool should replay an entry in a
+ * recovery segment. Objects and tombstones go to the thread that owns the
+ * bucket lock for their key; the range of locks each thread owns doesn't
+ * depend on the size of the hash table, so it isn't affected by resizing.
+ * All other entries are replayed by the first thread.
+ *
+ * \param it
+ *      Points to the entry to consider.
+ * \param numShards
+ *      Number of threads replaying the segment.
+ * \return
+ *      The index of the thread that should replay the entry.
+ */
+uint32_t
+ObjectManager::getReplayShard(SegmentIterator& it, uint32_t numShards)
+{
+    uint64_t keyHash;
+    LogEntryType type = it.getType();
+    if (expect_true(type == LOG_ENTRY_TYPE_OBJ)) {
+        const Object::SerializedForm* obj =
+            it.getContiguous<Object::SerializedForm>(NULL, 0);
+        keyHash = Key::getHash(obj->tableId, obj->keyAndData, obj->keyLength);
+    } else if (type == LOG_ENTRY_TYPE_OBJTOMB) {
+        const ObjectTombstone::SerializedForm* tomb =
+            it.getContiguous<ObjectTombstone::SerializedForm>(NULL, 0);
+        keyHash = Key::getHash(tomb->tableId, tomb->key, tomb->keyLength);
+    } else {
+        return 0;
+    }
+
+    uint64_t numLocks = arrayLength(hashTableBucketLocks);
+    uint64_t lockIndex = keyHash & (numLocks - 1);
+    return downCast<uint32_t>(lockIndex * numShards / numLocks);
+}
+
 /**
  * Removes an object from the hash table and frees it from the log if
  * it belongs to a tablet that doesn't exist in the master's TabletManager.
@@ -772,6 +1131,40 @@ ObjectManager::removeIfOrphanedObject(uint64_t reference, void *cookie)
     }
 }
 
+/**
+ * Callback used by copyTabletObjects. If the given reference is to an object
+ * in the tablet being scanned, append a copy of it to the output buffer.
+ *
+ * \param reference
+ *      Reference into the log for an entry in the hash table.
+ * \param cookie
+ *      Pointer to a CopyTabletParameters structure.
+ */
+void
+ObjectManager::copyIfInTablet(uint64_t reference, void *cookie)
+{
+    CopyTabletParameters* params =
+        reinterpret_cast<CopyTabletParameters*>(cookie);
+    LogEntryType type;
+    Buffer buffer;
+
+    type = params->objectManager->log.getEntry(Log::Reference(reference),
+                                               buffer);
+    if (type != LOG_ENTRY_TYPE_OBJ)
+        return;
+
+    Key key(type, buffer);
+    if (key.getTableId() != params->tableId ||
+            key.getHash() < params->firstKeyHash ||
+            key.getHash() > params->lastKeyHash)
+        return;
+
+    uint32_t length = buffer.getTotalLength();
+    buffer.copy(0, length, new(params->objects, APPEND) char[length]);
+    params->lengths->push_back(length);
+    params->totalBytes += length;
+}
+
 /**
  * Scan the hashtable and remove all objects that do not belong to a
  * tablet currently owned by this master. Used to clean up any objects
@@ -780,13 +1173,378 @@ ObjectManager::removeIfOrphanedObject(uint64_t reference, void *cookie)
 void
 ObjectManager::removeOrphanedObjects()
 {
-    for (uint64_t i = 0; i < objectMap.getNumBuckets(); i++) {
-        HashTableBucketLock lock(*this, i);
-        CleanupParameters params = { this , &lock };
-        objectMap.forEachInBucket(removeIfOrphanedObject, &params, i);
+    if (keyHashIndex) {
+        removeOrphanedObjectsFromIndex();
+        return;
+    }
+    scanObjectMap(removeIfOrphanedObject);
+}
+
+/**
+ * Implements removeOrphanedObjects using #keyHashIndex. Rather than visit
+ * every bucket, visit only the key hashes in the index that fall outside
+ * the tablets this master owns, skipping over each owned tablet in one
+ * step. The cost is proportional to the number of orphaned key hashes plus
+ * the number of tablets, not to the size of the hash table.
+ */
+void
+ObjectManager::removeOrphanedObjectsFromIndex()
+{
+    vector<uint64_t> tableIds;
+    keyHashIndex->getTableIds(&tableIds);
+
+    vector<uint64_t> keyHashes;
+    foreach (uint64_t tableId, tableIds) {
+        uint64_t nextKeyHash = 0;
+        bool done = false;
+        while (!done) {
+            keyHashes.clear();
+            keyHashIndex->lookup(tableId, nextKeyHash, ~0UL, 100, &keyHashes);
+            if (keyHashes.empty())
+                break;
+            foreach (uint64_t keyHash, keyHashes) {
+                TabletManager::Tablet tablet;
+                if (tabletManager->getTablet(tableId, keyHash, &tablet)) {
+                    // Skip the rest of this tablet; the hashes fetched
+                    // beyond this one may be in it.
+                    done = (tablet.endKeyHash == ~0UL);
+                    nextKeyHash = tablet.endKeyHash + 1;
+                    break;
+                }
+
+                HashTableBucketLock lock(*this, getBucketIndex(keyHash));
+                CleanupParameters params = { this, &lock };
+                HashTable::Candidates candidates = objectMap.lookup(keyHash);
+                for (; !candidates.isDone(); candidates.next())
+                    removeIfOrphanedObject(candidates.getReference(), &params);
+                done = (keyHash == ~0UL);
+                nextKeyHash = keyHash + 1;
+            }
+        }
+    }
+}
+
+/**
+ * Fill in the provided protocol buffer with the size of #objectMap and
+ * estimates of its load factor and chain lengths, for use in
+ * GetServerStatistics.
+ *
+ * \param[out] stats
+ *      Protocol buffer to fill in.
+ */
+void
+ObjectManager::getHashTableStatistics(
+                                ProtoBuf::ServerStatistics_HashTable* stats)
+{
+    stats->set_resize_count(objectMap.getResizeCount());
+
+    HashTableSample sample;
+    if (sampleObjectMap(HashTableResizer::SAMPLE_BUCKETS, &sample)) {
+        double sampled = static_cast<double>(sample.sampledBuckets);
+        stats->set_num_buckets(sample.numBuckets);
+        stats->set_sampled_buckets(sample.sampledBuckets);
+        stats->set_load_factor(static_cast<double>(sample.numEntries) /
+                               sampled / HashTable::entriesPerCacheLine());
+        stats->set_average_chain_length(
+            static_cast<double>(sample.numCacheLines) / sampled);
+        stats->set_max_chain_length(sample.maxChainLength);
+        stats->set_overflowed_bucket_fraction(
+            static_cast<double>(sample.overflowedBuckets) / sampled);
+        return;
+    }
+
+    // The table can't be sampled while it is being resized. Report the
+    // resize's progress instead. Any bucket lock keeps the resize from
+    // starting or finishing while we look.
+    HashTableBucketLock lock(*this, 0);
+    stats->set_num_buckets(objectMap.getNumBuckets());
+    stats->set_sampled_buckets(0);
+    if (objectMap.isResizing()) {
+        stats->set_resize_target_buckets(objectMap.getNewNumBuckets());
+        stats->set_resize_progress(
+            static_cast<double>(objectMap.getMigratedUnits()) /
+            static_cast<double>(objectMap.getMigrationUnits()));
+    }
+}
+
+/**
+ * Copy out the live objects belonging to one tablet, visiting the hash table
+ * one bucket at a time. Each bucket is examined while holding its lock, and
+ * the objects are copied so that no references into the log are held once
+ * the lock is released. This lets tablet migration ship a tablet's current
+ * contents without a LogIterator, so the log cleaner keeps running while it
+ * does. The cost of a complete walk is proportional to the size of the hash
+ * table rather than the size of the log; if the master keeps a KeyHashIndex,
+ * it is proportional to the size of the tablet instead.
+ *
+ * Objects written or removed while a walk is in progress may or may not be
+ * seen by it, so callers must catch up on those changes some other way (for
+ * example, by iterating over the log segments created since the walk began).
+ *
+ * \param scan
+ *      Identifies the tablet and the progress of the walk. It is advanced
+ *      past every bucket (or key hash) visited.
+ * \param maxBytes
+ *      Return once at least this many bytes of objects have been copied
+ *      (a bucket is never split, so more may be copied).
+ * \param[out] objects
+ *      A copy of each object found is appended to this buffer. Each is
+ *      stored contiguously.
+ * \param[out] lengths
+ *      The length of each object appended to \a objects is appended here.
+ * \return
+ *      The number of bytes appended to \a objects.
+ */
+uint32_t
+ObjectManager::copyTabletObjects(TabletScan* scan, uint32_t maxBytes,
+                                 Buffer* objects, vector<uint32_t>* lengths)
+{
+    if (keyHashIndex)
+        return copyTabletObjectsFromIndex(scan, maxBytes, objects, lengths);
+
+    CopyTabletParameters params = { this, scan->tableId, scan->startKeyHash,
+                                    scan->endKeyHash, objects, lengths, 0 };
+
+    while (!scan->isDone() && params.totalBytes < maxBytes) {
+        HashTableBucketLock lock(*this, scan->nextBucket);
+        if (objectMap.getResizeCount() != scan->resizeCount ||
+                scan->numBuckets == 0) {
+            if (scan->numBuckets != 0) {
+                LOG(NOTICE, "Hash table resized during scan of tablet "
+                    "[0x%lx,0x%lx] in tableId %lu; restarting scan",
+                    scan->startKeyHash, scan->endKeyHash, scan->tableId);
+                scan->restarts++;
+            }
+            scan->numBuckets = objectMap.getNumBuckets();
+            scan->resizeCount = objectMap.getResizeCount();
+            scan->nextBucket = 0;
+            continue;
+        }
+        objectMap.forEachInBucket(copyIfInTablet, &params, scan->nextBucket);
+        scan->nextBucket++;
+        if (scan->nextBucket >= scan->numBuckets)
+            scan->done = true;
+    }
+
+    return params.totalBytes;
+}
+
+/**
+ * Implements copyTabletObjects using #keyHashIndex: the tablet's key hashes
+ * are visited in increasing order, and for each one the objects with that
+ * hash are copied while holding its bucket lock. Since the walk's position
+ * is a key hash rather than a bucket index, hash table resizes don't
+ * disturb it.
+ *
+ * \copydetails copyTabletObjects
+ */
+uint32_t
+ObjectManager::copyTabletObjectsFromIndex(TabletScan* scan, uint32_t maxBytes,
+                                          Buffer* objects,
+                                          vector<uint32_t>* lengths)
+{
+    CopyTabletParameters params = { this, scan->tableId, 0, 0,
+                                    objects, lengths, 0 };
+    vector<uint64_t> keyHashes;
+
+    while (!scan->isDone() && params.totalBytes < maxBytes) {
+        keyHashes.clear();
+        keyHashIndex->lookup(scan->tableId, scan->nextKeyHash,
+                             scan->endKeyHash, 100, &keyHashes);
+        if (keyHashes.empty()) {
+            scan->done = true;
+            break;
+        }
+
+        foreach (uint64_t keyHash, keyHashes) {
+            if (params.totalBytes >= maxBytes)
+                break;
+
+            // The bucket may also hold objects with other key hashes; those
+            // are copied when their own hash is visited.
+            HashTableBucketLock lock(*this, getBucketIndex(keyHash));
+            params.firstKeyHash = params.lastKeyHash = keyHash;
+            HashTable::Candidates candidates = objectMap.lookup(keyHash);
+            for (; !candidates.isDone(); candidates.next())
+                copyIfInTablet(candidates.getReference(), &params);
+
+            if (keyHash == scan->endKeyHash)
+                scan->done = true;
+            else
+                scan->nextKeyHash = keyHash + 1;
+        }
+    }
+
+    return params.totalBytes;
+}
+
+/**
+ * Return the fraction of the tablet's walk that copyTabletObjects has
+ * completed so far, between 0 and 1.
+ */
+double
+ObjectManager::TabletScan::getProgress() const
+{
+    if (done)
+        return 1.0;
+    if (numBuckets != 0) {
+        return static_cast<double>(nextBucket) /
+               static_cast<double>(numBuckets);
+    }
+    return (static_cast<double>(nextKeyHash - startKeyHash)) /
+           (static_cast<double>(endKeyHash - startKeyHash) + 1.0);
+}
+
+/**
+ * Construct a TombstoneProtector; from now on, the cleaner keeps every
+ * tombstone for a key in the given range until this object is destroyed.
+ *
+ * \param objectManager
+ *      The ObjectManager whose log holds the tombstones.
+ * \param tableId
+ *      Table containing the range of keys.
+ * \param firstKeyHash
+ *      Smallest key hash in the range.
+ * \param lastKeyHash
+ *      Largest key hash in the range.
+ */
+ObjectManager::TombstoneProtector::TombstoneProtector(
+        ObjectManager* objectManager, uint64_t tableId,
+        uint64_t firstKeyHash, uint64_t lastKeyHash)
+    : objectManager(objectManager)
+    , tableId(tableId)
+    , firstKeyHash(firstKeyHash)
+    , lastKeyHash(lastKeyHash)
+{
+    std::lock_guard<SpinLock> _(objectManager->tombstoneProtectorsLock);
+    objectManager->tombstoneProtectors.push_back(this);
+}
+
+/**
+ * Destructor: the cleaner may once again drop tombstones in this range
+ * whose objects are no longer in the log.
+ */
+ObjectManager::TombstoneProtector::~TombstoneProtector()
+{
+    std::lock_guard<SpinLock> _(objectManager->tombstoneProtectorsLock);
+    vector<TombstoneProtector*>& protectors =
+        objectManager->tombstoneProtectors;
+    protectors.erase(std::remove(protectors.begin(), protectors.end(), this),
+                     protectors.end());
+}
+
+/**
+ * Copy the objects in a range of keys of one tablet, in key order. Requires
+ * #orderedKeyIndex (see ServerConfig::Master::useOrderedKeyIndex).
+ *
+ * \param tableId
+ *      Table containing the tablet.
+ * \param firstKeyHash
+ *      Smallest key hash in the tablet; objects whose keys hash outside
+ *      [firstKeyHash, lastKeyHash] belong to other tablets and are skipped.
+ * \param lastKeyHash
+ *      Largest key hash in the tablet.
+ * \param startKey
+ *      Smallest key to return.
+ * \param endKey
+ *      Return only keys less than this one. If empty, there is no upper
+ *      bound.
+ * \param maxBytes
+ *      Stop once adding another object would take \a objects past this many
+ *      bytes. This also bounds the objects plus \a nextKey, since the two
+ *      are returned together. At least one object is always returned if the
+ *      range holds any.
+ * \param[out] objects
+ *      Each object found is appended here as a uint32_t length followed by
+ *      a copy of the object, as in an Enumerate response.
+ * \param[out] nextKey
+ *      If the range was not finished, set to the key to pass as
+ *      \a startKey to continue the scan.
+ * \return
+ *      True if every object in the range has been returned, false if the
+ *      scan stopped early because of \a maxBytes.
+ * \throw UnimplementedRequestError
+ *      This master does not keep an ordered key index.
+ */
+bool
+ObjectManager::scanObjects(uint64_t tableId, uint64_t firstKeyHash,
+                           uint64_t lastKeyHash, const string& startKey,
+                           const string& endKey, uint32_t maxBytes,
+                           Buffer* objects, string* nextKey)
+{
+    if (!orderedKeyIndex)
+        throw UnimplementedRequestError(HERE);
+
+    uint32_t initialLength = objects->getTotalLength();
+    string resumeKey = startKey;
+    vector<string> keys;
+    uint32_t numObjects = 0;
+    uint32_t lastObjectBytes = 0;
+    string lastKey;
+
+    while (true) {
+        keys.clear();
+        orderedKeyIndex->lookup(tableId, resumeKey, endKey, 100, &keys);
+        if (keys.empty())
+            return true;
+
+        foreach (const string& keyString, keys) {
+            Key key(tableId, keyString.data(),
+                    downCast<uint16_t>(keyString.size()));
+            if (key.getHash() < firstKeyHash || key.getHash() > lastKeyHash)
+                continue;
+
+            HashTableBucketLock lock(*this, key);
+            LogEntryType type;
+            Buffer buffer;
+            if (!lookup(lock, key, type, buffer) ||
+                    type != LOG_ENTRY_TYPE_OBJ)
+                continue;
+
+            uint32_t length = buffer.getTotalLength();
+            uint32_t bytesSoFar = objects->getTotalLength() - initialLength;
+            if (bytesSoFar != 0 &&
+                    bytesSoFar + sizeof32(length) + length > maxBytes) {
+                *nextKey = keyString;
+                // If the key doesn't fit alongside the objects, give back
+                // the last object and resume from its key instead. That key
+                // is part of the object, so it is sure to fit in the space
+                // freed.
+                if (bytesSoFar + nextKey->size() > maxBytes &&
+                        numObjects > 1) {
+                    objects->truncateEnd(lastObjectBytes);
+                    *nextKey = lastKey;
+                }
+                return false;
+            }
+            *new(objects, APPEND) uint32_t = length;
+            buffer.copy(0, length, new(objects, APPEND) char[length]);
+            numObjects++;
+            lastObjectBytes = sizeof32(length) + length;
+            lastKey = keyString;
+        }
+
+        if (keys.size() < 100)
+            return true;
+
+        // Resume just past the last key seen: the smallest longer key.
+        resumeKey = keys.back();
+        resumeKey.push_back('\0');
     }
 }
 
+/**
+ * Return the index of the #objectMap bucket that keys with the given hash
+ * currently map to, for use with HashTableBucketLock.
+ */
+uint64_t
+ObjectManager::getBucketIndex(uint64_t keyHash)
+{
+    uint64_t unused;
+    return HashTable::findBucketIndex(objectMap.getNumBuckets(), keyHash,
+                                      &unused);
+}
+
 /**
  * Check a set of RejectRules against the current state of an object
  * to decide whether an operation is allowed.
@@ -976,8 +1734,14 @@ ObjectManager::relocateTombstone(Buffer& oldBuffer,
 {
     ObjectTombstone tomb(oldBuffer);
 
-    // See if the object this tombstone refers to is still in the log.
+    // See if the object this tombstone refers to is still in the log. If
+    // not, the tombstone is normally garbage, unless a migration still needs
+    // to send it.
     bool keepNewTomb = log.segmentExists(tomb.getSegmentId());
+    if (!keepNewTomb) {
+        Key key(LOG_ENTRY_TYPE_OBJTOMB, oldBuffer);
+        keepNewTomb = isTombstoneProtected(key);
+    }
 
     if (keepNewTomb) {
         // Try to relocate it. If it fails, just return. The cleaner will
@@ -987,6 +1751,24 @@ ObjectManager::relocateTombstone(Buffer& oldBuffer,
     }
 }
 
+/**
+ * Return true if a TombstoneProtector covers the given key, meaning its
+ * tombstones must be kept even if their objects have been cleaned.
+ */
+bool
+ObjectManager::isTombstoneProtected(Key& key)
+{
+    std::lock_guard<SpinLock> _(tombstoneProtectorsLock);
+    foreach (TombstoneProtector* protector, tombstoneProtectors) {
+        if (protector->tableId == key.getTableId() &&
+                key.getHash() >= protector->firstKeyHash &&
+                key.getHash() <= protector->lastKeyHash) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * Callback used by the Log to determine the age of Tombstone.
  *
@@ -1092,6 +1874,13 @@ ObjectManager::remove(HashTableBucketLock& lock, Key& key)
         Key candidateKey(type, buffer);
         if (key == candidateKey) {
             candidates.remove();
+            if (type == LOG_ENTRY_TYPE_OBJ)
+                tabletManager->adjustSize(
+                    key, -static_cast<int64_t>(buffer.getTotalLength()), -1);
+            if (keyHashIndex)
+                keyHashIndex->remove(key.getTableId(), key.getHash());
+            if (orderedKeyIndex)
+                orderedKeyIndex->remove(key);
             return true;
         }
         candidates.next();
@@ -1122,6 +1911,13 @@ ObjectManager::replace(HashTableBucketLock& lock,
                        Key& key,
                        Log::Reference reference)
 {
+    // Keep the tablet's size up to date. Only objects count towards it;
+    // tombstones in the hash table (during recovery) are not live data.
+    Buffer newBuffer;
+    int64_t newBytes = 0;
+    if (log.getEntry(reference, newBuffer) == LOG_ENTRY_TYPE_OBJ)
+        newBytes = newBuffer.getTotalLength();
+
     HashTable::Candidates candidates = objectMap.lookup(key);
     while (!candidates.isDone()) {
         Buffer buffer;
@@ -1130,12 +1926,23 @@ ObjectManager::replace(HashTableBucketLock& lock,
         Key candidateKey(type, buffer);
         if (key == candidateKey) {
             candidates.setReference(reference.toInteger());
+            int64_t oldBytes = 0;
+            if (type == LOG_ENTRY_TYPE_OBJ)
+                oldBytes = buffer.getTotalLength();
+            tabletManager->adjustSize(key, newBytes - oldBytes,
+                                      (newBytes > 0) - (oldBytes > 0));
             return true;
         }
         candidates.next();
     }
 
+    if (newBytes > 0)
+        tabletManager->adjustSize(key, newBytes, 1);
     objectMap.insert(key, reference.toInteger());
+    if (keyHashIndex)
+        keyHashIndex->insert(key.getTableId(), key.getHash());
+    if (orderedKeyIndex)
+        orderedKeyIndex->insert(key);
     return false;
 }
 
@@ -1194,11 +2001,81 @@ ObjectManager::removeIfTombstone(uint64_t maybeTomb, void *cookie)
 void
 ObjectManager::removeTombstones()
 {
-    for (uint64_t i = 0; i < objectMap.getNumBuckets(); i++) {
+    scanObjectMap(removeIfTombstone);
+}
+
+/**
+ * Estimate the occupancy of #objectMap by examining a subset of its
+ * buckets, evenly spaced through the table. Each bucket is examined while
+ * holding its HashTableBucketLock.
+ *
+ * \param maxSampledBuckets
+ *      Upper bound on the number of buckets to examine. Must be nonzero.
+ * \param[out] sample
+ *      Filled in with the results of the sample.
+ *
+ * \return
+ *      True if the sample was taken. False if the table was being resized,
+ *      in which case \a sample is not valid.
+ */
+bool
+ObjectManager::sampleObjectMap(uint64_t maxSampledBuckets,
+                               HashTableSample* sample)
+{
+    uint64_t numBuckets = objectMap.getNumBuckets();
+    uint64_t stride = std::max(numBuckets / maxSampledBuckets, 1UL);
+
+    sample->numBuckets = numBuckets;
+    sample->sampledBuckets = 0;
+    sample->numEntries = 0;
+    sample->numCacheLines = 0;
+    sample->overflowedBuckets = 0;
+    sample->maxChainLength = 0;
+
+    for (uint64_t i = 0; i < numBuckets; i += stride) {
         HashTableBucketLock lock(*this, i);
-        CleanupParameters params = { this , &lock };
-        objectMap.forEachInBucket(removeIfTombstone, &params, i);
+        if (objectMap.isResizing() || objectMap.getNumBuckets() != numBuckets)
+            return false;
+
+        uint32_t numEntries, numCacheLines;
+        objectMap.getBucketOccupancy(i, &numEntries, &numCacheLines);
+        sample->sampledBuckets++;
+        sample->numEntries += numEntries;
+        sample->numCacheLines += numCacheLines;
+        if (numCacheLines > 1)
+            sample->overflowedBuckets++;
+        sample->maxChainLength = std::max(sample->maxChainLength,
+                                          numCacheLines);
     }
+
+    return true;
+}
+
+/**
+ * Apply a cleanup callback (removeIfOrphanedObject or removeIfTombstone) to
+ * every entry in #objectMap, one bucket at a time while holding the bucket's
+ * lock. Since the table may be resized concurrently, the pass is repeated
+ * if a resize completed part way through it (bucket indexes change meaning
+ * when the table changes size, so entries may have been skipped).
+ *
+ * \param callback
+ *      Function to invoke on each entry. Its cookie is a pointer to
+ *      CleanupParameters.
+ */
+void
+ObjectManager::scanObjectMap(void (*callback)(uint64_t, void*))
+{
+    uint64_t resizeCount;
+    do {
+        resizeCount = objectMap.getResizeCount();
+        for (uint64_t i = 0; ; i++) {
+            HashTableBucketLock lock(*this, i);
+            if (i >= objectMap.getNumBuckets())
+                break;
+            CleanupParameters params = { this , &lock };
+            objectMap.forEachInBucket(callback, &params, i);
+        }
+    } while (resizeCount != objectMap.getResizeCount());
 }
 
 /**
@@ -1220,6 +2097,7 @@ ObjectManager::RemoveTombstonePoller::RemoveTombstonePoller(
     , currentBucket(0)
     , passes(0)
     , lastReplaySegmentCount(0)
+    , lastResizeCount(0)
     , objectManager(objectManager)
     , objectMap(objectMap)
 {
@@ -1234,6 +2112,7 @@ void
 ObjectManager::RemoveTombstonePoller::poll()
 {
     if (lastReplaySegmentCount == objectManager->replaySegmentReturnCount &&
+      lastResizeCount == objectMap->getResizeCount() &&
       currentBucket == 0) {
         return;
     }
@@ -1247,19 +2126,380 @@ ObjectManager::RemoveTombstonePoller::poll()
     // should complete much faster than one pass here, so at worst we
     // should hopefully only traverse the hash table an extra time per
     // recovery.
-    if (currentBucket == 0)
+    //
+    // A resize that completes during a pass changes the meaning of bucket
+    // indexes, so the pass may miss entries. Tracking the resize count the
+    // same way forces another pass after each resize.
+    if (currentBucket == 0) {
         lastReplaySegmentCount = objectManager->replaySegmentReturnCount;
+        lastResizeCount = objectMap->getResizeCount();
+    }
 
     HashTableBucketLock lock(*objectManager, currentBucket);
-    CleanupParameters params = { objectManager, &lock };
-    objectMap->forEachInBucket(removeIfTombstone, &params, currentBucket);
+    if (currentBucket < objectMap->getNumBuckets()) {
+        CleanupParameters params = { objectManager, &lock };
+        objectMap->forEachInBucket(removeIfTombstone, &params, currentBucket);
+    }
 
     ++currentBucket;
-    if (currentBucket == objectMap->getNumBuckets()) {
+    if (currentBucket >= objectMap->getNumBuckets()) {
         LOG(DEBUG, "Cleanup of tombstones completed pass %lu", passes);
         currentBucket = 0;
         passes++;
     }
 }
 
+/**
+ * Construct a HashTableResizer. The resizer does nothing until start() is
+ * called.
+ *
+ * \param objectManager
+ *      The ObjectManager whose #objectMap will be resized.
+ * \param maxBuckets
+ *      The table will not be grown beyond this many buckets (rounded down to
+ *      a power of two).
+ */
+ObjectManager::HashTableResizer::HashTableResizer(ObjectManager* objectManager,
+                                                  uint64_t maxBuckets)
+    : objectManager(objectManager)
+    , minBuckets(arrayLength(objectManager->hashTableBucketLocks))
+    , maxBuckets(BitOps::powerOfTwoLessOrEqual(maxBuckets))
+    , threadShouldExit(false)
+    , thread()
+{
+}
+
+/**
+ * Destroy the resizer, stopping its thread first if it is running.
+ */
+ObjectManager::HashTableResizer::~HashTableResizer()
+{
+    stop();
+}
+
+/**
+ * Start the resizer thread, if it isn't already running. Like
+ * LogCleaner::start(), this is not thread-safe with respect to stop().
+ */
+void
+ObjectManager::HashTableResizer::start()
+{
+    if (!thread)
+        thread.construct(resizerThreadEntry, this);
+}
+
+/**
+ * Halt the resizer thread (if it is running). A resize in progress is left
+ * part way done; the table keeps working normally and the resize is
+ * resumed by the next call to start().
+ */
+void
+ObjectManager::HashTableResizer::stop()
+{
+    threadShouldExit = true;
+    Fence::sfence();
+
+    if (thread) {
+        thread->join();
+        thread.destroy();
+    }
+
+    threadShouldExit = false;
+}
+
+/**
+ * Decide how big the table should be, given a sample of its occupancy.
+ *
+ * \param sample
+ *      The result of ObjectManager::sampleObjectMap().
+ * \return
+ *      The number of buckets the table should have. This is
+ *      sample.numBuckets if it should not be resized.
+ */
+uint64_t
+ObjectManager::HashTableResizer::chooseNewSize(const HashTableSample& sample)
+{
+    uint64_t numBuckets = sample.numBuckets;
+    if (numBuckets < minBuckets || sample.sampledBuckets == 0)
+        return numBuckets;
+
+    if (sample.overflowedBuckets * 100 >
+      sample.sampledBuckets * GROW_OVERFLOW_PERCENT) {
+        if (numBuckets * 2 <= maxBuckets)
+            return numBuckets * 2;
+    } else if (sample.numEntries * SHRINK_BUCKETS_PER_ENTRY <=
+      sample.sampledBuckets) {
+        if (numBuckets / 2 >= minBuckets)
+            return numBuckets / 2;
+    }
+    return numBuckets;
+}
+
+/**
+ * Resize the table synchronously, finishing any resize that is already in
+ * progress instead if there is one. The resizer thread must not be running.
+ * Used for testing.
+ *
+ * \param newNumBuckets
+ *      The number of buckets the table should end up with. This is clamped
+ *      to the range the resizer is allowed to use.
+ */
+void
+ObjectManager::HashTableResizer::resize(uint64_t newNumBuckets)
+{
+    assert(!thread);
+    HashTable& objectMap = objectManager->objectMap;
+    newNumBuckets = std::max(minBuckets, std::min(maxBuckets, newNumBuckets));
+
+    if (!objectMap.isResizing()) {
+        if (newNumBuckets == objectMap.getNumBuckets())
+            return;
+        objectMap.prepareResize(newNumBuckets);
+        lockAllBuckets();
+        objectMap.startResize();
+        unlockAllBuckets();
+    }
+
+    while (objectMap.isResizing())
+        migrateUnits(UNITS_PER_STEP);
+}
+
+/**
+ * Static entry point for the resizer thread. The thread alternates between
+ * sampling the table and migrating entries until stop() is called.
+ */
+void
+ObjectManager::HashTableResizer::resizerThreadEntry(HashTableResizer* resizer)
+{
+    LOG(NOTICE, "HashTable resizer thread started");
+
+    try {
+        while (1) {
+            Fence::lfence();
+            if (resizer->threadShouldExit)
+                break;
+
+            if (!resizer->doWork())
+                usleep(POLL_USEC);
+        }
+    } catch (const Exception& e) {
+        DIE("Fatal error in HashTable resizer thread: %s", e.what());
+    }
+
+    LOG(NOTICE, "HashTable resizer thread stopping");
+}
+
+/**
+ * Callback for HashTable::migrateUnit() that returns the key hash of an
+ * object or tombstone stored in the log.
+ *
+ * \param reference
+ *      Log reference of the object or tombstone.
+ * \param cookie
+ *      The ObjectManager whose log holds the entry.
+ */
+uint64_t
+ObjectManager::HashTableResizer::getKeyHash(uint64_t reference, void* cookie)
+{
+    ObjectManager* objectManager = static_cast<ObjectManager*>(cookie);
+    Buffer buffer;
+    LogEntryType type = objectManager->log.getEntry(Log::Reference(reference),
+                                                    buffer);
+    Key key(type, buffer);
+    return key.getHash();
+}
+
+/**
+ * Do one step of the resizer's work: migrate a batch of units if a resize
+ * is in progress, or otherwise sample the table and start a resize if its
+ * size is out of balance with the number of objects stored.
+ *
+ * \return
+ *      True if there may be more work to do immediately; false if the
+ *      caller should wait a while before calling again.
+ */
+bool
+ObjectManager::HashTableResizer::doWork()
+{
+    HashTable& objectMap = objectManager->objectMap;
+    if (objectMap.isResizing()) {
+        migrateUnits(UNITS_PER_STEP);
+        return true;
+    }
+
+    HashTableSample sample;
+    if (!objectManager->sampleObjectMap(SAMPLE_BUCKETS, &sample))
+        return false;
+    uint64_t newNumBuckets = chooseNewSize(sample);
+    if (newNumBuckets == sample.numBuckets)
+        return false;
+
+    // Allocating and zeroing the new bucket array may take a while, so do
+    // it before excluding everyone else from the table.
+    objectMap.prepareResize(newNumBuckets);
+    lockAllBuckets();
+    objectMap.startResize();
+    unlockAllBuckets();
+    return true;
+}
+
+/**
+ * Acquire every one of the ObjectManager's bucket locks, in order. This
+ * excludes all other users of the table while the resize starts or ends.
+ */
+void
+ObjectManager::HashTableResizer::lockAllBuckets()
+{
+    for (size_t i = 0; i < arrayLength(objectManager->hashTableBucketLocks);
+         i++) {
+        objectManager->hashTableBucketLocks[i].lock();
+    }
+}
+
+/**
+ * Move up to \a count migration units of the resize in progress to the new
+ * bucket array, holding only the unit's bucket lock while moving it. If this
+ * moves the last unit, the resize is finished as well.
+ *
+ * \param count
+ *      Maximum number of units to move.
+ */
+void
+ObjectManager::HashTableResizer::migrateUnits(uint64_t count)
+{
+    HashTable& objectMap = objectManager->objectMap;
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t unit = objectMap.getMigratedUnits();
+        if (unit == objectMap.getMigrationUnits())
+            break;
+
+        // Every bucket of the unit, in either array, maps to this lock
+        // because both arrays have at least one bucket per lock.
+        HashTableBucketLock lock(*objectManager, unit);
+        objectMap.migrateUnit(getKeyHash, objectManager);
+    }
+
+    if (objectMap.getMigratedUnits() == objectMap.getMigrationUnits()) {
+        lockAllBuckets();
+        objectMap.finishResize();
+        unlockAllBuckets();
+    }
+}
+
+/**
+ * Release the locks acquired by lockAllBuckets().
+ */
+void
+ObjectManager::HashTableResizer::unlockAllBuckets()
+{
+    for (size_t i = 0; i < arrayLength(objectManager->hashTableBucketLocks);
+         i++) {
+        objectManager->hashTableBucketLocks[i].unlock();
+    }
+}
+
+/**
+ * Construct a TabletStatsReporter and schedule its first check.
+ *
+ * \param objectManager
+ *      The ObjectManager whose tablets are to be reported on.
+ */
+ObjectManager::TabletStatsReporter::TabletStatsReporter(
+                                        ObjectManager* objectManager)
+    : Dispatch::Timer(*objectManager->context->dispatch)
+    , objectManager(objectManager)
+    , lastReported()
+    , reported(false)
+{
+    start(owner->currentTime +
+          Cycles::fromNanoseconds(INTERVAL_MS * 1000000UL));
+}
+
+/**
+ * Invoked by the dispatcher; reports tablet sizes if needed and reschedules
+ * this timer.
+ */
+void
+ObjectManager::TabletStatsReporter::handleTimerEvent()
+{
+    uint64_t ms = INTERVAL_MS;
+    if (!report())
+        ms = RETRY_MS;
+    start(owner->currentTime + Cycles::fromNanoseconds(ms * 1000000UL));
+}
+
+/**
+ * Gather the current size of each tablet and, if they differ significantly
+ * from what was last reported, hand them to the ReplicaManager to send to
+ * the coordinator.
+ *
+ * \return
+ *      False if the sizes needed to be reported but the ReplicaManager was
+ *      busy, in which case the caller should try again soon. True otherwise.
+ */
+bool
+ObjectManager::TabletStatsReporter::report()
+{
+    vector<TabletManager::Tablet> tablets;
+    objectManager->tabletManager->getTablets(&tablets);
+
+    ProtoBuf::MasterRecoveryInfo stats;
+    foreach (const TabletManager::Tablet& tablet, tablets) {
+        ProtoBuf::MasterRecoveryInfo::TabletStats& entry =
+            *stats.add_tablet_stats();
+        entry.set_table_id(tablet.tableId);
+        entry.set_start_key_hash(tablet.startKeyHash);
+        entry.set_end_key_hash(tablet.endKeyHash);
+        entry.set_byte_count(tablet.byteCount);
+        entry.set_object_count(tablet.objectCount);
+    }
+
+    if (reported && !changedSignificantly(stats))
+        return true;
+
+    // This runs in the dispatch thread, so it must not wait on the
+    // ReplicaManager's lock, which may be held for a while by sync().
+    if (!objectManager->replicaManager.tryUpdateTabletStats(stats))
+        return false;
+
+    RAMCLOUD_TEST_LOG("reporting sizes of %d tablets",
+                      stats.tablet_stats_size());
+    lastReported.Swap(&stats);
+    reported = true;
+    return true;
+}
+
+/**
+ * Return true if \a stats should be reported: that is, if it describes a
+ * different set of tablets than #lastReported, or if the size of any tablet
+ * has changed by more than CHANGE_PERCENT since then.
+ */
+bool
+ObjectManager::TabletStatsReporter::changedSignificantly(
+                            const ProtoBuf::MasterRecoveryInfo& stats)
+{
+    if (stats.tablet_stats_size() != lastReported.tablet_stats_size())
+        return true;
+
+    for (int i = 0; i < stats.tablet_stats_size(); i++) {
+        const ProtoBuf::MasterRecoveryInfo::TabletStats& now =
+            stats.tablet_stats(i);
+        const ProtoBuf::MasterRecoveryInfo::TabletStats& then =
+            lastReported.tablet_stats(i);
+        if (now.table_id() != then.table_id() ||
+            now.start_key_hash() != then.start_key_hash() ||
+            now.end_key_hash() != then.end_key_hash()) {
+            return true;
+        }
+        uint64_t change = now.byte_count() > then.byte_count() ?
+                            now.byte_count() - then.byte_count() :
+                            then.byte_count() - now.byte_count();
+        if (change > MIN_CHANGE_BYTES &&
+            change > then.byte_count() * CHANGE_PERCENT / 100) {
+            return true;
+        }
+    }
+    return false;
+}
+
 } //enamespace RAMCloud
@@ -16,16 +16,25 @@
 #ifndef RAMCLOUD_OBJECTMANAGER_H
 #define RAMCLOUD_OBJECTMANAGER_H
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "Common.h"
 #include "Log.h"
 #include "SideLog.h"
 #include "LogEntryHandlers.h"
 #include "HashTable.h"
+#include "KeyHashIndex.h"
 #include "Object.h"
+#include "OrderedKeyIndex.h"
 #include "SegmentManager.h"
 #include "SegmentIterator.h"
 #include "ReplicaManager.h"
 #include "ServerConfig.h"
+#include "ServerStatistics.pb.h"
 #include "SpinLock.h"
 #include "TabletManager.h"
 
@@ -46,6 +55,11 @@ namespace RAMCloud {
  */
 class ObjectManager : public LogEntryHandlers {
   public:
+    /// Largest number of keys prefetchObjects() accepts at once. Batches
+    /// much bigger than this would start evicting their own prefetched
+    /// cache lines before they are used.
+    static const uint32_t MAX_PREFETCH_BATCH = 16;
+
     ObjectManager(Context* context,
                   ServerId* serverId,
                   const ServerConfig* config,
@@ -56,6 +70,12 @@ class ObjectManager : public LogEntryHandlers {
                       Buffer* outBuffer,
                       RejectRules* rejectRules,
                       uint64_t* outVersion);
+    bool tryReadSmallObject(Key& key,
+                            uint32_t maxLength,
+                            Buffer* outBuffer,
+                            RejectRules* rejectRules,
+                            uint64_t* outVersion,
+                            Status* outStatus);
     Status writeObject(Key& key,
                        Buffer& value,
                        RejectRules* rejectRules,
@@ -65,8 +85,166 @@ class ObjectManager : public LogEntryHandlers {
                         uint64_t* outVersion);
     void syncChanges();
     void prefetchHashTableBucket(SegmentIterator* it);
-    void replaySegment(SideLog* sideLog, SegmentIterator& it);
+    void prefetchObjects(Key* keys[], uint32_t numKeys);
+    void replaySegment(SideLog* sideLog, SegmentIterator& it,
+                       const vector<uint32_t>* entryOffsets = NULL);
     void removeOrphanedObjects();
+    void getHashTableStatistics(ProtoBuf::ServerStatistics_HashTable* stats);
+
+    /**
+     * A fixed set of threads that replay recovery segments together, so
+     * that recovery isn't limited to the speed of a single core. Each
+     * thread appends to its own SideLog and replays only the objects and
+     * tombstones whose keys map to its own range of #hashTableBucketLocks
+     * (see getReplayShard()), so the threads don't contend for bucket locks
+     * or for a SideLog's append lock. Since all entries for a key are
+     * replayed by the same thread, version checks work just as in serial
+     * replay. The threads are started once and reused for every segment of
+     * a recovery.
+     */
+    class ReplayThreadPool {
+      public:
+        ReplayThreadPool(ObjectManager* objectManager,
+                         vector<SideLog*>& sideLogs);
+        ~ReplayThreadPool();
+        void replaySegment(SegmentIterator& it);
+
+      PRIVATE:
+        void workerMain(uint32_t shard);
+
+        /// The ObjectManager that segments are replayed into.
+        ObjectManager* objectManager;
+
+        /// One SideLog for each thread to replay into. All of them must be
+        /// committed before the replayed data is durable.
+        vector<SideLog*> sideLogs;
+
+        /// Protects #segment, #segmentCount and #stop.
+        std::mutex mutex;
+
+        /// Notified when a new segment is ready to replay or when #stop is
+        /// set.
+        std::condition_variable segmentReady;
+
+        /// The segment currently being replayed.
+        Tub<SegmentIterator> segment;
+
+        /// Incremented each time a new #segment is handed to the threads.
+        uint64_t segmentCount;
+
+        /// For each thread, the offsets in #segment of the entries it is to
+        /// replay. Filled in by replaySegment() before the threads are woken.
+        vector<vector<uint32_t>> slices;
+
+        /// For each thread, any exception it threw replaying #segment.
+        vector<std::exception_ptr> errors;
+
+        /// Number of threads still replaying their slice of #segment.
+        std::atomic<uint32_t> slicesRemaining;
+
+        /// Set by the destructor to tell the threads to exit.
+        bool stop;
+
+        /// The replay threads, one for each of #sideLogs.
+        vector<std::thread> threads;
+
+        DISALLOW_COPY_AND_ASSIGN(ReplayThreadPool);
+    };
+
+    /**
+     * Records how far copyTabletObjects has gotten in its walk over the
+     * objects of one tablet.
+     */
+    struct TabletScan {
+        TabletScan(uint64_t tableId, uint64_t startKeyHash,
+                   uint64_t endKeyHash)
+            : tableId(tableId)
+            , startKeyHash(startKeyHash)
+            , endKeyHash(endKeyHash)
+            , nextBucket(0)
+            , numBuckets(0)
+            , resizeCount(0)
+            , restarts(0)
+            , nextKeyHash(startKeyHash)
+            , done(false)
+        {
+        }
+
+        /// Returns true once every object in the tablet has been visited.
+        bool isDone() const { return done; }
+
+        double getProgress() const;
+
+        /// Table containing the tablet whose objects are wanted.
+        uint64_t tableId;
+
+        /// Smallest key hash in the tablet.
+        uint64_t startKeyHash;
+
+        /// Largest key hash in the tablet.
+        uint64_t endKeyHash;
+
+        /// Index of the next hash table bucket to visit.
+        uint64_t nextBucket;
+
+        /// Number of buckets in the hash table when the walk (last)
+        /// started. 0 means it hasn't started yet, or that the walk is
+        /// using the KeyHashIndex rather than visiting buckets.
+        uint64_t numBuckets;
+
+        /// The hash table's resize count when the walk (last) started. If
+        /// a resize finishes part way through, bucket indexes change
+        /// meaning and the walk starts over from the first bucket.
+        uint64_t resizeCount;
+
+        /// Number of times the walk has started over because of a resize.
+        uint64_t restarts;
+
+        /// When the master keeps a KeyHashIndex, the walk visits the
+        /// tablet's key hashes in increasing order instead of visiting
+        /// buckets; this is the smallest key hash not yet visited.
+        uint64_t nextKeyHash;
+
+        /// Set once the walk is complete.
+        bool done;
+    };
+
+    /**
+     * While an instance of this class exists, the log cleaner keeps every
+     * tombstone for the given range of keys, even once the object it
+     * deletes has been cleaned from the log. Tablet migration uses this so
+     * that objects deleted after they were copied stay deleted on the new
+     * owner: the catch-up pass can only send the tombstones it finds.
+     */
+    class TombstoneProtector {
+      public:
+        TombstoneProtector(ObjectManager* objectManager, uint64_t tableId,
+                           uint64_t firstKeyHash, uint64_t lastKeyHash);
+        ~TombstoneProtector();
+
+      PRIVATE:
+        /// The ObjectManager whose cleaner must keep the tombstones.
+        ObjectManager* objectManager;
+
+        /// Table containing the protected range.
+        uint64_t tableId;
+
+        /// Smallest key hash in the protected range.
+        uint64_t firstKeyHash;
+
+        /// Largest key hash in the protected range.
+        uint64_t lastKeyHash;
+
+        friend class ObjectManager;
+        DISALLOW_COPY_AND_ASSIGN(TombstoneProtector);
+    };
+
+    uint32_t copyTabletObjects(TabletScan* scan, uint32_t maxBytes,
+                               Buffer* objects, vector<uint32_t>* lengths);
+    bool scanObjects(uint64_t tableId, uint64_t firstKeyHash,
+                     uint64_t lastKeyHash, const string& startKey,
+                     const string& endKey, uint32_t maxBytes,
+                     Buffer* objects, string* nextKey);
 
     /**
      * The following two methods are used by the log cleaner. They aren't
@@ -121,6 +299,28 @@ class ObjectManager : public LogEntryHandlers {
             takeBucketLock(objectManager, bucket);
         }
 
+        /**
+         * This constructor is like the one above, except that it never waits:
+         * if another thread holds the lock, the object is constructed without
+         * it. Callers must check ownsLock() before using the bucket.
+         *
+         * \param objectManager
+         *      The ObjectManager that owns the hash table bucket to lock.
+         * \param key
+         *      Key whose corresponding bucket in the hash table will be locked.
+         */
+        HashTableBucketLock(ObjectManager& objectManager, Key& key,
+                            std::try_to_lock_t)
+            : lock(NULL)
+        {
+            uint64_t unused;
+            uint64_t bucket = HashTable::findBucketIndex(
+                objectManager.objectMap.getNumBuckets(), key, &unused);
+            SpinLock* bucketLock = objectManager.getBucketLock(bucket);
+            if (bucketLock->try_lock())
+                lock = bucketLock;
+        }
+
         /**
          * This constructor acquires the lock for a particular bucket index
          * in the hash table.
@@ -138,7 +338,18 @@ class ObjectManager : public LogEntryHandlers {
 
         ~HashTableBucketLock()
         {
-            lock->unlock();
+            if (lock != NULL)
+                lock->unlock();
+        }
+
+        /**
+         * Return true if this object holds its bucket lock. Only objects made
+         * with the std::try_to_lock constructor can return false.
+         */
+        bool
+        ownsLock()
+        {
+            return lock != NULL;
         }
 
       PRIVATE:
@@ -155,10 +366,7 @@ class ObjectManager : public LogEntryHandlers {
         takeBucketLock(ObjectManager& objectManager, uint64_t bucket)
         {
             assert(lock == NULL);
-            uint32_t numLocks = arrayLength(objectManager.hashTableBucketLocks);
-            assert(BitOps::isPowerOfTwo(numLocks));
-            uint64_t lockIndex = bucket & (numLocks - 1);
-            lock = &objectManager.hashTableBucketLocks[lockIndex];
+            lock = objectManager.getBucketLock(bucket);
             lock->lock();
         }
 
@@ -197,6 +405,12 @@ class ObjectManager : public LogEntryHandlers {
         /// removed.
         uint64_t lastReplaySegmentCount;
 
+        /// The value of #objectMap's resize count at the beginning of the
+        /// most recent pass. A pass that overlaps the end of a resize may
+        /// have skipped entries, so a change in this value also requires
+        /// another pass.
+        uint64_t lastResizeCount;
+
         /// The ObjectManager that owns the hash table to remove tombstones
         /// from in the #recoveryCleanup callback.
         ObjectManager* objectManager;
@@ -207,6 +421,144 @@ class ObjectManager : public LogEntryHandlers {
         DISALLOW_COPY_AND_ASSIGN(RemoveTombstonePoller);
     };
 
+    /**
+     * A Dispatch::Timer that periodically sends the approximate size of each
+     * of this master's tablets to the coordinator, so that if the master
+     * crashes its tablets can be split and packed into recovery partitions of
+     * roughly equal size (see Recovery::partitionTablets()). To keep
+     * coordinator updates rare, sizes are only sent when the set of tablets
+     * has changed or some tablet's size has changed significantly since the
+     * last report.
+     */
+    class TabletStatsReporter : public Dispatch::Timer {
+      public:
+        explicit TabletStatsReporter(ObjectManager* objectManager);
+        virtual void handleTimerEvent();
+        bool report();
+
+        /// How often tablet sizes are checked for changes.
+        enum { INTERVAL_MS = 5000 };
+
+        /// How soon to retry a report if the ReplicaManager was busy.
+        enum { RETRY_MS = 10 };
+
+        /// A tablet's size is reported again once its byte count has changed
+        /// by more than this percentage of its last reported size...
+        enum { CHANGE_PERCENT = 10 };
+
+        /// ...and by more than this many bytes, so that small tablets do not
+        /// cause frequent updates.
+        enum { MIN_CHANGE_BYTES = 1024 * 1024 };
+
+      PRIVATE:
+        bool changedSignificantly(const ProtoBuf::MasterRecoveryInfo& stats);
+
+        /// The ObjectManager whose tablets are reported on.
+        ObjectManager* objectManager;
+
+        /// The sizes included in the last successful report. Only the
+        /// tablet_stats field is used.
+        ProtoBuf::MasterRecoveryInfo lastReported;
+
+        /// False until the first report has been sent.
+        bool reported;
+
+        DISALLOW_COPY_AND_ASSIGN(TabletStatsReporter);
+    };
+
+    /**
+     * Occupancy of #objectMap, as estimated by sampleObjectMap().
+     */
+    struct HashTableSample {
+        /// Number of buckets in #objectMap when the sample was taken.
+        uint64_t numBuckets;
+
+        /// Number of buckets examined.
+        uint64_t sampledBuckets;
+
+        /// Total number of references found in the sampled buckets.
+        uint64_t numEntries;
+
+        /// Total number of cache lines in the sampled buckets' chains.
+        uint64_t numCacheLines;
+
+        /// Number of sampled buckets whose chain is longer than one cache
+        /// line.
+        uint64_t overflowedBuckets;
+
+        /// Length, in cache lines, of the longest chain sampled.
+        uint32_t maxChainLength;
+    };
+
+    /**
+     * Grows and shrinks #objectMap in the background as the number of
+     * objects on the master changes. A thread periodically samples the
+     * table; if too many buckets have overflowed their first cache line it
+     * doubles the table, and if the table is mostly empty it halves it.
+     * Entries are moved one migration unit at a time (see HashTable) while
+     * holding only that unit's HashTableBucketLock, so reads and writes
+     * keep running with low latency throughout a resize.
+     *
+     * Resizing never takes the table below one bucket per bucket lock.
+     * This keeps every bucket a key can map to during a resize covered by
+     * the same lock.
+     */
+    class HashTableResizer {
+      public:
+        HashTableResizer(ObjectManager* objectManager, uint64_t maxBuckets);
+        ~HashTableResizer();
+        void start();
+        void stop();
+        uint64_t chooseNewSize(const HashTableSample& sample);
+        void resize(uint64_t newNumBuckets);
+
+        /// How often the resizer thread samples the table when it has
+        /// nothing to migrate.
+        enum { POLL_USEC = 100000 };
+
+        /// Maximum number of buckets examined each time the table is
+        /// sampled.
+        enum { SAMPLE_BUCKETS = 4096 };
+
+        /// Number of migration units moved at a time before checking
+        /// whether the thread should exit.
+        enum { UNITS_PER_STEP = 1024 };
+
+        /// The table is doubled if more than this percentage of sampled
+        /// buckets have chained overflow cache lines.
+        enum { GROW_OVERFLOW_PERCENT = 5 };
+
+        /// The table is halved if it has at least this many buckets for
+        /// each entry in the sample.
+        enum { SHRINK_BUCKETS_PER_ENTRY = 2 };
+
+      PRIVATE:
+        static void resizerThreadEntry(HashTableResizer* resizer);
+        static uint64_t getKeyHash(uint64_t reference, void* cookie);
+        bool doWork();
+        void lockAllBuckets();
+        void migrateUnits(uint64_t count);
+        void unlockAllBuckets();
+
+        /// The ObjectManager whose #objectMap is resized.
+        ObjectManager* objectManager;
+
+        /// The table is never shrunk below this many buckets.
+        uint64_t minBuckets;
+
+        /// The table is never grown beyond this many buckets.
+        uint64_t maxBuckets;
+
+        /// Set to tell the resizer thread to return at its next
+        /// opportunity. A resize in progress is resumed by the next start().
+        bool threadShouldExit;
+
+        /// The resizer thread, if it has been started.
+        Tub<std::thread> thread;
+
+        DISALLOW_COPY_AND_ASSIGN(HashTableResizer);
+    };
+
     /**
      * Struct used to pass parameters into the removeIfOrphanedObject and
      * removeIfTombstone methods through the generic HashTable::forEachInBucket
@@ -221,6 +573,33 @@ class ObjectManager : public LogEntryHandlers {
         ObjectManager::HashTableBucketLock* lock;
     };
 
+    /**
+     * Struct used to pass parameters into copyIfInTablet through the
+     * generic HashTable::forEachInBucket method.
+     */
+    struct CopyTabletParameters {
+        /// Pointer to the ObjectManager class owning the hash table.
+        ObjectManager* objectManager;
+
+        /// Table whose objects are to be copied.
+        uint64_t tableId;
+
+        /// Only objects whose key hashes are at least this are copied.
+        uint64_t firstKeyHash;
+
+        /// Only objects whose key hashes are at most this are copied.
+        uint64_t lastKeyHash;
+
+        /// Buffer to append copies of the objects to.
+        Buffer* objects;
+
+        /// The length of each object copied is appended here.
+        vector<uint32_t>* lengths;
+
+        /// Incremented by the length of each object copied.
+        uint32_t totalBytes;
+    };
+
     bool lookup(HashTableBucketLock& lock,
                 Key& key,
                 LogEntryType& outType,
@@ -231,6 +610,32 @@ class ObjectManager : public LogEntryHandlers {
     bool replace(HashTableBucketLock& lock, Key& key, Log::Reference reference);
     static void removeIfOrphanedObject(uint64_t reference, void *cookie);
     static void removeIfTombstone(uint64_t maybeTomb, void *cookie);
+    static void copyIfInTablet(uint64_t reference, void *cookie);
+    uint32_t copyTabletObjectsFromIndex(TabletScan* scan, uint32_t maxBytes,
+                                        Buffer* objects,
+                                        vector<uint32_t>* lengths);
+    uint64_t getBucketIndex(uint64_t keyHash);
+    bool readObjectLocked(HashTableBucketLock& lock, Key& key,
+                          uint32_t maxLength, Buffer* outBuffer,
+                          RejectRules* rejectRules, uint64_t* outVersion,
+                          Status* outStatus);
+
+    /**
+     * Return the member of #hashTableBucketLocks that protects the given
+     * bucket of #objectMap.
+     */
+    SpinLock*
+    getBucketLock(uint64_t bucket)
+    {
+        uint32_t numLocks = arrayLength(hashTableBucketLocks);
+        assert(BitOps::isPowerOfTwo(numLocks));
+        return &hashTableBucketLocks[bucket & (numLocks - 1)];
+    }
+
+    uint32_t getReplayShard(SegmentIterator& it, uint32_t numShards);
+    void removeOrphanedObjectsFromIndex();
+    bool sampleObjectMap(uint64_t maxSampledBuckets, HashTableSample* sample);
+    void scanObjectMap(void (*callback)(uint64_t, void*));
 
     /**
      * Shared RAMCloud information.
@@ -305,6 +710,18 @@ class ObjectManager : public LogEntryHandlers {
      */
     SpinLock hashTableBucketLocks[1024];
 
+    /**
+     * Protects #tombstoneProtectors, which the cleaner reads while
+     * relocating tombstones.
+     */
+    SpinLock tombstoneProtectorsLock;
+
+    /**
+     * Ranges of keys whose tombstones the cleaner must keep; see
+     * TombstoneProtector.
+     */
+    vector<TombstoneProtector*> tombstoneProtectors;
+
     /**
      * Number of times the replaySegment() method returned (or threw an
      * exception). This is used by the RemoveTombstonePoller to decide when
@@ -322,6 +739,36 @@ class ObjectManager : public LogEntryHandlers {
      */
     Tub<RemoveTombstonePoller> tombstoneRemover;
 
+    /**
+     * Resizes #objectMap online. Only constructed if
+     * config->master.hashTableMaxBytes is nonzero; started once the
+     * server has enlisted.
+     */
+    Tub<HashTableResizer> hashTableResizer;
+
+    /**
+     * Reports tablet sizes to the coordinator. Constructed once the server
+     * has enlisted (under the Dispatch lock, which the parent constructor
+     * requires).
+     */
+    Tub<TabletStatsReporter> tabletStatsReporter;
+
+    /**
+     * Records the key hashes present in #objectMap, so that the objects of
+     * one tablet can be found without visiting every bucket. Only
+     * constructed if config->master.useKeyHashIndex is set. Updated by
+     * replace() and remove() while holding the key's bucket lock.
+     */
+    Tub<KeyHashIndex> keyHashIndex;
+
+    /**
+     * Records the keys present in #objectMap in sorted order, so that
+     * scanObjects() can return a range of keys. Only constructed if
+     * config->master.useOrderedKeyIndex is set. Updated by replace() and
+     * remove() while holding the key's bucket lock.
+     */
+    Tub<OrderedKeyIndex> orderedKeyIndex;
+
     friend void recoveryCleanup(uint64_t maybeTomb, void *cookie);
     friend void removeObjectIfFromUnknownTablet(uint64_t reference,
                                                 void *cookie);
@@ -335,9 +782,11 @@ class ObjectManager : public LogEntryHandlers {
                         LogEntryRelocator& relocator);
     void relocateTombstone(Buffer& oldBuffer,
                            LogEntryRelocator& relocator);
+    bool isTombstoneProtected(Key& key);
     void removeTombstones();
 
     friend class CleanerCompactionBenchmark;
+    friend class Enumeration;
 
     DISALLOW_COPY_AND_ASSIGN(ObjectManager);
 };
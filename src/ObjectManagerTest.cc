@@ -300,6 +300,23 @@ TEST_F(ObjectManagerTest, writeObject) {
               "writeObject: tombstone: 35 bytes, version 1", TestLog::get());
 }
 
+TEST_F(ObjectManagerTest, prefetchObjects) {
+    Key key1(0, "1", 1);
+    Key key2(0, "2", 1);
+    Key missing(0, "3", 1);
+    storeObject(key1, "one");
+    storeObject(key2, "two");
+
+    // Prefetching has no visible effect, even for keys that don't exist.
+    Key* keys[] = {&key1, &missing, &key2};
+    objectManager.prefetchObjects(keys, 3);
+    objectManager.prefetchObjects(keys, 0);
+
+    Buffer buffer;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key2, &buffer, 0, 0));
+    EXPECT_EQ("two", TestUtil::toString(&buffer));
+}
+
 TEST_F(ObjectManagerTest, readObject) {
     Buffer buffer;
     Key key(1, "1", 1);
@@ -696,6 +713,71 @@ TEST_F(ObjectManagerTest, replaySegment) {
     EXPECT_EQ(10UL, objectManager.segmentManager.safeVersion);
 }
 
+TEST_F(ObjectManagerTest, ReplayThreadPool) {
+    Segment s;
+    Tub<Key> keys[40];
+    char keyStrings[40][8];
+    for (int i = 0; i < 40; i++) {
+        snprintf(keyStrings[i], sizeof(keyStrings[i]), "key%d", i);
+        keys[i].construct(0, keyStrings[i],
+                          downCast<uint16_t>(strlen(keyStrings[i])));
+        Object object(*keys[i], keyStrings[i],
+                      downCast<uint32_t>(strlen(keyStrings[i]) + 1), 1, 0);
+        Buffer buffer;
+        object.serializeToBuffer(buffer);
+        EXPECT_TRUE(s.append(LOG_ENTRY_TYPE_OBJ, buffer));
+    }
+    Object deadObject(*keys[0], NULL, 0, 1, 0);
+    ObjectTombstone tomb(deadObject, 0, 0);
+    Buffer tombBuffer;
+    tomb.serializeToBuffer(tombBuffer);
+    EXPECT_TRUE(s.append(LOG_ENTRY_TYPE_OBJTOMB, tombBuffer));
+    s.close();
+    Segment::Certificate certificate;
+    s.getAppendedLength(&certificate);
+    Buffer segmentBuffer;
+    s.appendToBuffer(segmentBuffer);
+    uint32_t len = segmentBuffer.getTotalLength();
+    SegmentIterator it(segmentBuffer.getRange(0, len), len, certificate);
+
+    // Entries are spread over the threads, and a key's object and
+    // tombstone go to the same one.
+    uint32_t hits[3] = { 0, 0, 0 };
+    uint32_t key0Shard = 3;
+    for (SegmentIterator i = it; !i.isDone(); i.next()) {
+        uint32_t shard = objectManager.getReplayShard(i, 3);
+        ASSERT_LT(shard, 3U);
+        hits[shard]++;
+        if (i.getOffset() == 0)
+            key0Shard = shard;
+        if (i.getType() == LOG_ENTRY_TYPE_OBJTOMB)
+            EXPECT_EQ(key0Shard, shard);
+    }
+    EXPECT_NE(0U, hits[0]);
+    EXPECT_NE(0U, hits[1]);
+    EXPECT_NE(0U, hits[2]);
+
+    SideLog sl0(&objectManager.log);
+    SideLog sl1(&objectManager.log);
+    SideLog sl2(&objectManager.log);
+    vector<SideLog*> sideLogs = { &sl0, &sl1, &sl2 };
+    ObjectManager::ReplayThreadPool pool(&objectManager, sideLogs);
+    pool.replaySegment(it);
+    EXPECT_EQ(41U, pool.slices[0].size() + pool.slices[1].size() +
+                   pool.slices[2].size());
+
+    Log::Reference reference;
+    EXPECT_TRUE(lookup(*keys[0], &reference));
+    for (int i = 1; i < 40; i++)
+        verifyRecoveryObject(*keys[i], keyStrings[i]);
+    foreach (SideLog* sideLog, sideLogs)
+        sideLog->commit();
+    objectManager.removeTombstones();
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST, getObjectStatus(0, "key0", 4));
+    for (int i = 1; i < 40; i++)
+        verifyRecoveryObject(*keys[i], keyStrings[i]);
+}
+
 TEST_F(ObjectManagerTest, rejectOperation) {
     RejectRules empty, rules;
     memset(&empty, 0, sizeof(empty));
@@ -1148,4 +1230,524 @@ TEST_F(ObjectManagerTest, RemoveTombstonePoller_poll) {
     EXPECT_EQ("", TestLog::get());
 }
 
+TEST_F(ObjectManagerTest, RemoveTombstonePoller_poll_afterResize) {
+    ObjectManager::RemoveTombstonePoller* remover =
+        objectManager.tombstoneRemover.get();
+    ObjectManager::HashTableResizer resizer(&objectManager, 1 << 20);
+    resizer.resize(2048);
+
+    // A completed resize means a pass may have missed entries, so the
+    // remover makes another pass over the (now smaller) table.
+    TestLog::Enable _;
+    for (uint64_t i = 0; i < objectManager.objectMap.getNumBuckets(); i++)
+        objectManager.tombstoneRemover->poll();
+    EXPECT_EQ("poll: Cleanup of tombstones completed pass 0", TestLog::get());
+    EXPECT_EQ(1U, remover->passes);
+
+    TestLog::reset();
+    for (uint64_t i = 0; i < 2 * objectManager.objectMap.getNumBuckets(); i++)
+        objectManager.tombstoneRemover->poll();
+    EXPECT_EQ("", TestLog::get());
+}
+
+TEST_F(ObjectManagerTest, getHashTableStatistics) {
+    Buffer value;
+    value.append("hi", 2);
+    for (int i = 0; i < 100; i++) {
+        string stringKey = format("%d", i);
+        Key key(0, stringKey.c_str(), downCast<uint16_t>(stringKey.length()));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key, value, NULL, NULL));
+    }
+
+    ProtoBuf::ServerStatistics_HashTable stats;
+    objectManager.getHashTableStatistics(&stats);
+    EXPECT_EQ(16384U, stats.num_buckets());
+    EXPECT_EQ(4096U, stats.sampled_buckets());
+    EXPECT_EQ(0U, stats.resize_count());
+    EXPECT_GE(1.0, stats.load_factor());
+    EXPECT_EQ(1.0, stats.average_chain_length());
+    EXPECT_EQ(1U, stats.max_chain_length());
+    EXPECT_FALSE(stats.has_resize_progress());
+
+    // While a resize is in progress, its progress is reported instead.
+    HashTable& objectMap = objectManager.objectMap;
+    objectMap.prepareResize(32768);
+    objectMap.startResize();
+    stats.Clear();
+    objectManager.getHashTableStatistics(&stats);
+    EXPECT_EQ(16384U, stats.num_buckets());
+    EXPECT_EQ(0U, stats.sampled_buckets());
+    EXPECT_FALSE(stats.has_load_factor());
+    EXPECT_EQ(32768U, stats.resize_target_buckets());
+    EXPECT_EQ(0.0, stats.resize_progress());
+
+    ObjectManager::HashTableResizer resizer(&objectManager, 1 << 20);
+    resizer.resize(32768);
+    stats.Clear();
+    objectManager.getHashTableStatistics(&stats);
+    EXPECT_EQ(32768U, stats.num_buckets());
+    EXPECT_EQ(1U, stats.resize_count());
+}
+
+TEST_F(ObjectManagerTest, copyTabletObjects) {
+    tabletManager.addTablet(97, 0, ~0UL, TabletManager::NORMAL);
+    Buffer value;
+    value.append("hi", 2);
+    for (int i = 0; i < 100; i++) {
+        string stringKey = format("%d", i);
+        Key key0(0, stringKey.c_str(), downCast<uint16_t>(stringKey.length()));
+        Key key97(97, stringKey.c_str(),
+                  downCast<uint16_t>(stringKey.length()));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key0, value, NULL, NULL));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key97, value, NULL, NULL));
+    }
+
+    ObjectManager::TabletScan scan(97, 0, ~0UL);
+    Buffer objects;
+    vector<uint32_t> lengths;
+    uint32_t bytes = objectManager.copyTabletObjects(&scan, ~0U, &objects,
+                                                     &lengths);
+    EXPECT_TRUE(scan.isDone());
+    EXPECT_EQ(objectManager.objectMap.getNumBuckets(), scan.numBuckets);
+    EXPECT_EQ(0U, scan.restarts);
+    EXPECT_EQ(100U, lengths.size());
+    EXPECT_EQ(objects.getTotalLength(), bytes);
+
+    uint32_t offset = 0;
+    foreach (uint32_t length, lengths) {
+        Buffer object;
+        object.append(objects.getRange(offset, length), length);
+        offset += length;
+        Key key(LOG_ENTRY_TYPE_OBJ, object);
+        EXPECT_EQ(97U, key.getTableId());
+    }
+
+    // A subrange of the tablet.
+    ObjectManager::TabletScan half(97, 0, ~0UL / 2);
+    lengths.clear();
+    objectManager.copyTabletObjects(&half, ~0U, &objects, &lengths);
+    EXPECT_GT(100U, lengths.size());
+}
+
+TEST_F(ObjectManagerTest, copyTabletObjects_restartAfterResize) {
+    Key key(0, "1", 1);
+    Buffer value;
+    value.append("hi", 2);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key, value, NULL, NULL));
+
+    // Stop just after the bucket containing the object.
+    ObjectManager::TabletScan scan(0, 0, ~0UL);
+    Buffer objects;
+    vector<uint32_t> lengths;
+    objectManager.copyTabletObjects(&scan, 1, &objects, &lengths);
+    EXPECT_FALSE(scan.isDone());
+    EXPECT_EQ(1U, lengths.size());
+
+    uint64_t numBuckets = objectManager.objectMap.getNumBuckets();
+    ObjectManager::HashTableResizer resizer(&objectManager, numBuckets * 2);
+    resizer.resize(numBuckets * 2);
+
+    TestLog::Enable _;
+    objectManager.copyTabletObjects(&scan, ~0U, &objects, &lengths);
+    EXPECT_TRUE(scan.isDone());
+    EXPECT_EQ(1U, scan.restarts);
+    EXPECT_EQ(numBuckets * 2, scan.numBuckets);
+    EXPECT_EQ(2U, lengths.size());
+    EXPECT_EQ("copyTabletObjects: Hash table resized during scan of tablet "
+              "[0x0,0xffffffffffffffff] in tableId 0; restarting scan",
+              TestLog::get());
+}
+
+TEST_F(ObjectManagerTest, copyTabletObjects_keyHashIndex) {
+    objectManager.keyHashIndex.construct();
+    tabletManager.addTablet(97, 0, ~0UL, TabletManager::NORMAL);
+    Buffer value;
+    value.append("hi", 2);
+    for (int i = 0; i < 100; i++) {
+        string stringKey = format("%d", i);
+        Key key0(0, stringKey.c_str(), downCast<uint16_t>(stringKey.length()));
+        Key key97(97, stringKey.c_str(),
+                  downCast<uint16_t>(stringKey.length()));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key0, value, NULL, NULL));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key97, value, NULL, NULL));
+    }
+
+    // Copy a little at a time; objects come out in key hash order.
+    ObjectManager::TabletScan scan(97, 0, ~0UL);
+    Buffer objects;
+    vector<uint32_t> lengths;
+    EXPECT_EQ(0, scan.getProgress());
+    objectManager.copyTabletObjects(&scan, 1, &objects, &lengths);
+    EXPECT_EQ(1U, lengths.size());
+    EXPECT_FALSE(scan.isDone());
+    EXPECT_LT(0, scan.getProgress());
+    while (!scan.isDone())
+        objectManager.copyTabletObjects(&scan, 1000, &objects, &lengths);
+    EXPECT_EQ(1.0, scan.getProgress());
+    EXPECT_EQ(0U, scan.numBuckets);
+    EXPECT_EQ(100U, lengths.size());
+
+    uint32_t offset = 0;
+    uint64_t lastKeyHash = 0;
+    foreach (uint32_t length, lengths) {
+        Buffer object;
+        object.append(objects.getRange(offset, length), length);
+        offset += length;
+        Key key(LOG_ENTRY_TYPE_OBJ, object);
+        EXPECT_EQ(97U, key.getTableId());
+        EXPECT_LE(lastKeyHash, key.getHash());
+        lastKeyHash = key.getHash();
+    }
+
+    // A subrange of the tablet finds the same objects as a bucket walk.
+    ObjectManager::TabletScan half(97, 0, ~0UL / 2);
+    lengths.clear();
+    objectManager.copyTabletObjects(&half, ~0U, &objects, &lengths);
+    size_t fromIndex = lengths.size();
+    objectManager.keyHashIndex.destroy();
+    ObjectManager::TabletScan half2(97, 0, ~0UL / 2);
+    lengths.clear();
+    objectManager.copyTabletObjects(&half2, ~0U, &objects, &lengths);
+    EXPECT_EQ(lengths.size(), fromIndex);
+}
+
+TEST_F(ObjectManagerTest, keyHashIndex_maintained) {
+    objectManager.keyHashIndex.construct();
+    Key key1(0, "1", 1);
+    Key key2(0, "2", 1);
+    Buffer value;
+    value.append("hi", 2);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key1, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key1, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key2, value, NULL, NULL));
+    EXPECT_EQ(2U, objectManager.keyHashIndex->size());
+
+    EXPECT_EQ(STATUS_OK, objectManager.removeObject(key1, NULL, NULL));
+    EXPECT_EQ(1U, objectManager.keyHashIndex->size());
+    vector<uint64_t> keyHashes;
+    objectManager.keyHashIndex->lookup(0, 0, ~0UL, 10, &keyHashes);
+    ASSERT_EQ(1U, keyHashes.size());
+    EXPECT_EQ(key2.getHash(), keyHashes[0]);
+}
+
+TEST_F(ObjectManagerTest, removeOrphanedObjects_keyHashIndex) {
+    objectManager.keyHashIndex.construct();
+    tabletManager.addTablet(97, 0, ~0UL, TabletManager::NORMAL);
+    Key key1(97, "1", 1);
+    Key key2(97, "2", 1);
+    Key key3(0, "3", 1);
+    Buffer value;
+    value.append("hi", 2);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key1, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key2, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key3, value, NULL, NULL));
+
+    // Keep only the half of table 97 containing key2.
+    tabletManager.deleteTablet(97, 0, ~0UL);
+    uint64_t middle = (key1.getHash() + key2.getHash()) / 2;
+    if (key2.getHash() < key1.getHash())
+        tabletManager.addTablet(97, 0, middle, TabletManager::NORMAL);
+    else
+        tabletManager.addTablet(97, middle + 1, ~0UL, TabletManager::NORMAL);
+
+    TestLog::Enable _;
+    objectManager.removeOrphanedObjects();
+    EXPECT_EQ(
+        "removeIfOrphanedObject: removing orphaned object at ref 31457334 | "
+        "free: free on reference 31457334",
+        TestLog::get());
+    EXPECT_EQ(2U, objectManager.keyHashIndex->size());
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key2, &value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key3, &value, NULL, NULL));
+    tabletManager.addTablet(97, key1.getHash(), key1.getHash(),
+                            TabletManager::NORMAL);
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST,
+              objectManager.readObject(key1, &value, NULL, NULL));
+}
+
+TEST_F(ObjectManagerTest, orderedKeyIndex_maintained) {
+    objectManager.orderedKeyIndex.construct();
+    Key key1(0, "1", 1);
+    Key key2(0, "2", 1);
+    Buffer value;
+    value.append("hi", 2);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key1, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key1, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key2, value, NULL, NULL));
+    EXPECT_EQ(2U, objectManager.orderedKeyIndex->size());
+
+    EXPECT_EQ(STATUS_OK, objectManager.removeObject(key1, NULL, NULL));
+    EXPECT_EQ(1U, objectManager.orderedKeyIndex->size());
+    vector<string> keys;
+    objectManager.orderedKeyIndex->lookup(0, "", "", 10, &keys);
+    ASSERT_EQ(1U, keys.size());
+    EXPECT_EQ("2", keys[0]);
+}
+
+TEST_F(ObjectManagerTest, tabletSize_maintained) {
+    Key key(0, "1", 1);
+    Buffer value;
+    value.append("hi", 2);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key, value, NULL, NULL));
+    TabletManager::Tablet tablet;
+    EXPECT_TRUE(tabletManager.getTablet(0, 0, ~0UL, &tablet));
+    uint64_t bytes = tablet.byteCount;
+    EXPECT_LT(2U, bytes);
+    EXPECT_EQ(1U, tablet.objectCount);
+
+    // Overwriting replaces the old object's size.
+    Buffer largerValue;
+    largerValue.append("hello", 5);
+    EXPECT_EQ(STATUS_OK,
+              objectManager.writeObject(key, largerValue, NULL, NULL));
+    EXPECT_TRUE(tabletManager.getTablet(0, 0, ~0UL, &tablet));
+    EXPECT_EQ(bytes + 3, tablet.byteCount);
+    EXPECT_EQ(1U, tablet.objectCount);
+
+    EXPECT_EQ(STATUS_OK, objectManager.removeObject(key, NULL, NULL));
+    EXPECT_TRUE(tabletManager.getTablet(0, 0, ~0UL, &tablet));
+    EXPECT_EQ(0U, tablet.byteCount);
+    EXPECT_EQ(0U, tablet.objectCount);
+}
+
+static bool
+reportFilter(string s)
+{
+    return s == "report";
+}
+
+TEST_F(ObjectManagerTest, tabletStatsReporter_report) {
+    ObjectManager::TabletStatsReporter* reporter =
+        objectManager.tabletStatsReporter.get();
+    TestLog::Enable _(reportFilter);
+
+    EXPECT_TRUE(reporter->report());
+    EXPECT_EQ("report: reporting sizes of 1 tablets", TestLog::get());
+    EXPECT_EQ("tablet_stats { table_id: 0 start_key_hash: 0 "
+              "end_key_hash: 18446744073709551615 byte_count: 0 "
+              "object_count: 0 }",
+              reporter->lastReported.ShortDebugString());
+
+    // Nothing has changed.
+    TestLog::reset();
+    EXPECT_TRUE(reporter->report());
+    EXPECT_EQ("", TestLog::get());
+
+    // A new tablet.
+    tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+    EXPECT_TRUE(reporter->report());
+    EXPECT_EQ("report: reporting sizes of 2 tablets", TestLog::get());
+
+    // A small change in size.
+    TestLog::reset();
+    Key key(0, "1", 1);
+    Buffer value;
+    value.append("hi", 2);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(key, value, NULL, NULL));
+    EXPECT_TRUE(reporter->report());
+    EXPECT_EQ("", TestLog::get());
+
+    // A large change in size.
+    reporter->lastReported.mutable_tablet_stats(0)->set_byte_count(
+        100 * 1024 * 1024);
+    reporter->lastReported.mutable_tablet_stats(1)->set_byte_count(
+        100 * 1024 * 1024);
+    EXPECT_TRUE(reporter->report());
+    EXPECT_EQ("report: reporting sizes of 2 tablets", TestLog::get());
+}
+
+TEST_F(ObjectManagerTest, scanObjects) {
+    Buffer objects;
+    string nextKey;
+    EXPECT_THROW(objectManager.scanObjects(0, 0, ~0UL, "", "", 1000,
+                                           &objects, &nextKey),
+                 UnimplementedRequestError);
+
+    objectManager.orderedKeyIndex.construct();
+    Buffer value;
+    value.append("hi", 2);
+    for (int i = 0; i < 150; i++) {
+        string stringKey = format("%03d", i);
+        Key key0(0, stringKey.c_str(), downCast<uint16_t>(stringKey.length()));
+        Key key97(97, stringKey.c_str(),
+                  downCast<uint16_t>(stringKey.length()));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key0, value, NULL, NULL));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key97, value, NULL, NULL));
+    }
+    Key removed(97, "011", 3);
+    EXPECT_EQ(STATUS_OK, objectManager.removeObject(removed, NULL, NULL));
+
+    // Each object in the output is a length followed by the object; they
+    // come out in key order.
+    string keys;
+    EXPECT_TRUE(objectManager.scanObjects(97, 0, ~0UL, "009", "013", 1000,
+                                          &objects, &nextKey));
+    for (uint32_t offset = 0; offset < objects.getTotalLength(); ) {
+        uint32_t length = *objects.getOffset<uint32_t>(offset);
+        Buffer object;
+        object.append(objects.getRange(offset + 4, length), length);
+        offset += 4 + length;
+        Key key(LOG_ENTRY_TYPE_OBJ, object);
+        EXPECT_EQ(97U, key.getTableId());
+        keys += string(static_cast<const char*>(key.getStringKey()),
+                       key.getStringKeyLength()) + " ";
+    }
+    EXPECT_EQ("009 010 012 ", keys);
+
+    // A small limit still returns one object, then stops.
+    objects.reset();
+    EXPECT_FALSE(objectManager.scanObjects(97, 0, ~0UL, "100", "", 1,
+                                           &objects, &nextKey));
+    EXPECT_EQ("101", nextKey);
+    Buffer object;
+    object.append(objects.getRange(4, objects.getTotalLength() - 4),
+                  objects.getTotalLength() - 4);
+    Key key(LOG_ENTRY_TYPE_OBJ, object);
+    EXPECT_EQ(0, memcmp("100", key.getStringKey(), 3));
+
+    // Scans span more than one batch from the index.
+    objects.reset();
+    EXPECT_TRUE(objectManager.scanObjects(97, 0, ~0UL, "", "", ~0U,
+                                          &objects, &nextKey));
+    uint32_t count = 0;
+    for (uint32_t offset = 0; offset < objects.getTotalLength(); count++)
+        offset += 4 + *objects.getOffset<uint32_t>(offset);
+    EXPECT_EQ(149U, count);
+
+    // Keys whose hashes fall outside the tablet are skipped.
+    objects.reset();
+    Key key100(97, "100", 3);
+    EXPECT_TRUE(objectManager.scanObjects(97, key100.getHash() + 1,
+                                          key100.getHash() + 1, "100", "101",
+                                          ~0U, &objects, &nextKey));
+    EXPECT_EQ(0U, objects.getTotalLength());
+}
+
+TEST_F(ObjectManagerTest, scanObjects_nextKeyMustFit) {
+    objectManager.orderedKeyIndex.construct();
+    Buffer value;
+    value.append("hi", 2);
+    string longKey(200, 'c');
+    Key keyA(98, "a", 1);
+    Key keyB(98, "b", 1);
+    Key keyC(98, longKey.c_str(), downCast<uint16_t>(longKey.length()));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(keyA, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(keyB, value, NULL, NULL));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(keyC, value, NULL, NULL));
+
+    Buffer objects;
+    string nextKey;
+    EXPECT_FALSE(objectManager.scanObjects(98, 0, ~0UL, "a", "", 1,
+                                           &objects, &nextKey));
+    uint32_t objectBytes = objects.getTotalLength();
+
+    // "a" and "b" fit but the long key that follows them doesn't, so "b"
+    // is given back and the scan resumes from it.
+    objects.reset();
+    EXPECT_FALSE(objectManager.scanObjects(98, 0, ~0UL, "", "",
+                                           2 * objectBytes + 50,
+                                           &objects, &nextKey));
+    EXPECT_EQ(objectBytes, objects.getTotalLength());
+    EXPECT_EQ("b", nextKey);
+
+    // With room for the key, both objects are returned.
+    objects.reset();
+    EXPECT_FALSE(objectManager.scanObjects(98, 0, ~0UL, "", "",
+                                           2 * objectBytes + 200,
+                                           &objects, &nextKey));
+    EXPECT_EQ(2 * objectBytes, objects.getTotalLength());
+    EXPECT_EQ(longKey, nextKey);
+}
+
+TEST_F(ObjectManagerTest, HashTableResizer_chooseNewSize) {
+    ObjectManager::HashTableResizer resizer(&objectManager, 1 << 16);
+    ObjectManager::HashTableSample sample;
+    sample.numBuckets = 16384;
+    sample.sampledBuckets = 4096;
+    sample.numEntries = 4096 * 4;
+    sample.numCacheLines = 4096;
+    sample.overflowedBuckets = 0;
+    sample.maxChainLength = 1;
+
+    // Nicely balanced.
+    EXPECT_EQ(16384U, resizer.chooseNewSize(sample));
+
+    // Too many overflow chains.
+    sample.overflowedBuckets = 4096 / 10;
+    EXPECT_EQ(32768U, resizer.chooseNewSize(sample));
+
+    // ... but not beyond the maximum size.
+    sample.numBuckets = 1 << 16;
+    EXPECT_EQ(1U << 16, resizer.chooseNewSize(sample));
+
+    // Mostly empty.
+    sample.numBuckets = 16384;
+    sample.overflowedBuckets = 0;
+    sample.numEntries = 4096 / 4;
+    EXPECT_EQ(8192U, resizer.chooseNewSize(sample));
+
+    // ... but never smaller than the number of bucket locks.
+    sample.numBuckets = 1024;
+    EXPECT_EQ(1024U, resizer.chooseNewSize(sample));
+}
+
+TEST_F(ObjectManagerTest, HashTableResizer_resize) {
+    ObjectManager::HashTableResizer resizer(&objectManager, 1 << 16);
+    Buffer value;
+    value.append("hi", 2);
+    for (int i = 0; i < 1000; i++) {
+        string stringKey = format("%d", i);
+        Key key(0, stringKey.c_str(), downCast<uint16_t>(stringKey.length()));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key, value, NULL, NULL));
+    }
+
+    uint64_t sizes[] = { 32768, 1024, 1 << 20, 1 };
+    uint64_t expected[] = { 32768, 1024, 1 << 16, 1024 };
+    for (uint32_t s = 0; s < arrayLength(sizes); s++) {
+        resizer.resize(sizes[s]);
+        EXPECT_EQ(expected[s], objectManager.objectMap.getNumBuckets());
+        EXPECT_FALSE(objectManager.objectMap.isResizing());
+        for (int i = 0; i < 1000; i++) {
+            string stringKey = format("%d", i);
+            Key key(0, stringKey.c_str(),
+                    downCast<uint16_t>(stringKey.length()));
+            Buffer buffer;
+            EXPECT_EQ(STATUS_OK,
+                      objectManager.readObject(key, &buffer, NULL, NULL));
+        }
+    }
+}
+
+TEST_F(ObjectManagerTest, HashTableResizer_threadGrowsTable) {
+    ObjectManager::HashTableResizer resizer(&objectManager, 1 << 16);
+    resizer.resize(1024);
+
+    // Pack enough objects into 1024 buckets to overflow many of them.
+    Buffer value;
+    value.append("hi", 2);
+    for (int i = 0; i < 8192; i++) {
+        string stringKey = format("%d", i);
+        Key key(0, stringKey.c_str(), downCast<uint16_t>(stringKey.length()));
+        EXPECT_EQ(STATUS_OK,
+                  objectManager.writeObject(key, value, NULL, NULL));
+    }
+
+    resizer.start();
+    for (int i = 0; i < 1000; i++) {
+        if (objectManager.objectMap.getResizeCount() > 1)
+            break;
+        usleep(1000);
+    }
+    resizer.stop();
+    EXPECT_LT(1024U, objectManager.objectMap.getNumBuckets());
+}
+
 }  // namespace RAMCloud
@@ -0,0 +1,129 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "OrderedKeyIndex.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty index.
+ */
+OrderedKeyIndex::OrderedKeyIndex()
+    : shards()
+{
+}
+
+/**
+ * Record that a key has been added to the hash table.
+ *
+ * \param key
+ *      The key added.
+ */
+void
+OrderedKeyIndex::insert(Key& key)
+{
+    Shard& shard = getShard(key);
+    TableKey tableKey = makeTableKey(key);
+    std::lock_guard<SpinLock> lock(shard.lock);
+    shard.keys.insert(std::move(tableKey));
+}
+
+/**
+ * Record that a key has been removed from the hash table. Each call must
+ * match an earlier call to insert.
+ *
+ * \param key
+ *      The key removed.
+ */
+void
+OrderedKeyIndex::remove(Key& key)
+{
+    Shard& shard = getShard(key);
+    TableKey tableKey = makeTableKey(key);
+    std::lock_guard<SpinLock> lock(shard.lock);
+    size_t erased = shard.keys.erase(tableKey);
+    assert(erased == 1);
+    (void) erased;
+}
+
+/**
+ * Find the keys in a range of a table that are in the hash table.
+ *
+ * \param tableId
+ *      Table to look in.
+ * \param startKey
+ *      Smallest key to return.
+ * \param endKey
+ *      Return only keys less than this one. If empty, there is no upper
+ *      bound.
+ * \param maxKeys
+ *      Return at most this many keys: the smallest ones in the range.
+ * \param[out] keys
+ *      The keys found are appended here in increasing order. If fewer than
+ *      \a maxKeys are appended, there are no more in the range.
+ */
+void
+OrderedKeyIndex::lookup(uint64_t tableId, const string& startKey,
+                        const string& endKey, uint32_t maxKeys,
+                        vector<string>* keys)
+{
+    size_t start = keys->size();
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        Shard& shard = shards[i];
+        std::lock_guard<SpinLock> lock(shard.lock);
+        KeySet::iterator it =
+            shard.keys.lower_bound(std::make_pair(tableId, startKey));
+        for (uint32_t n = 0; n < maxKeys && it != shard.keys.end() &&
+                it->first == tableId &&
+                (endKey.empty() || it->second < endKey);
+                n++, it++) {
+            keys->push_back(it->second);
+        }
+    }
+
+    // Each shard contributed its smallest keys; keep the smallest overall.
+    std::sort(keys->begin() + start, keys->end());
+    if (keys->size() - start > maxKeys)
+        keys->resize(start + maxKeys);
+}
+
+/**
+ * Return the number of keys in the index.
+ */
+uint64_t
+OrderedKeyIndex::size()
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        std::lock_guard<SpinLock> lock(shards[i].lock);
+        total += shards[i].keys.size();
+    }
+    return total;
+}
+
+/**
+ * Return the entry under which a key is recorded in a shard.
+ */
+OrderedKeyIndex::TableKey
+OrderedKeyIndex::makeTableKey(Key& key)
+{
+    return TableKey(key.getTableId(),
+                    string(static_cast<const char*>(key.getStringKey()),
+                           key.getStringKeyLength()));
+}
+
+} // namespace RAMCloud
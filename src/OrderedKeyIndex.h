@@ -0,0 +1,97 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_ORDEREDKEYINDEX_H
+#define RAMCLOUD_ORDEREDKEYINDEX_H
+
+#include <set>
+
+#include "Common.h"
+#include "Key.h"
+#include "SpinLock.h"
+
+namespace RAMCloud {
+
+/**
+ * An OrderedKeyIndex records, for each table, the keys that currently have
+ * an entry in a master's object hash table, sorted by key. Tables are
+ * partitioned by key hash, so the hash table can only find objects by
+ * exact key; this index lets a master return the objects whose keys fall
+ * in a range (see MasterService::scan) without scanning the whole table.
+ *
+ * Like KeyHashIndex, the index is maintained by ObjectManager whenever a
+ * key is added to or removed from the hash table, while holding that key's
+ * bucket lock. The index is divided into shards by key hash so updates to
+ * keys in different buckets don't contend; lookups merge the shards.
+ *
+ * Each indexed key costs a std::set node plus a copy of the key, so the
+ * index is optional (see ServerConfig::Master::useOrderedKeyIndex).
+ *
+ * This class is thread-safe.
+ */
+class OrderedKeyIndex {
+  PUBLIC:
+    OrderedKeyIndex();
+    void insert(Key& key);
+    void remove(Key& key);
+    void lookup(uint64_t tableId, const string& startKey,
+                const string& endKey, uint32_t maxKeys, vector<string>* keys);
+    uint64_t size();
+
+  PRIVATE:
+    /// Number of independently locked pieces the index is divided into.
+    /// Must be a power of two.
+    enum { NUM_SHARDS = 16 };
+
+    /// A (tableId, key) pair; ordered by table, then bytewise by key.
+    typedef std::pair<uint64_t, string> TableKey;
+    typedef std::set<TableKey> KeySet;
+
+    /**
+     * One piece of the index, holding the keys whose hashes' low bits equal
+     * its index in #shards.
+     */
+    struct Shard {
+        Shard()
+            : lock("OrderedKeyIndex::Shard::lock")
+            , keys()
+        {
+        }
+
+        /// Protects #keys.
+        SpinLock lock;
+
+        /// The keys in this shard, in order.
+        KeySet keys;
+    };
+
+    /// Return the shard in which a key is recorded.
+    Shard&
+    getShard(Key& key)
+    {
+        return shards[key.getHash() & (NUM_SHARDS - 1)];
+    }
+
+    static TableKey makeTableKey(Key& key);
+
+    /// The index, divided into pieces by key hash.
+    Shard shards[NUM_SHARDS];
+
+    DISALLOW_COPY_AND_ASSIGN(OrderedKeyIndex);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_ORDEREDKEYINDEX_H
@@ -0,0 +1,107 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+
+#include "OrderedKeyIndex.h"
+
+namespace RAMCloud {
+
+/**
+ * Unit tests for OrderedKeyIndex.
+ */
+class OrderedKeyIndexTest : public ::testing::Test {
+  public:
+    OrderedKeyIndex index;
+
+    OrderedKeyIndexTest()
+        : index()
+    {
+    }
+
+    void
+    insert(uint64_t tableId, const char* stringKey)
+    {
+        Key key(tableId, stringKey, downCast<uint16_t>(strlen(stringKey)));
+        index.insert(key);
+    }
+
+    void
+    remove(uint64_t tableId, const char* stringKey)
+    {
+        Key key(tableId, stringKey, downCast<uint16_t>(strlen(stringKey)));
+        index.remove(key);
+    }
+
+    string
+    lookup(uint64_t tableId, const string& start, const string& end,
+           uint32_t max)
+    {
+        vector<string> keys;
+        index.lookup(tableId, start, end, max, &keys);
+        string result;
+        foreach (const string& key, keys) {
+            if (result.size() > 0)
+                result += " ";
+            result += key;
+        }
+        return result;
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(OrderedKeyIndexTest);
+};
+
+TEST_F(OrderedKeyIndexTest, insertAndRemove) {
+    insert(1, "b");
+    insert(1, "a");
+    insert(2, "a");
+    EXPECT_EQ(3U, index.size());
+    EXPECT_EQ("a b", lookup(1, "", "", 10));
+
+    remove(1, "a");
+    EXPECT_EQ("b", lookup(1, "", "", 10));
+    EXPECT_EQ("a", lookup(2, "", "", 10));
+    EXPECT_EQ(2U, index.size());
+}
+
+TEST_F(OrderedKeyIndexTest, lookup) {
+    for (int i = 0; i < 100; i++) {
+        string key = format("k%02d", i);
+        insert(1, key.c_str());
+        insert(2, key.c_str());
+    }
+
+    EXPECT_EQ("k10 k11 k12", lookup(1, "k10", "k13", 100));
+    EXPECT_EQ("k10 k11 k12", lookup(1, "k1", "k13", 3));
+    EXPECT_EQ("k98 k99", lookup(1, "k98", "", 100));
+    EXPECT_EQ("k00", lookup(1, "", "k01", 100));
+    EXPECT_EQ("", lookup(1, "k5", "k5", 100));
+    EXPECT_EQ("", lookup(3, "", "", 100));
+
+    // Keys are compared bytewise, so a prefix sorts first.
+    insert(1, "k1");
+    EXPECT_EQ("k1 k10", lookup(1, "k1", "k11", 100));
+
+    // Results are appended.
+    vector<string> keys(1, "x");
+    index.lookup(2, "k50", "k52", 10, &keys);
+    ASSERT_EQ(3U, keys.size());
+    EXPECT_EQ("x", keys[0]);
+    EXPECT_EQ("k50", keys[1]);
+    EXPECT_EQ("k51", keys[2]);
+}
+
+} // namespace RAMCloud
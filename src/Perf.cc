@@ -46,7 +46,9 @@
 #include "Memory.h"
 #include "MurmurHash3.h"
 #include "Object.h"
+#include "ObjectFinder.h"
 #include "ObjectPool.h"
+#include "RawMetrics.h"
 #include "Segment.h"
 #include "SegmentIterator.h"
 #include "SpinLock.h"
@@ -480,6 +482,56 @@ double murmur3()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Supplies ObjectFinder with a synthetic tablet map: 100 tables, each
+// split into 100 equal-sized tablets.
+struct SyntheticTabletMapFetcher : public ObjectFinder::TabletMapFetcher {
+    static const uint64_t NUM_TABLES = 100;
+    static const uint64_t TABLETS_PER_TABLE = 100;
+    void getTabletMap(ProtoBuf::Tablets& tabletMap) {
+        tabletMap.clear_tablet();
+        uint64_t tabletSpan = ~0UL / TABLETS_PER_TABLE;
+        for (uint64_t table = 0; table < NUM_TABLES; table++) {
+            for (uint64_t i = 0; i < TABLETS_PER_TABLE; i++) {
+                ProtoBuf::Tablets::Tablet& tablet(*tabletMap.add_tablet());
+                tablet.set_table_id(table);
+                tablet.set_start_key_hash(i * tabletSpan);
+                tablet.set_end_key_hash(i == TABLETS_PER_TABLE - 1 ?
+                                        ~0UL : (i + 1) * tabletSpan - 1);
+                tablet.set_state(ProtoBuf::Tablets_Tablet_State_NORMAL);
+                tablet.set_service_locator(format("mock:host=%lu.%lu",
+                                                  table, i));
+            }
+        }
+    }
+};
+
+// Measure the cost of ObjectFinder::lookupTablet when the cached tablet
+// map contains 10000 tablets.
+double objectFinderLookup()
+{
+    int count = 1000000;
+    Context context;
+    ObjectFinder finder(&context, new SyntheticTabletMapFetcher());
+
+    // Precompute random table ids and key hashes so the loop below only
+    // measures the lookups; the first lookup loads the tablet map.
+    vector<std::pair<uint64_t, uint64_t>> keys(1024);
+    for (size_t i = 0; i < keys.size(); i++) {
+        keys[i].first = generateRandom() %
+                SyntheticTabletMapFetcher::NUM_TABLES;
+        keys[i].second = generateRandom();
+    }
+    finder.lookupTablet(0, 0);
+
+    uint64_t start = Cycles::rdtsc();
+    for (int i = 0; i < count; i++) {
+        std::pair<uint64_t, uint64_t>& key = keys[i & 1023];
+        finder.lookupTablet(key.first, key.second);
+    }
+    uint64_t stop = Cycles::rdtsc();
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Starting with a new ObjectPool, measure the cost of Object
 // allocations. The pool may optionally be primed first to
 // measure the best-case performance.
@@ -575,6 +627,38 @@ double prefetch()
     return Cycles::toSeconds(totalTicks) / count / 16;
 }
 
+// A counter shared by all threads running sharedMetricInc, which is how
+// RawMetrics used to be updated before it was split into per-thread shards.
+static std::atomic_ulong sharedMetric;
+
+// Increment a metric count times. If sharded is true the calling thread's
+// RawMetrics shard is used, otherwise #sharedMetric is.
+template<bool sharded>
+void metricIncHelper(int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (sharded)
+            metrics->temp.count0++;
+        else
+            sharedMetric++;
+    }
+}
+
+// Measure the cost of incrementing a metric while another thread is
+// incrementing the same metric.
+template<bool sharded>
+double metricInc()
+{
+    int count = 10000000;
+    metrics->temp.count0 = 0;
+    std::thread other(metricIncHelper<sharded>, count);
+    uint64_t start = Cycles::rdtsc();
+    metricIncHelper<sharded>(count);
+    uint64_t stop = Cycles::rdtsc();
+    other.join();
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Measure the cost of reading the fine-grain cycle counter.
 double rdtscTest()
 {
@@ -935,12 +1019,16 @@ TestInfo tests[] = {
      "128-bit MurmurHash3 (64-bit optimised) on 1 byte of data"},
     {"murmur3", murmur3<256>,
      "128-bit MurmurHash3 hash (64-bit optimised) on 256 bytes of data"},
+    {"objectFinderLookup", objectFinderLookup,
+     "ObjectFinder::lookupTablet with 10000 tablets"},
     {"objectPoolAlloc", objectPoolAlloc<int, false>,
      "Cost of new allocations from an ObjectPool (no destroys)"},
     {"objectPoolRealloc", objectPoolAlloc<int, true>,
      "Cost of ObjectPool allocation after destroying an object"},
     {"prefetch", prefetch,
      "Prefetch instruction"},
+    {"rawMetricInc", metricInc<true>,
+     "Increment a RawMetric (2 threads, per-thread shards)"},
     {"rdtsc", rdtscTest,
      "Read the fine-grain cycle counter"},
     {"segmentEntrySort", segmentEntrySort,
@@ -951,6 +1039,8 @@ TestInfo tests[] = {
      "Create/delete SessionRef"},
     {"sfence", sfence,
      "Sfence instruction"},
+    {"sharedMetricInc", metricInc<false>,
+     "Increment a shared atomic counter (2 threads)"},
     {"spinLock", spinLock,
      "Acquire/release SpinLock"},
     {"startStopTimer", startStopTimer,
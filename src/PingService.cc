@@ -49,7 +49,7 @@ PingService::getMetrics(const WireFormat::GetMetrics::Request* reqHdr,
              Rpc* rpc)
 {
     string serialized;
-    metrics->serialize(serialized);
+    RawMetrics::serialize(serialized);
     respHdr->messageLength = downCast<uint32_t>(serialized.length());
     memcpy(new(rpc->replyPayload, APPEND) uint8_t[respHdr->messageLength],
            serialized.c_str(), respHdr->messageLength);
@@ -102,7 +102,7 @@ PriorityTask::deschedule()
 PriorityTaskQueue::PriorityTaskQueue()
     : mutex()
     , changes()
-    , thread()
+    , threads()
     , running(true)
     , tasks(PriorityTaskQueue::entryLessThan)
     , entryPool()
@@ -112,7 +112,7 @@ PriorityTaskQueue::PriorityTaskQueue()
 }
 
 /**
- * Halts outstanding tasks and destroys the thread used by this instance to
+ * Halts outstanding tasks and destroys the threads used by this instance to
  * perform tasks in the background.
  */
 PriorityTaskQueue::~PriorityTaskQueue()
@@ -210,7 +210,7 @@ try {
 /**
  * Notify any executing calls to performTaskUntilHalt() that they should
  * exit as soon as they finish executing any currently executing task, if
- * any. This includes the thread created by start() if it was called.
+ * any. This includes the threads created by start() if it was called.
  */
 void
 PriorityTaskQueue::halt()
@@ -219,23 +219,29 @@ PriorityTaskQueue::halt()
     running = false;
     changes.notify_all();
     lock.unlock();
-    if (thread)
-        thread->join();
-    thread.destroy();
+    foreach (std::thread& thread, threads)
+        thread.join();
+    threads.clear();
 }
 
 /**
  * Start performing enqueued tasks in the background.
  * Calling start() on an instance that is already started has no effect.
+ *
+ * \param threadCount
+ *      Number of threads which perform tasks concurrently. Tasks are still
+ *      started in priority order, but up to this many may be executing at
+ *      once, so tasks which share state must synchronize access to it.
  */
 void
-PriorityTaskQueue::start()
+PriorityTaskQueue::start(uint32_t threadCount)
 {
     Lock _(mutex);
-    if (thread)
+    if (!threads.empty())
         return;
     running = true;
-    thread.construct(&PriorityTaskQueue::main, this);
+    for (uint32_t i = 0; i < std::max(threadCount, 1u); ++i)
+        threads.emplace_back(&PriorityTaskQueue::main, this);
 }
 
 /**
@@ -136,9 +136,9 @@ class PriorityTask {
  * and TaskQueue instead.
  *
  * Users of PriorityTaskQueue have three choices how/when tasks get executed:
- * 1) Calling start() creates a thread which executes tasks until halt() is
- *    called. Whenever the queue is empty the thread will sleep waiting for
- *    new tasks.
+ * 1) Calling start() creates one or more threads which execute tasks until
+ *    halt() is called. Whenever the queue is empty the threads will sleep
+ *    waiting for new tasks.
  * 2) Calling performTasksUntilHalt() blocks the calling thread until halt()
  *    is called. Just as above, whenever there are no tasks to perform the
  *    thread will be put to sleep.
@@ -156,7 +156,7 @@ class PriorityTaskQueue {
     void performTask();
     void performTasksUntilHalt();
     void main();
-    void start();
+    void start(uint32_t threadCount = 1);
     void halt();
 
     void quiesce();
@@ -188,10 +188,10 @@ class PriorityTaskQueue {
     std::condition_variable changes;
 
     /**
-     * If start() is call, drives main() waiting for new tasks and performing
-     * them one-at-a-time. Exits if halt() is called.
+     * If start() is called, each drives main() waiting for new tasks and
+     * performing them one-at-a-time. Exit if halt() is called.
      */
-    Tub<std::thread> thread;
+    std::vector<std::thread> threads;
 
     /// If false exit (from performTasksUntilHalt()) on the next task pop.
     bool running;
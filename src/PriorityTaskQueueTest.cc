@@ -137,6 +137,21 @@ TEST_F(PriorityTaskQueueTest, startHalt)
     taskQueue.halt();
 }
 
+TEST_F(PriorityTaskQueueTest, startMultipleThreads)
+{
+    taskQueue.start(4);
+    EXPECT_EQ(4lu, taskQueue.threads.size());
+    taskQueue.start(2);
+    EXPECT_EQ(4lu, taskQueue.threads.size());
+    task1.schedule(PriorityTask::LOW);
+    task2.schedule(PriorityTask::LOW);
+    taskQueue.quiesce();
+    EXPECT_EQ(1, task1.count);
+    EXPECT_EQ(1, task2.count);
+    taskQueue.halt();
+    EXPECT_EQ(0lu, taskQueue.threads.size());
+}
+
 TEST_F(PriorityTaskQueueTest, schedule)
 {
     task1.schedule(PriorityTask::LOW);
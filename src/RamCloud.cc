@@ -1194,6 +1194,131 @@ RemoveRpc::wait(uint64_t* version)
         ClientException::throwException(HERE, respHdr->common.status);
 }
 
+/**
+ * Retrieve the objects of a table whose keys fall in a given range, in
+ * increasing key order. Like enumerateTable, this is invoked repeatedly;
+ * each invocation returns the next objects in the range from one tablet.
+ * Because a table's tablets are divided by key hash, objects are in key
+ * order within each tablet; a caller needing a single sorted stream must
+ * merge the results from the table's tablets.
+ *
+ * The masters owning the table must keep an ordered key index (see
+ * ServerConfig::Master::useOrderedKeyIndex); otherwise this method throws
+ * UnimplementedRequestError.
+ *
+ * \param tableId
+ *      The table being scanned (return value from a previous call to
+ *      getTableId).
+ * \param tabletFirstHash
+ *      Where to continue the scan. The caller should provide zero on the
+ *      initial call. On subsequent calls, the caller should pass the return
+ *      value from the previous call.
+ * \param startKey
+ *      Smallest key to return. Must be the same on every call of a scan.
+ * \param startKeyLength
+ *      Size in bytes of \a startKey.
+ * \param endKey
+ *      Only keys (bytewise) less than this one are returned. Must be the
+ *      same on every call of a scan.
+ * \param endKeyLength
+ *      Size in bytes of \a endKey; 0 means there is no upper bound.
+ * \param[in,out] state
+ *      Holds the state of the scan; opaque to the caller. On the initial
+ *      call this Buffer should be empty. At the end of each call the
+ *      contents are modified to hold the current state of the scan. The
+ *      caller must return the new value each time this method is invoked.
+ * \param[out] objects
+ *      After a successful return, this buffer will contain zero or more
+ *      objects from the requested tablet, in key order and in the same
+ *      format as for enumerateTable.
+ *
+ * \return
+ *      A key hash indicating where to continue the scan; it must be passed
+ *      to the next call to this method as the \a tabletFirstHash argument.
+ *      A zero return value, combined with an empty \a state, means that
+ *      the scan has finished.
+ */
+uint64_t
+RamCloud::scanTable(uint64_t tableId, uint64_t tabletFirstHash,
+        const void* startKey, uint16_t startKeyLength,
+        const void* endKey, uint16_t endKeyLength,
+        Buffer& state, Buffer& objects)
+{
+    ScanTableRpc rpc(this, tableId, tabletFirstHash, startKey, startKeyLength,
+            endKey, endKeyLength, state, objects);
+    return rpc.wait(state);
+}
+
+/**
+ * Constructor for ScanTableRpc: initiates an RPC in the same way as
+ * #RamCloud::scanTable, but returns once the RPC has been initiated,
+ * without waiting for it to complete.
+ *
+ * \copydetails RamCloud::scanTable
+ */
+ScanTableRpc::ScanTableRpc(RamCloud* ramcloud, uint64_t tableId,
+        uint64_t tabletFirstHash, const void* startKey,
+        uint16_t startKeyLength, const void* endKey, uint16_t endKeyLength,
+        Buffer& state, Buffer& objects)
+    : ObjectRpcWrapper(ramcloud, tableId, tabletFirstHash,
+            sizeof(WireFormat::Scan::Response), &objects)
+{
+    WireFormat::Scan::Request* reqHdr(allocHeader<WireFormat::Scan>());
+    reqHdr->tableId = tableId;
+    reqHdr->tabletFirstHash = tabletFirstHash;
+
+    // The state holds the key at which to resume within this tablet; it is
+    // empty when starting a tablet.
+    if (state.getTotalLength() > 0) {
+        reqHdr->startKeyLength = downCast<uint16_t>(state.getTotalLength());
+        for (Buffer::Iterator it(state); !it.isDone(); it.next())
+            request.append(it.getData(), it.getLength());
+    } else {
+        reqHdr->startKeyLength = startKeyLength;
+        request.append(startKey, startKeyLength);
+    }
+    reqHdr->endKeyLength = endKeyLength;
+    request.append(endKey, endKeyLength);
+    send();
+}
+
+/**
+ * Wait for a scan RPC to complete, and return the same results as
+ * #RamCloud::scanTable.
+ *
+ * \param[out] state
+ *      Will be filled in with the current state of the scan as of this
+ *      method's return. Must be passed back to this class as the \a state
+ *      parameter to the constructor when retrieving the next objects.
+ * \return
+ *      A key hash indicating where to continue the scan; it must be passed
+ *      to the constructor as the \a tabletFirstHash argument when
+ *      retrieving the next objects. A zero return value, combined with an
+ *      empty \a state, means that the scan has finished.
+ */
+uint64_t
+ScanTableRpc::wait(Buffer& state)
+{
+    simpleWait(ramcloud->clientContext->dispatch);
+    const WireFormat::Scan::Response* respHdr(
+            getResponseHeader<WireFormat::Scan>());
+    uint64_t result = respHdr->tabletFirstHash;
+
+    uint32_t nextKeyLength = respHdr->nextKeyLength;
+    state.reset();
+    response->copy(sizeof32(*respHdr) + respHdr->payloadBytes,
+            nextKeyLength, new(&state, APPEND) char[nextKeyLength]);
+
+    // Leave just the objects in the response buffer (the \c objects
+    // argument from the constructor).
+    assert(response->getTotalLength() == sizeof(*respHdr) +
+            respHdr->payloadBytes + nextKeyLength);
+    response->truncateFront(sizeof(*respHdr));
+    response->truncateEnd(nextKeyLength);
+
+    return result;
+}
+
 /**
  * Divide a tablet into two separate tablets.
  *
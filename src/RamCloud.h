@@ -72,6 +72,10 @@ class RamCloud {
             uint64_t* version = NULL);
     void remove(uint64_t tableId, const void* key, uint16_t keyLength,
             const RejectRules* rejectRules = NULL, uint64_t* version = NULL);
+    uint64_t scanTable(uint64_t tableId, uint64_t tabletFirstHash,
+            const void* startKey, uint16_t startKeyLength,
+            const void* endKey, uint16_t endKeyLength,
+            Buffer& state, Buffer& objects);
     void splitTablet(const char* name, uint64_t splitKeyHash);
     void testingFill(uint64_t tableId, const void* key, uint16_t keyLength,
             uint32_t numObjects, uint32_t objectSize);
@@ -585,6 +589,23 @@ class RemoveRpc : public ObjectRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(RemoveRpc);
 };
 
+/**
+ * Encapsulates the state of a RamCloud::scanTable
+ * request, allowing it to execute asynchronously.
+ */
+class ScanTableRpc : public ObjectRpcWrapper {
+  public:
+    ScanTableRpc(RamCloud* ramcloud, uint64_t tableId,
+            uint64_t tabletFirstHash, const void* startKey,
+            uint16_t startKeyLength, const void* endKey,
+            uint16_t endKeyLength, Buffer& state, Buffer& objects);
+    ~ScanTableRpc() {}
+    uint64_t wait(Buffer& state);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(ScanTableRpc);
+};
+
 /**
  * Encapsulates the state of a RamCloud::testingSetRuntimeOption operation,
  * allowing it to execute asynchronously.
@@ -25,21 +25,97 @@
 namespace RAMCloud {
 
 namespace {
-    /// See #metrics.
-    RawMetrics _metrics;
+/**
+ * Keeps track of every RawMetrics shard that has been allocated, so that they
+ * can be combined by RawMetrics::serialize.
+ */
+struct ShardRegistry {
+    ShardRegistry()
+        : mutex()
+        , shards()
+        , freeShards()
+        , threadExitKey()
+    {
+        pthread_key_create(&threadExitKey, RawMetrics::releaseShard);
+    }
+
+    /// Serializes access to the fields below.
+    std::mutex mutex;
+
+    /// All shards ever allocated. Shards are never freed.
+    std::vector<RawMetrics*> shards;
+
+    /// Shards whose threads have exited; these are reused by new threads.
+    std::vector<RawMetrics*> freeShards;
+
+    /// Thread-specific key whose destructor returns a thread's shard to
+    /// #freeShards when the thread exits.
+    pthread_key_t threadExitKey;
 };
 
 /**
- * Stores recovery metrics.
- * This is a pointer for future expansion. It always points to the same RawMetrics
- * object now.
+ * Return the ShardRegistry (constructed on first use, so that metrics can be
+ * used safely from other static initializers).
+ */
+ShardRegistry&
+registry()
+{
+    static ShardRegistry registry;
+    return registry;
+}
+} // anonymous namespace
+
+/**
+ * Stores performance counters and other metrics for the calling thread.
+ * Code just writes metrics->group.name += ...; the thread's RawMetrics
+ * shard is allocated the first time it is used.
  */
-RawMetrics* metrics = &_metrics;
+__thread RawMetricsShard metrics = {NULL};
 
 /**
- * This method is invoked from the constructor (which is defined in
- * RawMetrics.in.h).  It initializes a few special "metrics" that contain
- * general information about the server.
+ * Return a RawMetrics shard for the calling thread to use exclusively. This
+ * is invoked by RawMetricsShard the first time a thread uses #metrics.
+ */
+RawMetrics*
+RawMetrics::allocateShard()
+{
+    ShardRegistry& r = registry();
+    std::lock_guard<std::mutex> _(r.mutex);
+
+    RawMetrics* shard;
+    if (!r.freeShards.empty()) {
+        shard = r.freeShards.back();
+        r.freeShards.pop_back();
+    } else {
+        shard = new RawMetrics();
+        if (r.shards.empty())
+            shard->init();
+        r.shards.push_back(shard);
+    }
+
+    // Arrange for releaseShard to run when this thread exits.
+    pthread_setspecific(r.threadExitKey, shard);
+    return shard;
+}
+
+/**
+ * Make a shard available to other threads once the thread that was using it
+ * has exited. Its counts are kept and continue to be included by serialize.
+ *
+ * \param shard
+ *      The RawMetrics shard of the exiting thread.
+ */
+void
+RawMetrics::releaseShard(void* shard)
+{
+    ShardRegistry& r = registry();
+    std::lock_guard<std::mutex> _(r.mutex);
+    r.freeShards.push_back(static_cast<RawMetrics*>(shard));
+}
+
+/**
+ * This method is invoked on the first shard that is allocated. It initializes
+ * a few special "metrics" that contain general information about the server.
  */
 void
 RawMetrics::init()
@@ -52,7 +128,7 @@ RawMetrics::init()
 
 /**
  * Generate a string that contains a serialized representation of all of the
- * performance counters.
+ * performance counters. The values of all threads' shards are combined.
  *
  * \param out
  *      The contents of this variable are replaced with a (binary) string
@@ -61,17 +137,61 @@ RawMetrics::init()
 void
 RawMetrics::serialize(std::string& out)
 {
+     // Make sure the calling thread's shard exists (so there's at least one
+     // to take names from) before grabbing the lock.
+     RawMetrics* local = metrics.operator->();
+
+     ShardRegistry& r = registry();
+     std::lock_guard<std::mutex> _(r.mutex);
+
      ProtoBuf::MetricList list;
      for (int i = 0; i < numMetrics; i++) {
-        MetricInfo info = metricInfo(i);
+        MetricInfo info = local->metricInfo(i);
+        uint64_t value = 0;
+        foreach (RawMetrics* shard, r.shards) {
+            uint64_t shardValue = *shard->metricInfo(i).value;
+            if (info.isGauge)
+                value = std::max(value, shardValue);
+            else
+                value += shardValue;
+        }
         ProtoBuf::MetricList_Entry* metric = list.add_metric();
         metric->set_name(info.name);
-        metric->set_value(*info.value);
+        metric->set_value(value);
      }
      out.clear();
      list.SerializeToString(&out);
 }
 
+/**
+ * Return the value of a counter summed over every thread's shard. This is
+ * what serialize() would report for it; code that computes a delta of a
+ * counter bumped by other threads must use this rather than reading its own
+ * shard.
+ *
+ * \param metric
+ *      The counter in the calling thread's shard, e.g.
+ *      metrics->transport.transmit.byteCount.
+ */
+uint64_t
+RawMetrics::total(const RawMetric& metric)
+{
+    const RawMetrics* local = metrics.operator->();
+    size_t offset = reinterpret_cast<const char*>(&metric) -
+                    reinterpret_cast<const char*>(local);
+    assert(offset < sizeof(RawMetrics));
+
+    ShardRegistry& r = registry();
+    std::lock_guard<std::mutex> _(r.mutex);
+
+    uint64_t value = 0;
+    foreach (RawMetrics* shard, r.shards) {
+        value += *reinterpret_cast<const RawMetric*>(
+                reinterpret_cast<const char*>(shard) + offset);
+    }
+    return value;
+}
+
 }  // namespace RAMCloud
 
 // This file is automatically generated from scripts/rawmetrics.py; it defines
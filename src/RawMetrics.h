@@ -24,9 +24,16 @@
 #include <cstdatomic>
 #endif
 
+#include <mutex>
+#include <vector>
+
+#include "Common.h"
+
 #if !DISABLE_METRICS
 namespace RAMCloud {
-typedef std::atomic_ulong RawMetric;
+/// Each thread updates its own copy of the metrics (see RawMetricsShard), so
+/// a RawMetric is a plain integer and incrementing it is a non-atomic add.
+typedef uint64_t RawMetric;
 } // namespace RAMCloud
 #else
 #include "NoOp.h"
@@ -40,10 +47,19 @@ namespace RAMCloud {
 /**
  * This class is used internally by servers to collect performance counters
  * and other useful metrics.
+ *
+ * To keep hot counters from bouncing cache lines between cores, there is one
+ * RawMetrics object (a "shard") per thread: the #metrics variable refers to
+ * the calling thread's shard, which is allocated on first use. Shards are only
+ * combined when the metrics are read out by serialize(). When a thread exits
+ * its shard is kept, along with its counts, and handed to the next new thread.
  */
 class RawMetrics {
   public:
-    void serialize(std::string& out);
+    static void serialize(std::string& out);
+    static uint64_t total(const RawMetric& metric);
+    static RawMetrics* allocateShard();
+    static void releaseShard(void* shard);
   private:
     void init();
 
@@ -57,6 +73,11 @@ class RawMetrics {
 
         /// Pointer to the metric's value in this RawMetrics object.
         RawMetric* value;
+
+        /// True means the metric holds a value rather than a count (e.g. a
+        /// server id), so shards are combined by taking their maximum rather
+        /// than their sum.
+        bool isGauge;
     };
 
     /**
@@ -80,7 +101,25 @@ class RawMetrics {
 #include "RawMetrics.in.h"
 };
 
-extern RawMetrics* metrics;
+/**
+ * Refers to the calling thread's RawMetrics shard, allocating it the first
+ * time it is used. This has no constructor so that it can be a gcc "__thread"
+ * variable (see #metrics).
+ */
+struct RawMetricsShard {
+    RawMetrics*
+    operator->()
+    {
+        if (expect_false(shard == NULL))
+            shard = RawMetrics::allocateShard();
+        return shard;
+    }
+
+    /// This thread's shard, or NULL if it has not been allocated yet.
+    RawMetrics* shard;
+};
+
+extern __thread RawMetricsShard metrics;
 } // namespace RAMCloud
 
 #endif // RAMCLOUD_RAWMETRICS_H
@@ -24,24 +24,90 @@ namespace RAMCloud {
 class MetricsTest : public ::testing::Test {
   public:
     MetricsTest() { }
+
+    // Return the serialized value of the given metric, or -1 if it doesn't
+    // exist.
+    static int64_t
+    getSerialized(const char* name)
+    {
+        string serialized;
+        RawMetrics::serialize(serialized);
+        ProtoBuf::MetricList list;
+        list.ParseFromString(serialized);
+        for (int i = 0; i < list.metric_size(); i++) {
+            const ProtoBuf::MetricList_Entry& metric = list.metric(i);
+            if (metric.name().compare(name) == 0)
+                return static_cast<int64_t>(metric.value());
+        }
+        return -1;
+    }
+
     DISALLOW_COPY_AND_ASSIGN(MetricsTest);
 };
 
+static RawMetrics* otherShard;
+
+static void
+setOtherMetrics()
+{
+    otherShard = metrics.operator->();
+    metrics->temp.count1 += 5;
+    metrics->temp.count2 = 7;
+    metrics->master.replicas = 1LU << 60;
+}
+
 TEST_F(MetricsTest, serialize) {
-    RawMetrics metrics;
-    metrics.master.recoveryTicks = 12345;
-    string serialized;
-    metrics.serialize(serialized);
-    ProtoBuf::MetricList list;
-    list.ParseFromString(serialized);
-    for (int i = 0; i < list.metric_size(); i++) {
-        const ProtoBuf::MetricList_Entry& metric = list.metric(i);
-        if (metric.name().compare("master.recoveryTicks") == 0) {
-            EXPECT_EQ(12345U, metric.value());
-            return;
-        }
-    }
-    FAIL() << "master.recoveryTicks record not found";
+    metrics->master.recoveryTicks = 12345;
+    EXPECT_EQ(12345, getSerialized("master.recoveryTicks"));
+    EXPECT_EQ(-1, getSerialized("master.bogus"));
+}
+
+TEST_F(MetricsTest, serialize_combinesShards) {
+    metrics->temp.count1 = 10;
+    metrics->temp.count2 = 0;
+    metrics->master.replicas = 2;
+
+    std::thread thread(setOtherMetrics);
+    thread.join();
+    EXPECT_NE(metrics.operator->(), otherShard);
+
+    // Counters are summed, but gauges are not.
+    EXPECT_EQ(15, getSerialized("temp.count1"));
+    EXPECT_EQ(7, getSerialized("temp.count2"));
+    EXPECT_EQ(1L << 60, getSerialized("master.replicas"));
+
+    otherShard->temp.count1 = otherShard->temp.count2 = 0;
+    otherShard->master.replicas = 0;
+    metrics->master.replicas = 0;
+}
+
+TEST_F(MetricsTest, total) {
+    metrics->temp.count1 = 10;
+    metrics->temp.count2 = 0;
+
+    std::thread thread(setOtherMetrics);
+    thread.join();
+    EXPECT_EQ(15U, RawMetrics::total(metrics->temp.count1));
+    EXPECT_EQ(7U, RawMetrics::total(metrics->temp.count2));
+
+    otherShard->temp.count1 = otherShard->temp.count2 = 0;
+    otherShard->master.replicas = 0;
+    metrics->temp.count1 = 0;
+}
+
+TEST_F(MetricsTest, allocateShard_reusesShardsOfExitedThreads) {
+    std::thread thread1(setOtherMetrics);
+    thread1.join();
+    RawMetrics* first = otherShard;
+    std::thread thread2(setOtherMetrics);
+    thread2.join();
+    EXPECT_EQ(first, otherShard);
+
+    // Counts from exited threads are kept.
+    EXPECT_EQ(10U, otherShard->temp.count1);
+
+    otherShard->temp.count1 = otherShard->temp.count2 = 0;
+    otherShard->master.replicas = 0;
 }
 
 }
@@ -18,9 +18,11 @@
 #include "Logger.h"
 #include "MasterService.h"
 #include "Memory.h"
+#include "RecoverySegmentBuilder.h"
 #include "SegmentIterator.h"
 #include "Seglet.h"
 #include "Tablets.pb.h"
+#include "TabletsBuilder.h"
 
 namespace RAMCloud {
 
@@ -139,22 +141,22 @@ class RecoverSegmentBenchmark {
 
         printf("\n");
         printf("Verify object checksums: %.2f ms\n",
-               Cycles::toSeconds(metrics->master.verifyChecksumTicks.load()) *
+               Cycles::toSeconds(metrics->master.verifyChecksumTicks) *
                1000.);
         metrics->master.verifyChecksumTicks = 0;
 
 #define DUMP_TEMP_TICKS(i)  \
-if (metrics->temp.ticks##i.load()) { \
+if (metrics->temp.ticks##i) { \
     printf("temp.ticks%d: %.2f ms\n", i, \
-           Cycles::toSeconds(metrics->temp.ticks##i.load()) * \
+           Cycles::toSeconds(metrics->temp.ticks##i) * \
            1000.); \
     metrics->temp.ticks##i = 0; \
 }
 
 #define DUMP_TEMP_COUNT(i)  \
-if (metrics->temp.count##i.load()) { \
+if (metrics->temp.count##i) { \
     printf("temp.count%d: %lu\n", i, \
-           metrics->temp.count##i.load()); \
+           metrics->temp.count##i); \
     metrics->temp.count##i = 0; \
 }
 
@@ -186,6 +188,77 @@ if (metrics->temp.count##i.load()) { \
         }
     }
 
+    /**
+     * Measure how long backups spend splitting replicas into recovery
+     * segments (RecoverySegmentBuilder::build) when the crashed master's
+     * single table is divided evenly among \a numPartitions partitions.
+     */
+    static void
+    runPartitioning(int numSegments, int dataBytes, int numPartitions)
+    {
+        uint64_t numObjects = 0;
+        uint64_t nextKeyVal = 0;
+        Segment *segments[numSegments];
+        for (int i = 0; i < numSegments; i++) {
+            segments[i] = new Segment();
+            SegmentHeader header(1, i, Segment::DEFAULT_SEGMENT_SIZE);
+            segments[i]->append(LOG_ENTRY_TYPE_SEGHEADER,
+                                &header, sizeof(header));
+            while (1) {
+                Key key(0, &nextKeyVal, sizeof(nextKeyVal));
+
+                char objectData[dataBytes];
+                Object object(key, objectData, dataBytes, 0, 0);
+                Buffer buffer;
+                object.serializeToBuffer(buffer);
+                if (!segments[i]->append(LOG_ENTRY_TYPE_OBJ, buffer))
+                    break;
+                nextKeyVal++;
+                numObjects++;
+            }
+            segments[i]->close();
+        }
+
+        ProtoBuf::Tablets partitions;
+        TabletsBuilder builder{partitions};
+        uint64_t hashesPerPartition = ~0UL / numPartitions;
+        for (int i = 0; i < numPartitions; i++) {
+            uint64_t start = i * hashesPerPartition;
+            uint64_t end = (i == numPartitions - 1) ?
+                                ~0UL : start + hashesPerPartition - 1;
+            builder(0, start, end, TabletsBuilder::RECOVERING, i);
+        }
+
+        uint64_t before = Cycles::rdtsc();
+        RecoverySegmentBuilder::PartitionIndex index(partitions);
+        uint64_t indexTicks = Cycles::rdtsc() - before;
+
+        uint64_t buildTicks = 0;
+        for (int i = 0; i < numSegments; i++) {
+            Buffer buffer;
+            segments[i]->appendToBuffer(buffer);
+            Segment::Certificate certificate;
+            uint32_t length = segments[i]->getAppendedLength(&certificate);
+            const void* contigSeg = buffer.getRange(0, length);
+            std::unique_ptr<Segment[]> recoverySegments(
+                new Segment[numPartitions]);
+            before = Cycles::rdtsc();
+            RecoverySegmentBuilder::build(contigSeg, length, certificate,
+                                          index, recoverySegments.get());
+            buildTicks += Cycles::rdtsc() - before;
+        }
+
+        printf("%5d partitions: index built in %.2f us, %.1f ns/entry to "
+               "build recovery segments (%lu %d byte objects)\n",
+               numPartitions, Cycles::toSeconds(indexTicks) * 1e6,
+               Cycles::toSeconds(buildTicks) * 1e9 /
+               static_cast<double>(numObjects),
+               numObjects, dataBytes);
+
+        for (int i = 0; i < numSegments; i++)
+            delete segments[i];
+    }
+
     DISALLOW_COPY_AND_ASSIGN(RecoverSegmentBenchmark);
 };
 
@@ -203,5 +276,11 @@ main()
         rsb.run(numSegments, dataBytes[i]);
     }
 
+    printf("==========================\n");
+    int numPartitions[] = { 1, 10, 100, 1000, 0 };
+    for (int i = 0; numPartitions[i] != 0; i++)
+        RAMCloud::RecoverSegmentBenchmark::runPartitioning(8, 128,
+                                                           numPartitions[i]);
+
     return 0;
 }
@@ -83,6 +83,7 @@ Recovery::Recovery(Context* context,
     , testingMasterStartTaskSendCallback()
     , testingBackupEndTaskSendCallback()
     , testingFailRecoveryMasters()
+    , partitionBytes()
 {
 }
 
@@ -90,31 +91,190 @@ Recovery::~Recovery()
 {
 }
 
+namespace {
+/// A tablet (or piece of a split tablet) to be placed in a partition.
+struct TabletPiece {
+    TabletPiece(const Tablet& tablet, uint64_t bytes)
+        : tablet(tablet)
+        , bytes(bytes)
+    {}
+
+    /// Range of the piece and the rest of its tablet's metadata.
+    Tablet tablet;
+
+    /// Estimated bytes of live data in the piece.
+    uint64_t bytes;
+};
+
+/// Orders TabletPieces from largest to smallest.
+bool
+largestFirst(const TabletPiece& a, const TabletPiece& b)
+{
+    return a.bytes > b.bytes;
+}
+}
+
 /**
  * Finds out which tablets belonged to the crashed master and parititions
  * them into groups. Each of the groups is recovered later, one to each
  * recovery master. The result is left in #tabletsToRecover.
  *
- * Right now this just naively puts each tablet from the crashed master
- * in its own group (and thus on its own recovery master). At some
- * point we'll need smart logic to group tablets based on their
- * expected recovery time.
+ * Recovery time is determined by the recovery master with the most data to
+ * replay, so groups are made roughly equal in size using the tablet sizes
+ * the crashed master last reported (see #masterRecoveryInfo). Tablets larger
+ * than #partitionBytes are split into equal key hash ranges in the
+ * TableManager, then all of the pieces are packed, largest first, into
+ * groups of at most #partitionBytes each. If the master never reported sizes
+ * or #partitionBytes is 0, each tablet is simply put in its own group.
+ *
+ * \param tablets
+ *      The tablets of the crashed master, all of which must be marked as
+ *      RECOVERING in the TableManager.
  */
 void
 Recovery::partitionTablets(vector<Tablet> tablets)
 {
-    //TODO(syang0) A new partitioning scheme should be inserted here
+    if (partitionBytes == 0 || masterRecoveryInfo.tablet_stats_size() == 0) {
+        foreach (auto& tablet, tablets) {
+            ProtoBuf::Tablets::Tablet& entry = *tabletsToRecover.add_tablet();
+            tablet.serialize(entry);
+            entry.set_user_data(numPartitions++);
+        }
+        return;
+    }
+
+    vector<TabletPiece> pieces;
+    uint64_t totalBytes = 0;
+    foreach (const Tablet& tablet, tablets) {
+        uint64_t bytes;
+        // A tablet we know nothing about (for example, one assigned since
+        // the master last reported sizes) is assumed to fill a partition
+        // of #partitionBytes. It is never split, but if the target grows
+        // beyond #partitionBytes below it may be packed with other pieces.
+        if (!estimateTabletBytes(tablet, &bytes))
+            bytes = partitionBytes;
+        pieces.push_back(TabletPiece(tablet, bytes));
+        totalBytes += bytes;
+    }
+
+    // Don't create more partitions than there are masters to recover them;
+    // make the partitions bigger instead.
+    uint64_t target = partitionBytes;
+    uint64_t numMasters = tracker ?
+        tracker->getServersWithService(WireFormat::MASTER_SERVICE).size() : 0;
+    if (numMasters > 0)
+        target = std::max(target, (totalBytes + numMasters - 1) / numMasters);
+
+    // Split tablets that are too large for a single partition. Key hashes
+    // are uniformly distributed, so equal ranges have about equal data.
+    size_t numTablets = pieces.size();
+    for (size_t i = 0; i < numTablets; i++) {
+        if (pieces[i].bytes <= target)
+            continue;
+        Tablet tablet = pieces[i].tablet;
+        uint64_t span = tablet.endKeyHash - tablet.startKeyHash;
+        uint64_t count = std::min((pieces[i].bytes + target - 1) / target,
+                                  span);
+        if (count < 2)
+            continue;
+        uint64_t bytes = pieces[i].bytes;
+        uint64_t pieceBytes = bytes / count;
+        uint64_t step = span / count;
+        uint64_t pieceStart = tablet.startKeyHash;
+        uint64_t numPieces = 1;
+        for (uint64_t j = 1; j < count; j++) {
+            uint64_t splitKeyHash = tablet.startKeyHash + j * step;
+            try {
+                tableManager->splitRecoveringTablet(tablet.tableId,
+                                                    splitKeyHash);
+            } catch (const TableManager::NoSuchTable& e) {
+                // The table was dropped; there's no point splitting it
+                // further.
+                break;
+            }
+            Tablet piece = tablet;
+            piece.startKeyHash = pieceStart;
+            piece.endKeyHash = splitKeyHash - 1;
+            pieces.push_back(TabletPiece(piece, pieceBytes));
+            pieces[i].bytes -= pieceBytes;
+            pieceStart = splitKeyHash;
+            numPieces++;
+        }
+        pieces[i].tablet.startKeyHash = pieceStart;
+        LOG(DEBUG, "Split tablet %lu [0x%lx,0x%lx] of %lu bytes into %lu "
+            "pieces for recovery", tablet.tableId, tablet.startKeyHash,
+            tablet.endKeyHash, bytes, numPieces);
+    }
 
+    // First fit decreasing: place each piece in the first partition with
+    // room for it. Once there are as many partitions as masters, overflow
+    // goes to the emptiest partition.
+    std::sort(pieces.begin(), pieces.end(), largestFirst);
+    vector<uint64_t> partitions;
+    foreach (const TabletPiece& piece, pieces) {
+        size_t partition = 0;
+        while (partition < partitions.size() &&
+               partitions[partition] + piece.bytes > target) {
+            partition++;
+        }
+        if (partition == partitions.size()) {
+            if (numMasters > 0 && partitions.size() >= numMasters) {
+                partition = std::min_element(partitions.begin(),
+                                             partitions.end()) -
+                            partitions.begin();
+            } else {
+                partitions.push_back(0);
+            }
+        }
+        partitions[partition] += piece.bytes;
 
-    // Figure out the number of partitions to be recovered and bucket tablets
-    // together for recovery on a single recovery master. Right now the
-    // bucketing is each tablet from the crashed master is recovered on a
-    // single recovery master.
-    foreach (auto& tablet, tablets) {
         ProtoBuf::Tablets::Tablet& entry = *tabletsToRecover.add_tablet();
-        tablet.serialize(entry);
-        entry.set_user_data(numPartitions++);
+        piece.tablet.serialize(entry);
+        entry.set_user_data(partition);
+    }
+    numPartitions = downCast<uint32_t>(partitions.size());
+
+    LOG(NOTICE, "Partitioned %lu tablets (%lu pieces, about %lu MB) of "
+        "crashed server %s into %u partitions", numTablets, pieces.size(),
+        totalBytes / 1024 / 1024, crashedServerId.toString().c_str(),
+        numPartitions);
+}
+
+/**
+ * Estimate the number of bytes of live data in a tablet of the crashed
+ * master from the tablet sizes it last reported. Tablets may have been split
+ * or merged since then, so each reported tablet that overlaps \a tablet
+ * contributes in proportion to how much of its key hash range overlaps.
+ *
+ * \param tablet
+ *      The tablet whose size is needed.
+ * \param[out] bytes
+ *      Set to the estimated size of the tablet.
+ * \return
+ *      True if some reported tablet overlapped \a tablet, false if nothing
+ *      is known about its size (in which case \a bytes is 0).
+ */
+bool
+Recovery::estimateTabletBytes(const Tablet& tablet, uint64_t* bytes)
+{
+    bool found = false;
+    double total = 0;
+    foreach (const ProtoBuf::MasterRecoveryInfo::TabletStats& stats,
+             masterRecoveryInfo.tablet_stats()) {
+        if (stats.table_id() != tablet.tableId)
+            continue;
+        uint64_t start = std::max(stats.start_key_hash(), tablet.startKeyHash);
+        uint64_t end = std::min(stats.end_key_hash(), tablet.endKeyHash);
+        if (start > end)
+            continue;
+        found = true;
+        double overlap = static_cast<double>(end - start) + 1;
+        double range = static_cast<double>(stats.end_key_hash() -
+                                           stats.start_key_hash()) + 1;
+        total += static_cast<double>(stats.byte_count()) * overlap / range;
     }
+    *bytes = static_cast<uint64_t>(total);
+    return found;
 }
 
 /**
@@ -176,6 +176,7 @@ class Recovery : public Task {
 
   PRIVATE:
     void partitionTablets(vector<Tablet> tablets);
+    bool estimateTabletBytes(const Tablet& tablet, uint64_t* bytes);
     void startBackups();
     void startRecoveryMasters();
     void broadcastRecoveryComplete();
@@ -301,6 +302,14 @@ class Recovery : public Task {
      */
     uint32_t testingFailRecoveryMasters;
 
+    /**
+     * Target number of bytes of live data for each partition of the crashed
+     * master's tablets; set from the coordinator's RuntimeOptions when the
+     * recovery starts. 0 (the default) disables size-aware partitioning, in
+     * which case each tablet is recovered as its own partition.
+     */
+    uint64_t partitionBytes;
+
     friend class RecoveryInternal::BackupStartTask;
     friend class RecoveryInternal::BackupStartPartitionTask;
     friend class RecoveryInternal::MasterStartTask;
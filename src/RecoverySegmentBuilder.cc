@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <algorithm>
+
 #include "RecoverySegmentBuilder.h"
 #include "Object.h"
 #include "SegmentIterator.h"
@@ -41,7 +43,7 @@ namespace RAMCloud {
  *      contents of the replicas for delivery to different recovery masters.
  *      The partition ids inside each entry act as an index describing which
  *      recovery segment for a particular replica each object should be placed
- *      in.
+ *      in. Built once per recovery and shared by all of its replicas.
  * \param recoverySegments
  *      Array of Segments to which objects will be appended to construct
  *      recovery segments. Guaranteed to have the same number of elements
@@ -57,9 +59,10 @@ namespace RAMCloud {
 void
 RecoverySegmentBuilder::build(const void* buffer, uint32_t length,
                               const Segment::Certificate& certificate,
-                              const ProtoBuf::Tablets& partitions,
+                              const PartitionIndex& partitions,
                               Segment* recoverySegments)
 {
+    const ProtoBuf::Tablets& tablets = partitions.getPartitions();
     SegmentIterator it(buffer, length, certificate);
     it.checkMetadataIntegrity();
 
@@ -93,9 +96,9 @@ RecoverySegmentBuilder::build(const void* buffer, uint32_t length,
             // safeVersion recovery on all recovery masters
             Log::Position position(header->segmentId, it.getOffset());
             LOG(DEBUG, "Copying SAFEVERSION ");
-            for (int i = 0; i < partitions.tablet_size(); i++) {
+            for (int i = 0; i < tablets.tablet_size(); i++) {
                 const ProtoBuf::Tablets::Tablet* partition =
-                        &partitions.tablet(i);
+                        &tablets.tablet(i);
 
                 if (!isEntryAlive(position, partition)) {
                     LOG(DEBUG, "Skipping SAFEVERSION for partition "
@@ -134,7 +137,7 @@ RecoverySegmentBuilder::build(const void* buffer, uint32_t length,
             throw SegmentRecoveryFailedException(HERE);
         }
 
-        const auto* partition = whichPartition(tableId, keyHash, partitions);
+        const auto* partition = partitions.lookup(tableId, keyHash);
         if (!partition) {
             if (!supressNoPartitionWarning) {
                 LOG(WARNING,
@@ -216,6 +219,58 @@ RecoverySegmentBuilder::extractDigest(const void* buffer, uint32_t length,
     return false;
 }
 
+/**
+ * Sort \a partitions so that lookup() can binary search them.
+ *
+ * \param partitions
+ *      Describes how the coordinator would like the backup to split up the
+ *      contents of the replicas for delivery to different recovery masters.
+ *      Must outlive this index. Entries are expected not to overlap.
+ */
+RecoverySegmentBuilder::PartitionIndex::PartitionIndex(
+        const ProtoBuf::Tablets& partitions)
+    : partitions(partitions)
+    , ranges()
+{
+    ranges.reserve(partitions.tablet_size());
+    for (int i = 0; i < partitions.tablet_size(); i++) {
+        const ProtoBuf::Tablets::Tablet& tablet(partitions.tablet(i));
+        ranges.push_back(Range(tablet.table_id(), tablet.start_key_hash(),
+                               tablet.end_key_hash(), &tablet));
+    }
+    std::sort(ranges.begin(), ranges.end());
+}
+
+/**
+ * Find which partition an object or tombstone is in.
+ *
+ * \param tableId
+ *      Id of the table which this object was created in.
+ * \param keyHash
+ *      Hash of the string key contained inside this object.
+ * \return
+ *      Pointer to the entry in the partitions which this object or tombstone
+ *      belongs in. Note this object may still not be safe to include in
+ *      a recovered segment depending on its position in the log relative to
+ *      the time the partition was assigned to the crashed master (see
+ *      isEntryAlive()). If the object doesn't fit into any partition NULL
+ *      is returned.
+ */
+const ProtoBuf::Tablets::Tablet*
+RecoverySegmentBuilder::PartitionIndex::lookup(uint64_t tableId,
+                                               KeyHash keyHash) const
+{
+    // Find the last range starting at or before keyHash in this table.
+    Range key(tableId, keyHash, keyHash, NULL);
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), key);
+    if (it == ranges.begin())
+        return NULL;
+    --it;
+    if (it->tableId != tableId || it->endKeyHash < keyHash)
+        return NULL;
+    return it->tablet;
+}
+
 // - private -
 
 /**
@@ -259,40 +314,4 @@ RecoverySegmentBuilder::isEntryAlive(const Log::Position& position,
     return position >= minimum;
 }
 
-/**
- * Find which of \a partitions this object or tombstone is in.
- *
- * \param tableId
- *      Id of the table which this object was created in.
- * \param keyHash
- *      Hash of the string key contained inside this object.
- * \param partitions
- *      Describes how the coordinator would like the backup to split up the
- *      contents of the replicas for delivery to different recovery masters.
- *      The partition ids inside each entry act as an index describing which
- *      recovery segment for a particular replica each object should be placed
- *      in.
- * \return
- *      Pointer to an entry in \a partitions which this object or tombstone
- *      belongs in. Note this object may still not be safe to include in
- *      a recovered segment depending on its position in the log relative to
- *      the time the partition was assigned to the crashed master (see
- *      isEntryLive()). If the object doesn't fit into any partition given
- *      by \a partitions NULL is returned.
- */
-const ProtoBuf::Tablets::Tablet*
-RecoverySegmentBuilder::whichPartition(uint64_t tableId, KeyHash keyHash,
-                                       const ProtoBuf::Tablets& partitions)
-{
-    for (int i = 0; i < partitions.tablet_size(); i++) {
-        const ProtoBuf::Tablets::Tablet& tablet(partitions.tablet(i));
-        if (tablet.table_id() == tableId &&
-            (tablet.start_key_hash() <= keyHash &&
-            tablet.end_key_hash() >= keyHash)) {
-            return &tablet;
-        }
-    }
-    return NULL;
-}
-
 } // namespace RAMCloud
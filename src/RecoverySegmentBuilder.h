@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <vector>
+
 #include "Common.h"
 #include "Buffer.h"
 #include "Key.h"
@@ -41,9 +43,66 @@ namespace RAMCloud {
  */
 class RecoverySegmentBuilder {
   PUBLIC:
+    /**
+     * A sorted view of the partitions for a recovery that lets the
+     * partition containing an object be found in time logarithmic in the
+     * number of partition entries. Built once per recovery (see
+     * BackupMasterRecovery::setPartitionsAndSchedule) and then shared by
+     * every call to build() for that recovery.
+     *
+     * The index refers to the entries of the ProtoBuf::Tablets it was built
+     * from, which must not be modified or destroyed while it is in use.
+     */
+    class PartitionIndex {
+      public:
+        explicit PartitionIndex(const ProtoBuf::Tablets& partitions);
+        const ProtoBuf::Tablets::Tablet* lookup(uint64_t tableId,
+                                                KeyHash keyHash) const;
+
+        /// Return the partitions this index was built from.
+        const ProtoBuf::Tablets& getPartitions() const { return partitions; }
+
+      PRIVATE:
+        /**
+         * One entry of #partitions, keyed for sorting by table and then by
+         * the start of its key hash range.
+         */
+        struct Range {
+            Range(uint64_t tableId, KeyHash startKeyHash,
+                  KeyHash endKeyHash,
+                  const ProtoBuf::Tablets::Tablet* tablet)
+                : tableId(tableId)
+                , startKeyHash(startKeyHash)
+                , endKeyHash(endKeyHash)
+                , tablet(tablet)
+            {
+            }
+
+            bool operator<(const Range& other) const
+            {
+                if (tableId != other.tableId)
+                    return tableId < other.tableId;
+                return startKeyHash < other.startKeyHash;
+            }
+
+            uint64_t tableId;
+            KeyHash startKeyHash;
+            KeyHash endKeyHash;
+            const ProtoBuf::Tablets::Tablet* tablet;
+        };
+
+        /// The partitions this index was built from.
+        const ProtoBuf::Tablets& partitions;
+
+        /// One Range for each entry in #partitions, in sorted order.
+        vector<Range> ranges;
+
+        DISALLOW_COPY_AND_ASSIGN(PartitionIndex);
+    };
+
     static void build(const void* buffer, uint32_t length,
                       const Segment::Certificate& certificate,
-                      const ProtoBuf::Tablets& partitions,
+                      const PartitionIndex& partitions,
                       Segment* recoverySegments);
     static bool extractDigest(const void* buffer, uint32_t length,
                               const Segment::Certificate& certificate,
@@ -51,9 +110,6 @@ class RecoverySegmentBuilder {
   PRIVATE:
     static bool isEntryAlive(const Log::Position& position,
                              const ProtoBuf::Tablets::Tablet* tablet);
-    static const ProtoBuf::Tablets::Tablet*
-    whichPartition(uint64_t tableId, KeyHash keyHash,
-                   const ProtoBuf::Tablets& partitions);
 
     // Disallow construction.
     RecoverySegmentBuilder() {}
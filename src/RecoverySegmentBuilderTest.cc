@@ -104,8 +104,9 @@ TEST_F(RecoverySegmentBuilderTest, build) {
     ASSERT_TRUE(segment->copyOut(0, buf, length));
 
     std::unique_ptr<Segment[]> recoverySegments(new Segment[2]);
+    RecoverySegmentBuilder::PartitionIndex index(partitions);
     TestLog::Enable _;
-    build(buf, length, certificate, partitions, recoverySegments.get());
+    build(buf, length, certificate, index, recoverySegments.get());
     EXPECT_TRUE(StringUtil::contains(TestLog::get(),
         "Couldn't place object with <tableId, keyHash> of <10"));
     EXPECT_TRUE(StringUtil::contains(TestLog::get(),
@@ -113,7 +114,7 @@ TEST_F(RecoverySegmentBuilderTest, build) {
 
     certificate.checksum = 0;
     EXPECT_THROW(
-        build(buf, length, certificate, partitions, recoverySegments.get()),
+        build(buf, length, certificate, index, recoverySegments.get()),
         SegmentIteratorException);
 }
 
@@ -174,19 +175,42 @@ TEST_F(RecoverySegmentBuilderTest, isEntryAlive) {
     EXPECT_FALSE(isEntryAlive({12741, 57272}, tablet));
 }
 
-TEST_F(RecoverySegmentBuilderTest, whichPartition) {
-    auto whichPartition = RecoverySegmentBuilder::whichPartition;
-    auto r = whichPartition(1, Key::getHash(1, "1", 1), partitions);
+TEST_F(RecoverySegmentBuilderTest, PartitionIndex_lookup) {
+    RecoverySegmentBuilder::PartitionIndex index(partitions);
+    auto r = index.lookup(1, Key::getHash(1, "1", 1));
     EXPECT_TRUE(r);
     EXPECT_EQ(1u, r->user_data());
-    r = whichPartition(1, Key::getHash(1, "2", 1), partitions);
+    r = index.lookup(1, Key::getHash(1, "2", 1));
     EXPECT_TRUE(r);
-    r = whichPartition(2, Key::getHash(2, "1", 1), partitions);
+    r = index.lookup(2, Key::getHash(2, "1", 1));
     EXPECT_TRUE(r);
     EXPECT_EQ(0u, r->user_data());
-    TestLog::Enable _;
-    r = whichPartition(3, Key::getHash(3, "1", 1), partitions);
+    r = index.lookup(3, Key::getHash(3, "1", 1));
+    EXPECT_FALSE(r);
+    r = index.lookup(0, 0);
+    EXPECT_FALSE(r);
+    r = index.lookup(10, 0);
     EXPECT_FALSE(r);
 }
 
+TEST_F(RecoverySegmentBuilderTest, PartitionIndex_lookupBoundaries) {
+    // Entries given out of order, with a gap between 20 and 30.
+    ProtoBuf::Tablets tablets;
+    TabletsBuilder{tablets}
+        (5, 30lu, ~0lu, TabletsBuilder::NORMAL, 2lu)
+        (5, 0lu, 9lu, TabletsBuilder::NORMAL, 0lu)
+        (5, 10lu, 20lu, TabletsBuilder::NORMAL, 1lu);
+    RecoverySegmentBuilder::PartitionIndex index(tablets);
+    EXPECT_EQ(0u, index.lookup(5, 0)->user_data());
+    EXPECT_EQ(0u, index.lookup(5, 9)->user_data());
+    EXPECT_EQ(1u, index.lookup(5, 10)->user_data());
+    EXPECT_EQ(1u, index.lookup(5, 20)->user_data());
+    EXPECT_FALSE(index.lookup(5, 21));
+    EXPECT_FALSE(index.lookup(5, 29));
+    EXPECT_EQ(2u, index.lookup(5, 30)->user_data());
+    EXPECT_EQ(2u, index.lookup(5, ~0lu)->user_data());
+    EXPECT_FALSE(index.lookup(4, 0));
+    EXPECT_FALSE(index.lookup(6, 0));
+}
+
 } // namespace RAMCloud
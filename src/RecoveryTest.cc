@@ -132,6 +132,115 @@ TEST_F(RecoveryTest, partitionTablets) {
     EXPECT_EQ(3lu, recovery->numPartitions);
 }
 
+namespace {
+void
+addTabletStats(ProtoBuf::MasterRecoveryInfo& recoveryInfo,
+               uint64_t tableId, uint64_t startKeyHash, uint64_t endKeyHash,
+               uint64_t bytes)
+{
+    ProtoBuf::MasterRecoveryInfo::TabletStats& stats =
+        *recoveryInfo.add_tablet_stats();
+    stats.set_table_id(tableId);
+    stats.set_start_key_hash(startKeyHash);
+    stats.set_end_key_hash(endKeyHash);
+    stats.set_byte_count(bytes);
+    stats.set_object_count(bytes / 100);
+}
+
+/// Return "tableId:start-end:partition" for each tablet in \a tablets.
+string
+partitionsToString(const ProtoBuf::Tablets& tablets)
+{
+    string result;
+    foreach (const ProtoBuf::Tablets::Tablet& tablet, tablets.tablet()) {
+        if (!result.empty())
+            result += " ";
+        result += format("%lu:%lu-%lu:%lu", tablet.table_id(),
+                         tablet.start_key_hash(), tablet.end_key_hash(),
+                         tablet.user_data());
+    }
+    return result;
+}
+} // namespace
+
+TEST_F(RecoveryTest, partitionTablets_bySize) {
+    Lock lock(mutex);     // To trick TableManager internal calls.
+    tableManager.addTablet(
+        lock, {123,  0,  9, {99, 0}, Tablet::RECOVERING, {}});
+    tableManager.addTablet(
+        lock, {123, 10, 19, {99, 0}, Tablet::RECOVERING, {}});
+    tableManager.addTablet(
+        lock, {123, 20, 29, {99, 0}, Tablet::RECOVERING, {}});
+    tableManager.addTablet(
+        lock, {124,  0,  9, {99, 0}, Tablet::RECOVERING, {}});
+    addTabletStats(recoveryInfo, 123,  0,  9, 100);
+    addTabletStats(recoveryInfo, 123, 10, 19, 300);
+    addTabletStats(recoveryInfo, 123, 20, 29, 250);
+
+    // Without a target size each tablet gets its own partition.
+    Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
+                      {99, 0}, recoveryInfo);
+    recovery.partitionTablets(tableManager.markAllTabletsRecovering({99, 0}));
+    EXPECT_EQ(4u, recovery.numPartitions);
+
+    // Largest first, into the first partition with room. Table 124 has no
+    // reported size, so it is placed alone.
+    Recovery sized(&context, taskQueue, &tableManager, &tracker, NULL,
+                   {99, 0}, recoveryInfo);
+    sized.partitionBytes = 400;
+    sized.partitionTablets(tableManager.markAllTabletsRecovering({99, 0}));
+    EXPECT_EQ(3u, sized.numPartitions);
+    EXPECT_EQ("124:0-9:0 123:10-19:1 123:20-29:2 123:0-9:1",
+              partitionsToString(sized.tabletsToRecover));
+
+    // Never more partitions than masters.
+    addServersToTracker(2, {WireFormat::MASTER_SERVICE});
+    Recovery capped(&context, taskQueue, &tableManager, &tracker, NULL,
+                    {99, 0}, recoveryInfo);
+    capped.partitionBytes = 400;
+    capped.partitionTablets(tableManager.markAllTabletsRecovering({99, 0}));
+    EXPECT_EQ(2u, capped.numPartitions);
+    EXPECT_EQ("124:0-9:0 123:10-19:1 123:20-29:1 123:0-9:0",
+              partitionsToString(capped.tabletsToRecover));
+}
+
+TEST_F(RecoveryTest, partitionTablets_splitDroppedTable) {
+    Lock lock(mutex);     // To trick TableManager internal calls.
+    tableManager.addTablet(
+        lock, {123,  0, 99, {99, 0}, Tablet::RECOVERING, {}});
+    addTabletStats(recoveryInfo, 123,  0, 99, 1000);
+
+    // The tablet should be split in 3, but its table isn't in the
+    // TableManager, so it is recovered whole.
+    Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
+                      {99, 0}, recoveryInfo);
+    recovery.partitionBytes = 400;
+    recovery.partitionTablets(tableManager.markAllTabletsRecovering({99, 0}));
+    EXPECT_EQ(1u, recovery.numPartitions);
+    EXPECT_EQ("123:0-99:0", partitionsToString(recovery.tabletsToRecover));
+}
+
+TEST_F(RecoveryTest, estimateTabletBytes) {
+    addTabletStats(recoveryInfo, 123,  0, 19, 200);
+    addTabletStats(recoveryInfo, 123, 20, 29, 50);
+    addTabletStats(recoveryInfo, 124, 10, 29, 1000);
+    Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
+                      {99, 0}, recoveryInfo);
+
+    uint64_t bytes;
+    EXPECT_TRUE(recovery.estimateTabletBytes(
+        {123, 10, 29, {99, 0}, Tablet::RECOVERING, {}}, &bytes));
+    EXPECT_EQ(150u, bytes);
+    EXPECT_TRUE(recovery.estimateTabletBytes(
+        {123, 0, 19, {99, 0}, Tablet::RECOVERING, {}}, &bytes));
+    EXPECT_EQ(200u, bytes);
+    EXPECT_FALSE(recovery.estimateTabletBytes(
+        {123, 30, 39, {99, 0}, Tablet::RECOVERING, {}}, &bytes));
+    EXPECT_EQ(0u, bytes);
+    EXPECT_FALSE(recovery.estimateTabletBytes(
+        {125, 0, 19, {99, 0}, Tablet::RECOVERING, {}}, &bytes));
+}
+
 TEST_F(RecoveryTest, startBackups) {
     /**
      * Called by BackupStartTask instead of sending the startReadingData
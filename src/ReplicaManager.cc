@@ -52,7 +52,7 @@ ReplicaManager::ReplicaManager(Context* context,
     , replicatedSegmentPool(ReplicatedSegment::sizeOf(numReplicas))
     , replicatedSegmentList()
     , taskQueue()
-    , writeRpcsInFlight(0)
+    , writeWindow()
     , replicationEpoch()
     , failureMonitor(context, this)
     , replicationCounter()
@@ -365,10 +365,35 @@ ReplicaManager::proceed()
     Lock __(dataMutex);
     taskQueue.performTask();
     metrics->master.replicationTasks =
-        std::max(metrics->master.replicationTasks.load(),
+        std::max(metrics->master.replicationTasks,
                  taskQueue.outstandingTasks());
 }
 
+/**
+ * Send approximate tablet sizes to the coordinator for use in partitioning
+ * this master's tablets should it crash. Never blocks, so it is safe to call
+ * from the dispatch thread; the update is sent asynchronously by the
+ * BackupFailureMonitor thread.
+ *
+ * \param stats
+ *      Sizes of this master's tablets; only the tablet_stats field is used.
+ * \return
+ *      True if the update was queued. False if #dataMutex is currently held
+ *      by another thread, in which case the caller should try again later.
+ */
+bool
+ReplicaManager::tryUpdateTabletStats(const ProtoBuf::MasterRecoveryInfo& stats)
+{
+    {
+        std::unique_lock<std::mutex> lock(dataMutex, std::try_to_lock_t());
+        if (!lock.owns_lock())
+            return false;
+        replicationEpoch->updateTabletStats(stats);
+    }
+    failureMonitor.wakeUp();
+    return true;
+}
+
 // - private -
 
 /**
@@ -412,7 +437,7 @@ ReplicaManager::allocateSegment(const Lock& lock,
         DIE("Out of memory");
     auto* replicatedSegment =
         new(p) ReplicatedSegment(context, taskQueue, *backupSelector, *this,
-                                 writeRpcsInFlight, *replicationEpoch,
+                                 writeWindow, *replicationEpoch,
                                  dataMutex, segmentId, segment,
                                  isLogHead, *masterId, numReplicas,
                                  &replicationCounter);
@@ -441,6 +466,7 @@ ReplicaManager::handleBackupFailure(ServerId failedId)
 
     foreach (auto& segment, replicatedSegmentList)
         segment.handleBackupFailure(failedId, useMinCopysets);
+    writeWindow.removeBackup(failedId);
 }
 
 /**
@@ -81,6 +81,7 @@ class ReplicaManager
     void startFailureMonitor();
     void haltFailureMonitor();
     void proceed();
+    bool tryUpdateTabletStats(const ProtoBuf::MasterRecoveryInfo& stats);
 
   PRIVATE:
     ReplicatedSegment* allocateSegment(const Lock& lock, uint64_t segmentId,
@@ -156,10 +157,10 @@ class ReplicaManager
     TaskQueue taskQueue;
 
     /**
-     * Number of collective outstanding write rpcs to all backups.
-     * Used by ReplicatedSegment to throttle rpc creation.
+     * Tracks outstanding write rpcs to each backup and adapts how many each
+     * may have at once. Used by ReplicatedSegment to throttle rpc creation.
      */
-    uint32_t writeRpcsInFlight;
+    BackupWriteWindow writeWindow;
 
     /**
      * Provides access to the latest replicationEpoch acknowledged by the
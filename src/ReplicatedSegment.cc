@@ -43,8 +43,8 @@ enum { OBEY_SAFETY_CONSTRAINTS = true };
  *      is called.
  * \param backupSelector
  *      Used to choose where to store replicas. Shared among ReplicatedSegments.
- * \param writeRpcsInFlight
- *      Number of outstanding write rpcs to backups across all
+ * \param writeWindow
+ *      Tracks outstanding write rpcs to each backup across all
  *      ReplicatedSegments.  Used to throttle write rpcs.
  * \param replicationEpoch
  *      The ReplicaManager's UpdateReplicationEpochTask which is shared among
@@ -80,7 +80,7 @@ ReplicatedSegment::ReplicatedSegment(Context* context,
                                      TaskQueue& taskQueue,
                                      BaseBackupSelector& backupSelector,
                                      Deleter& deleter,
-                                     uint32_t& writeRpcsInFlight,
+                                     BackupWriteWindow& writeWindow,
                                      UpdateReplicationEpochTask&
                                                             replicationEpoch,
                                      std::mutex& dataMutex,
@@ -96,7 +96,7 @@ ReplicatedSegment::ReplicatedSegment(Context* context,
     , context(context)
     , backupSelector(backupSelector)
     , deleter(deleter)
-    , writeRpcsInFlight(writeRpcsInFlight)
+    , writeWindow(writeWindow)
     , replicationEpoch(replicationEpoch)
     , dataMutex(dataMutex)
     , syncMutex()
@@ -178,7 +178,7 @@ ReplicatedSegment::free()
             continue;
         replica.writeRpc->cancel();
         replica.writeRpc.destroy();
-        --writeRpcsInFlight;
+        writeWindow.abandoned(replica.backupId);
     }
 
     // Segment should free itself ASAP. It must not start new write rpcs after
@@ -300,7 +300,7 @@ ReplicatedSegment::handleBackupFailure(ServerId failedId, bool useMinCopysets)
         }
 
         if (replica.writeRpc)
-            --writeRpcsInFlight;
+            writeWindow.abandoned(replica.backupId);
         replica.failed();
         schedule();
         ++metrics->master.replicaRecoveries;
@@ -579,7 +579,7 @@ ReplicatedSegment::performTask()
         }
     }
     if (replicationCounter) {
-        if (writeRpcsInFlight > 0) {
+        if (writeWindow.getInFlight() > 0) {
             if (!*replicationCounter)
                 replicationCounter->
                     construct(&metrics->master.replicationTicks);
@@ -708,10 +708,15 @@ ReplicatedSegment::performWrite(Replica& replica)
         // This replica has a write request outstanding to a backup.
         if (replica.writeRpc->isReady()) {
             // Wait for it to complete if it is ready.
+            ServerId backupId = replica.backupId;
+            uint64_t writeTicks = Cycles::rdtsc() - replica.writeRpcStartTime;
             try {
                 replica.writeRpc->wait();
                 TEST_LOG("Write RPC finished for replica slot %ld",
                          &replica - &replicas[0]);
+                writeWindow.completed(backupId,
+                                      replica.sent.bytes - replica.acked.bytes,
+                                      writeTicks);
                 replica.acked = replica.sent;
                 if (replica.acked == queued || replica.acked.bytes == openLen) {
                     // #committed advances whenever a certificate was sent.
@@ -732,6 +737,7 @@ ReplicatedSegment::performWrite(Replica& replica)
                 // handleBackupFailure to reset the replica and break this
                 // loop.
                 replica.sent = replica.acked;
+                writeWindow.abandoned(backupId);
                 LOG(WARNING, "Couldn't write to backup %s; server is down",
                     replica.backupId.toString().c_str());
             } catch (const BackupOpenRejectedException& e) {
@@ -744,6 +750,9 @@ ReplicatedSegment::performWrite(Replica& replica)
                     "overloaded or may already have a replica for this segment "
                     "which was found on disk after a crash; will choose "
                     "another backup", replica.backupId.toString().c_str());
+                // Backups also reject opens when they are out of buffers;
+                // treat this as backpressure and slow down.
+                writeWindow.rejected(backupId, writeTicks);
                 replica.reset();
             } catch (const CallerNotInClusterException& e) {
                 // The backup seems to think we have crashed (or never existed).
@@ -753,17 +762,18 @@ ReplicatedSegment::performWrite(Replica& replica)
                     "STATUS_CALLER_NOT_IN_CLUSTER",
                     replica.backupId.toString().c_str());
                 replica.sent = replica.acked;
+                writeWindow.abandoned(backupId);
                 CoordinatorClient::verifyMembership(context, masterId);
             }
             replica.writeRpc.destroy();
-            --writeRpcsInFlight;
             if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
                 LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write <- %7u "
                     "%u rpcs out %s",
                     Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
                     masterId.toString().c_str(),
                     segmentId, &replica - &replicas[0], replica.acked.bytes,
-                    writeRpcsInFlight, replica.committed.close ? " CLOSE" : "");
+                    writeWindow.getInFlight(),
+                    replica.committed.close ? " CLOSE" : "");
             }
             if (replica.committed != queued || recoveringFromLostOpenReplicas)
                 schedule();
@@ -782,7 +792,7 @@ ReplicatedSegment::performWrite(Replica& replica)
                 return;
             }
             // No outstanding write, but not yet durably open.
-            if (writeRpcsInFlight == MAX_WRITE_RPCS_IN_FLIGHT) {
+            if (!writeWindow.tryStart(replica.backupId)) {
                 schedule();
                 return;
             }
@@ -800,14 +810,14 @@ ReplicatedSegment::performWrite(Replica& replica)
                                        masterId, segmentId, queued.epoch,
                                        segment, 0, openLen, certificateToSend,
                                        true, false, replicaIsPrimary(replica));
-            ++writeRpcsInFlight;
+            replica.writeRpcStartTime = Cycles::rdtsc();
             if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
                 LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
                     "%u rpcs out OPEN",
                     Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
                     masterId.toString().c_str(), segmentId,
                     &replica - &replicas[0],
-                    0, openLen, writeRpcsInFlight);
+                    0, openLen, writeWindow.getInFlight());
             }
             replica.sent.open = true;
             replica.sent.bytes = openLen;
@@ -861,7 +871,7 @@ ReplicatedSegment::performWrite(Replica& replica)
                 return;
             }
 
-            if (writeRpcsInFlight == MAX_WRITE_RPCS_IN_FLIGHT) {
+            if (!writeWindow.tryStart(replica.backupId)) {
                 TEST_LOG("Cannot write segment %lu, too many writes "
                          "in flight", segmentId);
                 schedule();
@@ -876,14 +886,14 @@ ReplicatedSegment::performWrite(Replica& replica)
                                        certificateToSend,
                                        false, sendClose,
                                        replicaIsPrimary(replica));
-            ++writeRpcsInFlight;
+            replica.writeRpcStartTime = Cycles::rdtsc();
             if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
                 LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
                     "%u rpcs out %s",
                     Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
                     masterId.toString().c_str(), segmentId,
                     &replica - &replicas[0], offset, length,
-                    writeRpcsInFlight, sendClose ? " CLOSE" : "");
+                    writeWindow.getInFlight(), sendClose ? " CLOSE" : "");
             }
             replica.sent.bytes += length;
             replica.sent.epoch = queued.epoch;
@@ -21,6 +21,7 @@
 #include "Common.h"
 #include "BackupClient.h"
 #include "BackupSelector.h"
+#include "BackupWriteWindow.h"
 #include "BoostIntrusive.h"
 #include "CycleCounter.h"
 #include "UpdateReplicationEpochTask.h"
@@ -230,6 +231,7 @@ class ReplicatedSegment : public Task {
             , sent()
             , freeRpc()
             , writeRpc()
+            , writeRpcStartTime(0)
             , replicateAtomically(false)
         {}
 
@@ -324,6 +326,12 @@ class ReplicatedSegment : public Task {
         /// The outstanding write operation to this backup, if any.
         Tub<WriteSegmentRpc> writeRpc;
 
+        /**
+         * Cycles::rdtsc() when #writeRpc was sent. Used to report its
+         * latency to BackupWriteWindow.
+         */
+        uint64_t writeRpcStartTime;
+
         // Fields below survive across failed()/start() calls.
 
         /**
@@ -363,17 +371,11 @@ class ReplicatedSegment : public Task {
   PRIVATE:
     friend class ReplicaManager;
 
-    /**
-     * Maximum number of simultaenously outstanding write rpcs to backups
-     * to allow across all ReplicatedSegments.
-     */
-    enum { MAX_WRITE_RPCS_IN_FLIGHT = 8 };
-
     ReplicatedSegment(Context* context,
                       TaskQueue& taskQueue,
                       BaseBackupSelector& backupSelector,
                       Deleter& deleter,
-                      uint32_t& writeRpcsInFlight,
+                      BackupWriteWindow& writeWindow,
                       UpdateReplicationEpochTask& replicationEpoch,
                       std::mutex& dataMutex,
                       uint64_t segmentId,
@@ -428,10 +430,11 @@ class ReplicatedSegment : public Task {
     Deleter& deleter;
 
     /**
-     * Number of outstanding write rpcs to backups across all
-     * ReplicatedSegments.  Used to throttle write rpcs.
+     * Tracks outstanding write rpcs to each backup across all
+     * ReplicatedSegments and decides when more may be sent.  Used to
+     * throttle write rpcs.
      */
-    uint32_t& writeRpcsInFlight;
+    BackupWriteWindow& writeWindow;
 
     /**
      * Provides access to the latest replicationEpoch acknowledged by the
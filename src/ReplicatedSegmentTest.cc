@@ -104,7 +104,7 @@ struct ReplicatedSegmentTest : public ::testing::Test {
                                               test->taskQueue,
                                               test->backupSelector,
                                               test->deleter,
-                                              test->writeRpcsInFlight,
+                                              test->writeWindow,
                                               test->replicationEpoch,
                                               test->dataMutex,
                                               segmentId,
@@ -133,7 +133,7 @@ struct ReplicatedSegmentTest : public ::testing::Test {
     TaskQueue taskQueue;
     ServerList serverList;
     CountingDeleter deleter;
-    uint32_t writeRpcsInFlight;
+    BackupWriteWindow writeWindow;
     std::mutex dataMutex;
     const ServerId masterId;
     const uint64_t segmentId;
@@ -155,7 +155,7 @@ struct ReplicatedSegmentTest : public ::testing::Test {
         , taskQueue()
         , serverList(&context)
         , deleter()
-        , writeRpcsInFlight(0)
+        , writeWindow()
         , dataMutex()
         , masterId(999, 0)
         , segmentId(888)
@@ -241,10 +241,10 @@ TEST_F(ReplicatedSegmentTest, freeWriteRpcInProgress) {
     transport.setInput("0 0"); // write+close second replica
     segment->close();
     taskQueue.performTask(); // writeRpc created
-    EXPECT_EQ(2lu, segment->writeRpcsInFlight);
+    EXPECT_EQ(2lu, segment->writeWindow.getInFlight());
     EXPECT_TRUE(segment->replicas[0].writeRpc);
     segment->free();
-    EXPECT_EQ(0lu, segment->writeRpcsInFlight);
+    EXPECT_EQ(0lu, segment->writeWindow.getInFlight());
     EXPECT_FALSE(segment->replicas[0].writeRpc);
 
     // make sure the backup "free" opcode was not sent
@@ -311,9 +311,9 @@ TEST_F(ReplicatedSegmentTest, handleBackupFailureWhileOpen) {
     foreach (auto& replica, segment->replicas)
         EXPECT_FALSE(replica.replicateAtomically);
 
-    EXPECT_EQ(2u, writeRpcsInFlight);
+    EXPECT_EQ(2u, writeWindow.getInFlight());
     segment->handleBackupFailure({0, 0}, false);
-    EXPECT_EQ(1u, writeRpcsInFlight);
+    EXPECT_EQ(1u, writeWindow.getInFlight());
     // The failed replica must restart replication in atomic mode.
     EXPECT_TRUE(segment->replicas[0].replicateAtomically);
     // The other open replica is in normal (non-atomic) mode still.
@@ -1118,7 +1118,7 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
     ASSERT_TRUE(segment->replicas[1].isActive);
     EXPECT_FALSE(segment->replicas[1].writeRpc);
 
-    writeRpcsInFlight = ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT;
+    writeWindow.totalInFlight = BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT;
     createSegment->logSegment.head = openLen + 10; // write queued
     segment->queued.bytes = openLen + 10;
     segment->schedule();
@@ -1127,9 +1127,10 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
 
     EXPECT_TRUE(segment->replicas[0].isActive);
     EXPECT_EQ(openLen, segment->replicas[0].sent.bytes);
-    EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
+    EXPECT_EQ(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT,
+              writeWindow.getInFlight());
 
-    writeRpcsInFlight = ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT - 1;
+    writeWindow.totalInFlight = BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT - 1;
     taskQueue.performTask(); // retry writes since a slot freed up
     EXPECT_TRUE(transport.outputMatches(0, MockTransport::SEND_REQUEST,
         WrReq{{BACKUP_WRITE, BACKUP_SERVICE, 0},
@@ -1137,7 +1138,8 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
                  openingCertificate},
                 "klmnopqrst", 10));
     transport.clearOutput();
-    EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
+    EXPECT_EQ(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT,
+              writeWindow.getInFlight());
     ASSERT_TRUE(segment->replicas[0].isActive);
     EXPECT_TRUE(segment->replicas[0].writeRpc);
     EXPECT_EQ(openLen + 10, segment->replicas[0].sent.bytes);
@@ -1151,7 +1153,8 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
                  999, 888, 0, 10, 10, false, false, false,
                  true, openingCertificate},
                 "klmnopqrst", 10));
-    EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
+    EXPECT_EQ(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT,
+              writeWindow.getInFlight());
     ASSERT_TRUE(segment->replicas[1].isActive);
     EXPECT_TRUE(segment->replicas[1].writeRpc);
     EXPECT_EQ(openLen + 10, segment->replicas[1].sent.bytes);
@@ -1160,8 +1163,8 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
 
     taskQueue.performTask(); // reap write
     EXPECT_FALSE(segment->replicas[1].writeRpc);
-    EXPECT_EQ(uint32_t(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT - 1),
-              writeRpcsInFlight);
+    EXPECT_EQ(uint32_t(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT - 1),
+              writeWindow.getInFlight());
     EXPECT_FALSE(segment->isScheduled());
     EXPECT_EQ(0u, deleter.count);
 }
@@ -1208,14 +1211,15 @@ TEST_F(ReplicatedSegmentTest, performWriteOpenTooManyInFlight) {
     transport.setInput("0 0"); // write
     transport.setInput("0 0"); // write
 
-    writeRpcsInFlight = ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT;
+    writeWindow.totalInFlight = BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT;
     taskQueue.performTask(); // try to send writes, shouldn't be able to.
 
     EXPECT_TRUE(segment->replicas[0].isActive);
     EXPECT_FALSE(segment->replicas[0].sent.open);
-    EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
+    EXPECT_EQ(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT,
+              writeWindow.getInFlight());
 
-    writeRpcsInFlight = ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT - 1;
+    writeWindow.totalInFlight = BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT - 1;
     taskQueue.performTask(); // retry writes since a slot freed up
     Segment::Certificate certificate;
     createSegment->logSegment.getAppendedLength(&certificate);
@@ -1223,7 +1227,8 @@ TEST_F(ReplicatedSegmentTest, performWriteOpenTooManyInFlight) {
         WrReq{{BACKUP_WRITE, BACKUP_SERVICE, 0},
                  999, 888, 0, 0, 10, true, false, true, true, certificate},
                 "abcdefghij", 10));
-    EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
+    EXPECT_EQ(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT,
+              writeWindow.getInFlight());
     ASSERT_TRUE(segment->replicas[0].isActive);
     EXPECT_TRUE(segment->replicas[0].writeRpc);
     EXPECT_TRUE(segment->replicas[0].sent.open);
@@ -1237,7 +1242,8 @@ TEST_F(ReplicatedSegmentTest, performWriteOpenTooManyInFlight) {
         WrReq{{BACKUP_WRITE, BACKUP_SERVICE, 1},
                  999, 888, 0, 0, 10, true, false, false, true, certificate},
                 "abcdefghij", 10));
-    EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
+    EXPECT_EQ(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT,
+              writeWindow.getInFlight());
     ASSERT_TRUE(segment->replicas[1].isActive);
     EXPECT_TRUE(segment->replicas[1].writeRpc);
     EXPECT_TRUE(segment->replicas[1].sent.open);
@@ -1247,8 +1253,8 @@ TEST_F(ReplicatedSegmentTest, performWriteOpenTooManyInFlight) {
 
     taskQueue.performTask(); // reap write
     EXPECT_FALSE(segment->replicas[1].writeRpc);
-    EXPECT_EQ(uint32_t(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT - 1),
-              writeRpcsInFlight);
+    EXPECT_EQ(uint32_t(BackupWriteWindow::MAX_WRITE_RPCS_IN_FLIGHT - 1),
+              writeWindow.getInFlight());
     EXPECT_FALSE(segment->isScheduled());
     EXPECT_EQ(0u, deleter.count);
 }
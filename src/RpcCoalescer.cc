@@ -0,0 +1,415 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "ClientException.h"
+#include "Cycles.h"
+#include "RpcCoalescer.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an RpcCoalescer.
+ *
+ * \param ramcloud
+ *      The RAMCloud object that governs the RPCs issued by this coalescer.
+ * \param windowNs
+ *      How long (in nanoseconds) a request may wait for others to join its
+ *      batch before the batch is sent. Larger values produce larger batches
+ *      at the cost of latency.
+ * \param maxBatchSize
+ *      A batch is sent immediately once it holds this many requests.
+ */
+RpcCoalescer::RpcCoalescer(RamCloud* ramcloud, uint64_t windowNs,
+        uint32_t maxBatchSize)
+    : Dispatch::Poller(*ramcloud->clientContext->dispatch, "RpcCoalescer")
+    , ramcloud(ramcloud)
+    , windowCycles(Cycles::fromNanoseconds(windowNs))
+    , maxBatchSize(std::max(maxBatchSize, 1U))
+    , pendingReads()
+    , pendingWrites()
+    , inFlight()
+    , reaping(false)
+{
+}
+
+/**
+ * Destructor: sends anything still pending and waits for all batches to
+ * finish.
+ */
+RpcCoalescer::~RpcCoalescer()
+{
+    flush();
+
+    // wait() runs the dispatcher, whose calls to poll() reap finished
+    // batches from inFlight; take our own copy so that doesn't disturb us.
+    vector<BatchRef> batches;
+    batches.swap(inFlight);
+    foreach (BatchRef& batch, batches)
+        wait(batch);
+}
+
+/**
+ * Send all pending requests immediately, without waiting for the window to
+ * expire. Does not wait for them to complete.
+ */
+void
+RpcCoalescer::flush()
+{
+    if (pendingReads)
+        send(pendingReads);
+    if (pendingWrites)
+        send(pendingWrites);
+}
+
+/**
+ * Invoked by the dispatcher on each pass through its polling loop: send any
+ * batch whose window has expired and reap batches that have finished.
+ */
+void
+RpcCoalescer::poll()
+{
+    uint64_t now = Cycles::rdtsc();
+    if (pendingReads && now - pendingReads->startTime >= windowCycles)
+        send(pendingReads);
+    if (pendingWrites && now - pendingWrites->startTime >= windowCycles)
+        send(pendingWrites);
+
+    // Checking a batch can run the dispatcher (e.g. to refresh the tablet
+    // map when a MultiOp retries), which calls us again; only the outermost
+    // call reaps, so inFlight doesn't shrink under our loop.
+    if (reaping)
+        return;
+    reaping = true;
+    try {
+        // The order of iteration lets us remove entries as we go.
+        for (size_t i = inFlight.size(); i > 0; i--) {
+            if (inFlight[i - 1]->isReady()) {
+                inFlight[i - 1] = inFlight.back();
+                inFlight.pop_back();
+            }
+        }
+    } catch (...) {
+        reaping = false;
+        throw;
+    }
+    reaping = false;
+}
+
+/**
+ * Add a read to the current read batch (creating one if needed).
+ *
+ * \param request
+ *      The read to add; must remain valid until the batch has finished or
+ *      the request has been removed from it.
+ * \return
+ *      The batch that will issue the read.
+ */
+RpcCoalescer::BatchRef
+RpcCoalescer::addRead(MultiReadObject* request)
+{
+    if (!pendingReads) {
+        pendingReads.reset(new Batch);
+        pendingReads->startTime = Cycles::rdtsc();
+    }
+    BatchRef batch = pendingReads;
+    batch->reads.push_back(request);
+    if (batch->reads.size() >= maxBatchSize)
+        send(pendingReads);
+    return batch;
+}
+
+/**
+ * Add a write to the current write batch (creating one if needed).
+ *
+ * \param request
+ *      The write to add; must remain valid until the batch has finished or
+ *      the request has been removed from it.
+ * \return
+ *      The batch that will issue the write.
+ */
+RpcCoalescer::BatchRef
+RpcCoalescer::addWrite(MultiWriteObject* request)
+{
+    if (!pendingWrites) {
+        pendingWrites.reset(new Batch);
+        pendingWrites->startTime = Cycles::rdtsc();
+    }
+    BatchRef batch = pendingWrites;
+    batch->writes.push_back(request);
+    if (batch->writes.size() >= maxBatchSize)
+        send(pendingWrites);
+    return batch;
+}
+
+/**
+ * Start the operation for a pending batch.
+ *
+ * \param pending
+ *      Either #pendingReads or #pendingWrites; it is cleared, since any
+ *      further requests must go in a new batch.
+ */
+void
+RpcCoalescer::send(BatchRef& pending)
+{
+    // Starting the operation may look up tablets and run the dispatcher,
+    // which calls poll(); clear the pending slot first so a nested call
+    // can't send this batch again.
+    BatchRef batch;
+    batch.swap(pending);
+    if (!batch->reads.empty()) {
+        batch->multiRead.construct(ramcloud, &batch->reads[0],
+                downCast<uint32_t>(batch->reads.size()));
+    } else if (!batch->writes.empty()) {
+        batch->multiWrite.construct(ramcloud, &batch->writes[0],
+                downCast<uint32_t>(batch->writes.size()));
+    } else {
+        // Every request was abandoned before the batch was sent.
+        batch->done = true;
+    }
+    if (!batch->done)
+        inFlight.push_back(batch);
+}
+
+/**
+ * Send a batch if it hasn't been sent yet, then wait for it to finish.
+ *
+ * \param batch
+ *      The batch to wait for.
+ */
+void
+RpcCoalescer::wait(const BatchRef& batch)
+{
+    if (batch == pendingReads)
+        send(pendingReads);
+    else if (batch == pendingWrites)
+        send(pendingWrites);
+
+    // As in MultiOp::wait, we must run the dispatcher ourselves if we are
+    // in the dispatch thread.
+    Dispatch* dispatch = ramcloud->clientContext->dispatch;
+    bool isDispatchThread = dispatch->isDispatchThread();
+    while (!batch->isReady()) {
+        if (isDispatchThread)
+            dispatch->poll();
+    }
+}
+
+/**
+ * Construct an empty batch.
+ */
+RpcCoalescer::Batch::Batch()
+    : reads()
+    , writes()
+    , startTime(0)
+    , multiRead()
+    , multiWrite()
+    , done(false)
+{
+}
+
+/**
+ * Drop a request from a batch that hasn't been sent yet.
+ *
+ * \param request
+ *      The request to remove; nothing happens if it isn't in the batch.
+ */
+void
+RpcCoalescer::Batch::remove(MultiOpObject* request)
+{
+    assert(!multiRead && !multiWrite);
+    reads.erase(std::remove(reads.begin(), reads.end(), request),
+            reads.end());
+    writes.erase(std::remove(writes.begin(), writes.end(), request),
+            writes.end());
+}
+
+/**
+ * Make progress on a batch that has been sent.
+ *
+ * \return
+ *      True means the batch has finished (the results in its requests are
+ *      final); false means it is still underway or hasn't been sent.
+ */
+bool
+RpcCoalescer::Batch::isReady()
+{
+    if (done)
+        return true;
+    if (multiRead)
+        done = multiRead->isReady();
+    else if (multiWrite)
+        done = multiWrite->isReady();
+    return done;
+}
+
+//-------------------------------------------------------
+// CoalescedReadRpc
+//-------------------------------------------------------
+
+/**
+ * Start reading an object; the read is issued as part of the coalescer's
+ * next read batch.
+ *
+ * \param coalescer
+ *      The coalescer that will issue the read.
+ * \param tableId
+ *      The table containing the desired object (return value from
+ *      a previous call to getTableId).
+ * \param key
+ *      Variable length key that uniquely identifies the object within tableId.
+ *      It does not necessarily have to be null terminated.  The caller must
+ *      ensure that the storage for this key is unchanged through the life of
+ *      the RPC.
+ * \param keyLength
+ *      Size in bytes of the key.
+ * \param[out] value
+ *      If the read succeeds, this will hold the contents of the object once
+ *      wait returns; otherwise it will be empty.
+ */
+CoalescedReadRpc::CoalescedReadRpc(RpcCoalescer* coalescer, uint64_t tableId,
+        const void* key, uint16_t keyLength, Tub<Buffer>* value)
+    : coalescer(coalescer)
+    , request(tableId, key, keyLength, value)
+    , batch()
+{
+    batch = coalescer->addRead(&request);
+}
+
+/**
+ * Destructor: if the read hasn't been sent it is dropped from its batch;
+ * if it is underway, this waits for its batch to finish, since the batch
+ * refers to this object.
+ */
+CoalescedReadRpc::~CoalescedReadRpc()
+{
+    if (batch->multiRead)
+        coalescer->wait(batch);
+    else
+        batch->remove(&request);
+}
+
+/**
+ * Indicates whether the read has finished.
+ *
+ * \return
+ *      True means that wait will not block.
+ */
+bool
+CoalescedReadRpc::isReady()
+{
+    return batch->isReady();
+}
+
+/**
+ * Wait for the read to complete (sending its batch right away if needed)
+ * and return its result.
+ *
+ * \param[out] version
+ *      If non-NULL, the version number of the object is returned here.
+ */
+void
+CoalescedReadRpc::wait(uint64_t* version)
+{
+    coalescer->wait(batch);
+    if (version != NULL)
+        *version = request.version;
+    if (request.status != STATUS_OK)
+        ClientException::throwException(HERE, request.status);
+}
+
+//-------------------------------------------------------
+// CoalescedWriteRpc
+//-------------------------------------------------------
+
+/**
+ * Start writing an object; the write is issued as part of the coalescer's
+ * next write batch.
+ *
+ * \param coalescer
+ *      The coalescer that will issue the write.
+ * \param tableId
+ *      The table containing the desired object (return value from
+ *      a previous call to getTableId).
+ * \param key
+ *      Variable length key that uniquely identifies the object within tableId.
+ *      It does not necessarily have to be null terminated.  The caller must
+ *      ensure that the storage for this key is unchanged through the life of
+ *      the RPC.
+ * \param keyLength
+ *      Size in bytes of the key.
+ * \param buf
+ *      Address of the first byte of the new contents for the object; must
+ *      remain unchanged through the life of the RPC.
+ * \param length
+ *      Size in bytes of the new contents for the object.
+ * \param rejectRules
+ *      If non-NULL, specifies conditions under which the write should be
+ *      aborted with an error.
+ */
+CoalescedWriteRpc::CoalescedWriteRpc(RpcCoalescer* coalescer,
+        uint64_t tableId, const void* key, uint16_t keyLength,
+        const void* buf, uint32_t length, const RejectRules* rejectRules)
+    : coalescer(coalescer)
+    , request(tableId, key, keyLength, buf, length, rejectRules)
+    , batch()
+{
+    batch = coalescer->addWrite(&request);
+}
+
+/**
+ * Destructor: if the write hasn't been sent it is dropped from its batch;
+ * if it is underway, this waits for its batch to finish, since the batch
+ * refers to this object.
+ */
+CoalescedWriteRpc::~CoalescedWriteRpc()
+{
+    if (batch->multiWrite)
+        coalescer->wait(batch);
+    else
+        batch->remove(&request);
+}
+
+/**
+ * Indicates whether the write has finished.
+ *
+ * \return
+ *      True means that wait will not block.
+ */
+bool
+CoalescedWriteRpc::isReady()
+{
+    return batch->isReady();
+}
+
+/**
+ * Wait for the write to complete (sending its batch right away if needed)
+ * and return its result.
+ *
+ * \param[out] version
+ *      If non-NULL, the version number of the new object is returned here.
+ */
+void
+CoalescedWriteRpc::wait(uint64_t* version)
+{
+    coalescer->wait(batch);
+    if (version != NULL)
+        *version = request.version;
+    if (request.status != STATUS_OK)
+        ClientException::throwException(HERE, request.status);
+}
+
+} // namespace RAMCloud
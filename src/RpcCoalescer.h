@@ -0,0 +1,182 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_RPCCOALESCER_H
+#define RAMCLOUD_RPCCOALESCER_H
+
+#include <memory>
+
+#include "Dispatch.h"
+#include "MultiRead.h"
+#include "MultiWrite.h"
+
+namespace RAMCloud {
+
+/**
+ * An RpcCoalescer lets a client issue many independent, asynchronous
+ * single-object reads and writes without paying for one RPC per object.
+ * Requests started through CoalescedReadRpc and CoalescedWriteRpc are held
+ * for a short window; then all of the reads (and, separately, all of the
+ * writes) collected during the window are issued together as a MultiRead or
+ * MultiWrite. The MultiOp framework groups them by master (using the
+ * ObjectFinder) so that each master receives a single MULTI_OP RPC per batch.
+ *
+ * A batch is sent as soon as any of the following happens:
+ *   - The window has elapsed since its first request was added (checked
+ *     each time the client's dispatcher polls).
+ *   - It reaches maxBatchSize requests.
+ *   - Some request in it is waited for.
+ *   - flush() is called.
+ *
+ * Batching is opt-in: ordinary RamCloud calls and RPC wrappers are unaffected.
+ * An RpcCoalescer must be used only in the client's dispatch thread, and it
+ * must outlive all of the RPCs started through it.
+ */
+class RpcCoalescer : public Dispatch::Poller {
+  PUBLIC:
+    /// Default for the \a windowNs constructor argument.
+    static const uint64_t DEFAULT_WINDOW_NS = 10000;
+
+    /// Default for the \a maxBatchSize constructor argument.
+    static const uint32_t DEFAULT_MAX_BATCH_SIZE = 100;
+
+    explicit RpcCoalescer(RamCloud* ramcloud,
+            uint64_t windowNs = DEFAULT_WINDOW_NS,
+            uint32_t maxBatchSize = DEFAULT_MAX_BATCH_SIZE);
+    ~RpcCoalescer();
+    void flush();
+    void poll();
+
+  PRIVATE:
+    /**
+     * A group of requests of the same type that are (or will be) issued
+     * together as a single MultiOp. Batches are shared between the
+     * RpcCoalescer and the RPCs in them, so that a batch lives until both
+     * the operation has finished and every RPC in it has been destroyed.
+     */
+    struct Batch {
+        Batch();
+        void remove(MultiOpObject* request);
+        bool isReady();
+
+        /// Requests in this batch, in the order they were started. Only
+        /// one of these is used, depending on the kind of batch.
+        vector<MultiReadObject*> reads;
+        vector<MultiWriteObject*> writes;
+
+        /// Rdtsc time when the first request was added to this batch.
+        uint64_t startTime;
+
+        /// The operation issuing this batch; constructed when the batch is
+        /// sent. Only one of these is used, depending on the kind of batch.
+        Tub<MultiRead> multiRead;
+        Tub<MultiWrite> multiWrite;
+
+        /// True means the operation has finished and the results in the
+        /// requests are final.
+        bool done;
+
+        DISALLOW_COPY_AND_ASSIGN(Batch);
+    };
+    typedef std::shared_ptr<Batch> BatchRef;
+
+    BatchRef addRead(MultiReadObject* request);
+    BatchRef addWrite(MultiWriteObject* request);
+    void send(BatchRef& pending);
+    void wait(const BatchRef& batch);
+
+    /// Overall client state information.
+    RamCloud* ramcloud;
+
+    /// A batch is sent once this many cycles have passed since its first
+    /// request was added.
+    uint64_t windowCycles;
+
+    /// A batch is sent as soon as it holds this many requests.
+    uint32_t maxBatchSize;
+
+    /// Reads and writes that haven't been sent yet; NULL means there are
+    /// none of that type.
+    BatchRef pendingReads;
+    BatchRef pendingWrites;
+
+    /// Batches that have been sent but haven't finished.
+    vector<BatchRef> inFlight;
+
+    /// True while poll() is reaping finished batches from #inFlight; used
+    /// to skip reaping in nested calls.
+    bool reaping;
+
+    friend class CoalescedReadRpc;
+    friend class CoalescedWriteRpc;
+    DISALLOW_COPY_AND_ASSIGN(RpcCoalescer);
+};
+
+/**
+ * Reads a single object through an RpcCoalescer. Its interface mirrors
+ * ReadRpc: construct it to start the read, then use isReady and wait to
+ * collect the result.
+ */
+class CoalescedReadRpc {
+  public:
+    CoalescedReadRpc(RpcCoalescer* coalescer, uint64_t tableId,
+            const void* key, uint16_t keyLength, Tub<Buffer>* value);
+    ~CoalescedReadRpc();
+    bool isReady();
+    void wait(uint64_t* version = NULL);
+
+  PRIVATE:
+    /// The coalescer that issues this read.
+    RpcCoalescer* coalescer;
+
+    /// Parameters and results of the read, as seen by the MultiRead.
+    MultiReadObject request;
+
+    /// The batch containing #request.
+    RpcCoalescer::BatchRef batch;
+
+    DISALLOW_COPY_AND_ASSIGN(CoalescedReadRpc);
+};
+
+/**
+ * Writes a single object through an RpcCoalescer. Its interface mirrors
+ * WriteRpc: construct it to start the write, then use isReady and wait to
+ * collect the result.
+ */
+class CoalescedWriteRpc {
+  public:
+    CoalescedWriteRpc(RpcCoalescer* coalescer, uint64_t tableId,
+            const void* key, uint16_t keyLength, const void* buf,
+            uint32_t length, const RejectRules* rejectRules = NULL);
+    ~CoalescedWriteRpc();
+    bool isReady();
+    void wait(uint64_t* version = NULL);
+
+  PRIVATE:
+    /// The coalescer that issues this write.
+    RpcCoalescer* coalescer;
+
+    /// Parameters and results of the write, as seen by the MultiWrite.
+    MultiWriteObject request;
+
+    /// The batch containing #request.
+    RpcCoalescer::BatchRef batch;
+
+    DISALLOW_COPY_AND_ASSIGN(CoalescedWriteRpc);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_RPCCOALESCER_H
@@ -0,0 +1,218 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "CoordinatorClient.h"
+#include "MockCluster.h"
+#include "RamCloud.h"
+#include "RpcCoalescer.h"
+
+namespace RAMCloud {
+
+// Fetches the real tablet map, but first runs the dispatcher as a client
+// waiting for the coordinator would, so pollers run in the middle of a
+// tablet lookup.
+class PollingRefresher : public ObjectFinder::TabletMapFetcher {
+  public:
+    explicit PollingRefresher(Context* context)
+        : context(context), refreshCount(0) {}
+    void getTabletMap(ProtoBuf::Tablets& tabletMap) {
+        refreshCount++;
+        context->dispatch->poll();
+        CoordinatorClient::getTabletMap(context, &tabletMap);
+    }
+    Context* context;
+    int refreshCount;
+    DISALLOW_COPY_AND_ASSIGN(PollingRefresher);
+};
+
+class RpcCoalescerTest : public ::testing::Test {
+  public:
+    Context context;
+    MockCluster cluster;
+    Tub<RamCloud> ramcloud;
+    uint64_t tableId1;
+    uint64_t tableId2;
+
+    RpcCoalescerTest()
+        : context()
+        , cluster(&context)
+        , ramcloud()
+        , tableId1(-1)
+        , tableId2(-2)
+    {
+        Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+
+        ServerConfig config = ServerConfig::forTesting();
+        config.services = {WireFormat::MASTER_SERVICE,
+                           WireFormat::PING_SERVICE};
+        config.localLocator = "mock:host=master1";
+        cluster.addServer(config);
+        config.localLocator = "mock:host=master2";
+        cluster.addServer(config);
+        ramcloud.construct(&context, "mock:host=coordinator");
+
+        tableId1 = ramcloud->createTable("table1");
+        ramcloud->write(tableId1, "object1-1", 9, "value:1-1");
+        ramcloud->write(tableId1, "object1-2", 9, "value:1-2");
+        tableId2 = ramcloud->createTable("table2");
+        ramcloud->write(tableId2, "object2-1", 9, "value:2-1");
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(RpcCoalescerTest);
+};
+
+TEST_F(RpcCoalescerTest, read_basics) {
+    RpcCoalescer coalescer(ramcloud.get(), 1000000000);
+    Tub<Buffer> value1, value2, value3;
+    CoalescedReadRpc read1(&coalescer, tableId1, "object1-1", 9, &value1);
+    CoalescedReadRpc read2(&coalescer, tableId1, "object1-2", 9, &value2);
+    CoalescedReadRpc read3(&coalescer, tableId2, "object2-1", 9, &value3);
+
+    // Nothing is sent until the window expires or someone waits.
+    EXPECT_EQ(3U, coalescer.pendingReads->reads.size());
+    EXPECT_FALSE(read1.isReady());
+    EXPECT_EQ(0U, coalescer.inFlight.size());
+
+    uint64_t version;
+    read2.wait(&version);
+    EXPECT_FALSE(coalescer.pendingReads);
+    EXPECT_EQ(2U, version);
+    EXPECT_EQ("value:1-2", TestUtil::toString(value2.get()));
+
+    // The other reads went out in the same batch.
+    EXPECT_TRUE(read1.isReady());
+    EXPECT_TRUE(read3.isReady());
+    read1.wait();
+    read3.wait();
+    EXPECT_EQ("value:1-1", TestUtil::toString(value1.get()));
+    EXPECT_EQ("value:2-1", TestUtil::toString(value3.get()));
+}
+
+TEST_F(RpcCoalescerTest, read_error) {
+    RpcCoalescer coalescer(ramcloud.get());
+    Tub<Buffer> value1, value2;
+    CoalescedReadRpc read1(&coalescer, tableId1, "object1-1", 9, &value1);
+    CoalescedReadRpc read2(&coalescer, tableId1, "bogus", 5, &value2);
+    EXPECT_THROW(read2.wait(), ObjectDoesntExistException);
+    EXPECT_FALSE(value2);
+    read1.wait();
+    EXPECT_EQ("value:1-1", TestUtil::toString(value1.get()));
+}
+
+TEST_F(RpcCoalescerTest, write) {
+    RpcCoalescer coalescer(ramcloud.get());
+    uint64_t version1, version2;
+    {
+        CoalescedWriteRpc write1(&coalescer, tableId1, "object1-1", 9,
+                "new1", 4);
+        CoalescedWriteRpc write2(&coalescer, tableId2, "object2-9", 9,
+                "new2", 4);
+        EXPECT_EQ(2U, coalescer.pendingWrites->writes.size());
+        write1.wait(&version1);
+        write2.wait(&version2);
+    }
+
+    Buffer value;
+    uint64_t version;
+    ramcloud->read(tableId1, "object1-1", 9, &value, NULL, &version);
+    EXPECT_EQ("new1", TestUtil::toString(&value));
+    EXPECT_EQ(version, version1);
+    ramcloud->read(tableId2, "object2-9", 9, &value, NULL, &version);
+    EXPECT_EQ("new2", TestUtil::toString(&value));
+    EXPECT_EQ(version, version2);
+
+    // Reject rules apply to each write individually.
+    RejectRules rules;
+    memset(&rules, 0, sizeof(rules));
+    rules.doesntExist = 1;
+    CoalescedWriteRpc write3(&coalescer, tableId1, "object1-3", 9,
+            "new3", 4, &rules);
+    EXPECT_THROW(write3.wait(), ObjectDoesntExistException);
+}
+
+TEST_F(RpcCoalescerTest, maxBatchSize) {
+    RpcCoalescer coalescer(ramcloud.get(), 1000000000, 2);
+    Tub<Buffer> value1, value2, value3;
+    CoalescedReadRpc read1(&coalescer, tableId1, "object1-1", 9, &value1);
+    EXPECT_EQ(1U, coalescer.pendingReads->reads.size());
+    CoalescedReadRpc read2(&coalescer, tableId1, "object1-2", 9, &value2);
+    EXPECT_FALSE(coalescer.pendingReads);
+    EXPECT_EQ(1U, coalescer.inFlight.size());
+    CoalescedReadRpc read3(&coalescer, tableId2, "object2-1", 9, &value3);
+    EXPECT_EQ(1U, coalescer.pendingReads->reads.size());
+    EXPECT_TRUE(read1.isReady());
+    EXPECT_FALSE(read3.isReady());
+}
+
+TEST_F(RpcCoalescerTest, poll) {
+    Tub<Buffer> value1, value2;
+    RpcCoalescer slow(ramcloud.get(), 1000000000);
+    CoalescedReadRpc read1(&slow, tableId1, "object1-1", 9, &value1);
+    slow.poll();
+    EXPECT_TRUE(slow.pendingReads);
+
+    // With no window, a batch goes out on the next poll, and a later poll
+    // reaps it once it has finished.
+    RpcCoalescer fast(ramcloud.get(), 0);
+    CoalescedReadRpc read2(&fast, tableId1, "object1-2", 9, &value2);
+    fast.poll();
+    EXPECT_FALSE(fast.pendingReads);
+    fast.poll();
+    EXPECT_EQ(0U, fast.inFlight.size());
+    EXPECT_TRUE(read2.isReady());
+    EXPECT_EQ("value:1-2", TestUtil::toString(value2.get()));
+}
+
+TEST_F(RpcCoalescerTest, send_tabletMapMiss) {
+    RpcCoalescer coalescer(ramcloud.get(), 0);
+    Tub<Buffer> value1, value2;
+    CoalescedReadRpc read1(&coalescer, tableId1, "object1-1", 9, &value1);
+    CoalescedReadRpc read2(&coalescer, tableId2, "object2-1", 9, &value2);
+    PollingRefresher* refresher = new PollingRefresher(&context);
+    ramcloud->objectFinder.tabletMapFetcher.reset(refresher);
+    ramcloud->objectFinder.flush();
+
+    // Sending the batch misses in the tablet map, and the refresh calls
+    // poll() while the batch's window has expired; it must not be sent
+    // again.
+    coalescer.flush();
+    EXPECT_LT(0, refresher->refreshCount);
+    EXPECT_FALSE(coalescer.pendingReads);
+    EXPECT_EQ(1U, coalescer.inFlight.size());
+
+    read1.wait();
+    read2.wait();
+    EXPECT_EQ("value:1-1", TestUtil::toString(value1.get()));
+    EXPECT_EQ("value:2-1", TestUtil::toString(value2.get()));
+    coalescer.poll();
+    EXPECT_EQ(0U, coalescer.inFlight.size());
+}
+
+TEST_F(RpcCoalescerTest, destroyUnsentRpc) {
+    RpcCoalescer coalescer(ramcloud.get(), 1000000000);
+    Tub<Buffer> value1;
+    Tub<CoalescedReadRpc> read1;
+    read1.construct(&coalescer, tableId1, "object1-1", uint16_t(9), &value1);
+    read1.destroy();
+    EXPECT_EQ(0U, coalescer.pendingReads->reads.size());
+
+    // Sending a batch whose requests were all abandoned is a no-op.
+    coalescer.flush();
+    EXPECT_FALSE(coalescer.pendingReads);
+    EXPECT_EQ(0U, coalescer.inFlight.size());
+}
+
+}  // namespace RAMCloud
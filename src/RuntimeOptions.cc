@@ -56,6 +56,28 @@ struct Parser<std::queue<T>> : public RuntimeOptions::Parseable {
     std::queue<T>& target;
 };
 
+/**
+ * Specialization which parses strings of form "a" to uint64_t. If the string
+ * cannot be parsed the field is left unchanged.
+ */
+template <>
+struct Parser<uint64_t> : public RuntimeOptions::Parseable {
+    explicit Parser(uint64_t& target)
+        : target(target)
+    {}
+
+    void
+    parse(const char* value)
+    {
+        std::istringstream iss(value);
+        uint64_t result;
+        if (iss >> result)
+            target = result;
+    }
+
+    uint64_t& target;
+};
+
 /// Helper function to make declaring a new option easier.
 template <typename T>
 Parser<T>*
@@ -76,9 +98,21 @@ RuntimeOptions::RuntimeOptions()
     : parsers()
     , mutex()
     , failRecoveryMasters()
+    , recoveryPartitionBytes(500 * 1024 * 1024)
+    , balancerIntervalMs(0)
+    , balancerMinOpsPerSecond(10000)
+    , balancerOverloadPercent(150)
+    , balancerUnderloadPercent(75)
+    , balancerCooldownMs(10000)
 {
 #define REGISTER(field) registerOption(#field, newParser(field))
     REGISTER(failRecoveryMasters);
+    REGISTER(recoveryPartitionBytes);
+    REGISTER(balancerIntervalMs);
+    REGISTER(balancerMinOpsPerSecond);
+    REGISTER(balancerOverloadPercent);
+    REGISTER(balancerUnderloadPercent);
+    REGISTER(balancerCooldownMs);
 #undef REGISTER
 }
 
@@ -129,6 +163,57 @@ RuntimeOptions::popFailRecoveryMasters()
     return result;
 }
 
+/**
+ * Return the target size of each recovery partition. See
+ * #recoveryPartitionBytes.
+ */
+uint64_t
+RuntimeOptions::getRecoveryPartitionBytes()
+{
+    Lock _(mutex);
+    return recoveryPartitionBytes;
+}
+
+/// Return #balancerIntervalMs.
+uint64_t
+RuntimeOptions::getBalancerIntervalMs()
+{
+    Lock _(mutex);
+    return balancerIntervalMs;
+}
+
+/// Return #balancerMinOpsPerSecond.
+uint64_t
+RuntimeOptions::getBalancerMinOpsPerSecond()
+{
+    Lock _(mutex);
+    return balancerMinOpsPerSecond;
+}
+
+/// Return #balancerOverloadPercent.
+uint64_t
+RuntimeOptions::getBalancerOverloadPercent()
+{
+    Lock _(mutex);
+    return balancerOverloadPercent;
+}
+
+/// Return #balancerUnderloadPercent.
+uint64_t
+RuntimeOptions::getBalancerUnderloadPercent()
+{
+    Lock _(mutex);
+    return balancerUnderloadPercent;
+}
+
+/// Return #balancerCooldownMs.
+uint64_t
+RuntimeOptions::getBalancerCooldownMs()
+{
+    Lock _(mutex);
+    return balancerCooldownMs;
+}
+
 // - private -
 
 /**
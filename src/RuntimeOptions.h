@@ -43,6 +43,12 @@ class RuntimeOptions {
 
         void set(const char* option, const char* value);
         uint32_t popFailRecoveryMasters();
+        uint64_t getRecoveryPartitionBytes();
+        uint64_t getBalancerIntervalMs();
+        uint64_t getBalancerMinOpsPerSecond();
+        uint64_t getBalancerOverloadPercent();
+        uint64_t getBalancerUnderloadPercent();
+        uint64_t getBalancerCooldownMs();
 
     PRIVATE:
         /**
@@ -85,6 +91,51 @@ class RuntimeOptions {
          */
         std::queue<uint32_t> failRecoveryMasters;
 
+        /**
+         * Target size in bytes of each partition of a crashed master's
+         * tablets. Recoveries split tablets larger than this and pack smaller
+         * ones together so each recovery master replays about this much data
+         * (see Recovery::partitionTablets()). 0 disables size-aware
+         * partitioning, so that each tablet is recovered as its own
+         * partition.
+         */
+        uint64_t recoveryPartitionBytes;
+
+        /**
+         * Milliseconds between rounds of the coordinator's TabletBalancer,
+         * each of which collects statistics from every master and may move
+         * one hot tablet. 0 disables the balancer; that is the default, so
+         * that tablets don't move underneath benchmarks and recovery
+         * experiments. Operators turn it on with SET_RUNTIME_OPTION.
+         */
+        uint64_t balancerIntervalMs;
+
+        /**
+         * The TabletBalancer leaves a master alone unless it is serving at
+         * least this many reads and writes per second, so that it doesn't
+         * move tablets around a lightly loaded cluster.
+         */
+        uint64_t balancerMinOpsPerSecond;
+
+        /**
+         * The TabletBalancer considers a master overloaded if it serves
+         * more than this percentage of the average load across masters.
+         */
+        uint64_t balancerOverloadPercent;
+
+        /**
+         * The TabletBalancer only moves tablets to masters serving less than
+         * this percentage of the average load across masters.
+         */
+        uint64_t balancerUnderloadPercent;
+
+        /**
+         * Minimum number of milliseconds between tablet moves made by the
+         * TabletBalancer, giving the cluster time to settle (and masters
+         * time to gather fresh statistics) after each one.
+         */
+        uint64_t balancerCooldownMs;
+
     DISALLOW_COPY_AND_ASSIGN(RuntimeOptions);
 };
 
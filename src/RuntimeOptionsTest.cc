@@ -44,6 +44,14 @@ TEST_F(RuntimeOptionsTest, set) {
     ASSERT_EQ(0u, options.failRecoveryMasters.size());
     options.set("failRecoveryMasters", "1 foo 2 other 3");
     ASSERT_EQ(1u, options.failRecoveryMasters.size());
+
+    // Check uint64_t parser.
+    options.set("recoveryPartitionBytes", "1000");
+    EXPECT_EQ(1000u, options.recoveryPartitionBytes);
+    options.set("recoveryPartitionBytes", "foo");
+    EXPECT_EQ(1000u, options.recoveryPartitionBytes);
+    options.set("recoveryPartitionBytes", "0");
+    EXPECT_EQ(0u, options.getRecoveryPartitionBytes());
 }
 
 TEST_F(RuntimeOptionsTest, popFailRecoveryMasters) {
@@ -158,6 +158,28 @@ SegmentIterator::next()
     currentLength.destroy();
 }
 
+/**
+ * Move the iterator directly to the entry at a given offset in the segment,
+ * as previously returned by getOffset() on an iterator over the same
+ * segment. This lets a caller that has already walked the segment revisit
+ * a subset of its entries without stepping over all the others again.
+ *
+ * \param offset
+ *      Offset of the entry to move to. Any offset at or past the end of the
+ *      segment leaves the iterator isDone().
+ */
+void
+SegmentIterator::seek(uint32_t offset)
+{
+    currentOffset = offset;
+    if (isDone())
+        currentHeader = Segment::EntryHeader();
+    else
+        currentHeader = segment->getEntryHeader(currentOffset);
+
+    currentLength.destroy();
+}
+
 /**
  * Return the type of the entry currently pointed to by the iterator.
  * If no entry is currently pointed to, returns LOG_ENTRY_TYPE_INVALID.
@@ -53,6 +53,7 @@ class SegmentIterator {
     SegmentIterator& operator=(const SegmentIterator& other);
     ~SegmentIterator();
     void next();
+    void seek(uint32_t offset);
     LogEntryType getType();
     uint32_t getLength();
     uint32_t getOffset();
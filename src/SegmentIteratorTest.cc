@@ -163,6 +163,28 @@ TEST_F(SegmentIteratorTest, next) {
     EXPECT_EQ(s.getEntryHeader(7), it2.currentHeader);
 }
 
+TEST_F(SegmentIteratorTest, seek) {
+    s.append(LOG_ENTRY_TYPE_OBJ, "hi", 3);
+    s.append(LOG_ENTRY_TYPE_OBJTOMB, "blam", 5);
+
+    SegmentIterator it(s);
+    it.next();
+    uint32_t second = it.getOffset();
+
+    SegmentIterator it2(s);
+    it2.getLength();
+    it2.seek(second);
+    EXPECT_FALSE(it2.currentLength);
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJTOMB, it2.getType());
+    EXPECT_EQ(5U, it2.getLength());
+    it2.seek(0);
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, it2.getType());
+
+    it2.seek(~0U);
+    EXPECT_TRUE(it2.isDone());
+    EXPECT_EQ(LOG_ENTRY_TYPE_INVALID, it2.getType());
+}
+
 TEST_F(SegmentIteratorTest, getType) {
     s.append(LOG_ENTRY_TYPE_OBJ, "hi", 3);
     s.append(LOG_ENTRY_TYPE_OBJTOMB, "hi", 3);
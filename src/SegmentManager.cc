@@ -336,6 +336,72 @@ SegmentManager::allocSideSegment(uint32_t flags, LogSegment* replacing)
     return s;
 }
 
+/**
+ * Allocate a segment for one of the Log's append streams. Each stream appends
+ * to its own open segment in parallel with the log head (see Log::append), so
+ * that appending threads need not all serialize on the head.
+ *
+ * The segment is opened durably on backups before this method returns, but it
+ * only becomes part of the log once the next LogDigest is written, which names
+ * it for as long as it remains open. The caller must therefore roll the head
+ * over before acknowledging anything appended to the segment. Because stream
+ * segments never contain a digest, recovery never takes one for the head of
+ * the log, and since they are named in the digest, the loss of every replica
+ * of one is detected just like the loss of any closed segment.
+ *
+ * \return
+ *      NULL if out of memory, otherwise the new segment. It contains only a
+ *      header.
+ */
+LogSegment*
+SegmentManager::allocStreamSegment()
+{
+    Tub<Lock> guard;
+    guard.construct(lock);
+
+    LogSegment* s = alloc(ALLOC_REGULAR_SIDELOG,
+                          nextSegmentId,
+                          WallTime::secondsTimestamp());
+    if (s == NULL)
+        return NULL;
+
+    nextSegmentId++;
+    writeHeader(s);
+    s->replicatedSegment = replicaManager.allocateNonHead(s->id, s);
+    segmentsOnDiskHistogram.storeSample(++segmentsOnDisk);
+
+    // A digest must never name a segment that isn't yet open on backups, or
+    // recovery would think it lost. Until the open is durable the segment
+    // stays in the SIDELOG state, which digests ignore.
+    guard.destroy();
+    s->replicatedSegment->sync();
+    s->syncedLength = s->getAppendedLength();
+
+    guard.construct(lock);
+    changeState(*s, STREAM);
+
+    TEST_LOG("id = %lu", s->id);
+
+    return s;
+}
+
+/**
+ * Called by the Log when one of its append streams is done with a segment
+ * previously returned by allocStreamSegment(). The segment must already have
+ * been closed, both in memory and on backups. It remains part of the log and
+ * may now be cleaned.
+ *
+ * \param segment
+ *      The closed stream segment.
+ */
+void
+SegmentManager::streamSegmentClosed(LogSegment* segment)
+{
+    Lock guard(lock);
+    assert(states[segment->slot] == STREAM);
+    changeState(*segment, NEWLY_CLEANABLE);
+}
+
 /**
  * This method is invoked by the log cleaner when it has finished a cleaning
  * pass. A list of cleaned segments is passed in, as well as a list of new
@@ -521,6 +587,7 @@ SegmentManager::getActiveSegments(uint64_t minSegmentId,
         NEWLY_CLEANABLE,
         CLEANABLE,
         FREEABLE_PENDING_DIGEST_AND_REFERENCES,
+        STREAM,
         HEAD
     };
 
@@ -802,6 +869,9 @@ SegmentManager::writeDigest(LogSegment* newHead, LogSegment* prevHead)
     foreach (LogSegment& s, segmentsByState[NEWLY_CLEANABLE])
         digest.addSegmentId(s.id);
 
+    foreach (LogSegment& s, segmentsByState[STREAM])
+        digest.addSegmentId(s.id);
+
     if (prevHead != NULL)
         digest.addSegmentId(prevHead->id);
 
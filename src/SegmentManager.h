@@ -111,6 +111,8 @@ class SegmentManager {
     LogSegment* allocHeadSegment(uint32_t flags = EMPTY);
     LogSegment* allocSideSegment(uint32_t flags = EMPTY,
                                  LogSegment* replacing = NULL);
+    LogSegment* allocStreamSegment();
+    void streamSegmentClosed(LogSegment* segment);
     void cleaningComplete(LogSegmentVector& clean, LogSegmentVector& survivors);
     void compactionComplete(LogSegment* oldSegment, LogSegment* newSegment);
     void injectSideSegments(LogSegmentVector& segments);
@@ -161,6 +163,13 @@ class SegmentManager {
      *        CLEANABLE --> FREEABLE_PENDING_DIGEST_AND_REFERENCES -->
      *        FREEABLE_PENDING_REFERENCES --> FREE*
      *
+     * For segments appended to by one of the Log's append streams (see
+     * allocStreamSegment()), the sequence is:
+     *
+     *     SIDELOG --> STREAM --> NEWLY_CLEANABLE --> CLEANABLE -->
+     *        FREEABLE_PENDING_DIGEST_AND_REFERENCES -->
+     *        FREEABLE_PENDING_REFERENCES --> FREE*
+     *
      * [*] There is no explicit FREE state. Rather, the segment is destroyed
      *     at this point.
      */
@@ -190,6 +199,12 @@ class SegmentManager {
         /// of the durable log and eligible for cleaning.
         CLEANABLE_PENDING_DIGEST,
 
+        /// The segment is open and being appended to by one of the Log's
+        /// append streams. Like the head, it is named in every LogDigest
+        /// written while it is in this state, but it never holds a digest
+        /// itself and so is never mistaken for the head during recovery.
+        STREAM,
+
         /// The segment was cleaned, but it cannot be freed until it is removed
         /// from the log and all outstanding references to its data in memory
         /// have completed.
@@ -193,6 +193,62 @@ TEST_F(SegmentManagerTest, allocSideSegment_mustNotFail) {
     thread.join();
 }
 
+TEST_F(SegmentManagerTest, allocStreamSegment) {
+    TestLog::Enable _(allocFilter);
+
+    segmentManager.allocHeadSegment();
+    TestLog::reset();
+    LogSegment* s = segmentManager.allocStreamSegment();
+    EXPECT_NE(static_cast<LogSegment*>(NULL), s);
+    EXPECT_EQ("alloc: purpose: 2", TestLog::get());
+    EXPECT_EQ(2UL, s->id);
+    EXPECT_EQ(SegmentManager::STREAM, segmentManager.states[s->slot]);
+    EXPECT_EQ(s->getAppendedLength(), s->syncedLength);
+
+    SegmentIterator it(*s);
+    EXPECT_FALSE(it.isDone());
+    EXPECT_EQ(LOG_ENTRY_TYPE_SEGHEADER, it.getType());
+    it.next();
+    EXPECT_TRUE(it.isDone());
+
+    // Open stream segments are named in every digest.
+    LogSegment* head = segmentManager.allocHeadSegment();
+    head = segmentManager.allocHeadSegment();
+    for (SegmentIterator it2(*head); !it2.isDone(); it2.next()) {
+        if (it2.getType() != LOG_ENTRY_TYPE_LOGDIGEST)
+            continue;
+
+        Buffer buffer;
+        it2.appendToBuffer(buffer);
+        LogDigest digest(buffer.getRange(0, buffer.getTotalLength()),
+                         buffer.getTotalLength());
+        EXPECT_EQ(4U, digest.size());
+        EXPECT_EQ(1UL, digest[0]);
+        EXPECT_EQ(2UL, digest[1]);
+        EXPECT_EQ(3UL, digest[2]);
+        EXPECT_EQ(4UL, digest[3]);
+    }
+
+    while (segmentManager.allocSideSegment() != NULL) {
+        // eat up all free segments
+    }
+    EXPECT_EQ(static_cast<LogSegment*>(NULL),
+              segmentManager.allocStreamSegment());
+}
+
+TEST_F(SegmentManagerTest, streamSegmentClosed) {
+    LogSegment* s = segmentManager.allocStreamSegment();
+    s->close();
+    s->replicatedSegment->close();
+    segmentManager.streamSegmentClosed(s);
+    EXPECT_EQ(SegmentManager::NEWLY_CLEANABLE, segmentManager.states[s->slot]);
+
+    LogSegmentVector cleanable;
+    segmentManager.cleanableSegments(cleanable);
+    ASSERT_EQ(1U, cleanable.size());
+    EXPECT_EQ(s, cleanable[0]);
+}
+
 TEST_F(SegmentManagerTest, cleaningComplete) {
     LogSegment* cleaned = segmentManager.allocHeadSegment();
     EXPECT_NE(static_cast<LogSegment*>(NULL), cleaned);
@@ -291,6 +347,7 @@ TEST_F(SegmentManagerTest, getActiveSegments) {
     LogSegment* cleanable = segmentManager.allocHeadSegment();
     LogSegment* freeablePendingJunk = segmentManager.allocHeadSegment();
     LogSegment* head = segmentManager.allocHeadSegment();
+    LogSegment* stream = segmentManager.allocStreamSegment();
 
     // "newlyCleanable" is in the correct state already, as is "head"
     segmentManager.changeState(*cleanable, SegmentManager::NEWLY_CLEANABLE);
@@ -298,20 +355,22 @@ TEST_F(SegmentManagerTest, getActiveSegments) {
         SegmentManager::FREEABLE_PENDING_DIGEST_AND_REFERENCES);
 
     segmentManager.getActiveSegments(1, active);
-    EXPECT_EQ(4U, active.size());
+    EXPECT_EQ(5U, active.size());
     EXPECT_EQ(newlyCleanable, active[0]);
     EXPECT_EQ(cleanable, active[1]);
     EXPECT_EQ(freeablePendingJunk, active[2]);
-    EXPECT_EQ(head, active[3]);
+    EXPECT_EQ(stream, active[3]);
+    EXPECT_EQ(head, active[4]);
 
     active.clear();
     segmentManager.getActiveSegments(3, active);
-    EXPECT_EQ(2U, active.size());
+    EXPECT_EQ(3U, active.size());
     EXPECT_EQ(freeablePendingJunk, active[0]);
-    EXPECT_EQ(head, active[1]);
+    EXPECT_EQ(stream, active[1]);
+    EXPECT_EQ(head, active[2]);
 
     active.clear();
-    segmentManager.getActiveSegments(head->id + 1, active);
+    segmentManager.getActiveSegments(stream->id + 1, active);
     EXPECT_EQ(0U, active.size());
 
     segmentManager.logIteratorDestroyed();
@@ -211,6 +211,7 @@ struct ServerConfig {
         Master(Testing) // NOLINT
             : logBytes(32 * 1024 * 1024)
             , hashTableBytes(1 * 1024 * 1024)
+            , hashTableMaxBytes(0)
             , disableLogCleaner(true)
             , disableInMemoryCleaning(true)
             , diskExpansionFactor(1.0)
@@ -219,6 +220,12 @@ struct ServerConfig {
             , masterServiceThreadCount(1)
             , numReplicas(0)
             , useMinCopysets(false)
+            , migrationBytesPerSecond(0)
+            , useKeyHashIndex(false)
+            , recoveryReplayThreadCount(1)
+            , maxInlineReadBytes(0)
+            , useOrderedKeyIndex(false)
+            , logAppendStreams(0)
         {}
 
         /**
@@ -229,6 +236,7 @@ struct ServerConfig {
         Master()
             : logBytes()
             , hashTableBytes()
+            , hashTableMaxBytes()
             , disableLogCleaner()
             , disableInMemoryCleaning()
             , diskExpansionFactor()
@@ -237,6 +245,12 @@ struct ServerConfig {
             , masterServiceThreadCount()
             , numReplicas()
             , useMinCopysets()
+            , migrationBytesPerSecond()
+            , useKeyHashIndex()
+            , recoveryReplayThreadCount()
+            , maxInlineReadBytes()
+            , useOrderedKeyIndex()
+            , logAppendStreams()
         {}
 
         /**
@@ -247,6 +261,7 @@ struct ServerConfig {
         {
             config.set_log_bytes(logBytes);
             config.set_hash_table_bytes(hashTableBytes);
+            config.set_hash_table_max_bytes(hashTableMaxBytes);
             config.set_disable_log_cleaner(disableLogCleaner);
             config.set_disable_in_memory_cleaning(disableInMemoryCleaning);
             config.set_backup_disk_expansion_factor(diskExpansionFactor);
@@ -255,6 +270,12 @@ struct ServerConfig {
             config.set_master_service_thread_count(masterServiceThreadCount);
             config.set_num_replicas(numReplicas);
             config.set_use_mincopysets(useMinCopysets);
+            config.set_migration_bytes_per_second(migrationBytesPerSecond);
+            config.set_use_key_hash_index(useKeyHashIndex);
+            config.set_recovery_replay_thread_count(recoveryReplayThreadCount);
+            config.set_max_inline_read_bytes(maxInlineReadBytes);
+            config.set_use_ordered_key_index(useOrderedKeyIndex);
+            config.set_log_append_streams(logAppendStreams);
         }
 
         /// Total number bytes to use for the in-memory Log.
@@ -263,6 +284,12 @@ struct ServerConfig {
         /// Total number of bytes to use for the HashTable.
         uint64_t hashTableBytes;
 
+        /// If nonzero, the HashTable is resized online as the number of
+        /// objects changes: it grows (up to this many bytes) when chains
+        /// get long and shrinks when it is mostly empty. If 0, the table
+        /// keeps the size given by #hashTableBytes.
+        uint64_t hashTableMaxBytes;
+
         /// If true, disable the log cleaner entirely.
         bool disableLogCleaner;
 
@@ -296,6 +323,38 @@ struct ServerConfig {
         /// Specifies whether to use MinCopysets replication or random
         /// replication.
         bool useMinCopysets;
+
+        /// Upper bound on the rate at which this master sends a tablet's
+        /// data to its new owner during migration, in bytes per second.
+        /// 0 means migration runs as fast as it can.
+        uint64_t migrationBytesPerSecond;
+
+        /// If true, the master keeps a KeyHashIndex of the keys in its hash
+        /// table so that migrating, enumerating, or dropping a tablet takes
+        /// time proportional to the size of the tablet rather than the size
+        /// of the master. Costs roughly 64 bytes of memory per object.
+        bool useKeyHashIndex;
+
+        /// Number of threads a recovery master uses to replay each recovery
+        /// segment (see ObjectManager::ReplayThreadPool). Higher
+        /// values speed up recovery at the expense of CPU cycles.
+        uint32_t recoveryReplayThreadCount;
+
+        /// Reads of objects no larger than this many bytes are served
+        /// directly in the dispatch thread when their hash table bucket is
+        /// not locked (see MasterService::dispatchInline). 0 disables this.
+        uint32_t maxInlineReadBytes;
+
+        /// If true, the master keeps an OrderedKeyIndex of the keys in its
+        /// hash table so that it can serve Scan rpcs, which return objects
+        /// in key order. Costs a copy of each key plus roughly 64 bytes of
+        /// memory per object.
+        bool useOrderedKeyIndex;
+
+        /// Number of append streams in the log (see Log::AppendStream).
+        /// Appending threads are spread across the streams so that they
+        /// don't all serialize on the head. 0 sends all appends to the head.
+        uint32_t logAppendStreams;
     } master;
 
     /**
@@ -317,6 +376,8 @@ struct ServerConfig {
             , strategy(1)
             , mockSpeed(100)
             , writeRateLimit(0)
+            , numRecoverySegmentBuilders(1)
+            , ioDepth(1)
         {}
 
         /**
@@ -334,6 +395,8 @@ struct ServerConfig {
             , strategy(1)
             , mockSpeed(0)
             , writeRateLimit(0)
+            , numRecoverySegmentBuilders(1)
+            , ioDepth(1)
         {}
 
         /**
@@ -351,6 +414,9 @@ struct ServerConfig {
             config.set_strategy(strategy);
             config.set_mock_speed(mockSpeed);
             config.set_write_rate_limit(writeRateLimit);
+            config.set_num_recovery_segment_builders(
+                numRecoverySegmentBuilders);
+            config.set_io_depth(ioDepth);
         }
 
         /**
@@ -409,6 +475,21 @@ struct ServerConfig {
          * If non-0, limit writes to backup to this many megabytes per second.
          */
         size_t writeRateLimit;
+
+        /**
+         * Number of threads to build recovery segments from primary replicas
+         * with during master recovery. If 1, they are built one at a time on
+         * the backup's task queue thread.
+         */
+        uint32_t numRecoverySegmentBuilders;
+
+        /**
+         * Maximum number of replica reads and writes the backup keeps
+         * outstanding to its storage device at once. 1 serializes all IO,
+         * which suits rotating disks; flash devices generally need a deeper
+         * queue to reach full bandwidth.
+         */
+        uint32_t ioDepth;
     } backup;
 
   public:
@@ -37,6 +37,8 @@ main(int argc, char *argv[])
     try {
         ServerConfig config = ServerConfig::forExecution();
         string masterTotalMemory, hashTableMemory;
+        uint64_t maxHashTableMegs;
+        uint64_t migrationMegsPerSecond;
 
         bool masterOnly;
         bool backupOnly;
@@ -81,6 +83,20 @@ main(int argc, char *argv[])
                 default_value("10%"),
              "Percentage or megabytes of master memory allocated to "
              "the hash table")
+            ("maxHashTableMemory",
+             ProgramOptions::value<uint64_t>(&maxHashTableMegs)->
+                default_value(0),
+             "If nonzero, resize the hash table online as objects are added "
+             "and removed, letting it grow to at most this many megabytes. "
+             "Growth beyond hashTableMemory is not subtracted from the log's "
+             "share of master memory. 0 (the default) keeps the hash table "
+             "at a fixed size.")
+            ("migrationBandwidth",
+             ProgramOptions::value<uint64_t>(&migrationMegsPerSecond)->
+                default_value(0),
+             "Maximum rate, in megabytes per second, at which tablet data is "
+             "sent to the new owner when migrating a tablet away from this "
+             "master. 0 (the default) means no limit.")
             ("masterOnly,M",
              ProgramOptions::bool_switch(&masterOnly),
              "The server should run the master service only (no backup)")
@@ -97,6 +113,12 @@ main(int argc, char *argv[])
              ProgramOptions::value<bool>(&config.master.useMinCopysets)->
                 default_value(false),
              "Whether to use MinCopysets or random replication")
+            ("useKeyHashIndex",
+             ProgramOptions::value<bool>(&config.master.useKeyHashIndex)->
+                default_value(false),
+             "Whether to keep a sorted index of key hashes so that migrating, "
+             "enumerating, or dropping a tablet takes time proportional to "
+             "the tablet's size. Costs about 64 bytes of memory per object.")
             ("segmentFrames",
              ProgramOptions::value<uint32_t>(&config.backup.numSegmentFrames)->
                 default_value(512),
@@ -152,13 +174,52 @@ main(int argc, char *argv[])
              "The number of cleaner threads controls the amount of parallelism "
              "in the cleaner. More threads will use more cores, but may be "
              "able to better keep up with high write rates.")
+            ("recoveryReplayThreads",
+             ProgramOptions::value<uint32_t>(
+                &config.master.recoveryReplayThreadCount)->default_value(1),
+             "The number of threads a recovery master uses to replay the "
+             "segments of a crashed master's log. More threads will use more "
+             "cores, but will recover data faster.")
+            ("maxInlineReadBytes",
+             ProgramOptions::value<uint32_t>(
+                &config.master.maxInlineReadBytes)->default_value(0),
+             "Reads of objects with values up to this many bytes are executed "
+             "directly in the dispatch thread instead of a worker thread, "
+             "unless the object is locked. 0 sends all reads to workers.")
+            ("useOrderedKeyIndex",
+             ProgramOptions::value<bool>(&config.master.useOrderedKeyIndex)->
+                default_value(false),
+             "Whether to keep a sorted index of keys so that clients can scan "
+             "a range of keys within a table. Costs a copy of each key plus "
+             "about 64 bytes of memory per object.")
+            ("logAppendStreams",
+             ProgramOptions::value<uint32_t>(
+                &config.master.logAppendStreams)->default_value(0),
+             "Number of segments, besides the log head, that worker threads "
+             "append to in parallel. More streams reduce contention between "
+             "writers, but each stream keeps its own partly-filled segment "
+             "open. 0 sends all appends to the head.")
             ("backupWriteRateLimit",
              ProgramOptions::value<size_t>(
                 &config.backup.writeRateLimit)->default_value(0),
              "If non-0, specifies the maximum number of megabytes per second "
              "of bandwidth this backup should use. Useful for artificially "
              "restricting bandwidth when measuring various parts of the "
-             "system.");
+             "system.")
+            ("recoverySegmentBuilders",
+             ProgramOptions::value<uint32_t>(
+                &config.backup.numRecoverySegmentBuilders)->default_value(1),
+             "The number of threads the backup uses to split primary replicas "
+             "into recovery segments during master recovery. More threads "
+             "use more cores, but recovery is often CPU-bound on the backups "
+             "while replicas are being split.")
+            ("backupIoDepth",
+             ProgramOptions::value<uint32_t>(
+                &config.backup.ioDepth)->default_value(1),
+             "The maximum number of replica reads and writes the backup keeps "
+             "outstanding to its storage device at once. Flash devices "
+             "usually need several outstanding requests to reach full "
+             "bandwidth; 1 serializes all IO.");
 
         OptionParser optionParser(serverOptions, argc, argv);
 
@@ -213,6 +274,9 @@ main(int argc, char *argv[])
         if (!backupOnly) {
             LOG(NOTICE, "Using %u backups", config.master.numReplicas);
             config.setLogAndHashTableSize(masterTotalMemory, hashTableMemory);
+            config.master.hashTableMaxBytes = maxHashTableMegs * 1024 * 1024;
+            config.master.migrationBytesPerSecond =
+                migrationMegsPerSecond * 1024 * 1024;
         }
 
         Server server(&context, &config);
@@ -154,6 +154,39 @@ Service::handleRpc(Rpc* rpc) {
     (&metrics->rpc.rpc0Ticks)[opcode] += Cycles::rdtsc() - start;
 }
 
+/**
+ * This method is invoked by ServiceManager in the dispatch thread to give
+ * the service a chance to process an incoming RPC without a worker thread
+ * (see dispatchInline). If the request can't be completed inline, nothing is
+ * recorded and the RPC must be handed to handleRpc in a worker as usual.
+ *
+ * \param rpc
+ *      An incoming RPC that is ready to be serviced.
+ * \return
+ *      True if the RPC has been serviced and its response prepared.
+ */
+bool
+Service::handleRpcInline(Rpc* rpc) {
+    const WireFormat::RequestCommon* header;
+    header = rpc->requestPayload->getStart<WireFormat::RequestCommon>();
+    if (header == NULL || header->opcode >= WireFormat::ILLEGAL_RPC_TYPE)
+        return false;
+
+    uint32_t opcode = header->opcode;
+    uint64_t start = Cycles::rdtsc();
+    try {
+        if (!dispatchInline(WireFormat::Opcode(opcode), rpc))
+            return false;
+    } catch (ClientException& e) {
+        // Let a worker redo the request and report the error.
+        rpc->replyPayload->truncateEnd(rpc->replyPayload->getTotalLength());
+        return false;
+    }
+    (&metrics->rpc.rpc0Count)[opcode]++;
+    (&metrics->rpc.rpc0Ticks)[opcode] += Cycles::rdtsc() - start;
+    return true;
+}
+
 /**
  * Fill in an RPC response buffer to indicate that the RPC failed with
  * a particular status.
@@ -214,9 +247,52 @@ Service::Rpc::sendReply()
 {
     // The "if" statement below is only needed to simplify tests; it should
     // never be needed in a real system.
+    replied = true;
     if (worker != NULL) {
         worker->sendReply();
     }
 }
 
+/**
+ * A worker thread can invoke this method during a long-running request to
+ * declare that it no longer holds any pointers into log memory that it
+ * obtained before the call. The RPC is then treated as if it had arrived
+ * now, so the log may reclaim segments cleaned before this point rather
+ * than waiting for the request to finish (see ServerRpcPool and
+ * SegmentManager::freeUnreferencedSegments).
+ */
+void
+Service::Rpc::renewEpoch()
+{
+    // As in sendReply, the "if" statement is only needed for tests.
+    if (worker != NULL) {
+        worker->renewEpoch();
+    }
+}
+
+/**
+ * A worker thread can invoke this method, after appending to the log and
+ * filling in the reply, to indicate that the reply must not be sent until
+ * the log has been synced, but that the worker itself need not wait for
+ * that. Once the service returns, the RPC is handed to \a queue, which will
+ * sync the log (together with any other deferred RPCs) and then send the
+ * reply, and the worker moves on to its next RPC.
+ *
+ * \param queue
+ *      Queue that will sync the log and then send the reply.
+ * \return
+ *      True means the reply has been deferred. False means the RPC isn't
+ *      running in a worker thread (e.g. in unit tests) or its reply has
+ *      already been sent, so the caller must sync the log itself.
+ */
+bool
+Service::Rpc::deferReply(LogSyncQueue* queue)
+{
+    // As in sendReply, workers are missing only in tests.
+    if (worker == NULL || replied)
+        return false;
+    syncQueue = queue;
+    return true;
+}
+
 } // namespace RAMCloud
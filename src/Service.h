@@ -25,6 +25,8 @@
 #include "WireFormat.h"
 
 namespace RAMCloud {
+class LogSyncQueue;
+
 // There are cross-dependencies between this header file and ServiceManager.h;
 // the declaration below is used instead of #including ServiceManager.h to
 // break the circularity.
@@ -58,9 +60,12 @@ class Service {
             : requestPayload(requestPayload)
             , replyPayload(replyPayload)
             , worker(worker)
-            , replied(false) {}
+            , replied(false)
+            , syncQueue(NULL) {}
 
         void sendReply();
+        void renewEpoch();
+        bool deferReply(LogSyncQueue* queue);
 
         /// The incoming request, which describes the desired operation.
         Buffer* requestPayload;
@@ -76,6 +81,11 @@ class Service {
         /// True means that sendReply has been invoked.
         bool replied;
 
+        /// If non-NULL, deferReply has been invoked: once the service
+        /// returns, the reply is handed to this queue rather than being sent
+        /// immediately.
+        LogSyncQueue* syncQueue;
+
         friend class ServiceManager;
         DISALLOW_COPY_AND_ASSIGN(Rpc);
     };
@@ -84,11 +94,31 @@ class Service {
     virtual ~Service() {}
     virtual void dispatch(WireFormat::Opcode opcode,
                           Rpc* rpc);
+
+    /**
+     * Services may override this method to execute some requests directly
+     * in the dispatch thread, which avoids handing them to a worker thread
+     * and back. It is invoked by ServiceManager for HIGH_PRIORITY requests
+     * before they are assigned a worker; implementations must not block.
+     *
+     * \param opcode
+     *      Opcode from the request's header.
+     * \param rpc
+     *      The request (its worker is NULL).
+     * \return
+     *      True if a complete response has been prepared in the RPC's reply
+     *      payload. False means the request must be dispatched to a worker
+     *      as usual; in that case the reply payload must be left empty.
+     */
+    virtual bool dispatchInline(WireFormat::Opcode opcode, Rpc* rpc) {
+        return false;
+    }
     static void prepareErrorResponse(Buffer* buffer, Status status);
 
     static const char* getString(Buffer* buffer, uint32_t offset,
                                  uint32_t length);
     void handleRpc(Rpc* rpc);
+    bool handleRpcInline(Rpc* rpc);
     void setServerId(ServerId serverId);
 
     /**
@@ -17,6 +17,8 @@
 #include "Cycles.h"
 #include "Fence.h"
 #include "Initialize.h"
+#include "LogSyncQueue.h"
+#include "RawMetrics.h"
 #include "ShortMacros.h"
 #include "ServerRpcPool.h"
 #include "ServiceManager.h"
@@ -166,34 +168,96 @@ ServiceManager::handleRpc(Transport::ServerRpc* rpc)
             rpc->requestPayload.getTotalLength());
 #endif
 
-    // See if we have exceeded the concurrency limit for the service.
-    if (serviceInfo->requestsRunning >= serviceInfo->maxThreads) {
-        serviceInfo->waitingRpcs.push(rpc);
-        return;
+    // The check below is needed to avoid out-of-range accesses to the
+    // per-opcode wait metrics.
+    uint32_t opcode = header->opcode;
+    if (opcode >= WireFormat::ILLEGAL_RPC_TYPE)
+        opcode = WireFormat::ILLEGAL_RPC_TYPE;
+    Priority priority = getPriority(WireFormat::Opcode(opcode));
+
+    // Short requests that the service can complete without blocking (such
+    // as reads of small objects) are executed right here, which saves
+    // handing them to a worker and back.
+    if (priority == HIGH_PRIORITY) {
+        Service::Rpc serviceRpc(NULL, &rpc->requestPayload,
+                                &rpc->replyPayload);
+        if (serviceInfo->service.handleRpcInline(&serviceRpc)) {
+            rpc->sendReply();
+            return;
+        }
     }
-    // Temporary code to test how much faster things would be without threads.
-#if 0
-    if ((header->opcode == RpcOpcode::READ) &&
-            (header->service == MASTER_SERVICE)) {
-        Service::Rpc serviceRpc(NULL, rpc->requestPayload, rpc->replyPayload);
-        services[MASTER_SERVICE]->service.handleRpc(&serviceRpc);
-        rpc->sendReply();
+
+    // See if we have exceeded the concurrency limit for the service (or
+    // for its low priority RPCs).
+    if (!serviceInfo->canStart(priority)) {
+        serviceInfo->waitingRpcs[priority].push(
+                ServiceInfo::WaitingRpc(rpc, opcode, Cycles::rdtsc()));
         return;
     }
-#endif
-
     serviceInfo->requestsRunning++;
+    if (priority == LOW_PRIORITY)
+        serviceInfo->lowPriorityRunning++;
 
     // Hand off the RPC to a worker thread.
     assert(!idleThreads.empty());
     Worker* worker = idleThreads.back();
     idleThreads.pop_back();
     worker->serviceInfo = serviceInfo;
+    worker->priority = priority;
     worker->handoff(rpc);
     worker->busyIndex = downCast<int>(busyThreads.size());
     busyThreads.push_back(worker);
 }
 
+/**
+ * Returns the priority class for RPCs with a given opcode. RPCs that
+ * clients wait on directly and that finish quickly are HIGH_PRIORITY; bulk
+ * RPCs that can occupy a worker for a long time (backup writes, recovery,
+ * migration, enumeration) are LOW_PRIORITY. So are the coordinator RPCs
+ * that modify cluster state: the coordinator runs them one at a time (see
+ * CoordinatorService::dispatch), so any beyond the first would only tie up
+ * workers needed by its read-only RPCs.
+ *
+ * \param opcode
+ *      Opcode from the header of an incoming RPC.
+ */
+ServiceManager::Priority
+ServiceManager::getPriority(WireFormat::Opcode opcode)
+{
+    switch (opcode) {
+        case WireFormat::PING:
+        case WireFormat::PROXY_PING:
+        case WireFormat::GET_TABLE_ID:
+        case WireFormat::READ:
+        case WireFormat::MULTI_OP:
+        case WireFormat::GET_TABLET_MAP:
+        case WireFormat::VERIFY_MEMBERSHIP:
+            return HIGH_PRIORITY;
+        case WireFormat::RECOVER:
+        case WireFormat::ENUMERATE:
+        case WireFormat::SCAN:
+        case WireFormat::FILL_WITH_TEST_DATA:
+        case WireFormat::BACKUP_GETRECOVERYDATA:
+        case WireFormat::BACKUP_STARTREADINGDATA:
+        case WireFormat::BACKUP_WRITE:
+        case WireFormat::BACKUP_STARTPARTITION:
+        case WireFormat::RECEIVE_MIGRATION_DATA:
+        case WireFormat::MIGRATE_TABLET:
+        case WireFormat::CREATE_TABLE:
+        case WireFormat::DROP_TABLE:
+        case WireFormat::SPLIT_TABLET:
+        case WireFormat::ENLIST_SERVER:
+        case WireFormat::HINT_SERVER_CRASHED:
+        case WireFormat::RECOVERY_MASTER_FINISHED:
+        case WireFormat::REASSIGN_TABLET_OWNERSHIP:
+        case WireFormat::SET_MASTER_RECOVERY_INFO:
+        case WireFormat::SET_RUNTIME_OPTION:
+            return LOW_PRIORITY;
+        default:
+            return NORMAL_PRIORITY;
+    }
+}
+
 /**
  * Returns true if there are currently no RPCs being serviced, false
  * if at least one RPC is currently being executed by a worker.  If true
@@ -242,10 +306,9 @@ ServiceManager::poll()
         if (state != Worker::POSTPROCESSING) {
             // If there is work waiting for this service, start the next RPC.
             ServiceInfo* info = worker->serviceInfo;
-            if (!info->waitingRpcs.empty()) {
-                worker->handoff(info->waitingRpcs.front());
-                info->waitingRpcs.pop();
-            } else {
+            if (worker->priority == LOW_PRIORITY)
+                info->lowPriorityRunning--;
+            if (!startWaitingRpc(info, worker)) {
                 // This worker is now idle; remove it from busyThreads (fill
                 // its slot with the worker in the last slot).
                 if (worker != busyThreads.back()) {
@@ -262,6 +325,47 @@ ServiceManager::poll()
     }
 }
 
+/**
+ * Hand the highest priority waiting RPC that is allowed to run to a worker
+ * that has just finished an RPC for the same service. The time the RPC
+ * spent waiting is added to its opcode's counter in RawMetrics.
+ *
+ * \param serviceInfo
+ *      Service whose waiting RPCs should be considered. The worker's
+ *      previous RPC must still be included in its requestsRunning count.
+ * \param worker
+ *      Worker to hand the RPC to; must be idle.
+ *
+ * \return
+ *      True if an RPC was started, false if there was nothing waiting that
+ *      could run.
+ */
+bool
+ServiceManager::startWaitingRpc(ServiceInfo* serviceInfo, Worker* worker)
+{
+    for (int i = HIGH_PRIORITY; i < NUM_PRIORITIES; i++) {
+        Priority priority = Priority(i);
+        std::queue<ServiceInfo::WaitingRpc>& queue =
+                serviceInfo->waitingRpcs[priority];
+        if (queue.empty())
+            continue;
+        if (priority == LOW_PRIORITY && serviceInfo->lowPriorityRunning >=
+                serviceInfo->maxLowPriorityThreads)
+            continue;
+
+        ServiceInfo::WaitingRpc& next = queue.front();
+        (&metrics->rpc.rpc0WaitTicks)[next.opcode] +=
+                Cycles::rdtsc() - next.arrivalTime;
+        if (priority == LOW_PRIORITY)
+            serviceInfo->lowPriorityRunning++;
+        worker->priority = priority;
+        worker->handoff(next.rpc);
+        queue.pop();
+        return true;
+    }
+    return false;
+}
+
 /**
  * Wait for an RPC request to appear in the testRpcs queue, but give up if
  * it takes too long.  This method is intended only for testing (it only
@@ -343,6 +447,14 @@ ServiceManager::workerMain(Worker* worker)
                     &worker->rpc->replyPayload);
             worker->serviceInfo->service.handleRpc(&rpc);
 
+            // If the service deferred its reply until the log is synced, the
+            // sync queue now owns the RPC; the dispatch thread must not send
+            // the reply, and this worker is free to take another request.
+            if (rpc.syncQueue != NULL) {
+                rpc.syncQueue->enqueue(worker->rpc);
+                worker->rpc = NULL;
+            }
+
             // Pass the RPC back to ServiceManager for completion.
             Fence::leave();
             worker->state.store(Worker::POLLING);
@@ -431,4 +543,17 @@ Worker::sendReply()
     state.store(POSTPROCESSING);
 }
 
+/**
+ * Retag the RPC this worker is processing with the current epoch. See
+ * Service::Rpc::renewEpoch for details. This method should only be invoked
+ * in the worker thread.
+ */
+void
+Worker::renewEpoch()
+{
+    Dispatch::Lock lock(context->dispatch);
+    if (rpc != NULL)
+        rpc->epoch = ServerRpcPool<>::getCurrentEpoch();
+}
+
 } // namespace RAMCloud
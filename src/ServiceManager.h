@@ -45,6 +45,22 @@ class ServiceManager : Dispatch::Poller {
     void setServerId(ServerId serverId);
     Transport::ServerRpc* waitForRpc(double timeoutSeconds);
 
+    /// Priority classes for incoming RPCs (see getPriority). When a service
+    /// has more RPCs than threads, waiting RPCs are started in priority
+    /// order, and LOW_PRIORITY RPCs are never allowed to occupy all of a
+    /// service's threads.
+    enum Priority {
+        /// Short, latency-sensitive RPCs such as READ and PING.
+        HIGH_PRIORITY = 0,
+        /// Everything not listed in one of the other classes.
+        NORMAL_PRIORITY,
+        /// Long-running bulk RPCs such as backup writes, recovery reads, and
+        /// migration.
+        LOW_PRIORITY,
+        NUM_PRIORITIES
+    };
+    static Priority getPriority(WireFormat::Opcode opcode);
+
   PROTECTED:
 
     /// How many microseconds worker threads should remain in their polling
@@ -68,25 +84,69 @@ class ServiceManager : Dispatch::Poller {
                                        /// means no service has been registered
                                        /// for this RpcService.
         int maxThreads;                /// Concurrency limit for this service.
+        int maxLowPriorityThreads;     /// Concurrency limit for LOW_PRIORITY
+                                       /// RPCs in this service; one less than
+                                       /// maxThreads (if maxThreads > 1) so
+                                       /// that long RPCs can't keep short ones
+                                       /// waiting.
         int requestsRunning;           /// The number of RPCs currently being
                                        /// executed by the service (each in a
                                        /// separate thread); must never be
                                        /// greater than maxThreads.
-        std::queue<Transport::ServerRpc*> waitingRpcs;
+        int lowPriorityRunning;        /// The number of LOW_PRIORITY RPCs
+                                       /// included in requestsRunning.
+
+        /// An RPC that could not start as soon as it arrived.
+        struct WaitingRpc {
+            WaitingRpc(Transport::ServerRpc* rpc, uint32_t opcode,
+                       uint64_t arrivalTime)
+                : rpc(rpc), opcode(opcode), arrivalTime(arrivalTime) {}
+            Transport::ServerRpc* rpc; /// The waiting request.
+            uint32_t opcode;           /// Its opcode (ILLEGAL_RPC_TYPE if out
+                                       /// of range); selects the RawMetrics
+                                       /// counter its wait time is added to.
+            uint64_t arrivalTime;      /// Cycles::rdtsc() when it arrived.
+        };
+        std::queue<WaitingRpc> waitingRpcs[NUM_PRIORITIES];
                                        /// Requests that cannot execute until
-                                       /// an existing request completes
-                                       /// (requestsRunning == maxThreads).
+                                       /// an existing request completes, one
+                                       /// queue per Priority.
+
         explicit ServiceInfo(Service& service)
             : service(service)
             , maxThreads(service.maxThreads())
+            , maxLowPriorityThreads(maxThreads > 1 ? maxThreads - 1 : 1)
             , requestsRunning(0)
+            , lowPriorityRunning(0)
             , waitingRpcs()
         {}
+
+        /**
+         * Return true if an RPC of the given priority may start executing
+         * now without exceeding this service's concurrency limits.
+         */
+        bool canStart(Priority priority) {
+            return requestsRunning < maxThreads &&
+                (priority != LOW_PRIORITY ||
+                 lowPriorityRunning < maxLowPriorityThreads);
+        }
+
+        /**
+         * Return the total number of RPCs waiting for this service.
+         */
+        size_t numWaitingRpcs() {
+            size_t count = 0;
+            for (int i = 0; i < NUM_PRIORITIES; i++)
+                count += waitingRpcs[i].size();
+            return count;
+        }
         friend class Worker;
         DISALLOW_COPY_AND_ASSIGN(ServiceInfo);
     };
     Tub<ServiceInfo> services[WireFormat::INVALID_SERVICE];
 
+    bool startWaitingRpc(ServiceInfo* serviceInfo, Worker* worker);
+
     // Worker threads that are currently executing RPCs (no particular order).
     std::vector<Worker*> busyThreads;
 
@@ -121,6 +181,7 @@ class ServiceManager : Dispatch::Poller {
 class Worker {
   public:
     void sendReply();
+    void renewEpoch();
 
   PRIVATE:
     Context* context;                  /// Shared RAMCloud information.
@@ -133,6 +194,7 @@ class Worker {
                                        /// the worker has been finished and a
                                        /// response sent (but the worker may
                                        /// still be in POSTPROCESSING state).
+    ServiceManager::Priority priority; /// Priority class of #rpc.
     int busyIndex;                     /// Location of this worker in
                                        /// #busyThreads, or -1 if this worker
                                        /// is idle.
@@ -175,7 +237,8 @@ class Worker {
 
     explicit Worker(Context* context)
         : context(context), serviceInfo(NULL), thread(), rpc(NULL),
-          busyIndex(-1), state(POLLING), exited(false) {}
+          priority(ServiceManager::NORMAL_PRIORITY), busyIndex(-1),
+          state(POLLING), exited(false) {}
     void exit();
     void handoff(Transport::ServerRpc* rpc);
 
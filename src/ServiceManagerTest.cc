@@ -18,6 +18,7 @@
 #include "MockService.h"
 #include "MockSyscall.h"
 #include "MockTransport.h"
+#include "RawMetrics.h"
 #include "ServiceManager.h"
 #include "Tub.h"
 
@@ -170,10 +171,49 @@ TEST_F(ServiceManagerTest, handleRpc_concurrencyLimitExceeded) {
     manager->handleRpc(rpc2);
     manager->handleRpc(rpc3);
     EXPECT_EQ(3U, manager->busyThreads.size());
-    EXPECT_EQ(0U, manager->services[1]->waitingRpcs.size());
+    EXPECT_EQ(0U, manager->services[1]->numWaitingRpcs());
     manager->handleRpc(rpc4);
     EXPECT_EQ(3U, manager->busyThreads.size());
-    EXPECT_EQ(1U, manager->services[1]->waitingRpcs.size());
+    EXPECT_EQ(1U, manager->services[1]->numWaitingRpcs());
+}
+
+TEST_F(ServiceManagerTest, handleRpc_inline) {
+    service.handleInline = true;
+    MockTransport::MockServerRpc* rpc1 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 1");
+    MockTransport::MockServerRpc* rpc2 = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 2");
+    // Only HIGH_PRIORITY requests are offered to the service inline.
+    manager->handleRpc(rpc1);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    manager->handleRpc(rpc2);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    EXPECT_EQ("serverReply: 99", transport.outputLog);
+    waitUntilDone(1);
+    manager->poll();
+}
+
+TEST_F(ServiceManagerTest, handleRpc_lowPriorityLimit) {
+    service.gate = -1;
+    MockTransport::MockServerRpc* rpc1 = new MockTransport::MockServerRpc(
+            &transport, "0x10020 1");
+    MockTransport::MockServerRpc* rpc2 = new MockTransport::MockServerRpc(
+            &transport, "0x10020 2");
+    MockTransport::MockServerRpc* rpc3 = new MockTransport::MockServerRpc(
+            &transport, "0x10020 3");
+    MockTransport::MockServerRpc* rpc4 = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 4");
+    manager->handleRpc(rpc1);
+    manager->handleRpc(rpc2);
+    manager->handleRpc(rpc3);
+    EXPECT_EQ(2U, manager->busyThreads.size());
+    EXPECT_EQ(1U, manager->services[1]->waitingRpcs[
+            ServiceManager::LOW_PRIORITY].size());
+
+    // The last thread is still available for a short RPC.
+    manager->handleRpc(rpc4);
+    EXPECT_EQ(3U, manager->busyThreads.size());
+    EXPECT_EQ(1U, manager->services[1]->numWaitingRpcs());
 }
 
 TEST_F(ServiceManagerTest, handleRpc_handoffToWorker) {
@@ -188,6 +228,21 @@ TEST_F(ServiceManagerTest, handleRpc_handoffToWorker) {
     EXPECT_EQ(3U, manager->idleThreads.size());
 }
 
+TEST_F(ServiceManagerTest, getPriority) {
+    EXPECT_EQ(ServiceManager::HIGH_PRIORITY,
+              ServiceManager::getPriority(WireFormat::READ));
+    EXPECT_EQ(ServiceManager::NORMAL_PRIORITY,
+              ServiceManager::getPriority(WireFormat::WRITE));
+    EXPECT_EQ(ServiceManager::LOW_PRIORITY,
+              ServiceManager::getPriority(WireFormat::BACKUP_WRITE));
+    EXPECT_EQ(ServiceManager::LOW_PRIORITY,
+              ServiceManager::getPriority(WireFormat::CREATE_TABLE));
+    EXPECT_EQ(ServiceManager::HIGH_PRIORITY,
+              ServiceManager::getPriority(WireFormat::GET_TABLET_MAP));
+    EXPECT_EQ(ServiceManager::NORMAL_PRIORITY,
+              ServiceManager::getPriority(WireFormat::ILLEGAL_RPC_TYPE));
+}
+
 TEST_F(ServiceManagerTest, idle) {
     EXPECT_TRUE(manager->idle());
     // Start one RPC.
@@ -220,7 +275,7 @@ TEST_F(ServiceManagerTest, poll_basics) {
     manager->handleRpc(rpc3);
     manager->handleRpc(rpc4);
     manager->handleRpc(rpc5);
-    EXPECT_EQ(2U, manager->services[1]->waitingRpcs.size());
+    EXPECT_EQ(2U, manager->services[1]->numWaitingRpcs());
 
     // Allow 2 of the requests to complete, and make sure that the remaining
     // 2 start service.
@@ -229,7 +284,7 @@ TEST_F(ServiceManagerTest, poll_basics) {
     service.gate = 2;
     waitUntilDone(2);
     manager->poll();
-    EXPECT_EQ(0U, manager->services[1]->waitingRpcs.size());
+    EXPECT_EQ(0U, manager->services[1]->numWaitingRpcs());
     EXPECT_EQ("serverReply: 0x10001 3 | serverReply: 0x10001 2",
             transport.outputLog);
 
@@ -251,6 +306,49 @@ TEST_F(ServiceManagerTest, poll_basics) {
             transport.outputLog);
 }
 
+TEST_F(ServiceManagerTest, poll_startHighestPriorityFirst) {
+    // Fill all 3 threads, then queue one RPC of each priority.
+    service.gate = -1;
+    MockTransport::MockServerRpc* rpc1 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 1");
+    MockTransport::MockServerRpc* rpc2 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 2");
+    MockTransport::MockServerRpc* rpc3 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 3");
+    MockTransport::MockServerRpc* rpc4 = new MockTransport::MockServerRpc(
+            &transport, "0x10020 4");
+    MockTransport::MockServerRpc* rpc5 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 5");
+    MockTransport::MockServerRpc* rpc6 = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 6");
+    manager->handleRpc(rpc1);
+    manager->handleRpc(rpc2);
+    manager->handleRpc(rpc3);
+    manager->handleRpc(rpc4);
+    manager->handleRpc(rpc5);
+    manager->handleRpc(rpc6);
+    EXPECT_EQ(3U, manager->services[1]->numWaitingRpcs());
+
+    // When a thread frees up, the READ gets it even though it arrived last.
+    metrics->rpc.readWaitTicks = 0;
+    service.gate = 1;
+    waitUntilDone(1);
+    manager->poll();
+    EXPECT_EQ(2U, manager->services[1]->numWaitingRpcs());
+    EXPECT_EQ(0U, manager->services[1]->waitingRpcs[
+            ServiceManager::HIGH_PRIORITY].size());
+    EXPECT_LT(0U, metrics->rpc.readWaitTicks);
+    bool found = false;
+    foreach (Worker* worker, manager->busyThreads) {
+        if (worker->rpc != NULL && TestUtil::toString(
+                &worker->rpc->requestPayload) == "0x1000d 6") {
+            found = true;
+            EXPECT_EQ(ServiceManager::HIGH_PRIORITY, worker->priority);
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
 TEST_F(ServiceManagerTest, poll_postprocessing) {
     // This test makes sure that the POSTPROCESSING state is handled
     // correctly (along with the subsequent POLLING state).
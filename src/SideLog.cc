@@ -115,9 +115,10 @@ SideLog::commit()
 
     // Force the head to roll over so a new digest goes out. The caller also
     // acquires the appendLock, so drop it first. This is safe. We don't care
-    // about any races. We only want the log head to change.
+    // about any races. We only want the log head to change, so the log's
+    // append streams can keep their segments (see Log::rollHeadOver).
     lock.destroy();
-    log->rollHeadOver();
+    log->rollHead();
 }
 
 /******************************************************************************
@@ -381,6 +381,9 @@ SingleFileStorage::Frame::close()
 /**
  * Perform outstanding IO for this frame. Frames prioritize writes over loads
  * since loads require writes to finish first.
+ * Called by one of the storage's IO threads; several frames may be
+ * performing IO at once, but at most one IO operation is outstanding for
+ * any single frame.
  */
 void
 SingleFileStorage::Frame::performTask()
@@ -388,6 +391,11 @@ SingleFileStorage::Frame::performTask()
     Lock lock(storage->mutex);
     if (epoch != scheduledInEpoch)
         return;
+    // Another IO thread is already working on this frame (it was rescheduled
+    // while the lock was dropped for IO). That thread reschedules the frame
+    // when it finishes if more work remains; see performWrite().
+    if (performingIo)
+        return;
     performingIo = true;
     if (!isSynced()) {
         performWrite(lock);
@@ -747,16 +755,22 @@ SingleFileStorage::BufferDeleter::operator()(void* buffer)
  * \param openFlags
  *      Extra flags for use while opening filePath (default to 0, O_DIRECT may
  *      be used to disable the OS buffer cache.
+ * \param ioDepth
+ *      Maximum number of frame reads and writes to keep outstanding to
+ *      storage at once. Values greater than 1 allow devices with internal
+ *      parallelism to service several frames concurrently.
  */
 SingleFileStorage::SingleFileStorage(size_t segmentSize,
                                      size_t frameCount,
                                      size_t writeRateLimit,
                                      size_t maxNonVolatileBuffers,
                                      const char* filePath,
-                                     int openFlags)
+                                     int openFlags,
+                                     uint32_t ioDepth)
     : BackupStorage(segmentSize, Type::DISK, writeRateLimit)
     , mutex()
     , ioQueue()
+    , ioDepth(std::max(ioDepth, 1u))
     , superblock()
     , lastSuperblockFrame(1)
     , frames()
@@ -833,7 +847,7 @@ SingleFileStorage::SingleFileStorage(size_t segmentSize,
     for (size_t frame = 0; frame < frameCount; ++frame)
         frames.emplace_back(this, frame);
 
-    ioQueue.start();
+    ioQueue.start(this->ioDepth);
 }
 
 /// Close the file.
@@ -181,7 +181,11 @@ class SingleFileStorage : public BackupStorage {
          */
         bool loadRequested;
 
-        /// True if a read or write is ongoing (which is done without a lock).
+        /**
+         * True if a read or write is ongoing (which is done without a lock).
+         * Also keeps a second IO thread from performing IO for this frame
+         * concurrently; see performTask().
+         */
         bool performingIo;
 
         /**
@@ -215,7 +219,8 @@ class SingleFileStorage : public BackupStorage {
                       size_t writeRateLimit,
                       size_t maxNonVolatileBuffers,
                       const char* filePath,
-                      int openFlags = 0);
+                      int openFlags = 0,
+                      uint32_t ioDepth = 1);
     ~SingleFileStorage();
 
     FrameRef open(bool sync);
@@ -260,11 +265,21 @@ class SingleFileStorage : public BackupStorage {
 
     /**
      * Orders competing read/write operations for frames and calls back
-     * to frames when their turn for IO arrives. Provides its own
-     * thread which is dedicated to and serializes IO.
+     * to frames when their turn for IO arrives. Provides #ioDepth threads
+     * which are dedicated to IO; each has at most one read or write
+     * outstanding to storage at a time.
      */
     PriorityTaskQueue ioQueue;
 
+    /**
+     * Maximum number of frame reads and writes that may be outstanding to
+     * storage at once (that is, the number of threads driving #ioQueue).
+     * Devices with internal parallelism (for example, flash) only reach
+     * their full bandwidth when several requests are queued; 1 serializes
+     * all IO as rotating disks prefer.
+     */
+    const uint32_t ioDepth;
+
     /// Holds the most recent image of the superblock.
     Superblock superblock;
 
@@ -327,6 +327,22 @@ TEST_F(SingleFileStorageTest, Frame_performWrite) {
     EXPECT_TRUE(frame->buffer);
 }
 
+TEST_F(SingleFileStorageTest, Frame_performTaskIoAlreadyInProgress) {
+    storage->ioQueue.halt();
+    BackupStorage::FrameRef frameRef = storage->open(false);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 5, 0, test, testLength + 1);
+    frame->deschedule();
+    TestLog::Enable _;
+    frame->performingIo = true;
+    frame->performTask();
+    EXPECT_EQ("", TestLog::get());
+    EXPECT_EQ(0lu, frame->committedLength);
+    frame->performingIo = false;
+    frame->performTask();
+    EXPECT_EQ(5lu, frame->committedLength);
+}
+
 TEST_F(SingleFileStorageTest, Frame_performWriteReleasesBufferAtTheRightTimes) {
     storage->ioQueue.halt();
     BackupStorage::FrameRef frameRef = storage->open(false);
@@ -455,6 +471,15 @@ TEST_F(SingleFileStorageTest, constructor) {
               uint32_t(s.st_size));
 }
 
+TEST_F(SingleFileStorageTest, constructorIoDepth) {
+    EXPECT_EQ(1u, storage->ioDepth);
+    EXPECT_EQ(1lu, storage->ioQueue.threads.size());
+    storage.construct(segmentSize, segmentFrames, 0, segmentFrames,
+                      static_cast<const char*>(NULL), O_DIRECT | O_SYNC, 4);
+    EXPECT_EQ(4u, storage->ioDepth);
+    EXPECT_EQ(4lu, storage->ioQueue.threads.size());
+}
+
 TEST_F(SingleFileStorageTest, openFails) {
     TestLog::Enable _;
     EXPECT_THROW(SingleFileStorage(segmentSize,
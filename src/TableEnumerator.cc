@@ -14,6 +14,7 @@
  */
 
 #include "TableEnumerator.h"
+#include "Object.h"
 #include "ShortMacros.h"
 
 namespace RAMCloud {
@@ -26,14 +27,21 @@ namespace RAMCloud {
  *      enumeration.
  * \param tableId
  *      Identifier for the table to enumerate.
+ * \param maxResponses
+ *      Largest number of enumerate responses to have in flight or buffered
+ *      at once, across all of the table's tablets. Each response may be up
+ *      to Transport::MAX_RPC_LEN bytes. 1 enumerates tablets one at a time
+ *      with a single rpc outstanding.
  */
-TableEnumerator::TableEnumerator(RamCloud& ramcloud, uint64_t tableId)
+TableEnumerator::TableEnumerator(RamCloud& ramcloud, uint64_t tableId,
+                                 uint32_t maxResponses)
     : ramcloud(ramcloud)
     , tableId(tableId)
-    , tabletStartHash(0)
+    , maxResponses(std::max(maxResponses, 1U))
+    , responsesOutstanding(0)
     , done(false)
-    , state()
-    , objects()
+    , streams()
+    , objects(NULL)
     , nextOffset(0)
 {
 }
@@ -65,7 +73,10 @@ TableEnumerator::hasNext()
  *      After a successful return, this will point to contiguous
  *      memory containing an instance of Object immediately followed
  *      by its key and data payloads. NULL is returned to indicate
- *      that the enumeration is complete.
+ *      that the enumeration is complete. The memory is part of the rpc
+ *      response the object arrived in (it is only copied if the object
+ *      spans pieces of the response), and remains valid until all the
+ *      objects in that response have been returned.
  */
 void
 TableEnumerator::next(uint32_t* size, const void** object)
@@ -76,10 +87,10 @@ TableEnumerator::next(uint32_t* size, const void** object)
     requestMoreObjects();
     if (done) return;
 
-    uint32_t objectSize = *objects.getOffset<uint32_t>(nextOffset);
+    uint32_t objectSize = *objects->getOffset<uint32_t>(nextOffset);
     nextOffset += downCast<uint32_t>(sizeof(uint32_t));
 
-    const void* blob = objects.getRange(nextOffset, objectSize);
+    const void* blob = objects->getRange(nextOffset, objectSize);
     nextOffset += objectSize;
 
     // Store result in out params.
@@ -87,6 +98,104 @@ TableEnumerator::next(uint32_t* size, const void** object)
     *object = blob;
 }
 
+/**
+ * Construct a Stream covering a range of key hashes.
+ *
+ * \param firstHash
+ *      Smallest key hash in the range.
+ * \param lastHash
+ *      Largest key hash in the range.
+ */
+TableEnumerator::Stream::Stream(uint64_t firstHash, uint64_t lastHash)
+    : nextHash(firstHash)
+    , lastHash(lastHash)
+    , finished(false)
+    , state()
+    , rpc()
+    , buffers()
+    , rpcBuffer(-1)
+    , readyBuffer(-1)
+{
+}
+
+/**
+ * Divide the table's key hash space into one Stream per tablet, according
+ * to the client's tablet map.
+ *
+ * \throw TableDoesntExistException
+ *      The table does not exist.
+ */
+void
+TableEnumerator::createStreams()
+{
+    uint64_t firstHash = 0;
+    while (true) {
+        uint64_t lastHash = ramcloud.objectFinder.lookupTablet(
+                tableId, firstHash).end_key_hash();
+        streams.push_back(std::unique_ptr<Stream>(
+                new Stream(firstHash, lastHash)));
+        if (lastHash == ~0UL)
+            break;
+        firstHash = lastHash + 1;
+    }
+}
+
+/**
+ * Collect the responses of any enumerate rpcs that have completed, and
+ * start new rpcs for streams that have a free buffer, as long as
+ * #maxResponses allows. Streams earlier in the key hash space get the
+ * first chance to start rpcs.
+ */
+void
+TableEnumerator::poll()
+{
+    foreach (std::unique_ptr<Stream>& stream, streams) {
+        Stream* s = stream.get();
+        if (s->rpc && s->rpc->isReady()) {
+            uint64_t nextHash = s->rpc->wait(s->state);
+            s->rpc.destroy();
+            Buffer* response = &s->buffers[s->rpcBuffer];
+            s->rpcBuffer = -1;
+
+            // An empty response means the server has returned everything
+            // in the tablet starting at s->nextHash; nextHash is then the
+            // start of the following tablet, or 0 at the end of the table.
+            // Tablets may have been split since the streams were created,
+            // so that one may still be part of this stream.
+            if (response->getTotalLength() == 0) {
+                if (nextHash == 0 || nextHash > s->lastHash)
+                    s->finished = true;
+                else
+                    s->nextHash = nextHash;
+            }
+
+            // If tablets have been merged, the server may return objects
+            // from the next stream's range as well.
+            if (s->lastHash != ~0UL)
+                discardObjectsAfter(response, s->lastHash);
+
+            if (response->getTotalLength() > 0) {
+                s->readyBuffer = downCast<int>(response - s->buffers);
+            } else {
+                responsesOutstanding--;
+            }
+        }
+
+        if (s->rpc || s->finished || responsesOutstanding >= maxResponses)
+            continue;
+        for (int i = 0; i < 2; i++) {
+            if (i == s->readyBuffer || &s->buffers[i] == objects)
+                continue;
+            s->buffers[i].reset();
+            s->rpc.construct(&ramcloud, tableId, s->nextHash, s->state,
+                             s->buffers[i]);
+            s->rpcBuffer = i;
+            responsesOutstanding++;
+            break;
+        }
+    }
+}
+
 /**
  * Used internally by #hasNext() and #next() to retrieve objects. Will
  * set the #done field if enumeration is complete. Otherwise the
@@ -95,25 +204,91 @@ TableEnumerator::next(uint32_t* size, const void** object)
 void
 TableEnumerator::requestMoreObjects()
 {
-    if (done || nextOffset < objects.getTotalLength()) return;
+    if (done || (objects != NULL && nextOffset < objects->getTotalLength()))
+        return;
 
-    nextOffset = 0;
+    // Release the response we've finished with so it can be refilled.
+    if (objects != NULL) {
+        objects = NULL;
+        responsesOutstanding--;
+    }
+    if (streams.empty())
+        createStreams();
+
+    // As in MultiOp::wait, we must run the dispatcher ourselves if we are
+    // in the dispatch thread.
+    Dispatch* dispatch = ramcloud.clientContext->dispatch;
+    bool isDispatchThread = dispatch->isDispatchThread();
     while (true) {
-        tabletStartHash = ramcloud.enumerateTable(tableId, tabletStartHash,
-                state, objects);
-        if (objects.getTotalLength() > 0) {
-            return;
+        poll();
+
+        bool anyActive = false;
+        foreach (std::unique_ptr<Stream>& stream, streams) {
+            Stream* s = stream.get();
+            if (s->readyBuffer >= 0) {
+                objects = &s->buffers[s->readyBuffer];
+                nextOffset = 0;
+                s->readyBuffer = -1;
+
+                // Get the stream's next rpc going while the caller reads
+                // this response.
+                poll();
+                return;
+            }
+            if (s->rpc || !s->finished)
+                anyActive = true;
         }
-        // End of table?
-        if (objects.getTotalLength() == 0 && tabletStartHash == 0) {
+        if (!anyActive) {
             done = true;
             return;
         }
+        if (isDispatchThread)
+            dispatch->poll();
+    }
+}
+
+/**
+ * Remove from an enumerate response any objects whose key hashes are past
+ * the end of the stream that requested it.
+ *
+ * \param objects
+ *      An enumerate response: each object is preceded by its uint32_t
+ *      length.
+ * \param lastHash
+ *      Objects with key hashes larger than this are removed.
+ */
+void
+TableEnumerator::discardObjectsAfter(Buffer* objects, uint64_t lastHash)
+{
+    // Hashing keys is much cheaper than copying objects, and merges are
+    // rare, so first check whether anything needs to be removed at all.
+    vector<std::pair<uint32_t, uint32_t>> keep;
+    bool discarded = false;
+    uint32_t totalLength = objects->getTotalLength();
+    for (uint32_t offset = 0; offset < totalLength; ) {
+        uint32_t objectLength = *objects->getOffset<uint32_t>(offset);
+        uint32_t length = sizeof32(uint32_t) + objectLength;
+        Object object(objects->getRange(offset + sizeof32(uint32_t),
+                                        objectLength),
+                      objectLength);
+        Key key(tableId, object.getKey(), object.getKeyLength());
+        if (key.getHash() > lastHash)
+            discarded = true;
+        else
+            keep.push_back(std::make_pair(offset, length));
+        offset += length;
+    }
+    if (!discarded)
+        return;
 
-        // If we get here it means that the last server we contacted
-        // has no more objects for us, but there are probably some other
-        // objects in a different server. Try again with a new server.
+    Buffer kept;
+    for (size_t i = 0; i < keep.size(); i++) {
+        objects->copy(keep[i].first, keep[i].second,
+                      new(&kept, APPEND) char[keep[i].second]);
     }
+    objects->reset();
+    uint32_t keptLength = kept.getTotalLength();
+    kept.copy(0, keptLength, new(objects, APPEND) char[keptLength]);
 }
 
 } // namespace RAMCloud
@@ -16,6 +16,8 @@
 #ifndef RAMCLOUD_TABLEENUMERATOR_H
 #define RAMCLOUD_TABLEENUMERATOR_H
 
+#include <memory>
+
 #include "RamCloud.h"
 
 namespace RAMCloud {
@@ -24,14 +26,65 @@ namespace RAMCloud {
  * This class provides the client-side interface for table enumeration;
  * each instance of this class can be used to enumerate the objects in
  * a single table.
+ *
+ * The table's key hash space is divided into streams, one for each tablet
+ * the table had when enumeration started, and enumerate rpcs for different
+ * streams are kept in flight in parallel. Each stream has two response
+ * buffers, so that its next rpc can be in flight while objects from its
+ * previous response are being returned by next(). Objects come from
+ * whichever stream has a response ready, preferring streams earlier in
+ * the key hash space.
  */
 class TableEnumerator {
   public:
-    TableEnumerator(RamCloud& ramCloud, uint64_t tableId);
+    TableEnumerator(RamCloud& ramCloud, uint64_t tableId,
+                    uint32_t maxResponses = 8);
     bool hasNext();
     void next(uint32_t* size, const void** object);
-  private:
+  PRIVATE:
+    /**
+     * Enumeration state for one contiguous range of key hashes, which
+     * initially is exactly one tablet. If the table's tablets are split or
+     * merged during enumeration, a stream may take several rpcs to cover
+     * its range, or receive objects past its end that must be discarded.
+     */
+    struct Stream {
+        Stream(uint64_t firstHash, uint64_t lastHash);
+
+        /// Key hash to pass as tabletFirstHash in the next rpc.
+        uint64_t nextHash;
+
+        /// Largest key hash belonging to this stream.
+        uint64_t lastHash;
+
+        /// Set once the server has returned everything in the stream; no
+        /// more rpcs will be sent, though #readyBuffer may still be valid.
+        bool finished;
+
+        /// Opaque enumeration state returned by the server for this stream.
+        Buffer state;
+
+        /// The rpc outstanding for this stream, if any.
+        Tub<EnumerateTableRpc> rpc;
+
+        /// Response buffers; the rpc fills one while the other's objects
+        /// are returned by next().
+        Buffer buffers[2];
+
+        /// Index in #buffers of the one #rpc is filling; -1 if none.
+        int rpcBuffer;
+
+        /// Index in #buffers of a response holding objects that haven't
+        /// been handed to the caller yet; -1 if none.
+        int readyBuffer;
+
+        DISALLOW_COPY_AND_ASSIGN(Stream);
+    };
+
+    void createStreams();
+    void poll();
     void requestMoreObjects();
+    void discardObjectsAfter(Buffer* objects, uint64_t lastHash);
 
     /// The RamCloud master object.
     RamCloud& ramcloud;
@@ -39,19 +92,24 @@ class TableEnumerator {
     /// The table containing the tablet being enumerated.
     uint64_t tableId;
 
-    /// The start hash of the tablet being enumerated.
-    uint64_t tabletStartHash;
+    /// Largest number of responses that may be outstanding or held in
+    /// stream buffers waiting to be returned, across all streams. Bounds
+    /// the memory used by the enumeration as well as its parallelism.
+    const uint32_t maxResponses;
+
+    /// Number of responses currently counted against #maxResponses.
+    uint32_t responsesOutstanding;
 
     /// Set to true when the entire enumeration has completed.
     bool done;
 
-    /// Opaque storage keeps track of the state of enumeration;
-    /// contents are managed by the server.
-    Buffer state;
+    /// One entry per range of the table's key hash space, in increasing
+    /// order of key hash. Empty until the first call to hasNext() or next().
+    std::vector<std::unique_ptr<Stream>> streams;
 
-    /// A buffer to hold the payload of object last received from
-    /// the server, and currently being read out by the client.
-    Buffer objects;
+    /// The response being read out by the client (one of the buffers of
+    /// a stream); NULL if none.
+    Buffer* objects;
 
     /// The next offset to read within the objects buffer.
     uint32_t nextOffset;
@@ -129,4 +129,99 @@ TEST_F(TableEnumeratorTest, basics) {
     EXPECT_FALSE(iter.hasNext());
 }
 
+TEST_F(TableEnumeratorTest, parallelRpcs) {
+    for (int i = 0; i < 5; i++)
+        ramcloud.write(tableId1, format("%d", i).c_str(), 1, "abcdef", 6);
+
+    // Both tablets' responses arrive before the first is read out.
+    TableEnumerator iter(ramcloud, tableId1);
+    EXPECT_TRUE(iter.hasNext());
+    ASSERT_EQ(2U, iter.streams.size());
+    EXPECT_EQ(~0UL / 2, iter.streams[0]->lastHash);
+    EXPECT_TRUE(iter.streams[0]->finished);
+    EXPECT_LE(0, iter.streams[1]->readyBuffer);
+
+    uint32_t count = 0;
+    uint32_t size;
+    const void* buffer;
+    while (iter.hasNext()) {
+        iter.next(&size, &buffer);
+        count++;
+    }
+    EXPECT_EQ(5U, count);
+    EXPECT_EQ(0U, iter.responsesOutstanding);
+}
+
+TEST_F(TableEnumeratorTest, oneResponseAtATime) {
+    for (int i = 0; i < 5; i++)
+        ramcloud.write(tableId1, format("%d", i).c_str(), 1, "abcdef", 6);
+
+    TableEnumerator iter(ramcloud, tableId1, 1);
+    EXPECT_TRUE(iter.hasNext());
+    EXPECT_FALSE(iter.streams[1]->rpc);
+    EXPECT_EQ(-1, iter.streams[1]->readyBuffer);
+    EXPECT_EQ(1U, iter.responsesOutstanding);
+
+    uint32_t count = 0;
+    uint32_t size;
+    const void* buffer;
+    while (iter.hasNext()) {
+        iter.next(&size, &buffer);
+        count++;
+    }
+    EXPECT_EQ(5U, count);
+}
+
+TEST_F(TableEnumeratorTest, mergedTablets) {
+    for (int i = 0; i < 5; i++)
+        ramcloud.write(tableId1, format("%d", i).c_str(), 1, "abcdef", 6);
+
+    // Pretend the first tablet had been split in two when the enumeration
+    // started and merged since: the first stream will be sent objects that
+    // belong to the second, which must not be returned twice.
+    Key key0(tableId1, "0", 1);
+    Key key4(tableId1, "4", 1);
+    uint64_t splitHash = std::min(key0.getHash(), key4.getHash());
+    TableEnumerator iter(ramcloud, tableId1);
+    iter.streams.push_back(std::unique_ptr<TableEnumerator::Stream>(
+            new TableEnumerator::Stream(0, splitHash)));
+    iter.streams.push_back(std::unique_ptr<TableEnumerator::Stream>(
+            new TableEnumerator::Stream(splitHash + 1, ~0UL)));
+
+    std::set<string> keys;
+    uint32_t size;
+    const void* buffer;
+    while (iter.hasNext()) {
+        iter.next(&size, &buffer);
+        Object object(buffer, size);
+        EXPECT_TRUE(keys.insert(string(static_cast<const char*>(
+                object.getKey()), object.getKeyLength())).second);
+    }
+    EXPECT_EQ(5U, keys.size());
+}
+
+TEST_F(TableEnumeratorTest, discardObjectsAfter) {
+    ramcloud.write(tableId1, "0", 1, "abcdef", 6);
+    ramcloud.write(tableId1, "4", 1, "ghijkl", 6);
+    Key key0(tableId1, "0", 1);
+    Key key4(tableId1, "4", 1);
+
+    // Both objects are in the first tablet (see basics).
+    Buffer state, objects;
+    ramcloud.enumerateTable(tableId1, 0, state, objects);
+    EXPECT_EQ(74U, objects.getTotalLength());
+
+    TableEnumerator iter(ramcloud, tableId1);
+    iter.discardObjectsAfter(&objects, std::max(key0.getHash(),
+                                                key4.getHash()));
+    EXPECT_EQ(74U, objects.getTotalLength());
+
+    iter.discardObjectsAfter(&objects, std::min(key0.getHash(),
+                                                key4.getHash()));
+    ASSERT_EQ(37U, objects.getTotalLength());
+    Object object(objects.getRange(4, 33), 33);
+    EXPECT_EQ(0, memcmp(key0.getHash() < key4.getHash() ? "0" : "4",
+                        object.getKey(), 1));
+}
+
 }  // namespace RAMCloud
@@ -33,6 +33,16 @@ TableManager::TableManager(Context* context)
     , nextTableMasterIdx(0)
     , tables()
     , tablesLogIds()
+    , generation(generateRandom() | 1)
+    , version(1)
+    , changeLog()
+    , oldestDeltaVersion(1)
+    , updateCache()
+    , updateCacheVersion(0)
+    , snapshotLock("TableManager::snapshotLock")
+    , publishedVersion(0)
+    , publishedOldestDeltaVersion(0)
+    , publishedTables()
 {
     context->tableManager = this;
 }
@@ -64,7 +74,7 @@ TableManager::~TableManager(){}
 uint64_t
 TableManager::createTable(const char* name, uint32_t serverSpan)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
 
     return CreateTable(*this, lock, name, uint64_t(), serverSpan).execute();
 }
@@ -108,7 +118,7 @@ TableManager::debugString() const
 void
 TableManager::dropTable(const char* name)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
 
     return DropTable(*this, lock, name).execute();
 }
@@ -128,7 +138,24 @@ TableManager::dropTable(const char* name)
 uint64_t
 TableManager::getTableId(const char* name)
 {
-    Lock lock(mutex);
+    Lock lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        // Some operation is modifying the tables (and may be waiting on
+        // LogCabin or a master); rather than wait for it, answer from the
+        // tables as they were before it started.
+        std::shared_ptr<const Tables> snapshot;
+        {
+            std::lock_guard<SpinLock> _(snapshotLock);
+            snapshot = publishedTables;
+        }
+        if (snapshot) {
+            Tables::const_iterator it(snapshot->find(name));
+            if (it == snapshot->end())
+                throw NoSuchTable(HERE);
+            return it->second;
+        }
+        lock.lock();
+    }
     Tables::iterator it(tables.find(name));
     if (it == tables.end()) {
         throw NoSuchTable(HERE);
@@ -151,7 +178,7 @@ TableManager::getTableId(const char* name)
 vector<Tablet>
 TableManager::markAllTabletsRecovering(ServerId serverId)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     vector<Tablet> results;
     foreach (Tablet& tablet, map) {
         if (tablet.serverId == serverId) {
@@ -159,6 +186,8 @@ TableManager::markAllTabletsRecovering(ServerId serverId)
             results.push_back(tablet);
         }
     }
+    foreach (const Tablet& tablet, results)
+        tabletsChanged(lock, tablet.tableId);
     return results;
 }
 
@@ -189,7 +218,7 @@ TableManager::reassignTabletOwnership(
         uint64_t startKeyHash, uint64_t endKeyHash,
         uint64_t ctimeSegmentId, uint64_t ctimeSegmentOffset)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     // Could throw TableManager::NoSuchTablet exception
     Tablet tablet = getTablet(lock, tableId, startKeyHash, endKeyHash);
     LOG(NOTICE, "Reassigning tablet [0x%lx,0x%lx] in tableId %lu "
@@ -231,18 +260,116 @@ TableManager::serialize(AbstractServerList& serverList,
                         ProtoBuf::Tablets& tablets) const
 {
     Lock lock(mutex);
-    foreach (const auto& tablet, map) {
-        ProtoBuf::Tablets::Tablet& entry(*tablets.add_tablet());
-        tablet.serialize(entry);
-        try {
-            string locator = serverList.getLocator(tablet.serverId);
-            entry.set_service_locator(locator);
-        } catch (const Exception& e) {
-            LOG(NOTICE, "Server id (%s) in tablet map no longer in server "
-                "list; sending empty locator for entry",
-                tablet.serverId.toString().c_str());
+    serializeTablets(lock, serverList, NULL, tablets);
+}
+
+/**
+ * Return the tablets a client needs to bring its copy of the tablet map up
+ * to date, serialized and ready to be sent across the wire. Updates are
+ * cached until the tablet map next changes, so that when many clients ask
+ * for the same thing (which is typical: a change to the map sends all the
+ * clients using the affected table back to the coordinator) the map is
+ * only walked and serialized once.
+ *
+ * \param serverList
+ *      The single instance of the AbstractServerList. Used to fill in
+ *      the service_locator field of the returned tablets.
+ * \param generation
+ *      The generation of the client's copy of the tablet map, as returned
+ *      with the update it was built from, or 0 if it has none.
+ * \param sinceVersion
+ *      The version of the client's copy of the tablet map, or 0 if it has
+ *      none.
+ * \param tableId
+ *      If WireFormat::GetTabletMap::ALL_TABLES, the returned update brings
+ *      the whole map up to date: it either holds the entire map or just the
+ *      tablets of the tables that changed after \a sinceVersion. Otherwise
+ *      the update holds the tablets of just this table, regardless of
+ *      \a generation and \a sinceVersion.
+ * \return
+ *      The update to send to the client. It is shared and must not be
+ *      modified. If some operation is in the middle of modifying the tablet
+ *      map, this may reflect the map as it was before the operation
+ *      started.
+ */
+std::shared_ptr<const TableManager::TabletMapUpdate>
+TableManager::getTabletMapUpdate(AbstractServerList& serverList,
+                                 uint64_t generation,
+                                 uint64_t sinceVersion,
+                                 uint64_t tableId)
+{
+    std::shared_ptr<const TabletMapUpdate> update;
+    Lock lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        // Some operation is modifying the tablet map (and may be waiting on
+        // LogCabin or a master); rather than wait for it, serve the map as
+        // it was before the operation started, if that's been cached.
+        update = findCachedUpdate(generation, sinceVersion, tableId);
+        if (update)
+            return update;
+        lock.lock();
+    }
+    publish(lock);
+    update = findCachedUpdate(generation, sinceVersion, tableId);
+    if (update)
+        return update;
+
+    UpdateCache::key_type key = getUpdateCacheKey(generation, sinceVersion,
+                                                  tableId, version,
+                                                  oldestDeltaVersion);
+    sinceVersion = key.first;
+    bool fullMap = (sinceVersion == 0 &&
+                    tableId == WireFormat::GetTabletMap::ALL_TABLES);
+
+    std::set<uint64_t> tableIds;
+    if (tableId != WireFormat::GetTabletMap::ALL_TABLES) {
+        tableIds.insert(tableId);
+    } else if (!fullMap) {
+        // Entries are in version order; scan back to the first change the
+        // client hasn't seen.
+        for (auto change = changeLog.rbegin();
+             change != changeLog.rend() && change->first > sinceVersion;
+             ++change) {
+            tableIds.insert(change->second);
         }
     }
+
+    ProtoBuf::Tablets tablets;
+    serializeTablets(lock, serverList, fullMap ? NULL : &tableIds, tablets);
+
+    std::shared_ptr<TabletMapUpdate> newUpdate(new TabletMapUpdate);
+    newUpdate->generation = this->generation;
+    newUpdate->version = version;
+    newUpdate->fullMap = fullMap;
+    newUpdate->numChangedTables = downCast<uint32_t>(tableIds.size());
+    foreach (uint64_t id, tableIds) {
+        newUpdate->payload.append(reinterpret_cast<const char*>(&id),
+                                  sizeof(id));
+    }
+    string serialized;
+    tablets.SerializeToString(&serialized);
+    newUpdate->tabletMapLength = downCast<uint32_t>(serialized.size());
+    newUpdate->payload.append(serialized);
+
+    std::lock_guard<SpinLock> _(snapshotLock);
+    if (updateCacheVersion != version ||
+            updateCache.size() >= MAX_CACHED_UPDATES) {
+        updateCache.clear();
+        updateCacheVersion = version;
+    }
+    updateCache[key] = newUpdate;
+    return newUpdate;
+}
+
+/**
+ * Return the current version of the tablet map. The version increases
+ * each time the tablet map changes.
+ */
+uint64_t
+TableManager::getVersion() const
+{
+    Lock lock(mutex);
+    return version;
 }
 
 /**
@@ -264,10 +391,65 @@ void
 TableManager::splitTablet(const char* name,
                           uint64_t splitKeyHash)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     SplitTablet(*this, lock, name, splitKeyHash).execute();
 }
 
+/**
+ * Split a Tablet in the tablet map into two disjoint Tablets at a specific
+ * key hash, like splitTablet(const char*, uint64_t), but with the table
+ * identified by id. Used by the TabletBalancer, which learns of hot tablets
+ * from masters' statistics.
+ *
+ * \param tableId
+ *      Identifier of the table that contains the tablet to be split.
+ * \param splitKeyHash
+ *      Key hash to used to partition the tablet into two. Keys less than
+ *      \a splitKeyHash belong to one Tablet, keys greater than or equal to
+ *      \a splitKeyHash belong to the other.
+ *
+ * \throw NoSuchTable
+ *      If tableId does not identify a table currently in the tables.
+ */
+void
+TableManager::splitTablet(uint64_t tableId,
+                          uint64_t splitKeyHash)
+{
+    MutationLock lock(*this);
+    foreach (const Tables::value_type& table, tables) {
+        if (table.second != tableId)
+            continue;
+        SplitTablet(*this, lock, table.first.c_str(), splitKeyHash).execute();
+        return;
+    }
+    throw NoSuchTable(HERE);
+}
+
+/**
+ * Split a Tablet that is being recovered into two disjoint Tablets at a
+ * specific key hash. Used by Recovery to divide large tablets of a crashed
+ * master among several recovery masters. Unlike splitTablet() no master is
+ * informed of the split, since the tablet has no live owner; the recovery
+ * masters will each be given one of the pieces.
+ *
+ * \param tableId
+ *      Identifier of the table that contains the tablet to be split.
+ * \param splitKeyHash
+ *      Key hash to used to partition the tablet into two. Keys less than
+ *      \a splitKeyHash belong to one Tablet, keys greater than or equal to
+ *      \a splitKeyHash belong to the other.
+ *
+ * \throw NoSuchTable
+ *      If tableId does not identify a table currently in the tables.
+ */
+void
+TableManager::splitRecoveringTablet(uint64_t tableId,
+                                    uint64_t splitKeyHash)
+{
+    // SplitTablet only tells the owner about splits of live tablets.
+    splitTablet(tableId, splitKeyHash);
+}
+
 /**
  * Used by MasterRecoveryManager after recovery for a tablet has successfully
  * completed to inform coordinator about the new master for the tablet.
@@ -291,7 +473,7 @@ TableManager::tabletRecovered(
         uint64_t tableId, uint64_t startKeyHash, uint64_t endKeyHash,
         ServerId serverId, Log::Position ctime)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     TabletRecovered(*this, lock, tableId, startKeyHash, endKeyHash,
                     serverId, ctime).execute();
 }
@@ -313,7 +495,7 @@ void
 TableManager::recoverAliveTable(
     ProtoBuf::TableInformation* state, EntryId entryId)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     LOG(DEBUG, "TableManager::recoverCreateTable()");
 
     nextTableId = state->table_id() + 1;
@@ -352,7 +534,7 @@ void
 TableManager::recoverCreateTable(
     ProtoBuf::TableInformation* state, EntryId entryId)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     LOG(DEBUG, "TableManager::recoverCreateTable()");
     nextTableId = state->table_id() + 1;
     CreateTable(*this, lock,
@@ -376,7 +558,7 @@ void
 TableManager::recoverDropTable(
     ProtoBuf::TableDrop* state, EntryId entryId)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     LOG(DEBUG, "TableManager::recoverDropTable()");
     DropTable(*this, lock,
               state->name().c_str()).complete(entryId);
@@ -399,7 +581,7 @@ void
 TableManager::recoverLargestTableId(
     ProtoBuf::LargestTableId* state, EntryId entryId)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     LOG(DEBUG, "TableManager::recoverLargestTableId()");
     nextTableId = state->table_id() + 1;
     logIdLargestTableId = entryId;
@@ -419,7 +601,7 @@ void
 TableManager::recoverSplitTablet(
     ProtoBuf::SplitTablet* state, EntryId entryId)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     LOG(DEBUG, "TableManager::recoverSplitTablet()");
     SplitTablet(*this, lock,
                 state->name().c_str(),
@@ -440,7 +622,7 @@ void
 TableManager::recoverTabletRecovered(
     ProtoBuf::TabletRecovered* state, EntryId entryId)
 {
-    Lock lock(mutex);
+    MutationLock lock(*this);
     LOG(DEBUG, "TableManager::recoverTabletRecovered()");
     TabletRecovered(*this, lock,
                     state->table_id(),
@@ -713,10 +895,17 @@ TableManager::SplitTablet::complete(EntryId entryId)
         newTablet.startKeyHash = splitKeyHash;
         tablet.endKeyHash = splitKeyHash - 1;
         tm.map.push_back(newTablet);
-
-        // Tell the master to split the tablet
-        MasterClient::splitMasterTablet(tm.context, tablet.serverId, tableId,
-                                        splitKeyHash);
+        tm.tabletsChanged(lock, tableId);
+
+        // Tell the master to split the tablet. Tablets under recovery have
+        // no live master; they are split before being handed out to
+        // recovery masters (see splitRecoveringTablet()).
+        // (The push_back above may have invalidated the tablet reference,
+        // so use the copy.)
+        if (newTablet.status != Tablet::RECOVERING) {
+            MasterClient::splitMasterTablet(tm.context, newTablet.serverId,
+                                            tableId, splitKeyHash);
+        }
 
         EntryId oldTableInfoEntryId = tm.getTableInfoLogId(lock, tableId);
         vector<EntryId> invalidates {oldTableInfoEntryId, entryId};
@@ -820,6 +1009,7 @@ void
 TableManager::addTablet(const Lock& lock, const Tablet& tablet)
 {
     map.push_back(tablet);
+    tabletsChanged(lock, tablet.tableId);
 }
 
 /**
@@ -1051,6 +1241,7 @@ TableManager::modifyTablet(const Lock& lock,
     tablet.serverId = serverId;
     tablet.status = status;
     tablet.ctime = ctime;
+    tabletsChanged(lock, tableId);
 }
 
 /**
@@ -1080,9 +1271,162 @@ TableManager::removeTabletsForTable(const Lock& lock, uint64_t tableId)
             ++it;
         }
     }
+    if (!removed.empty())
+        tabletsChanged(lock, tableId);
     return removed;
 }
 
+/**
+ * Return the update for a getTabletMapUpdate() request from #updateCache,
+ * if it holds one for the last published version of the tablet map. Only
+ * #snapshotLock is taken, so this may be used while some other thread
+ * holds #mutex.
+ *
+ * \param generation
+ *      See getTabletMapUpdate().
+ * \param sinceVersion
+ *      See getTabletMapUpdate().
+ * \param tableId
+ *      See getTabletMapUpdate().
+ * \return
+ *      The cached update, or NULL if there is none.
+ */
+std::shared_ptr<const TableManager::TabletMapUpdate>
+TableManager::findCachedUpdate(uint64_t generation,
+                               uint64_t sinceVersion,
+                               uint64_t tableId)
+{
+    std::lock_guard<SpinLock> _(snapshotLock);
+    if (updateCacheVersion != publishedVersion)
+        return std::shared_ptr<const TabletMapUpdate>();
+    UpdateCache::iterator it = updateCache.find(
+            getUpdateCacheKey(generation, sinceVersion, tableId,
+                              publishedVersion, publishedOldestDeltaVersion));
+    if (it == updateCache.end())
+        return std::shared_ptr<const TabletMapUpdate>();
+    return it->second;
+}
+
+/**
+ * Normalize a getTabletMapUpdate() request into its key in #updateCache,
+ * so that requests which get the same answer share a cache entry: all
+ * requests for the full map get (0, ALL_TABLES), all requests for one
+ * table get (0, tableId), and requests for a delta get
+ * (sinceVersion, ALL_TABLES).
+ *
+ * \param generation
+ *      See getTabletMapUpdate().
+ * \param sinceVersion
+ *      See getTabletMapUpdate().
+ * \param tableId
+ *      See getTabletMapUpdate().
+ * \param currentVersion
+ *      Version of the tablet map the request will be answered from.
+ * \param oldestDeltaVersion
+ *      Value of #oldestDeltaVersion at \a currentVersion.
+ */
+std::pair<uint64_t, uint64_t>
+TableManager::getUpdateCacheKey(uint64_t generation,
+                                uint64_t sinceVersion,
+                                uint64_t tableId,
+                                uint64_t currentVersion,
+                                uint64_t oldestDeltaVersion) const
+{
+    if (tableId != WireFormat::GetTabletMap::ALL_TABLES ||
+            generation != this->generation || sinceVersion > currentVersion ||
+            sinceVersion < oldestDeltaVersion) {
+        sinceVersion = 0;
+    }
+    return std::make_pair(sinceVersion, tableId);
+}
+
+/**
+ * Make the current state of the tables and tablet map available to
+ * readers that don't want to wait for #mutex (see getTableId() and
+ * getTabletMapUpdate()). Called whenever that state is known to be
+ * consistent: when a MutationLock is released, and by readers holding
+ * #mutex.
+ *
+ * \param lock
+ *      Explicity needs caller to hold a lock.
+ */
+void
+TableManager::publish(const Lock& lock)
+{
+    {
+        std::lock_guard<SpinLock> _(snapshotLock);
+        if (publishedVersion == version && publishedTables)
+            return;
+    }
+    std::shared_ptr<const Tables> tablesCopy(new Tables(tables));
+    std::lock_guard<SpinLock> _(snapshotLock);
+    publishedVersion = version;
+    publishedOldestDeltaVersion = oldestDeltaVersion;
+    publishedTables = tablesCopy;
+}
+
+/**
+ * Copy tablets from the tablet map into a protocol buffer, \a tablets,
+ * suitable for sending across the wire.
+ *
+ * \param lock
+ *      Explicity needs caller to hold a lock.
+ * \param serverList
+ *      The single instance of the AbstractServerList. Used to fill in
+ *      the service_locator field of entries in \a tablets.
+ * \param tableIds
+ *      If non-NULL, only tablets of these tables are copied; otherwise
+ *      every tablet in the tablet map is.
+ * \param tablets
+ *      Protocol buffer to which entries are added representing the
+ *      selected tablets.
+ */
+void
+TableManager::serializeTablets(const Lock& lock,
+                               AbstractServerList& serverList,
+                               const std::set<uint64_t>* tableIds,
+                               ProtoBuf::Tablets& tablets) const
+{
+    foreach (const auto& tablet, map) {
+        if (tableIds && tableIds->find(tablet.tableId) == tableIds->end())
+            continue;
+        ProtoBuf::Tablets::Tablet& entry(*tablets.add_tablet());
+        tablet.serialize(entry);
+        try {
+            string locator = serverList.getLocator(tablet.serverId);
+            entry.set_service_locator(locator);
+        } catch (const Exception& e) {
+            LOG(NOTICE, "Server id (%s) in tablet map no longer in server "
+                "list; sending empty locator for entry",
+                tablet.serverId.toString().c_str());
+        }
+    }
+}
+
+/**
+ * Record that the tablets of a table have changed: bump the version of the
+ * tablet map and note which table changed in it, so that clients can later
+ * fetch just that table's tablets. Must be called after every change to
+ * #map.
+ *
+ * \param lock
+ *      Explicity needs caller to hold a lock.
+ * \param tableId
+ *      Table id of the table whose tablets were added, removed, or changed.
+ */
+void
+TableManager::tabletsChanged(const Lock& lock, uint64_t tableId)
+{
+    ++version;
+    changeLog.push_back({version, tableId});
+    while (changeLog.size() > MAX_CHANGE_LOG_ENTRIES) {
+        // A client at the version of the dropped entry still has every
+        // change after it available.
+        oldestDeltaVersion = changeLog.front().first;
+        changeLog.pop_front();
+    }
+}
+
 /**
  * Add the LogCabin EntryId corresponding to the information about this table.
  *
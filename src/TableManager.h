@@ -17,7 +17,11 @@
 #define RAMCLOUD_TABLEMANAGER_H
 
 #include <Client/Client.h>
+#include <deque>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <set>
 
 #include "LargestTableId.pb.h"
 #include "SplitTablet.pb.h"
@@ -31,6 +35,7 @@
 #include "LogCabinHelper.h"
 #include "LogEntryTypes.h"
 #include "ServerId.h"
+#include "SpinLock.h"
 #include "Tablet.h"
 
 namespace RAMCloud {
@@ -46,6 +51,12 @@ using LogCabin::Client::NO_ID;
  *
  * Instances are locked for thread-safety, and methods return tablets
  * by-value to avoid inconsistencies due to concurrency.
+ *
+ * Every change to the tablet map increments its version. Clients that have
+ * cached the map at some version can fetch just the tables that changed
+ * since then (see getTabletMapUpdate()), and since many clients tend to ask
+ * for the same thing at once (for example, after a recovery) the serialized
+ * responses are cached until the map next changes.
  */
 class TableManager {
   PUBLIC:
@@ -74,6 +85,45 @@ class TableManager {
         explicit NoSuchTablet(const CodeLocation& where) : Exception(where) {}
     };
 
+    /**
+     * A serialized portion of the tablet map, as returned to clients by
+     * getTabletMapUpdate(). Immutable once created, so that it can be shared
+     * among all the clients asking for the same thing.
+     */
+    struct TabletMapUpdate {
+        TabletMapUpdate()
+            : generation(0)
+            , version(0)
+            , fullMap(false)
+            , numChangedTables(0)
+            , tabletMapLength(0)
+            , payload()
+        {}
+
+        /// See TableManager::generation.
+        uint64_t generation;
+
+        /// Version of the tablet map this update brings the caller up to.
+        uint64_t version;
+
+        /// True if #payload holds the entire tablet map, which should
+        /// replace any cached copy. Otherwise it holds all the tablets of
+        /// the tables listed in its changed table ids, which replace just
+        /// the cached tablets of those tables.
+        bool fullMap;
+
+        /// Number of changed table ids at the start of #payload.
+        uint32_t numChangedTables;
+
+        /// Number of bytes of serialized ProtoBuf::Tablets that follow the
+        /// changed table ids in #payload.
+        uint32_t tabletMapLength;
+
+        /// The bytes to send after the response header: #numChangedTables
+        /// uint64_t table ids followed by a serialized ProtoBuf::Tablets.
+        string payload;
+    };
+
     explicit TableManager(Context* context);
     ~TableManager();
 
@@ -81,6 +131,12 @@ class TableManager {
     string debugString() const;
     void dropTable(const char* name);
     uint64_t getTableId(const char* name);
+    std::shared_ptr<const TabletMapUpdate> getTabletMapUpdate(
+                                        AbstractServerList& serverList,
+                                        uint64_t generation,
+                                        uint64_t sinceVersion,
+                                        uint64_t tableId);
+    uint64_t getVersion() const;
     vector<Tablet> markAllTabletsRecovering(ServerId serverId);
     void reassignTabletOwnership(ServerId newOwner, uint64_t tableId,
                                  uint64_t startKeyHash, uint64_t endKeyHash,
@@ -90,6 +146,10 @@ class TableManager {
                    ProtoBuf::Tablets& tablets) const;
     void splitTablet(const char* name,
                      uint64_t splitKeyHash);
+    void splitTablet(uint64_t tableId,
+                     uint64_t splitKeyHash);
+    void splitRecoveringTablet(uint64_t tableId,
+                               uint64_t splitKeyHash);
     void tabletRecovered(uint64_t tableId,
                          uint64_t startKeyHash,
                          uint64_t endKeyHash,
@@ -118,6 +178,26 @@ class TableManager {
     typedef std::unique_lock<std::mutex> Lock;
 
   PRIVATE:
+    /**
+     * Used in place of a Lock by every operation that modifies the tables
+     * or the tablet map. When it is released the operation is complete, so
+     * the new state is published for readers that don't want to wait for
+     * the next operation to finish (see publish()).
+     */
+    class MutationLock : public Lock {
+      public:
+        explicit MutationLock(TableManager& tm)
+            : Lock(tm.mutex)
+            , tm(tm)
+        {}
+        ~MutationLock()
+        {
+            tm.publish(*this);
+        }
+      private:
+        TableManager& tm;
+        DISALLOW_COPY_AND_ASSIGN(MutationLock);
+    };
 
     /**
      * Defines methods and stores data to create a table.
@@ -325,6 +405,22 @@ class TableManager {
                            uint64_t tableId,
                            EntryId entryId);
     size_t size(const Lock& lock) const;
+    void serializeTablets(const Lock& lock,
+                          AbstractServerList& serverList,
+                          const std::set<uint64_t>* tableIds,
+                          ProtoBuf::Tablets& tablets) const;
+    void tabletsChanged(const Lock& lock, uint64_t tableId);
+    std::shared_ptr<const TabletMapUpdate> findCachedUpdate(
+                                        uint64_t generation,
+                                        uint64_t sinceVersion,
+                                        uint64_t tableId);
+    std::pair<uint64_t, uint64_t> getUpdateCacheKey(
+                                        uint64_t generation,
+                                        uint64_t sinceVersion,
+                                        uint64_t tableId,
+                                        uint64_t currentVersion,
+                                        uint64_t oldestDeltaVersion) const;
+    void publish(const Lock& lock);
 
     /**
      * Shared RAMCloud information.
@@ -372,6 +468,78 @@ class TableManager {
      */
     TablesLogIds tablesLogIds;
 
+    /**
+     * Randomly chosen when the TableManager is created. Versions are only
+     * meaningful within a generation: a client holding a map from another
+     * generation (say, from before the coordinator restarted) always gets a
+     * full map.
+     */
+    const uint64_t generation;
+
+    /**
+     * Incremented every time the tablet map changes (see tabletsChanged()).
+     * Starts at 1, so that 0 can mean "no map" to clients.
+     */
+    uint64_t version;
+
+    /**
+     * Maximum number of entries to keep in #changeLog. Clients whose map is
+     * older than the oldest entry get a full map instead of a delta.
+     */
+    enum { MAX_CHANGE_LOG_ENTRIES = 10000 };
+
+    /**
+     * The ids of the tables whose tablets changed in recent versions, as
+     * (version, tableId) pairs in increasing order of version. Used to find
+     * which tables a client must refetch to bring its map up to date.
+     */
+    std::deque<std::pair<uint64_t, uint64_t>> changeLog;
+
+    /**
+     * Deltas can only be computed for clients whose map is at least this
+     * version; older changes have been dropped from #changeLog.
+     */
+    uint64_t oldestDeltaVersion;
+
+    /**
+     * Maximum number of serialized updates to keep in #updateCache. Once
+     * exceeded, the cache is cleared.
+     */
+    enum { MAX_CACHED_UPDATES = 64 };
+
+    /**
+     * Updates returned by getTabletMapUpdate() for #updateCacheVersion,
+     * indexed by (sinceVersion, tableId) after normalizing the request (so,
+     * for instance, all requests for a full map share one entry; see
+     * getUpdateCacheKey()). Protected by #snapshotLock rather than #mutex,
+     * so that readers can use it while an operation is in progress.
+     */
+    typedef std::map<std::pair<uint64_t, uint64_t>,
+                     std::shared_ptr<const TabletMapUpdate>> UpdateCache;
+    UpdateCache updateCache;
+
+    /// The #version that the entries in #updateCache were built from.
+    uint64_t updateCacheVersion;
+
+    /**
+     * Protects #updateCache and the published* fields below, which
+     * together describe the state of the TableManager as of the last time
+     * it was known to be consistent (see publish()). Readers that find
+     * #mutex held by an operation in progress answer from this state
+     * instead of waiting, so operations that block on LogCabin or a master
+     * don't hold up clients looking up tables.
+     */
+    SpinLock snapshotLock;
+
+    /// Value of #version when state was last published.
+    uint64_t publishedVersion;
+
+    /// Value of #oldestDeltaVersion when state was last published.
+    uint64_t publishedOldestDeltaVersion;
+
+    /// Copy of #tables when state was last published; NULL until then.
+    std::shared_ptr<const Tables> publishedTables;
+
     DISALLOW_COPY_AND_ASSIGN(TableManager);
 };
 
@@ -104,6 +104,31 @@ class TableManagerTest : public ::testing::Test {
         }
     }
 
+    /**
+     * Summarize a TabletMapUpdate as "full" or "delta", the version, the
+     * changed table ids, and the (table id, start key hash) of each tablet.
+     */
+    string
+    toString(const TableManager::TabletMapUpdate& update) {
+        string result = format("%s v%lu [", update.fullMap ? "full" : "delta",
+                               update.version);
+        const uint64_t* ids =
+            reinterpret_cast<const uint64_t*>(update.payload.data());
+        for (uint32_t i = 0; i < update.numChangedTables; i++)
+            result += format("%s%lu", i ? " " : "", ids[i]);
+        result += "]";
+        ProtoBuf::Tablets tablets;
+        tablets.ParseFromString(update.payload.substr(
+            update.numChangedTables * sizeof(uint64_t)));
+        EXPECT_EQ(update.tabletMapLength, update.payload.size() -
+                  update.numChangedTables * sizeof(uint64_t));
+        foreach (const ProtoBuf::Tablets::Tablet& tablet, tablets.tablet()) {
+            result += format(" %lu:%lu", tablet.table_id(),
+                             tablet.start_key_hash());
+        }
+        return result;
+    }
+
     DISALLOW_COPY_AND_ASSIGN(TableManagerTest);
 };
 
@@ -339,6 +364,106 @@ TEST_F(TableManagerTest, getTableId) {
                  TableManager::NoSuchTable);
 }
 
+static void
+getTableIdInThread(TableManager* tableManager, const char* name,
+                   uint64_t* tableId)
+{
+    try {
+        *tableId = tableManager->getTableId(name);
+    } catch (TableManager::NoSuchTable& e) {
+        *tableId = ~0lu;
+    }
+}
+
+TEST_F(TableManagerTest, getTableId_snapshot) {
+    enlistMaster();
+    tableManager->createTable("foo", 1);
+
+    // Some operation is in progress; its changes aren't visible yet.
+    Lock lock(tableManager->mutex);
+    tableManager->tables["bar"] = 2;
+    uint64_t tableId = 0;
+    std::thread(getTableIdInThread, tableManager, "foo", &tableId).join();
+    EXPECT_EQ(1lu, tableId);
+    std::thread(getTableIdInThread, tableManager, "bar", &tableId).join();
+    EXPECT_EQ(~0lu, tableId);
+}
+
+TEST_F(TableManagerTest, getTabletMapUpdate) {
+    Lock lock(mutex);     // Used to trick internal calls.
+    const uint64_t all = WireFormat::GetTabletMap::ALL_TABLES;
+    const uint64_t generation = tableManager->generation;
+    tableManager->addTablet(lock, {1, 0, 9, {0, 1}, Tablet::NORMAL, {0, 0}});
+    tableManager->addTablet(lock, {2, 0, 9, {0, 1}, Tablet::NORMAL, {0, 0}});
+    uint64_t version = tableManager->getVersion();
+    EXPECT_EQ(3lu, version);
+
+    // No map yet, or one from another generation: full map.
+    auto update = tableManager->getTabletMapUpdate(*serverList, 0, 0, all);
+    EXPECT_EQ("full v3 [] 1:0 2:0", toString(*update));
+    EXPECT_EQ(generation, update->generation);
+    EXPECT_EQ(update, tableManager->getTabletMapUpdate(
+                                *serverList, generation + 1, 2, all));
+
+    // Up to date: empty delta.
+    EXPECT_EQ("delta v3 []", toString(*tableManager->getTabletMapUpdate(
+                                *serverList, generation, 3, all)));
+
+    // Just the tables changed since the given version.
+    tableManager->addTablet(lock, {1, 10, 19, {0, 1}, Tablet::NORMAL, {0, 0}});
+    tableManager->addTablet(lock, {3, 0, 9, {0, 1}, Tablet::NORMAL, {0, 0}});
+    tableManager->removeTabletsForTable(lock, 2);
+    EXPECT_EQ("delta v6 [2]", toString(*tableManager->getTabletMapUpdate(
+                                *serverList, generation, 5, all)));
+    EXPECT_EQ("delta v6 [1 2 3] 1:0 3:0 1:10",
+              toString(*tableManager->getTabletMapUpdate(
+                                *serverList, generation, 3, all)));
+
+    // Versions from the future can't be trusted.
+    EXPECT_EQ("full v6 [] 1:0 3:0 1:10",
+              toString(*tableManager->getTabletMapUpdate(
+                                *serverList, generation, 7, all)));
+
+    // A single table.
+    update = tableManager->getTabletMapUpdate(*serverList, 0, 0, 1);
+    EXPECT_EQ("delta v6 [1] 1:0 1:10", toString(*update));
+    EXPECT_EQ(update, tableManager->getTabletMapUpdate(
+                                *serverList, generation, 4, 1));
+
+    // Changes to the map invalidate cached updates.
+    tableManager->modifyTablet(lock, 1, 0, 9, {0, 1}, Tablet::RECOVERING,
+                               {0, 0});
+    auto update2 = tableManager->getTabletMapUpdate(*serverList, 0, 0, 1);
+    EXPECT_NE(update, update2);
+    EXPECT_EQ("delta v7 [1] 1:0 1:10", toString(*update2));
+}
+
+static void
+getTabletMapUpdateInThread(TableManager* tableManager,
+                           AbstractServerList* serverList,
+                           std::shared_ptr<const TableManager::TabletMapUpdate>*
+                                update)
+{
+    *update = tableManager->getTabletMapUpdate(*serverList, 0, 0,
+            WireFormat::GetTabletMap::ALL_TABLES);
+}
+
+TEST_F(TableManagerTest, getTabletMapUpdate_snapshot) {
+    enlistMaster();
+    tableManager->createTable("foo", 1);
+    auto update = tableManager->getTabletMapUpdate(*serverList, 0, 0,
+            WireFormat::GetTabletMap::ALL_TABLES);
+
+    // Some operation is in progress; the cached update is served without
+    // waiting for it.
+    Lock lock(tableManager->mutex);
+    tableManager->tabletsChanged(lock, 2);
+    std::shared_ptr<const TableManager::TabletMapUpdate> update2;
+    std::thread(getTabletMapUpdateInThread, tableManager, serverList,
+                &update2).join();
+    EXPECT_EQ(update, update2);
+}
+
 TEST_F(TableManagerTest, markAllTabletsRecovering) {
     Lock lock(mutex);     // Used to trick internal calls.
     tableManager->addTablet(lock, {1, 1, 6, {0, 1}, Tablet::NORMAL, {0, 5}});
@@ -500,6 +625,27 @@ TEST_F(TableManagerTest, splitTablet) {
                  TableManager::NoSuchTable);
 }
 
+TEST_F(TableManagerTest, splitRecoveringTablet) {
+    enlistMaster();
+
+    tableManager->createTable("foo", 1);
+    tableManager->markAllTabletsRecovering({1, 0});
+    tableManager->splitRecoveringTablet(1, ~0lu / 2);
+    EXPECT_EQ("Tablet { tableId: 1 startKeyHash: 0 "
+              "endKeyHash: 9223372036854775806 "
+              "serverId: 1.0 status: RECOVERING "
+              "ctime: 0, 0 } "
+              "Tablet { tableId: 1 "
+              "startKeyHash: 9223372036854775807 "
+              "endKeyHash: 18446744073709551615 "
+              "serverId: 1.0 status: RECOVERING "
+              "ctime: 0, 0 }",
+              tableManager->debugString());
+
+    EXPECT_THROW(tableManager->splitRecoveringTablet(2, ~0ul / 2),
+                 TableManager::NoSuchTable);
+}
+
 TEST_F(TableManagerTest, splitTablet_LogCabin) {
     enlistMaster();
 
@@ -873,4 +1019,25 @@ TEST_F(TableManagerTest, removeTabletsForTable) {
     }
 }
 
+TEST_F(TableManagerTest, tabletsChanged) {
+    Lock lock(mutex);     // Used to trick internal calls.
+    EXPECT_EQ(1lu, tableManager->getVersion());
+    for (uint64_t tableId = 0; tableId < 10000; tableId++)
+        tableManager->tabletsChanged(lock, tableId);
+    EXPECT_EQ(10001lu, tableManager->getVersion());
+    EXPECT_EQ(10000lu, tableManager->changeLog.size());
+    EXPECT_EQ(1lu, tableManager->oldestDeltaVersion);
+    EXPECT_EQ(2lu, tableManager->changeLog.front().first);
+
+    // Once entries are dropped, clients from before them get a full map.
+    tableManager->tabletsChanged(lock, 7);
+    EXPECT_EQ(2lu, tableManager->oldestDeltaVersion);
+    EXPECT_TRUE(tableManager->getTabletMapUpdate(*serverList,
+                tableManager->generation, 1,
+                WireFormat::GetTabletMap::ALL_TABLES)->fullMap);
+    EXPECT_FALSE(tableManager->getTabletMapUpdate(*serverList,
+                tableManager->generation, 2,
+                WireFormat::GetTabletMap::ALL_TABLES)->fullMap);
+}
+
 }  // namespace RAMCloud
@@ -0,0 +1,369 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <chrono>
+#include <cmath>
+
+#include "TabletBalancer.h"
+#include "CoordinatorServerList.h"
+#include "Cycles.h"
+#include "MasterClient.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * Create a TabletBalancer; it does nothing until start() is called.
+ *
+ * \param context
+ *      Overall information about the RAMCloud server. Its
+ *      coordinatorServerList is used to find the masters.
+ * \param tableManager
+ *      Tablet map of the coordinator; hot tablets are split through it.
+ * \param runtimeOptions
+ *      Thresholds and rate limits for the balancer are read from here at
+ *      the start of each round, so they can be changed while it runs.
+ * \param mutationMutex
+ *      See CoordinatorService::mutationMutex.
+ */
+TabletBalancer::TabletBalancer(Context* context,
+                               TableManager& tableManager,
+                               RuntimeOptions* runtimeOptions,
+                               std::mutex& mutationMutex)
+    : context(context)
+    , tableManager(tableManager)
+    , runtimeOptions(runtimeOptions)
+    , mutationMutex(mutationMutex)
+    , lastCounts()
+    , lastRoundTicks(0)
+    , lastMoveTicks(0)
+    , mutex()
+    , stop(false)
+    , stopRequested()
+    , thread()
+{
+}
+
+TabletBalancer::~TabletBalancer()
+{
+    halt();
+}
+
+/**
+ * Start balancing load in a separate thread. Calling start() on an instance
+ * that is already started has no effect. start() and halt() are not
+ * thread-safe.
+ */
+void
+TabletBalancer::start()
+{
+    if (thread)
+        return;
+    stop = false;
+    thread.construct(&TabletBalancer::main, this);
+}
+
+/**
+ * Stop balancing load, waiting for any move in progress to finish. Calling
+ * halt() on an instance that is already halted or has never been started
+ * has no effect. start() and halt() are not thread-safe.
+ */
+void
+TabletBalancer::halt()
+{
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        stop = true;
+    }
+    stopRequested.notify_all();
+    if (thread)
+        thread->join();
+    thread.destroy();
+}
+
+/**
+ * Run one round of balancing: collect statistics from every master,
+ * compute the load on each since the last round, and move a tablet if
+ * the load is badly skewed (see chooseMove()). Called periodically by
+ * the balancer's thread; exposed for testing.
+ */
+void
+TabletBalancer::balance()
+{
+    uint64_t now = Cycles::rdtsc();
+    double seconds = 0;
+    if (lastRoundTicks != 0)
+        seconds = Cycles::toSeconds(now - lastRoundTicks);
+
+    ProtoBuf::ServerList masters;
+    context->coordinatorServerList->serialize(masters,
+                                              {WireFormat::MASTER_SERVICE});
+
+    // Collect statistics from all the masters in parallel.
+    size_t numMasters = masters.server_size();
+    auto rpcs = std::unique_ptr<Tub<GetMasterStatisticsRpc>[]>(
+            new Tub<GetMasterStatisticsRpc>[numMasters]);
+    for (size_t i = 0; i < numMasters; i++) {
+        const ProtoBuf::ServerList::Entry& entry =
+                masters.server(downCast<int>(i));
+        if (entry.status() != static_cast<uint32_t>(ServerStatus::UP))
+            continue;
+        rpcs[i].construct(context, ServerId(entry.server_id()));
+    }
+
+    vector<MasterLoad> loads;
+    TabletCounts counts;
+    for (size_t i = 0; i < numMasters; i++) {
+        if (!rpcs[i])
+            continue;
+        ServerId serverId(masters.server(downCast<int>(i)).server_id());
+        ProtoBuf::ServerStatistics stats;
+        try {
+            rpcs[i]->wait(&stats);
+        } catch (const ClientException& e) {
+            LOG(NOTICE, "Couldn't get statistics from master %s: %s",
+                serverId.toString().c_str(), e.toString());
+            continue;
+        }
+        loads.push_back(computeLoad(serverId, stats, seconds, counts));
+    }
+    lastCounts.swap(counts);
+    lastRoundTicks = now;
+
+    // Rates aren't known until the second round.
+    if (seconds == 0)
+        return;
+    if (lastMoveTicks != 0 &&
+            Cycles::toNanoseconds(now - lastMoveTicks) <
+            runtimeOptions->getBalancerCooldownMs() * 1000 * 1000) {
+        return;
+    }
+
+    Move move = chooseMove(loads);
+    if (!move.from.isValid())
+        return;
+    executeMove(move);
+    lastMoveTicks = Cycles::rdtsc();
+}
+
+// - private -
+
+/**
+ * Work out how many reads and writes per second a master has served for
+ * each of its tablets since the last round.
+ *
+ * \param serverId
+ *      Identifies the master.
+ * \param stats
+ *      Statistics just returned by the master.
+ * \param seconds
+ *      Time since the last round, or 0 if this is the first round, in which
+ *      case all rates are 0.
+ * \param[out] counts
+ *      The read and write counts of the master's tablets are added here,
+ *      to serve as #lastCounts in the next round.
+ * \return
+ *      Load on the master and each of its tablets.
+ */
+TabletBalancer::MasterLoad
+TabletBalancer::computeLoad(ServerId serverId,
+                            const ProtoBuf::ServerStatistics& stats,
+                            double seconds,
+                            TabletCounts& counts)
+{
+    MasterLoad load(serverId);
+    load.migrating = (stats.migration_size() > 0);
+    foreach (const ProtoBuf::ServerStatistics::TabletEntry& entry,
+             stats.tabletentry()) {
+        TabletKey key(serverId.getId(), entry.table_id(),
+                      entry.start_key_hash(), entry.end_key_hash());
+        uint64_t count = entry.number_read_and_writes();
+        counts[key] = count;
+
+        // A tablet that is new to us (just migrated here, or split, which
+        // changes its range) started counting from 0. So did one whose
+        // count went down, which must have been dropped and recreated.
+        uint64_t ops = count;
+        TabletCounts::iterator it = lastCounts.find(key);
+        if (it != lastCounts.end() && it->second <= count)
+            ops = count - it->second;
+
+        double rate = 0;
+        if (seconds > 0)
+            rate = static_cast<double>(ops) / seconds;
+        load.tablets.push_back(TabletLoad(entry.table_id(),
+                                          entry.start_key_hash(),
+                                          entry.end_key_hash(),
+                                          rate));
+        load.opsPerSecond += rate;
+    }
+    return load;
+}
+
+/**
+ * Decide which tablet, if any, to move to even out load across masters.
+ * Load is moved from the busiest master to the least busy one, but only if
+ * the busiest is serving more than RuntimeOptions::balancerMinOpsPerSecond
+ * and RuntimeOptions::balancerOverloadPercent of the average load, and the
+ * least busy less than RuntimeOptions::balancerUnderloadPercent of it.
+ *
+ * The busiest master's hottest tablet is moved, either whole or, if that
+ * would leave the pair of masters further from balanced than moving half
+ * of it (for instance, if it's the busiest master's only tablet), the upper
+ * half of its key hash range.
+ *
+ * \param loads
+ *      Load on each master during the last round.
+ * \return
+ *      The move to make; its \a from field is invalid if there is none.
+ */
+TabletBalancer::Move
+TabletBalancer::chooseMove(const vector<MasterLoad>& loads)
+{
+    Move move;
+    if (loads.size() < 2)
+        return move;
+
+    double average = 0;
+    foreach (const MasterLoad& load, loads)
+        average += load.opsPerSecond;
+    average /= static_cast<double>(loads.size());
+
+    const MasterLoad* busiest = NULL;
+    const MasterLoad* idlest = NULL;
+    foreach (const MasterLoad& load, loads) {
+        if (load.migrating)
+            continue;
+        if (busiest == NULL || load.opsPerSecond > busiest->opsPerSecond)
+            busiest = &load;
+        if (idlest == NULL || load.opsPerSecond < idlest->opsPerSecond)
+            idlest = &load;
+    }
+    if (busiest == NULL || busiest == idlest)
+        return move;
+
+    double minOps =
+            static_cast<double>(runtimeOptions->getBalancerMinOpsPerSecond());
+    double overload = average * static_cast<double>(
+            runtimeOptions->getBalancerOverloadPercent()) / 100;
+    double underload = average * static_cast<double>(
+            runtimeOptions->getBalancerUnderloadPercent()) / 100;
+    if (busiest->opsPerSecond < minOps ||
+            busiest->opsPerSecond <= overload ||
+            idlest->opsPerSecond >= underload) {
+        return move;
+    }
+
+    const TabletLoad* hottest = NULL;
+    foreach (const TabletLoad& tablet, busiest->tablets) {
+        if (hottest == NULL || tablet.opsPerSecond > hottest->opsPerSecond)
+            hottest = &tablet;
+    }
+    if (hottest == NULL || hottest->opsPerSecond == 0)
+        return move;
+
+    move.tableId = hottest->tableId;
+    move.firstKeyHash = hottest->startKeyHash;
+    move.lastKeyHash = hottest->endKeyHash;
+
+    // Moving this much would leave both masters at the same load.
+    double excess = (busiest->opsPerSecond - idlest->opsPerSecond) / 2;
+    double wholeError = fabs(excess - hottest->opsPerSecond);
+    double halfError = fabs(excess - hottest->opsPerSecond / 2);
+    if (halfError < wholeError) {
+        if (hottest->startKeyHash == hottest->endKeyHash) {
+            LOG(NOTICE, "Master %s is overloaded by key hash 0x%lx in table "
+                "%lu, which can't be split",
+                busiest->serverId.toString().c_str(), hottest->startKeyHash,
+                hottest->tableId);
+            return Move();
+        }
+        move.firstKeyHash = hottest->startKeyHash +
+                (hottest->endKeyHash - hottest->startKeyHash) / 2 + 1;
+        move.split = true;
+    }
+    move.from = busiest->serverId;
+    move.to = idlest->serverId;
+    return move;
+}
+
+/**
+ * Carry out a move decided on by chooseMove(). Failures (for instance, if
+ * the table was dropped or one of the masters crashed in the meantime) are
+ * logged and otherwise ignored; the next round will decide afresh.
+ *
+ * \param move
+ *      The tablet to move, and where.
+ */
+void
+TabletBalancer::executeMove(const Move& move)
+{
+    try {
+        if (move.split) {
+            LOG(NOTICE, "Splitting hot tablet in table %lu at key hash 0x%lx",
+                move.tableId, move.firstKeyHash);
+            std::lock_guard<std::mutex> _(mutationMutex);
+            tableManager.splitTablet(move.tableId, move.firstKeyHash);
+        }
+        LOG(NOTICE, "Migrating tablet [0x%lx,0x%lx] in table %lu from %s "
+            "to %s to balance load", move.firstKeyHash, move.lastKeyHash,
+            move.tableId, move.from.toString().c_str(),
+            move.to.toString().c_str());
+        MasterClient::migrateMasterTablet(context, move.from, move.tableId,
+                                          move.firstKeyHash, move.lastKeyHash,
+                                          move.to);
+    } catch (const ClientException& e) {
+        LOG(WARNING, "Couldn't move tablet [0x%lx,0x%lx] in table %lu: %s",
+            move.firstKeyHash, move.lastKeyHash, move.tableId,
+            e.toString());
+    } catch (const TableManager::NoSuchTable& e) {
+        LOG(NOTICE, "Table %lu was dropped before its tablet could be moved",
+            move.tableId);
+    } catch (const TableManager::NoSuchTablet& e) {
+        LOG(NOTICE, "Tablet [0x%lx,0x%lx] in table %lu changed before it "
+            "could be moved", move.firstKeyHash, move.lastKeyHash,
+            move.tableId);
+    }
+}
+
+/**
+ * Main loop of the balancer's thread: run a round of balancing every
+ * RuntimeOptions::balancerIntervalMs until halt() is called.
+ */
+void
+TabletBalancer::main()
+try {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+        uint64_t intervalMs = runtimeOptions->getBalancerIntervalMs();
+
+        // While disabled, check every second whether that has changed.
+        stopRequested.wait_for(lock,
+                std::chrono::milliseconds(intervalMs != 0 ? intervalMs : 1000));
+        if (stop || intervalMs == 0)
+            continue;
+        lock.unlock();
+        balance();
+        lock.lock();
+    }
+} catch (const std::exception& e) {
+    LOG(ERROR, "Fatal error in TabletBalancer: %s", e.what());
+    throw;
+} catch (...) {
+    LOG(ERROR, "Unknown fatal error in TabletBalancer.");
+    throw;
+}
+
+} // namespace RAMCloud
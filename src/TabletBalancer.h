@@ -0,0 +1,195 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_TABLETBALANCER_H
+#define RAMCLOUD_TABLETBALANCER_H
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+#include "Common.h"
+#include "RuntimeOptions.h"
+#include "ServerId.h"
+#include "ServerStatistics.pb.h"
+#include "TableManager.h"
+#include "Tub.h"
+
+namespace RAMCloud {
+
+/**
+ * Runs on the coordinator and spreads read and write load evenly across
+ * masters. Every so often (see RuntimeOptions::balancerIntervalMs) it asks
+ * each master for the read and write counts of its tablets, turns them into
+ * rates, and if one master is serving well above the average load it moves
+ * some of that load to the least loaded master: either a whole tablet or,
+ * if the master's hottest tablet alone carries more than should be moved,
+ * half of that tablet, split at the midpoint of its key hash range.
+ *
+ * At most one tablet is moved per round, and moves are at least
+ * RuntimeOptions::balancerCooldownMs apart, so that the masters' statistics
+ * can reflect each move before the next is decided on. A badly skewed
+ * table is thus spread out over several rounds.
+ *
+ * The balancer is off unless RuntimeOptions::balancerIntervalMs is set.
+ * It runs in its own thread. Splits are made while holding the
+ * coordinator's mutation mutex, like any other change to the tablet map
+ * (see CoordinatorService::mutationMutex); migrations are carried out by
+ * the masters, which tell the coordinator about the new owner themselves.
+ */
+class TabletBalancer {
+  PUBLIC:
+    /// Load on a single tablet during the last round.
+    struct TabletLoad {
+        TabletLoad(uint64_t tableId, uint64_t startKeyHash,
+                   uint64_t endKeyHash, double opsPerSecond)
+            : tableId(tableId)
+            , startKeyHash(startKeyHash)
+            , endKeyHash(endKeyHash)
+            , opsPerSecond(opsPerSecond)
+        {}
+
+        uint64_t tableId;
+        uint64_t startKeyHash;
+        uint64_t endKeyHash;
+
+        /// Reads and writes per second served for the tablet.
+        double opsPerSecond;
+    };
+
+    /// Load on a single master during the last round.
+    struct MasterLoad {
+        explicit MasterLoad(ServerId serverId)
+            : serverId(serverId)
+            , opsPerSecond(0)
+            , migrating(false)
+            , tablets()
+        {}
+
+        ServerId serverId;
+
+        /// Sum of TabletLoad::opsPerSecond over #tablets.
+        double opsPerSecond;
+
+        /**
+         * True if the master is in the middle of migrating a tablet away,
+         * in which case it is neither a source nor a target of moves.
+         */
+        bool migrating;
+
+        vector<TabletLoad> tablets;
+    };
+
+    /// A tablet move decided on by chooseMove().
+    struct Move {
+        Move()
+            : tableId(0)
+            , firstKeyHash(0)
+            , lastKeyHash(0)
+            , split(false)
+            , from()
+            , to()
+        {}
+
+        /// Identifies the key hash range to migrate.
+        uint64_t tableId;
+        uint64_t firstKeyHash;
+        uint64_t lastKeyHash;
+
+        /**
+         * If true, the range is the upper half of a tablet, which must be
+         * split at #firstKeyHash before the range can be migrated.
+         */
+        bool split;
+
+        /// Current owner of the range. Invalid if there is nothing to do.
+        ServerId from;
+
+        /// Master to migrate the range to.
+        ServerId to;
+    };
+
+    TabletBalancer(Context* context,
+                   TableManager& tableManager,
+                   RuntimeOptions* runtimeOptions,
+                   std::mutex& mutationMutex);
+    ~TabletBalancer();
+
+    void start();
+    void halt();
+    void balance();
+
+  PRIVATE:
+    /**
+     * Identifies a tablet on a particular master in #lastCounts:
+     * (master ServerId, tableId, startKeyHash, endKeyHash).
+     */
+    typedef std::tuple<uint64_t, uint64_t, uint64_t, uint64_t> TabletKey;
+
+    /// Read and write counts of tablets, as returned by masters.
+    typedef std::map<TabletKey, uint64_t> TabletCounts;
+
+    MasterLoad computeLoad(ServerId serverId,
+                           const ProtoBuf::ServerStatistics& stats,
+                           double seconds,
+                           TabletCounts& counts);
+    Move chooseMove(const vector<MasterLoad>& loads);
+    void executeMove(const Move& move);
+    void main();
+
+    /// Shared RAMCloud information.
+    Context* context;
+
+    /// Used to split tablets.
+    TableManager& tableManager;
+
+    /// Thresholds and rate limits; see the balancer* options there.
+    RuntimeOptions* runtimeOptions;
+
+    /// See CoordinatorService::mutationMutex. Held while splitting tablets.
+    std::mutex& mutationMutex;
+
+    /**
+     * Read and write counts of every tablet of every master as of the
+     * last round, used to turn the next round's counts into rates.
+     */
+    TabletCounts lastCounts;
+
+    /// Cycles::rdtsc() at the start of the last round; 0 before the first.
+    uint64_t lastRoundTicks;
+
+    /// Cycles::rdtsc() when the last move was made; 0 if none has been.
+    uint64_t lastMoveTicks;
+
+    /// Protects #stop.
+    std::mutex mutex;
+
+    /// Set by halt() to tell #thread to exit.
+    bool stop;
+
+    /// Notified by halt() to wake #thread up early.
+    std::condition_variable stopRequested;
+
+    /// Runs main() while the balancer is started.
+    Tub<std::thread> thread;
+
+    DISALLOW_COPY_AND_ASSIGN(TabletBalancer);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_TABLETBALANCER_H
@@ -0,0 +1,237 @@
+/* Copyright (c) 2013 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "MockCluster.h"
+#include "RamCloud.h"
+#include "TabletBalancer.h"
+
+namespace RAMCloud {
+
+class TabletBalancerTest : public ::testing::Test {
+  public:
+    Context context;
+    MockCluster cluster;
+    ServerConfig masterConfig;
+    RuntimeOptions runtimeOptions;
+    std::mutex mutationMutex;
+    Tub<TabletBalancer> balancer;
+
+    typedef TabletBalancer::MasterLoad MasterLoad;
+    typedef TabletBalancer::TabletLoad TabletLoad;
+    typedef TabletBalancer::Move Move;
+
+    TabletBalancerTest()
+        : context()
+        , cluster(&context)
+        , masterConfig(ServerConfig::forTesting())
+        , runtimeOptions()
+        , mutationMutex()
+        , balancer()
+    {
+        Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+
+        masterConfig.services = {WireFormat::MASTER_SERVICE,
+                                 WireFormat::PING_SERVICE,
+                                 WireFormat::MEMBERSHIP_SERVICE};
+        masterConfig.master.numReplicas = 0;
+
+        CoordinatorService* service = cluster.coordinator.get();
+        balancer.construct(service->context, *service->tableManager,
+                           &runtimeOptions, mutationMutex);
+    }
+
+    MasterLoad
+    master(uint32_t id, double ops)
+    {
+        MasterLoad load(ServerId(id, 0));
+        load.opsPerSecond = ops;
+        return load;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(TabletBalancerTest);
+};
+
+TEST_F(TabletBalancerTest, balance) {
+    masterConfig.localLocator = "mock:host=master1";
+    Server* master1 = cluster.addServer(masterConfig);
+    RamCloud ramcloud(&context, "mock:host=coordinator");
+    ramcloud.createTable("hot");
+    uint64_t tableId = ramcloud.getTableId("hot");
+    ramcloud.write(tableId, "0", 1, "abcdef", 6);
+    masterConfig.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(masterConfig);
+    runtimeOptions.set("balancerMinOpsPerSecond", "0");
+
+    // The first round only gathers counts.
+    balancer->balance();
+    EXPECT_EQ(1u, balancer->lastCounts.size());
+    EXPECT_EQ(0u, balancer->lastMoveTicks);
+
+    Buffer value;
+    for (int i = 0; i < 10; i++)
+        ramcloud.read(tableId, "0", 1, &value);
+    balancer->balance();
+    EXPECT_NE(0u, balancer->lastMoveTicks);
+
+    std::mutex mutex;
+    TableManager::Lock lock(mutex);
+    TableManager* tableManager = cluster.coordinator->tableManager;
+    EXPECT_EQ(master1->serverId,
+              tableManager->getTablet(lock, tableId, 0, ~0lu >> 1).serverId);
+    EXPECT_EQ(master2->serverId,
+              tableManager->getTablet(lock, tableId, 1lu << 63, ~0lu).serverId);
+    EXPECT_EQ(1u, master2->master->tabletManager.getCount());
+
+    // No more moves until the cooldown is over.
+    uint64_t lastMoveTicks = balancer->lastMoveTicks;
+    for (int i = 0; i < 10; i++)
+        ramcloud.read(tableId, "0", 1, &value);
+    balancer->balance();
+    EXPECT_EQ(lastMoveTicks, balancer->lastMoveTicks);
+}
+
+TEST_F(TabletBalancerTest, computeLoad) {
+    ProtoBuf::ServerStatistics stats;
+    ProtoBuf::ServerStatistics::TabletEntry* entry = stats.add_tabletentry();
+    entry->set_table_id(1);
+    entry->set_start_key_hash(0);
+    entry->set_end_key_hash(9);
+    entry->set_number_read_and_writes(300);
+    entry = stats.add_tabletentry();
+    entry->set_table_id(2);
+    entry->set_start_key_hash(0);
+    entry->set_end_key_hash(9);
+    entry->set_number_read_and_writes(50);
+    entry = stats.add_tabletentry();
+    entry->set_table_id(3);
+    entry->set_start_key_hash(0);
+    entry->set_end_key_hash(9);
+    entry->set_number_read_and_writes(20);
+
+    ServerId serverId(5, 0);
+    balancer->lastCounts[std::make_tuple(5lu, 1lu, 0lu, 9lu)] = 100;
+    balancer->lastCounts[std::make_tuple(5lu, 3lu, 0lu, 9lu)] = 40;
+    balancer->lastCounts[std::make_tuple(6lu, 2lu, 0lu, 9lu)] = 40;
+    TabletBalancer::TabletCounts counts;
+    MasterLoad load = balancer->computeLoad(serverId, stats, 2, counts);
+
+    EXPECT_EQ(serverId, load.serverId);
+    EXPECT_FALSE(load.migrating);
+    ASSERT_EQ(3u, load.tablets.size());
+    EXPECT_DOUBLE_EQ(100, load.tablets[0].opsPerSecond); // (300 - 100) / 2
+    EXPECT_DOUBLE_EQ(25, load.tablets[1].opsPerSecond);  // new here
+    EXPECT_DOUBLE_EQ(10, load.tablets[2].opsPerSecond);  // count went down
+    EXPECT_DOUBLE_EQ(135, load.opsPerSecond);
+    EXPECT_EQ(3u, counts.size());
+    EXPECT_EQ(300u, (counts[std::make_tuple(5lu, 1lu, 0lu, 9lu)]));
+
+    // First round: no rates yet.
+    stats.add_migration();
+    load = balancer->computeLoad(serverId, stats, 0, counts);
+    EXPECT_TRUE(load.migrating);
+    EXPECT_DOUBLE_EQ(0, load.opsPerSecond);
+}
+
+TEST_F(TabletBalancerTest, chooseMove_balanced) {
+    vector<MasterLoad> loads;
+    loads.push_back(master(1, 40000));
+    EXPECT_FALSE(balancer->chooseMove(loads).from.isValid());
+
+    loads.push_back(master(2, 30000));
+    loads.push_back(master(3, 20000));
+    loads[0].tablets.push_back(TabletLoad(1, 0, ~0lu, 40000));
+    EXPECT_FALSE(balancer->chooseMove(loads).from.isValid());
+}
+
+TEST_F(TabletBalancerTest, chooseMove_thresholds) {
+    vector<MasterLoad> loads;
+    loads.push_back(master(1, 6000));
+    loads.push_back(master(2, 0));
+    loads.push_back(master(3, 3000));
+    loads[0].tablets.push_back(TabletLoad(1, 0, 9, 6000));
+
+    // Too little load overall.
+    EXPECT_FALSE(balancer->chooseMove(loads).from.isValid());
+    runtimeOptions.set("balancerMinOpsPerSecond", "1000");
+    EXPECT_TRUE(balancer->chooseMove(loads).from.isValid());
+
+    // Busiest not far enough above average.
+    runtimeOptions.set("balancerOverloadPercent", "200");
+    EXPECT_FALSE(balancer->chooseMove(loads).from.isValid());
+    runtimeOptions.set("balancerOverloadPercent", "150");
+
+    // Idlest not far enough below average.
+    runtimeOptions.set("balancerUnderloadPercent", "0");
+    EXPECT_FALSE(balancer->chooseMove(loads).from.isValid());
+}
+
+TEST_F(TabletBalancerTest, chooseMove_wholeTablet) {
+    vector<MasterLoad> loads;
+    loads.push_back(master(1, 0));
+    loads.push_back(master(2, 60000));
+    loads.push_back(master(3, 30000));
+    loads[1].tablets.push_back(TabletLoad(1, 0, 9, 10000));
+    loads[1].tablets.push_back(TabletLoad(2, 10, 19, 30000));
+    loads[1].tablets.push_back(TabletLoad(3, 0, 9, 20000));
+
+    Move move = balancer->chooseMove(loads);
+    EXPECT_EQ(2lu, move.tableId);
+    EXPECT_EQ(10lu, move.firstKeyHash);
+    EXPECT_EQ(19lu, move.lastKeyHash);
+    EXPECT_FALSE(move.split);
+    EXPECT_EQ(ServerId(2, 0), move.from);
+    EXPECT_EQ(ServerId(1, 0), move.to);
+}
+
+TEST_F(TabletBalancerTest, chooseMove_split) {
+    vector<MasterLoad> loads;
+    loads.push_back(master(1, 60000));
+    loads.push_back(master(2, 0));
+    loads.push_back(master(3, 30000));
+    loads[0].tablets.push_back(TabletLoad(1, 0, ~0lu, 60000));
+
+    Move move = balancer->chooseMove(loads);
+    EXPECT_EQ(1lu, move.tableId);
+    EXPECT_EQ(1lu << 63, move.firstKeyHash);
+    EXPECT_EQ(~0lu, move.lastKeyHash);
+    EXPECT_TRUE(move.split);
+    EXPECT_EQ(ServerId(1, 0), move.from);
+    EXPECT_EQ(ServerId(2, 0), move.to);
+
+    // A single key hash can't be split.
+    loads[0].tablets[0].startKeyHash = 5;
+    loads[0].tablets[0].endKeyHash = 5;
+    EXPECT_FALSE(balancer->chooseMove(loads).from.isValid());
+}
+
+TEST_F(TabletBalancerTest, chooseMove_migrating) {
+    vector<MasterLoad> loads;
+    loads.push_back(master(1, 60000));
+    loads.push_back(master(2, 0));
+    loads.push_back(master(3, 10000));
+    loads[0].tablets.push_back(TabletLoad(1, 0, 9, 60000));
+    loads[0].migrating = true;
+    loads[2].tablets.push_back(TabletLoad(2, 0, 9, 10000));
+
+    // Master 3 isn't far enough above average to be worth moving from.
+    EXPECT_FALSE(balancer->chooseMove(loads).from.isValid());
+
+    loads[0].migrating = false;
+    loads[1].migrating = true;
+    EXPECT_EQ(ServerId(3, 0), balancer->chooseMove(loads).to);
+}
+
+}  // namespace RAMCloud
@@ -13,15 +13,27 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <thread>
+
 #include "Common.h"
 #include "TabletManager.h"
+#include "ThreadId.h"
 
 namespace RAMCloud {
 
 TabletManager::TabletManager()
     : tabletMap()
     , lock("TabletManager::lock")
+    , index(NULL)
+    , readerGeneration(0)
+    , readerShards()
 {
+    index = new Index(tabletMap.begin(), tabletMap.end());
+}
+
+TabletManager::~TabletManager()
+{
+    delete index.load();
 }
 
 /**
@@ -50,12 +62,11 @@ TabletManager::addTablet(uint64_t tableId,
     Lock guard(lock);
 
     // If an existing tablet overlaps this range at all, fail.
-    if (lookup(tableId, startKeyHash, guard) != tabletMap.end() ||
-      lookup(tableId, endKeyHash, guard) != tabletMap.end()) {
+    if (overlaps(tableId, startKeyHash, endKeyHash, guard))
         return false;
-    }
 
     tabletMap.emplace(tableId, tableId, startKeyHash, endKeyHash, state);
+    publishIndex(guard);
     return true;
 }
 
@@ -84,6 +95,10 @@ TabletManager::getTablet(Key& key, Tablet* outTablet)
  * with them, if one exists. Note that the data returned is a snapshot. The
  * TabletManager's data may be modified at any time by other threads.
  *
+ * This method is on the fast path of every object operation and takes no
+ * lock. As a result, the returned readCount, writeCount, byteCount, and
+ * objectCount are always 0.
+ *
  * \param tableId
  *      The table identifier of the tablet we're looking up.
  * \param keyHash
@@ -98,14 +113,17 @@ TabletManager::getTablet(Key& key, Tablet* outTablet)
 bool
 TabletManager::getTablet(uint64_t tableId, uint64_t keyHash, Tablet* outTablet)
 {
-    Lock guard(lock);
+    ReadGuard guard(this);
 
-    TabletMap::iterator it = lookup(tableId, keyHash, guard);
-    if (it == tabletMap.end())
+    const TabletEntry* entry = guard.index->lookup(tableId, keyHash);
+    if (entry == NULL)
         return false;
 
-    if (outTablet != NULL)
-        *outTablet = it->second;
+    if (outTablet != NULL) {
+        *outTablet = *entry;
+        outTablet->readCount = outTablet->writeCount = 0;
+        outTablet->byteCount = outTablet->objectCount = 0;
+    }
     return true;
 }
 
@@ -140,12 +158,12 @@ TabletManager::getTablet(uint64_t tableId,
     if (it == tabletMap.end())
         return false;
 
-    Tablet* t = &it->second;
+    TabletEntry* t = &it->second;
     if (t->startKeyHash != startKeyHash || t->endKeyHash != endKeyHash)
         return false;
 
     if (outTablet != NULL)
-        *outTablet = *t;
+        copyOut(*t, outTablet);
     return true;
 }
 
@@ -163,7 +181,8 @@ TabletManager::getTablets(vector<Tablet>* outTablets)
 
     TabletMap::iterator it = tabletMap.begin();
     for (size_t i = 0; it != tabletMap.end(); i++) {
-        outTablets->push_back(it->second);
+        outTablets->push_back(Tablet());
+        copyOut(it->second, &outTablets->back());
         ++it;
     }
 }
@@ -197,6 +216,7 @@ TabletManager::deleteTablet(uint64_t tableId,
         return false;
 
     tabletMap.erase(it);
+    publishIndex(guard);
     return true;
 }
 
@@ -227,21 +247,41 @@ TabletManager::splitTablet(uint64_t tableId,
     if (it == tabletMap.end())
         return false;
 
-    Tablet* t = &it->second;
+    TabletEntry* t = &it->second;
 
     // If a split already exists in the master's tablet map, lookup
     // will return the tablet whose startKeyHash matches splitKeyHash.
     // So to make it idempotent, check for this condition before you
     // decide to do the split
     if (splitKeyHash != t->startKeyHash) {
-        tabletMap.emplace(tableId,
+        TabletMap::iterator newIt = tabletMap.emplace(tableId,
                           tableId, splitKeyHash, t->endKeyHash, t->state);
+        uint64_t oldEndKeyHash = t->endKeyHash;
         t->endKeyHash = splitKeyHash - 1;
 
         // It's unclear what to do with the counts when splitting. The old
         // behavior was to simply zero them, so for the time being we'll
         // stick with that. At the very least it's what Christian expects.
-        t->readCount = t->writeCount = 0;
+        t->counters->reset();
+
+        // We don't know where the tablet's objects lie in its key hash range
+        // without scanning the hash table, so split its size in proportion
+        // to the size of each half of the range. Key hashes are uniformly
+        // distributed, so this is a reasonable estimate.
+        uint64_t bytes = t->counters->getByteCount();
+        uint64_t objects = t->counters->getObjectCount();
+        double fraction =
+            (static_cast<double>(t->endKeyHash - t->startKeyHash) + 1) /
+            (static_cast<double>(oldEndKeyHash - t->startKeyHash) + 1);
+        uint64_t lowBytes = static_cast<uint64_t>(
+            static_cast<double>(bytes) * fraction);
+        uint64_t lowObjects = static_cast<uint64_t>(
+            static_cast<double>(objects) * fraction);
+        t->counters->setSize(lowBytes, lowObjects);
+        newIt->second.counters->setSize(bytes - lowBytes,
+                                        objects - lowObjects);
+
+        publishIndex(guard);
     }
 
     return true;
@@ -289,6 +329,7 @@ TabletManager::changeState(uint64_t tableId,
         return false;
 
     t->state = newState;
+    publishIndex(guard);
     return true;
 }
 
@@ -299,10 +340,11 @@ TabletManager::changeState(uint64_t tableId,
 void
 TabletManager::incrementReadCount(Key& key)
 {
-    Lock guard(lock);
-    TabletMap::iterator it = lookup(key.getTableId(), key.getHash(), guard);
-    if (it != tabletMap.end())
-        it->second.readCount++;
+    ReadGuard guard(this);
+    const TabletEntry* entry =
+        guard.index->lookup(key.getTableId(), key.getHash());
+    if (entry != NULL)
+        entry->counters->increment(false);
 }
 
 /**
@@ -312,15 +354,39 @@ TabletManager::incrementReadCount(Key& key)
 void
 TabletManager::incrementWriteCount(Key& key)
 {
-    Lock guard(lock);
-    TabletMap::iterator it = lookup(key.getTableId(), key.getHash(), guard);
-    if (it != tabletMap.end())
-        it->second.writeCount++;
+    ReadGuard guard(this);
+    const TabletEntry* entry =
+        guard.index->lookup(key.getTableId(), key.getHash());
+    if (entry != NULL)
+        entry->counters->increment(true);
+}
+
+/**
+ * Adjust the number of bytes and objects stored in the tablet associated with
+ * the given key. Called by the ObjectManager whenever objects are added to or
+ * removed from the log. Like incrementReadCount(), this takes no lock.
+ *
+ * \param key
+ *      Key of the object that was added or removed.
+ * \param bytes
+ *      Change in the number of bytes stored in the tablet.
+ * \param objects
+ *      Change in the number of objects stored in the tablet.
+ */
+void
+TabletManager::adjustSize(Key& key, int64_t bytes, int64_t objects)
+{
+    ReadGuard guard(this);
+    const TabletEntry* entry =
+        guard.index->lookup(key.getTableId(), key.getHash());
+    if (entry != NULL)
+        entry->counters->adjustSize(bytes, objects);
 }
 
 /**
  * Populate a ServerStatistics protocol buffer with read and write statistics
- * gathered for our tablets.
+ * gathered for our tablets, along with their sizes. This sums the per-thread
+ * counter shards of every tablet.
  */
 void
 TabletManager::getStatistics(ProtoBuf::ServerStatistics* serverStatistics)
@@ -329,15 +395,20 @@ TabletManager::getStatistics(ProtoBuf::ServerStatistics* serverStatistics)
 
     TabletMap::iterator it = tabletMap.begin();
     while (it != tabletMap.end()) {
-        Tablet* t = &it->second;
+        Tablet t;
+        copyOut(it->second, &t);
         ProtoBuf::ServerStatistics_TabletEntry* entry =
             serverStatistics->add_tabletentry();
-        entry->set_table_id(t->tableId);
-        entry->set_start_key_hash(t->startKeyHash);
-        entry->set_end_key_hash(t->endKeyHash);
-        uint64_t totalOperations = t->readCount + t->writeCount;
+        entry->set_table_id(t.tableId);
+        entry->set_start_key_hash(t.startKeyHash);
+        entry->set_end_key_hash(t.endKeyHash);
+        uint64_t totalOperations = t.readCount + t.writeCount;
         if (totalOperations > 0)
             entry->set_number_read_and_writes(totalOperations);
+        if (t.byteCount > 0)
+            entry->set_byte_count(t.byteCount);
+        if (t.objectCount > 0)
+            entry->set_object_count(t.objectCount);
         ++it;
     }
 }
@@ -366,10 +437,11 @@ TabletManager::toString()
     while (it != tabletMap.end()) {
         if (output.length() != 0)
             output += "\n";
-        Tablet* t = &it->second;
+        Tablet t;
+        copyOut(it->second, &t);
         output += format("{ tableId: %lu startKeyHash: %lu endKeyHash: %lu "
-            "state: %d reads: %lu writes: %lu }", t->tableId, t->startKeyHash,
-            t->endKeyHash, t->state, t->readCount, t->writeCount);
+            "state: %d reads: %lu writes: %lu }", t.tableId, t.startKeyHash,
+            t.endKeyHash, t.state, t.readCount, t.writeCount);
         ++it;
     }
 
@@ -410,4 +482,328 @@ TabletManager::lookup(uint64_t tableId, uint64_t keyHash, Lock& lock)
     return tabletMap.end();
 }
 
+/**
+ * Determine whether any existing tablet in the given table shares one or more
+ * key hash values with the given range.
+ *
+ * \param tableId
+ *      Identifier of the table to check.
+ * \param startKeyHash
+ *      The first key hash value in the range to check.
+ * \param endKeyHash
+ *      The last key hash value in the range to check.
+ * \param lock
+ *      This internal method is not thread-safe, so the caller must hold the
+ *      monitor lock while calling. This parameter ensures they don't forget
+ *      to.
+ */
+bool
+TabletManager::overlaps(uint64_t tableId,
+                        uint64_t startKeyHash,
+                        uint64_t endKeyHash,
+                        Lock& lock)
+{
+    std::pair<TabletMap::iterator, TabletMap::iterator> range =
+        tabletMap.equal_range(tableId);
+    for (TabletMap::iterator it = range.first; it != range.second; ++it) {
+        Tablet* t = &it->second;
+        if (startKeyHash <= t->endKeyHash && t->startKeyHash <= endKeyHash)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * Build a new Index from the current contents of the tabletMap and make it
+ * visible to readers. This must be called after every change to the tabletMap
+ * that lock-free readers need to see. The previous Index is freed before
+ * returning, once all readers that may still be using it have finished.
+ *
+ * \param lock
+ *      This internal method is not thread-safe, so the caller must hold the
+ *      monitor lock while calling. This parameter ensures they don't forget
+ *      to.
+ */
+void
+TabletManager::publishIndex(Lock& lock)
+{
+    Index* oldIndex = index.exchange(new Index(tabletMap.begin(),
+                                               tabletMap.end()));
+
+    // Any reader that may have obtained oldIndex registered itself under the
+    // current generation before doing so. Readers arriving from now on will
+    // register under the other generation and can only see the new Index, so
+    // once the current generation drains, nobody can refer to oldIndex.
+    uint32_t generation = readerGeneration.load();
+    readerGeneration.store(generation ^ 1);
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        while (readerShards[i].activeReaders[generation].load() != 0)
+            std::this_thread::yield();
+    }
+
+    delete oldIndex;
+}
+
+/**
+ * Copy the data for a tablet out to a caller, summing its read, write, byte,
+ * and object counts.
+ *
+ * \param entry
+ *      The tablet to copy.
+ * \param[out] outTablet
+ *      Tablet object to fill in.
+ */
+void
+TabletManager::copyOut(const TabletEntry& entry, Tablet* outTablet)
+{
+    *outTablet = entry;
+    outTablet->readCount = entry.counters->getReadCount();
+    outTablet->writeCount = entry.counters->getWriteCount();
+    outTablet->byteCount = entry.counters->getByteCount();
+    outTablet->objectCount = entry.counters->getObjectCount();
+}
+
+/**
+ * Return the shard of the counters and active reader counts that the calling
+ * thread should use.
+ */
+uint32_t
+TabletManager::getShard()
+{
+    return downCast<uint32_t>(ThreadId::get() % NUM_SHARDS);
+}
+
+/******************************************************************************
+ * TabletManager::Counters inner class
+ ******************************************************************************/
+
+TabletManager::Counters::Counters()
+    : shards()
+{
+}
+
+/**
+ * Count a read or write operation on the tablet in the calling thread's shard.
+ *
+ * \param isWrite
+ *      True to count a write, false to count a read.
+ */
+void
+TabletManager::Counters::increment(bool isWrite)
+{
+    Shard* shard = &shards[getShard()];
+    if (isWrite)
+        shard->writeCount.fetch_add(1, std::memory_order_relaxed);
+    else
+        shard->readCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Adjust the tablet's byte and object counts in the calling thread's shard.
+ *
+ * \param bytes
+ *      Change in the number of bytes stored in the tablet.
+ * \param objects
+ *      Change in the number of objects stored in the tablet.
+ */
+void
+TabletManager::Counters::adjustSize(int64_t bytes, int64_t objects)
+{
+    Shard* shard = &shards[getShard()];
+    shard->byteCount.fetch_add(bytes, std::memory_order_relaxed);
+    shard->objectCount.fetch_add(objects, std::memory_order_relaxed);
+}
+
+/**
+ * Zero the read and write counts in all shards. Sizes are unaffected.
+ */
+void
+TabletManager::Counters::reset()
+{
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        shards[i].readCount = 0;
+        shards[i].writeCount = 0;
+    }
+}
+
+/**
+ * Replace the tablet's byte and object counts. Used when splitting a tablet.
+ * This must not race with adjustSize() calls on other threads, or some of
+ * their adjustments may be lost; since sizes are only estimates, this is
+ * tolerated.
+ *
+ * \param bytes
+ *      New number of bytes stored in the tablet.
+ * \param objects
+ *      New number of objects stored in the tablet.
+ */
+void
+TabletManager::Counters::setSize(uint64_t bytes, uint64_t objects)
+{
+    for (uint32_t i = 0; i < NUM_SHARDS; i++) {
+        shards[i].byteCount = 0;
+        shards[i].objectCount = 0;
+    }
+    shards[0].byteCount = static_cast<int64_t>(bytes);
+    shards[0].objectCount = static_cast<int64_t>(objects);
+}
+
+/**
+ * Return the total number of reads counted across all shards.
+ */
+uint64_t
+TabletManager::Counters::getReadCount()
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < NUM_SHARDS; i++)
+        total += shards[i].readCount.load(std::memory_order_relaxed);
+    return total;
+}
+
+/**
+ * Return the total number of writes counted across all shards.
+ */
+uint64_t
+TabletManager::Counters::getWriteCount()
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < NUM_SHARDS; i++)
+        total += shards[i].writeCount.load(std::memory_order_relaxed);
+    return total;
+}
+
+/**
+ * Return the total number of bytes stored in the tablet, summed across all
+ * shards. Never negative, even if a concurrent update makes the sum of the
+ * shards briefly so.
+ */
+uint64_t
+TabletManager::Counters::getByteCount()
+{
+    int64_t total = 0;
+    for (uint32_t i = 0; i < NUM_SHARDS; i++)
+        total += shards[i].byteCount.load(std::memory_order_relaxed);
+    return total < 0 ? 0 : total;
+}
+
+/**
+ * Return the total number of objects stored in the tablet, summed across all
+ * shards. Never negative (see getByteCount()).
+ */
+uint64_t
+TabletManager::Counters::getObjectCount()
+{
+    int64_t total = 0;
+    for (uint32_t i = 0; i < NUM_SHARDS; i++)
+        total += shards[i].objectCount.load(std::memory_order_relaxed);
+    return total < 0 ? 0 : total;
+}
+
+/******************************************************************************
+ * TabletManager::Index inner class
+ ******************************************************************************/
+
+namespace {
+
+/**
+ * Orders tablets by table identifier and then by the first key hash value
+ * they own. Used to sort and search TabletManager::Index.
+ */
+struct IndexOrder {
+    bool
+    operator()(const TabletManager::Tablet& a,
+               const TabletManager::Tablet& b) const
+    {
+        if (a.tableId != b.tableId)
+            return a.tableId < b.tableId;
+        return a.startKeyHash < b.startKeyHash;
+    }
+};
+
+} // anonymous namespace
+
+/**
+ * Construct an Index containing copies of a range of TabletMap entries.
+ *
+ * \param begin
+ *      Iterator referring to the first TabletMap entry to include.
+ * \param end
+ *      Iterator referring to one past the last TabletMap entry to include.
+ */
+template<typename Iterator>
+TabletManager::Index::Index(Iterator begin, Iterator end)
+    : tablets()
+{
+    for (Iterator it = begin; it != end; ++it)
+        tablets.push_back(it->second);
+    std::sort(tablets.begin(), tablets.end(), IndexOrder());
+}
+
+/**
+ * Find the tablet containing a particular key hash value, if one exists.
+ *
+ * \param tableId
+ *      Identifier of the table to look up.
+ * \param keyHash
+ *      Key hash value corresponding to the desired tablet.
+ * \return
+ *      A pointer to the matching tablet (valid for the lifetime of this Index),
+ *      or NULL if no tablet contains the given key hash.
+ */
+const TabletManager::TabletEntry*
+TabletManager::Index::lookup(uint64_t tableId, uint64_t keyHash) const
+{
+    // Find the last tablet starting at or before keyHash. Tablets in the same
+    // table never overlap, so it's the only one that could contain keyHash.
+    Tablet probe(tableId, keyHash, keyHash, NORMAL);
+    vector<TabletEntry>::const_iterator it =
+        std::upper_bound(tablets.begin(), tablets.end(), probe, IndexOrder());
+    if (it == tablets.begin())
+        return NULL;
+    --it;
+
+    if (it->tableId != tableId || keyHash > it->endKeyHash)
+        return NULL;
+    return &*it;
+}
+
+/******************************************************************************
+ * TabletManager::ReadGuard inner class
+ ******************************************************************************/
+
+/**
+ * Register the calling thread as a reader of the TabletManager's current
+ * Index.
+ *
+ * \param tabletManager
+ *      The TabletManager whose Index will be read.
+ */
+TabletManager::ReadGuard::ReadGuard(TabletManager* tabletManager)
+    : index(NULL)
+    , shard(&tabletManager->readerShards[getShard()])
+    , generation(0)
+{
+    // If a writer flips the generation between our reading it and registering
+    // ourselves, it may not wait for us. Back out and try again in that case.
+    while (1) {
+        generation = tabletManager->readerGeneration.load();
+        shard->activeReaders[generation].fetch_add(1);
+        if (tabletManager->readerGeneration.load() == generation)
+            break;
+        shard->activeReaders[generation].fetch_sub(1);
+    }
+
+    index = tabletManager->index.load();
+}
+
+/**
+ * Unregister the calling thread, allowing any Index it may have been using
+ * to be freed.
+ */
+TabletManager::ReadGuard::~ReadGuard()
+{
+    shard->activeReaders[generation].fetch_sub(1);
+}
+
 } // namespace
@@ -16,6 +16,8 @@
 #ifndef RAMCLOUD_TABLETMANAGER_H
 #define RAMCLOUD_TABLETMANAGER_H
 
+#include <atomic>
+#include <memory>
 #include <boost/unordered_map.hpp>
 
 #include "Common.h"
@@ -35,13 +37,25 @@ namespace RAMCloud {
  * may exist in the hash table temporarily for tablets that are not yet owned.
  * This happens, for instance, during crash recovery and tablet migration.
  *
- * This class is thread-safe (a monitor lock is used to support concurrent
- * access). When looking up tablets (see the getTablet() methods) a snapshot of
- * the current tablet's data is returned to the caller. This copying avoids the
- * need for atomic operations or other synchronization each time a field is
- * read. The downside, of course, is that the caller needs to be aware that the
- * actual state may be permuted at any time and will not be reflected in the
- * cached copy obtained during the lookup.
+ * This class is thread-safe. When looking up tablets (see the getTablet()
+ * methods) a snapshot of the current tablet's data is returned to the caller.
+ * This copying avoids the need for atomic operations or other synchronization
+ * each time a field is read. The downside, of course, is that the caller needs
+ * to be aware that the actual state may be permuted at any time and will not
+ * be reflected in the cached copy obtained during the lookup.
+ *
+ * Tablets are looked up on every object read and write, but are modified
+ * only rarely (when tablets are assigned, split, recovered, or dropped). The
+ * class is therefore optimized for readers. Modifications are serialized by a
+ * monitor lock and, once applied, are published as an immutable, sorted Index
+ * of all tablets. Lookups by key hash binary search the current Index without
+ * taking any lock; an old Index is only freed once every reader that might be
+ * using it has finished (see ReadGuard). Per-tablet read and write counts are
+ * likewise split across per-thread shards (see Counters) so that the fast path
+ * never contends on a shared cache line, and are summed only when requested.
+ * The same shards also track the approximate number of bytes and objects live
+ * in each tablet, which the master reports to the coordinator so that crash
+ * recovery can partition its tablets by size (see Recovery).
  */
 class TabletManager {
   PUBLIC:
@@ -78,6 +92,8 @@ class TabletManager {
             , state(RECOVERING)
             , readCount(-1)
             , writeCount(-1)
+            , byteCount(-1)
+            , objectCount(-1)
         {
         }
 
@@ -91,6 +107,8 @@ class TabletManager {
             , state(state)
             , readCount(0)
             , writeCount(0)
+            , byteCount(0)
+            , objectCount(0)
         {
         }
 
@@ -107,13 +125,35 @@ class TabletManager {
         TabletState state;
 
         /// The number of read operations performed on objects in this tablet.
+        /// This is summed across all counter shards, which is comparatively
+        /// expensive, so lookups by key hash (the getTablet() methods used on
+        /// the read/write fast path) always return 0 here.
         uint64_t readCount;
 
         /// The number of write operations performed on objects in this tablet.
+        /// See readCount for when this is computed.
         uint64_t writeCount;
+
+        /// The number of bytes of live object data (including log entry
+        /// headers and keys) currently stored in this tablet. This is an
+        /// estimate: it is split proportionally when the tablet is split.
+        /// See readCount for when this is computed.
+        uint64_t byteCount;
+
+        /// The number of live objects currently stored in this tablet. Like
+        /// byteCount, this is an estimate. See readCount for when this is
+        /// computed.
+        uint64_t objectCount;
     };
 
+    /// Number of independent shards the per-tablet read and write counters,
+    /// as well as the active reader counts, are split into. Threads choose a
+    /// shard based on their ThreadId, so threads only contend with one another
+    /// if more than this many are accessing the TabletManager concurrently.
+    enum { NUM_SHARDS = 16 };
+
     TabletManager();
+    ~TabletManager();
     bool addTablet(uint64_t tableId,
                    uint64_t startKeyHash,
                    uint64_t endKeyHash,
@@ -140,31 +180,172 @@ class TabletManager {
                      TabletState newState);
     void incrementReadCount(Key& key);
     void incrementWriteCount(Key& key);
+    void adjustSize(Key& key, int64_t bytes, int64_t objects);
     void getStatistics(ProtoBuf::ServerStatistics* serverStatistics);
     size_t getCount();
     string toString();
 
   PRIVATE:
+    /**
+     * Read and write counts, as well as byte and object counts, for a single
+     * tablet. Each thread updates the counters in its own shard (chosen by
+     * ThreadId), so concurrent workers do not bounce a single cache line
+     * between cores. The shards are only summed when the counts are needed
+     * (see getStatistics()).
+     */
+    class Counters {
+      public:
+        Counters();
+        void increment(bool isWrite);
+        void adjustSize(int64_t bytes, int64_t objects);
+        void reset();
+        void setSize(uint64_t bytes, uint64_t objects);
+        uint64_t getReadCount();
+        uint64_t getWriteCount();
+        uint64_t getByteCount();
+        uint64_t getObjectCount();
+
+      PRIVATE:
+        /// Counters updated by the threads mapping to a particular shard.
+        /// Padded to a cache line to avoid false sharing between shards.
+        /// Sizes are signed, since an object may be added by a thread in one
+        /// shard and removed by a thread in another; only the sum across all
+        /// shards is meaningful.
+        struct Shard {
+            std::atomic<uint64_t> readCount;
+            std::atomic<uint64_t> writeCount;
+            std::atomic<int64_t> byteCount;
+            std::atomic<int64_t> objectCount;
+            char pad[CACHE_LINE_SIZE - 4 * sizeof(std::atomic<uint64_t>)];
+        };
+        Shard shards[NUM_SHARDS];
+
+        DISALLOW_COPY_AND_ASSIGN(Counters);
+    };
+
+    /**
+     * The canonical record for each tablet kept in the TabletMap. It extends
+     * the Tablet data that is copied out to callers with the tablet's
+     * Counters, which are shared with any Index that refers to the tablet.
+     */
+    class TabletEntry : public Tablet {
+      public:
+        TabletEntry(uint64_t tableId,
+                    uint64_t startKeyHash,
+                    uint64_t endKeyHash,
+                    TabletState state)
+            : Tablet(tableId, startKeyHash, endKeyHash, state)
+            , counters(new Counters())
+        {
+        }
+
+        /// Read and write counts for this tablet. These are kept outside of
+        /// the entry so that the Index can continue to refer to them after the
+        /// entry has been erased from the TabletMap.
+        std::shared_ptr<Counters> counters;
+    };
+
+    /**
+     * Immutable snapshot of all tablets, sorted by table identifier and then
+     * by startKeyHash so that the tablet containing a particular key hash can
+     * be found with a binary search over a flat array. A new Index is built
+     * by each operation that modifies tablets and replaces the previous one.
+     * Readers access the current Index without any locking (see ReadGuard).
+     */
+    class Index {
+      public:
+        template<typename Iterator>
+        Index(Iterator begin, Iterator end);
+        const TabletEntry* lookup(uint64_t tableId, uint64_t keyHash) const;
+
+      PRIVATE:
+        /// Copies of the TabletEntries at the time this Index was created,
+        /// sorted as described above.
+        vector<TabletEntry> tablets;
+
+        DISALLOW_COPY_AND_ASSIGN(Index);
+    };
+
+    /**
+     * Counts of the readers currently accessing an Index on threads that map
+     * to a particular shard. Each shard has a counter for both of the current
+     * and previous reader generations (see #readerGeneration). Padded to a
+     * cache line to avoid false sharing between shards.
+     */
+    struct ReaderShard {
+        std::atomic<uint32_t> activeReaders[2];
+        char pad[CACHE_LINE_SIZE - 2 * sizeof(std::atomic<uint32_t>)];
+    };
+
+    /**
+     * Registers the current thread as a reader of the TabletManager's current
+     * Index for as long as the guard exists. While any guard exists that
+     * could have obtained a particular Index, that Index will not be freed.
+     * Constructing a guard costs an atomic increment of a counter that is
+     * only shared with other threads in the same shard; no lock is taken.
+     */
+    class ReadGuard {
+      public:
+        explicit ReadGuard(TabletManager* tabletManager);
+        ~ReadGuard();
+
+        /// The Index that was current when this guard was created. It will
+        /// remain valid until the guard is destroyed.
+        const Index* index;
+
+      PRIVATE:
+        /// Shard the current thread registered itself with.
+        ReaderShard* shard;
+
+        /// Reader generation the current thread registered itself in.
+        uint32_t generation;
+
+        DISALLOW_COPY_AND_ASSIGN(ReadGuard);
+    };
+
     /// Tablets are stored in a multimap that is indexed by table identifier.
     /// The assumption is that we are likely to have many tablets, but
     /// relatively few for the same table.
     ///
     /// We use the boost version, rather than std::'s, because gcc 4.4.4's
     /// libstdc++ does not implement the emplace() method.
-    typedef boost::unordered_multimap<uint64_t, Tablet> TabletMap;
+    typedef boost::unordered_multimap<uint64_t, TabletEntry> TabletMap;
 
     /// Lock guard type used to hold the monitor spinlock and automatically
     /// release it.
     typedef std::lock_guard<SpinLock> Lock;
 
     TabletMap::iterator lookup(uint64_t tableId, uint64_t keyHash, Lock& lock);
+    bool overlaps(uint64_t tableId,
+                  uint64_t startKeyHash,
+                  uint64_t endKeyHash,
+                  Lock& lock);
+    void publishIndex(Lock& lock);
+    static void copyOut(const TabletEntry& entry, Tablet* outTablet);
+    static uint32_t getShard();
 
-    /// This unordered_multimap is used to store and access all tablet data.
+    /// This unordered_multimap is the canonical copy of all tablet data. It is
+    /// only accessed with the monitor lock held. Lock-free lookups use #index
+    /// instead.
     TabletMap tabletMap;
 
-    /// Monitor spinlock used to protect the tabletMap from concurrent access.
+    /// Monitor spinlock used to protect the tabletMap from concurrent access
+    /// and to serialize modifications to tablets.
     SpinLock lock;
 
+    /// The Index reflecting the current contents of #tabletMap. Replaced (but
+    /// never modified) by publishIndex() whenever tablets change.
+    std::atomic<Index*> index;
+
+    /// Readers register themselves under the current generation (0 or 1).
+    /// Each time a new Index is published, the generation is flipped and the
+    /// writer waits for all readers under the old generation to leave before
+    /// freeing the previous Index.
+    std::atomic<uint32_t> readerGeneration;
+
+    /// Active reader counts, one per shard (see ReadGuard).
+    ReaderShard readerShards[NUM_SHARDS];
+
     DISALLOW_COPY_AND_ASSIGN(TabletManager);
 };
 
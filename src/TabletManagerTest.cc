@@ -40,6 +40,9 @@ TEST_F(TabletManagerTest, addTablet) {
     EXPECT_FALSE(tm.addTablet(0, 0, 10, TabletManager::NORMAL));
     EXPECT_FALSE(tm.addTablet(0, 20, 30, TabletManager::NORMAL));
     EXPECT_FALSE(tm.addTablet(0, 0, 15, TabletManager::NORMAL));
+    EXPECT_FALSE(tm.addTablet(0, 0, 30, TabletManager::NORMAL));
+    EXPECT_FALSE(tm.addTablet(0, 12, 18, TabletManager::NORMAL));
+    EXPECT_TRUE(tm.addTablet(1, 0, 30, TabletManager::NORMAL));
 
     SpinLock lock;
     TabletManager::Lock fakeGuard(lock);
@@ -81,6 +84,30 @@ TEST_F(TabletManagerTest, getTablet_byHashPoint) {
     EXPECT_EQ(TabletManager::RECOVERING, tablet.state);
 }
 
+TEST_F(TabletManagerTest, getTablet_byHashPoint_manyTablets) {
+    tm.addTablet(5, 20, 29, TabletManager::NORMAL);
+    tm.addTablet(5, 0, 9, TabletManager::NORMAL);
+    tm.addTablet(6, 10, 19, TabletManager::NORMAL);
+    tm.addTablet(4, 10, 19, TabletManager::NORMAL);
+
+    TabletManager::Tablet tablet;
+    EXPECT_TRUE(tm.getTablet(5, 5, &tablet));
+    EXPECT_EQ(0U, tablet.startKeyHash);
+    EXPECT_FALSE(tm.getTablet(5, 15));
+    EXPECT_TRUE(tm.getTablet(5, 29, &tablet));
+    EXPECT_EQ(20U, tablet.startKeyHash);
+    EXPECT_FALSE(tm.getTablet(5, 30));
+    EXPECT_TRUE(tm.getTablet(6, 15, &tablet));
+    EXPECT_EQ(6U, tablet.tableId);
+    EXPECT_TRUE(tm.getTablet(4, 10, &tablet));
+    EXPECT_EQ(4U, tablet.tableId);
+    EXPECT_FALSE(tm.getTablet(3, 15));
+    EXPECT_FALSE(tm.getTablet(7, 15));
+
+    tm.deleteTablet(5, 0, 9);
+    EXPECT_FALSE(tm.getTablet(5, 5));
+}
+
 TEST_F(TabletManagerTest, getTablet_byHashRange) {
     EXPECT_FALSE(tm.getTablet(5, 9, 11));
     tm.addTablet(5, 9, 11, TabletManager::RECOVERING);
@@ -156,6 +183,22 @@ TEST_F(TabletManagerTest, splitTablet) {
     EXPECT_EQ(TabletManager::NORMAL, tablet.state);
 }
 
+TEST_F(TabletManagerTest, splitTablet_size) {
+    EXPECT_TRUE(tm.addTablet(0, 0, ~0UL, TabletManager::NORMAL));
+    Key key(0, "1", 1);
+    tm.adjustSize(key, 1000, 10);
+
+    // Sizes are divided in proportion to the key hash ranges.
+    EXPECT_TRUE(tm.splitTablet(0, 1UL << 62));
+    TabletManager::Tablet tablet;
+    EXPECT_TRUE(tm.getTablet(0, 0, (1UL << 62) - 1, &tablet));
+    EXPECT_EQ(250U, tablet.byteCount);
+    EXPECT_EQ(2U, tablet.objectCount);
+    EXPECT_TRUE(tm.getTablet(0, 1UL << 62, ~0UL, &tablet));
+    EXPECT_EQ(750U, tablet.byteCount);
+    EXPECT_EQ(8U, tablet.objectCount);
+}
+
 TEST_F(TabletManagerTest, changeState) {
     EXPECT_TRUE(tm.addTablet(0, 10, 20, TabletManager::RECOVERING));
 
@@ -212,6 +255,80 @@ TEST_F(TabletManagerTest, getStatistics) {
             "end_key_hash: 18446744073709551615 number_read_and_writes: 2 }",
             stats.ShortDebugString());
     }
+
+    tm.adjustSize(key, 100, 1);
+
+    {
+        ProtoBuf::ServerStatistics stats;
+        tm.getStatistics(&stats);
+        EXPECT_EQ("tabletentry { table_id: 58 start_key_hash: 0 "
+            "end_key_hash: 18446744073709551615 number_read_and_writes: 2 "
+            "byte_count: 100 object_count: 1 }",
+            stats.ShortDebugString());
+    }
+}
+
+TEST_F(TabletManagerTest, adjustSize) {
+    tm.addTablet(58, 0, ~0UL, TabletManager::NORMAL);
+    Key key(58, "1", 1);
+    Key otherKey(59, "1", 1);
+
+    tm.adjustSize(key, 100, 1);
+    tm.adjustSize(key, 50, 1);
+    tm.adjustSize(otherKey, 1000, 1);
+    TabletManager::Tablet tablet;
+    EXPECT_TRUE(tm.getTablet(58, 0, ~0UL, &tablet));
+    EXPECT_EQ(150U, tablet.byteCount);
+    EXPECT_EQ(2U, tablet.objectCount);
+
+    // Lookups on the fast path don't sum the counters.
+    EXPECT_TRUE(tm.getTablet(key, &tablet));
+    EXPECT_EQ(0U, tablet.byteCount);
+
+    tm.adjustSize(key, -150, -2);
+    EXPECT_TRUE(tm.getTablet(58, 0, ~0UL, &tablet));
+    EXPECT_EQ(0U, tablet.byteCount);
+    EXPECT_EQ(0U, tablet.objectCount);
+
+    // Sizes never appear negative.
+    tm.adjustSize(key, -1, -1);
+    EXPECT_TRUE(tm.getTablet(58, 0, ~0UL, &tablet));
+    EXPECT_EQ(0U, tablet.byteCount);
+    EXPECT_EQ(0U, tablet.objectCount);
+}
+
+static void
+incrementCounts(TabletManager* tm, Key* key)
+{
+    for (int i = 0; i < 1000; i++) {
+        tm->incrementReadCount(*key);
+        tm->incrementWriteCount(*key);
+    }
+}
+
+TEST_F(TabletManagerTest, incrementCounts_multipleThreads) {
+    tm.addTablet(58, 0, ~0UL, TabletManager::NORMAL);
+    Key key(58, "1", 1);
+
+    std::thread thread1(incrementCounts, &tm, &key);
+    std::thread thread2(incrementCounts, &tm, &key);
+    incrementCounts(&tm, &key);
+    thread1.join();
+    thread2.join();
+
+    TabletManager::Tablet tablet;
+    EXPECT_TRUE(tm.getTablet(58, 0, ~0UL, &tablet));
+    EXPECT_EQ(3000U, tablet.readCount);
+    EXPECT_EQ(3000U, tablet.writeCount);
+
+    // Lookups on the fast path don't sum the counters.
+    EXPECT_TRUE(tm.getTablet(key, &tablet));
+    EXPECT_EQ(0U, tablet.readCount);
+
+    tm.splitTablet(58, 100);
+    EXPECT_TRUE(tm.getTablet(58, 0, 99, &tablet));
+    EXPECT_EQ(0U, tablet.readCount);
+    EXPECT_EQ(0U, tablet.writeCount);
 }
 
 TEST_F(TabletManagerTest, getCount) {
@@ -253,4 +370,40 @@ TEST_F(TabletManagerTest, lookup) {
     EXPECT_FALSE(tm.tabletMap.end() == tm.lookup(0, 101, fakeGuard));
 }
 
+TEST_F(TabletManagerTest, publishIndex) {
+    const TabletManager::Index* before = tm.index.load();
+    EXPECT_TRUE(before->lookup(0, 10) == NULL);
+    EXPECT_EQ(0U, tm.readerGeneration.load());
+
+    EXPECT_TRUE(tm.addTablet(0, 0, 20, TabletManager::NORMAL));
+    EXPECT_NE(before, tm.index.load());
+    EXPECT_EQ(1U, tm.readerGeneration.load());
+    EXPECT_TRUE(tm.index.load()->lookup(0, 10) != NULL);
+
+    // Failed operations leave the index alone.
+    const TabletManager::Index* after = tm.index.load();
+    EXPECT_FALSE(tm.addTablet(0, 0, 20, TabletManager::NORMAL));
+    EXPECT_EQ(after, tm.index.load());
+    EXPECT_EQ(1U, tm.readerGeneration.load());
+}
+
+TEST_F(TabletManagerTest, readGuard) {
+    uint32_t shard = TabletManager::getShard();
+    {
+        TabletManager::ReadGuard guard(&tm);
+        EXPECT_EQ(tm.index, guard.index);
+        EXPECT_EQ(1U, tm.readerShards[shard].activeReaders[0]);
+        EXPECT_EQ(0U, tm.readerShards[shard].activeReaders[1]);
+    }
+    EXPECT_EQ(0U, tm.readerShards[shard].activeReaders[0]);
+
+    tm.addTablet(0, 0, 20, TabletManager::NORMAL);
+    {
+        TabletManager::ReadGuard guard(&tm);
+        EXPECT_EQ(0U, tm.readerShards[shard].activeReaders[0]);
+        EXPECT_EQ(1U, tm.readerShards[shard].activeReaders[1]);
+    }
+    EXPECT_EQ(0U, tm.readerShards[shard].activeReaders[1]);
+}
+
 }  // namespace RAMCloud
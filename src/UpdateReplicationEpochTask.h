@@ -34,6 +34,12 @@ namespace RAMCloud {
  * Logically part of ReplicaManager. Used as part of backup recovery
  * to prevent replicas which the master lost contact with from being
  * detected as the head of the log during a recovery.
+ *
+ * The same coordinator rpc also carries the approximate sizes of the master's
+ * tablets (see updateTabletStats()), which the coordinator uses to partition
+ * them if the master crashes. Every update sends both the latest replication
+ * epoch and the latest tablet sizes, since the coordinator replaces its copy
+ * of the master's recovery info wholesale.
  */
 class UpdateReplicationEpochTask : public Task {
   PUBLIC:
@@ -61,6 +67,8 @@ class UpdateReplicationEpochTask : public Task {
         , current()
         , sent()
         , requested()
+        , tabletStats()
+        , tabletStatsChanged(false)
         , rpc()
     {}
 
@@ -98,6 +106,22 @@ class UpdateReplicationEpochTask : public Task {
         schedule();
     }
 
+    /**
+     * Replace the tablet sizes stored on the coordinator with those in
+     * \a stats. The update is sent asynchronously (along with the current
+     * replication epoch) the next time the #taskQueue makes progress; if
+     * called again before then, only the latest sizes are sent.
+     *
+     * \param stats
+     *      Only the tablet_stats field is used; the replication epoch fields
+     *      are ignored.
+     */
+    void updateTabletStats(const ProtoBuf::MasterRecoveryInfo& stats) {
+        tabletStats.mutable_tablet_stats()->CopyFrom(stats.tablet_stats());
+        tabletStatsChanged = true;
+        schedule();
+    }
+
     /**
      * Called by #taskQueue when it makes progress if this Task is scheduled.
      * That is, whenever a rpc needs to be sent or there is an outstanding rpc
@@ -111,16 +135,18 @@ class UpdateReplicationEpochTask : public Task {
         // present, then just skip the call.
         if (context->coordinatorSession->getLocation().empty()) {
             current = requested;
+            tabletStatsChanged = false;
             return;
         }
 #endif
         if (!rpc) {
-            if (current != requested) {
-                ProtoBuf::MasterRecoveryInfo recoveryInfo;
+            if (current != requested || tabletStatsChanged) {
+                ProtoBuf::MasterRecoveryInfo recoveryInfo(tabletStats);
                 recoveryInfo.set_min_open_segment_id(requested.first);
                 recoveryInfo.set_min_open_segment_epoch(requested.second);
                 rpc.construct(context, *serverId, recoveryInfo);
                 sent = requested;
+                tabletStatsChanged = false;
             }
         } else {
             if (rpc->isReady()) {
@@ -132,7 +158,7 @@ class UpdateReplicationEpochTask : public Task {
                 rpc.destroy();
             }
         }
-        if (current != requested)
+        if (current != requested || tabletStatsChanged || rpc)
             schedule();
     }
 
@@ -173,6 +199,18 @@ class UpdateReplicationEpochTask : public Task {
      */
     ReplicationEpoch requested;
 
+    /**
+     * The latest tablet sizes given to updateTabletStats(). Only the
+     * tablet_stats field is used.
+     */
+    ProtoBuf::MasterRecoveryInfo tabletStats;
+
+    /**
+     * True if #tabletStats has changed since it was last sent to the
+     * coordinator.
+     */
+    bool tabletStatsChanged;
+
     /**
      * Holds an ongoing rpc to the coordinator to update the replication epoch
      * for this #serverId, if any rpc is outstanding.
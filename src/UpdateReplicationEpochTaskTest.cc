@@ -108,4 +108,35 @@ TEST_F(UpdateReplicationEpochTaskTest, updateToAtLeast) {
     EXPECT_FALSE(epoch->isScheduled());
 }
 
+TEST_F(UpdateReplicationEpochTaskTest, updateTabletStats) {
+    epoch->updateToAtLeast(1, 2);
+    taskQueue.performTask(); // send rpc
+    taskQueue.performTask(); // reap rpc
+    EXPECT_FALSE(epoch->isScheduled());
+
+    ProtoBuf::MasterRecoveryInfo stats;
+    ProtoBuf::MasterRecoveryInfo::TabletStats& tablet =
+        *stats.add_tablet_stats();
+    tablet.set_table_id(3);
+    tablet.set_start_key_hash(0);
+    tablet.set_end_key_hash(10);
+    tablet.set_byte_count(1000);
+    tablet.set_object_count(10);
+    epoch->updateTabletStats(stats);
+    EXPECT_TRUE(epoch->isScheduled());
+    taskQueue.performTask(); // send rpc
+    EXPECT_TRUE(epoch->rpc);
+    EXPECT_TRUE(epoch->isScheduled());
+
+    // The epoch is sent along with the stats.
+    auto coordRecoveryInfo = &(*serverList)[serverId].masterRecoveryInfo;
+    EXPECT_EQ("min_open_segment_id: 1 min_open_segment_epoch: 2 "
+              "tablet_stats { table_id: 3 start_key_hash: 0 end_key_hash: 10 "
+              "byte_count: 1000 object_count: 10 }",
+              coordRecoveryInfo->ShortDebugString());
+    taskQueue.performTask(); // reap rpc
+    EXPECT_FALSE(epoch->rpc);
+    EXPECT_FALSE(epoch->isScheduled());
+}
+
 }  // namespace RAMCloud
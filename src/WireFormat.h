@@ -109,7 +109,8 @@ enum Opcode {
     GET_SERVER_CONFIG         = 52,
     GET_LOG_METRICS           = 53,
     VERIFY_MEMBERSHIP         = 55,
-    ILLEGAL_RPC_TYPE          = 56,  // 1 + the highest legitimate Opcode
+    SCAN                      = 56,
+    ILLEGAL_RPC_TYPE          = 57,  // 1 + the highest legitimate Opcode
 };
 
 /**
@@ -495,6 +496,36 @@ struct Enumerate {
     } __attribute__((packed));
 };
 
+struct Scan {
+    static const Opcode opcode = SCAN;
+    static const ServiceType service = MASTER_SERVICE;
+    struct Request {
+        RequestCommon common;
+        uint64_t tableId;
+        uint64_t tabletFirstHash;
+        uint16_t startKeyLength;    // Length of the smallest key to return.
+                                    // The key follows immediately after
+                                    // this header.
+        uint16_t endKeyLength;      // Length of the key at which the scan
+                                    // stops (exclusive); it follows the
+                                    // start key. 0 means no upper bound.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint64_t tabletFirstHash;   // Tablet from which to continue the
+                                    // scan; see Enumerate.
+        uint32_t payloadBytes;      // Size of payload, in the same format
+                                    // as for Enumerate, with objects in
+                                    // increasing key order. The payload
+                                    // follows immediately after this
+                                    // header.
+        uint16_t nextKeyLength;     // Length of the key from which to
+                                    // continue scanning this tablet; it
+                                    // follows the payload. 0 if the
+                                    // tablet has been scanned completely.
+    } __attribute__((packed));
+};
+
 struct FillWithTestData {
     static const Opcode opcode = FILL_WITH_TEST_DATA;
     static const ServiceType service = MASTER_SERVICE;
@@ -618,14 +649,36 @@ struct GetTableId {
 struct GetTabletMap {
     static const Opcode opcode = GET_TABLET_MAP;
     static const ServiceType service = COORDINATOR_SERVICE;
+    /// Value for tableId that asks for the tablets of every table.
+    static const uint64_t ALL_TABLES = ~0UL;
     struct Request {
         RequestCommon common;
+        uint64_t generation;       // Generation of the caller's copy of the
+                                   // tablet map, or 0 if it has none.
+        uint64_t sinceVersion;     // Version of the caller's copy of the
+                                   // tablet map, or 0 if it has none. Only
+                                   // tables changed after this version are
+                                   // returned.
+        uint64_t tableId;          // If not ALL_TABLES, return just the
+                                   // tablets of this table (generation and
+                                   // sinceVersion are ignored).
     } __attribute__((packed));
     struct Response {
         ResponseCommon common;
+        uint64_t generation;       // Generation of the coordinator's map;
+                                   // versions are only comparable within
+                                   // a generation.
+        uint64_t version;          // Version of the tablet map this response
+                                   // brings the caller up to.
+        uint8_t fullMap;           // If nonzero, the tablets returned are
+                                   // the entire tablet map. Otherwise they
+                                   // replace just the tablets of the tables
+                                   // listed.
+        uint32_t numChangedTables; // Number of uint64_t table ids that
+                                   // follow immediately after this header.
         uint32_t tabletMapLength;  // Number of bytes in the tablet map.
                                    // The bytes of the tablet map follow
-                                   // immediately after this header. See
+                                   // the changed table ids. See
                                    // ProtoBuf::Tablets.
     } __attribute__((packed));
 };